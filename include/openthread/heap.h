@@ -36,6 +36,9 @@
 #define OPENTHREAD_HEAP_H_
 
 #include <stddef.h>
+#include <stdint.h>
+
+#include <openthread/error.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -64,6 +67,33 @@ void *otHeapCAlloc(size_t aCount, size_t aSize);
  */
 void otHeapFree(void *aPointer);
 
+/**
+ * Represents the occupancy and fragmentation statistics of the OpenThread internal heap.
+ *
+ * Small allocations may be served from slabs, i.e., heap blocks divided into equal size chunks. A slab occupies its
+ * whole block in the block heap, so free chunks in a slab are not counted in `mFreeSize`.
+ */
+typedef struct otHeapStats
+{
+    uint16_t mCapacity;             ///< The capacity of the heap (in bytes).
+    uint16_t mFreeSize;             ///< The free space in the block heap (in bytes).
+    uint16_t mLargestFreeBlockSize; ///< The size of the largest free block (in bytes).
+    uint16_t mNumFreeBlocks;        ///< The number of free blocks. More free blocks indicate a more fragmented heap.
+    uint16_t mNumSlabs;             ///< The number of slabs.
+    uint16_t mNumSlabChunks;        ///< The total number of chunks in all slabs.
+    uint16_t mNumFreeSlabChunks;    ///< The number of free chunks in all slabs.
+} otHeapStats;
+
+/**
+ * Gets the occupancy and fragmentation statistics of the OpenThread internal heap.
+ *
+ * @param[out] aStats   A pointer to an `otHeapStats` to output the statistics.
+ *
+ * @retval OT_ERROR_NONE             Successfully retrieved the statistics.
+ * @retval OT_ERROR_NOT_IMPLEMENTED  The internal heap is not used (an external heap is set or this is a radio build).
+ */
+otError otHeapGetStats(otHeapStats *aStats);
+
 /**
  * @}
  */
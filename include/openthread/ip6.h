@@ -434,6 +434,24 @@ const otNetifMulticastAddress *otIp6GetMulticastAddresses(otInstance *aInstance)
  */
 otMessage *otIp6NewMessage(otInstance *aInstance, const otMessageSettings *aSettings);
 
+/**
+ * Allocate a new message buffer for sending an IPv6 message from a given origin.
+ *
+ * Is the same as `otIp6NewMessage()` (which uses `OT_MESSAGE_ORIGIN_HOST_TRUSTED`) except that the message is
+ * allocated with origin @p aOrigin, so all its buffers are subject to the quota of @p aOrigin.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ * @param[in]  aSettings  A pointer to the message settings or NULL to set default settings.
+ * @param[in]  aOrigin    The message origin.
+ *
+ * @returns A pointer to the message buffer or NULL if no message buffers are available or parameters are invalid.
+ *
+ * @sa otMessageFree
+ */
+otMessage *otIp6NewMessageWithOrigin(otInstance              *aInstance,
+                                     const otMessageSettings *aSettings,
+                                     otMessageOrigin          aOrigin);
+
 /**
  * Allocate a new message buffer and write the IPv6 datagram to the message buffer for sending an IPv6 message.
  *
@@ -455,6 +473,28 @@ otMessage *otIp6NewMessageFromBuffer(otInstance              *aInstance,
                                      uint16_t                 aDataLength,
                                      const otMessageSettings *aSettings);
 
+/**
+ * Allocate a new message buffer from a given origin and write the IPv6 datagram to the message buffer.
+ *
+ * Is the same as `otIp6NewMessageFromBuffer()` (which uses `OT_MESSAGE_ORIGIN_HOST_TRUSTED`) except that the message
+ * is allocated with origin @p aOrigin, so all its buffers are subject to the quota of @p aOrigin.
+ *
+ * @param[in]  aInstance    A pointer to an OpenThread instance.
+ * @param[in]  aData        A pointer to the IPv6 datagram buffer.
+ * @param[in]  aDataLength  The size of the IPv6 datagram buffer pointed by @p aData.
+ * @param[in]  aSettings    A pointer to the message settings or NULL to set default settings.
+ * @param[in]  aOrigin      The message origin.
+ *
+ * @returns A pointer to the message or NULL if malformed IPv6 header or insufficient message buffers are available.
+ *
+ * @sa otMessageFree
+ */
+otMessage *otIp6NewMessageFromBufferWithOrigin(otInstance              *aInstance,
+                                               const uint8_t           *aData,
+                                               uint16_t                 aDataLength,
+                                               const otMessageSettings *aSettings,
+                                               otMessageOrigin          aOrigin);
+
 /**
  * Pointer is called when an IPv6 datagram is received.
  *
@@ -108,6 +108,15 @@ typedef struct otThreadLinkInfo
     uint8_t mRadioType; ///< Radio link type.
 } otThreadLinkInfo;
 
+/**
+ * Represents a span, i.e., a contiguous sequence of message bytes stored in a single message buffer.
+ */
+typedef struct otMessageSpan
+{
+    const uint8_t *mBytes;  ///< A pointer to the bytes of the span.
+    uint16_t       mLength; ///< The number of bytes in the span.
+} otMessageSpan;
+
 /**
  * Gets the `otInstance` associated with a given message.
  *
@@ -262,6 +271,10 @@ otMessageOrigin otMessageGetOrigin(const otMessage *aMessage);
 /**
  * Sets the message origin.
  *
+ * The buffers of the message are accounted for the new origin. The quota of the new origin (see `otMessagePoolQuotas`)
+ * is only applied to buffers allocated afterwards, so the origin should preferably be given when the message is
+ * allocated, e.g., using `otIp6NewMessageWithOrigin()`.
+ *
  * @param[in]  aMessage  A pointer to a message buffer.
  * @param[in]  aOrigin   The message origin.
  */
@@ -395,6 +408,31 @@ uint16_t otMessageRead(const otMessage *aMessage, uint16_t aOffset, void *aBuf,
  */
 int otMessageWrite(otMessage *aMessage, uint16_t aOffset, const void *aBuf, uint16_t aLength);
 
+/**
+ * Gets the spans covering a given range of bytes in a message without copying the message content.
+ *
+ * Each span is a contiguous sequence of message bytes stored in a single message buffer, so the spans can be used
+ * directly as an I/O vector (e.g., with `writev()`). The spans point into the message buffers and remain valid only
+ * while the message is not modified or freed.
+ *
+ * @param[in]     aMessage   A pointer to a message buffer.
+ * @param[in]     aOffset    An offset in bytes.
+ * @param[in]     aLength    Number of bytes.
+ * @param[out]    aSpans     A pointer to an array to output the spans.
+ * @param[in,out] aNumSpans  On input, the number of entries in @p aSpans. On output, the number of spans.
+ *
+ * @retval OT_ERROR_NONE     Successfully got the spans. @p aNumSpans is updated.
+ * @retval OT_ERROR_PARSE    The requested range extends beyond the end of the message.
+ * @retval OT_ERROR_NO_BUFS  The @p aSpans array is too small to cover the requested range.
+ *
+ * @sa otMessageRead
+ */
+otError otMessageGetSpans(const otMessage *aMessage,
+                          uint16_t         aOffset,
+                          uint16_t         aLength,
+                          otMessageSpan   *aSpans,
+                          uint16_t        *aNumSpans);
+
 /**
  * Creates a clone of a given message.
  *
@@ -453,6 +491,72 @@ typedef struct otBufferInfo
     otMessageQueueInfo mApplicationCoapQueue; ///< Info about application CoAP send queue.
 } otBufferInfo;
 
+/**
+ * Represents the message buffer usage of a class of messages (messages of a priority level or of an origin).
+ */
+typedef struct otMessageBufferUsage
+{
+    uint16_t mNumBuffers; ///< The number of buffers currently used.
+
+    /**
+     * The maximum number of buffers used at the same time since OT stack initialization or last call to
+     * `otMessageResetBufferInfo()`.
+     */
+    uint16_t mMaxUsedBuffers;
+
+    uint32_t mNumFailedAllocations; ///< The number of failed buffer allocations (no buffer, or quota/reservation).
+} otMessageBufferUsage;
+
+/**
+ * Represents the message buffer usage per message priority level and per message origin.
+ *
+ * Network control messages (e.g., MLE) use a priority level above `OT_MESSAGE_PRIORITY_HIGH`.
+ */
+typedef struct otMessagePoolUsage
+{
+    otMessageBufferUsage mLowPriority;    ///< Usage by low priority messages.
+    otMessageBufferUsage mNormalPriority; ///< Usage by normal priority messages.
+    otMessageBufferUsage mHighPriority;   ///< Usage by high priority messages.
+    otMessageBufferUsage mNetPriority;    ///< Usage by network control messages (e.g., MLE).
+    otMessageBufferUsage mThreadNetif;    ///< Usage by messages from Thread Netif.
+    otMessageBufferUsage mHostTrusted;    ///< Usage by messages from a trusted source on host (or locally created).
+    otMessageBufferUsage mHostUntrusted;  ///< Usage by messages from an untrusted source on host.
+} otMessagePoolUsage;
+
+/**
+ * Represents the message buffer reservations and quotas used for admission control of message buffer allocations.
+ *
+ * The reservations are hierarchical: a message can only use a free buffer if enough free buffers remain for the
+ * (not yet used part of the) reservations of all the higher priority levels. Network control messages (e.g., MLE)
+ * can use all buffers.
+ *
+ * The quotas limit the number of buffers used by the messages of an origin. Zero indicates no limit.
+ */
+typedef struct otMessagePoolQuotas
+{
+    uint16_t mReservedHighPriorityBuffers; ///< Buffers reserved for high priority messages.
+    uint16_t mReservedNetPriorityBuffers;  ///< Buffers reserved for network control messages (e.g., MLE).
+    uint16_t mMaxThreadNetifBuffers;       ///< Max buffers used by messages from Thread Netif (zero for no limit).
+    uint16_t mMaxHostTrustedBuffers;       ///< Max buffers used by messages from trusted host (zero for no limit).
+    uint16_t mMaxHostUntrustedBuffers;     ///< Max buffers used by messages from untrusted host (zero for no limit).
+} otMessagePoolQuotas;
+
+/**
+ * Represents the counters of the message buffers shared between messages.
+ *
+ * A message cloned on a multi-consumer path (e.g., a multicast datagram passed to the host and received locally) can
+ * share the buffers of the original message after its first buffer instead of copying them. A shared buffer is copied
+ * when one of the messages sharing it is modified.
+ */
+typedef struct otMessageSharingCounters
+{
+    uint32_t mNumSharedClones;  ///< The number of clones sharing buffers with the original message.
+    uint32_t mNumSharedBuffers; ///< The number of buffers shared by the clones instead of being copied.
+    uint32_t mNumCopiedBuffers; ///< The number of shared buffers copied when a message sharing them was modified.
+    uint16_t mCurSharedBuffers; ///< The number of buffers currently shared between messages.
+    uint16_t mMaxSharedBuffers; ///< The maximum number of buffers shared between messages at the same time.
+} otMessageSharingCounters;
+
 /**
  * Initialize the message queue.
  *
@@ -519,12 +623,51 @@ void otMessageGetBufferInfo(otInstance *aInstance, otBufferInfo *aBufferInfo);
 /**
  * Reset the Message Buffer information counter tracking the maximum number buffers in use at the same time.
  *
- * This resets `mMaxUsedBuffers` in `otBufferInfo`.
+ * This resets `mMaxUsedBuffers` in `otBufferInfo` and in every `otMessageBufferUsage` of `otMessagePoolUsage`.
  *
  * @param[in]   aInstance    A pointer to the OpenThread instance.
  */
 void otMessageResetBufferInfo(otInstance *aInstance);
 
+/**
+ * Get the message buffer usage per message priority level and per message origin.
+ *
+ * @param[in]   aInstance    A pointer to the OpenThread instance.
+ * @param[out]  aUsage       A pointer where the message buffer usage is written.
+ */
+void otMessageGetPoolUsage(otInstance *aInstance, otMessagePoolUsage *aUsage);
+
+/**
+ * Get the message buffer reservations and quotas.
+ *
+ * @param[in]   aInstance    A pointer to the OpenThread instance.
+ * @param[out]  aQuotas      A pointer where the message buffer reservations and quotas are written.
+ */
+void otMessageGetPoolQuotas(otInstance *aInstance, otMessagePoolQuotas *aQuotas);
+
+/**
+ * Set the message buffer reservations and quotas.
+ *
+ * The new reservations and quotas only apply to new buffer allocations. Buffers already in use are not freed.
+ *
+ * @param[in]   aInstance    A pointer to the OpenThread instance.
+ * @param[in]   aQuotas      A pointer to the message buffer reservations and quotas.
+ *
+ * @retval OT_ERROR_NONE          Successfully set the reservations and quotas.
+ * @retval OT_ERROR_INVALID_ARGS  The reservations together are not smaller than the total number of buffers.
+ */
+otError otMessageSetPoolQuotas(otInstance *aInstance, const otMessagePoolQuotas *aQuotas);
+
+/**
+ * Get the counters of the message buffers shared between messages.
+ *
+ * Requires `OPENTHREAD_CONFIG_MESSAGE_NUM_SHARED_BUFFER_CHAINS` to be non-zero.
+ *
+ * @param[in]   aInstance    A pointer to the OpenThread instance.
+ * @param[out]  aCounters    A pointer where the buffer sharing counters are written.
+ */
+void otMessageGetSharingCounters(otInstance *aInstance, otMessageSharingCounters *aCounters);
+
 /**
  * @}
  */
@@ -325,6 +325,26 @@ void otNat64SetEnabled(otInstance *aInstance, bool aEnabled);
  */
 otMessage *otIp4NewMessage(otInstance *aInstance, const otMessageSettings *aSettings);
 
+/**
+ * Allocate a new message buffer for sending an IPv4 message to the NAT64 translator from a given origin.
+ *
+ * Is the same as `otIp4NewMessage()` (which uses `OT_MESSAGE_ORIGIN_HOST_TRUSTED`) except that the message is
+ * allocated with origin @p aOrigin, so all its buffers are subject to the quota of @p aOrigin.
+ *
+ * Available when `OPENTHREAD_CONFIG_NAT64_TRANSLATOR_ENABLE` is enabled.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ * @param[in]  aSettings  A pointer to the message settings or NULL to set default settings.
+ * @param[in]  aOrigin    The message origin.
+ *
+ * @returns A pointer to the message buffer or NULL if no message buffers are available or parameters are invalid.
+ *
+ * @sa otNat64Send
+ */
+otMessage *otIp4NewMessageWithOrigin(otInstance              *aInstance,
+                                     const otMessageSettings *aSettings,
+                                     otMessageOrigin          aOrigin);
+
 /**
  * Sets the CIDR used when setting the source address of the outgoing translated IPv4 packets.
  *
@@ -428,6 +428,30 @@ otError otPlatCryptoAesSetKey(otCryptoContext *aContext, const otCryptoKey *aKey
  */
 otError otPlatCryptoAesEncrypt(otCryptoContext *aContext, const uint8_t *aInput, uint8_t *aOutput);
 
+/**
+ * Encrypt a number of independent blocks (AES ECB).
+ *
+ * OpenThread uses this to process the blocks of several AES CCM operations at once, so that a platform can pipeline
+ * the AES rounds of independent blocks (e.g., using AES instructions of the CPU or a hardware accelerator).
+ *
+ * A weak default implementation is provided, which calls `otPlatCryptoAesEncrypt()` for each block.
+ *
+ * @p aInput and @p aOutput can point to the same buffer.
+ *
+ * @param[in]  aContext           Context for AES operation.
+ * @param[in]  aInput             Pointer to the input buffer (@p aNumBlocks blocks of 16 bytes).
+ * @param[out] aOutput            Pointer to the output buffer (@p aNumBlocks blocks of 16 bytes).
+ * @param[in]  aNumBlocks         The number of blocks.
+ *
+ * @retval OT_ERROR_NONE          Successfully encrypted @p aInput.
+ * @retval OT_ERROR_FAILED        Failed to encrypt @p aInput.
+ * @retval OT_ERROR_INVALID_ARGS  @p aContext or @p aInput or @p aOutput were NULL
+ */
+otError otPlatCryptoAesEncryptBlocks(otCryptoContext *aContext,
+                                     const uint8_t   *aInput,
+                                     uint8_t         *aOutput,
+                                     uint16_t         aNumBlocks);
+
 /**
  * Free the AES context.
  *
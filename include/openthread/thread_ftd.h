@@ -125,6 +125,16 @@ typedef struct otCacheEntryIterator
     const void *mData[2]; ///< Opaque data used by the core implementation. Should not be changed by user.
 } otCacheEntryIterator;
 
+/**
+ * Represents the EID cache counters.
+ */
+typedef struct otCacheCounters
+{
+    uint32_t mHits;      ///< Number of address resolutions served from a cached or snooped entry.
+    uint32_t mMisses;    ///< Number of address resolutions with no usable cache entry.
+    uint32_t mEvictions; ///< Number of entries evicted to make room for a new entry.
+} otCacheCounters;
+
 /**
  * Gets the maximum number of children currently allowed.
  *
@@ -638,6 +648,22 @@ otError otThreadGetNextCacheEntry(otInstance *aInstance, otCacheEntryInfo *aEntr
  */
 void otThreadClearEidCache(otInstance *aInstance);
 
+/**
+ * Gets the EID cache counters.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ * @returns A pointer to the EID cache counters.
+ */
+const otCacheCounters *otThreadGetCacheCounters(otInstance *aInstance);
+
+/**
+ * Resets the EID cache counters.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ */
+void otThreadResetCacheCounters(otInstance *aInstance);
+
 /**
  * Get the Thread PSKc
  *
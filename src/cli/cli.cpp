@@ -2915,6 +2915,46 @@ template <> otError Interpreter::Process<Cmd("eidcache")>(Arg aArgs[])
     {
         otThreadClearEidCache(GetInstancePtr());
     }
+    /**
+     * @cli eidcache counters
+     * @code
+     * eidcache counters
+     * Hits: 120
+     * Misses: 4
+     * Evictions: 0
+     * Done
+     * @endcode
+     * @par api_copy
+     * #otThreadGetCacheCounters
+     */
+    else if (aArgs[0] == "counters")
+    {
+        if (aArgs[1].IsEmpty())
+        {
+            const otCacheCounters *counters = otThreadGetCacheCounters(GetInstancePtr());
+
+            OutputLine("Hits: %lu", ToUlong(counters->mHits));
+            OutputLine("Misses: %lu", ToUlong(counters->mMisses));
+            OutputLine("Evictions: %lu", ToUlong(counters->mEvictions));
+        }
+        /**
+         * @cli eidcache counters reset
+         * @code
+         * eidcache counters reset
+         * Done
+         * @endcode
+         * @par api_copy
+         * #otThreadResetCacheCounters
+         */
+        else if ((aArgs[1] == "reset") && aArgs[2].IsEmpty())
+        {
+            otThreadResetCacheCounters(GetInstancePtr());
+        }
+        else
+        {
+            error = OT_ERROR_INVALID_ARGS;
+        }
+    }
     else
     {
         error = OT_ERROR_INVALID_ARGS;
@@ -36,6 +36,7 @@
 #include <openthread/heap.h>
 
 #include "common/heap.hpp"
+#include "instance/instance.hpp"
 
 #if OPENTHREAD_RADIO
 
@@ -59,8 +60,30 @@ void otHeapFree(void *aPointer)
     OT_ASSERT(false);
 }
 
+otError otHeapGetStats(otHeapStats *aStats)
+{
+    OT_UNUSED_VARIABLE(aStats);
+
+    return OT_ERROR_NOT_IMPLEMENTED;
+}
+
 #else  // OPENTHREAD_RADIO
 void *otHeapCAlloc(size_t aCount, size_t aSize) { return ot::Heap::CAlloc(aCount, aSize); }
 
 void otHeapFree(void *aPointer) { ot::Heap::Free(aPointer); }
+
+otError otHeapGetStats(otHeapStats *aStats)
+{
+    ot::Error error = ot::kErrorNone;
+
+    AssertPointerIsNotNull(aStats);
+
+#if OPENTHREAD_CONFIG_HEAP_EXTERNAL_ENABLE
+    error = ot::kErrorNotImplemented;
+#else
+    ot::Instance::GetHeap().GetStats(*aStats);
+#endif
+
+    return error;
+}
 #endif // OPENTHREAD_RADIO
@@ -151,6 +151,13 @@ otMessage *otIp6NewMessage(otInstance *aInstance, const otMessageSettings *aSett
     return AsCoreType(aInstance).Get<Ip6::Ip6>().NewMessage(Message::Settings::From(aSettings));
 }
 
+otMessage *otIp6NewMessageWithOrigin(otInstance              *aInstance,
+                                     const otMessageSettings *aSettings,
+                                     otMessageOrigin          aOrigin)
+{
+    return AsCoreType(aInstance).Get<Ip6::Ip6>().NewMessage(Message::Settings::From(aSettings, MapEnum(aOrigin)));
+}
+
 otMessage *otIp6NewMessageFromBuffer(otInstance              *aInstance,
                                      const uint8_t           *aData,
                                      uint16_t                 aDataLength,
@@ -160,6 +167,16 @@ otMessage *otIp6NewMessageFromBuffer(otInstance              *aInstance,
                                                                     Message::Settings::From(aSettings));
 }
 
+otMessage *otIp6NewMessageFromBufferWithOrigin(otInstance              *aInstance,
+                                               const uint8_t           *aData,
+                                               uint16_t                 aDataLength,
+                                               const otMessageSettings *aSettings,
+                                               otMessageOrigin          aOrigin)
+{
+    return AsCoreType(aInstance).Get<Ip6::Ip6>().NewMessageFromData(
+        aData, aDataLength, Message::Settings::From(aSettings, MapEnum(aOrigin)));
+}
+
 otError otIp6AddUnsecurePort(otInstance *aInstance, uint16_t aPort)
 {
     return AsCoreType(aInstance).Get<Ip6::Filter>().AddUnsecurePort(aPort);
@@ -113,6 +113,22 @@ uint16_t otMessageRead(const otMessage *aMessage, uint16_t aOffset, void *aBuf,
     return AsCoreType(aMessage).ReadBytes(aOffset, aBuf, aLength);
 }
 
+otError otMessageGetSpans(const otMessage *aMessage,
+                          uint16_t         aOffset,
+                          uint16_t         aLength,
+                          otMessageSpan   *aSpans,
+                          uint16_t        *aNumSpans)
+{
+    OffsetRange offsetRange;
+
+    AssertPointerIsNotNull(aSpans);
+    AssertPointerIsNotNull(aNumSpans);
+
+    offsetRange.Init(aOffset, aLength);
+
+    return AsCoreType(aMessage).GetSpans(offsetRange, aSpans, *aNumSpans);
+}
+
 int otMessageWrite(otMessage *aMessage, uint16_t aOffset, const void *aBuf, uint16_t aLength)
 {
     AssertPointerIsNotNull(aBuf);
@@ -163,4 +179,27 @@ void otMessageGetBufferInfo(otInstance *aInstance, otBufferInfo *aBufferInfo)
 }
 
 void otMessageResetBufferInfo(otInstance *aInstance) { AsCoreType(aInstance).ResetBufferInfo(); }
+
+void otMessageGetPoolUsage(otInstance *aInstance, otMessagePoolUsage *aUsage)
+{
+    AsCoreType(aInstance).Get<MessagePool>().GetUsage(AsCoreType(aUsage));
+}
+
+void otMessageGetPoolQuotas(otInstance *aInstance, otMessagePoolQuotas *aQuotas)
+{
+    AsCoreType(aInstance).Get<MessagePool>().GetQuotas(AsCoreType(aQuotas));
+}
+
+otError otMessageSetPoolQuotas(otInstance *aInstance, const otMessagePoolQuotas *aQuotas)
+{
+    return AsCoreType(aInstance).Get<MessagePool>().SetQuotas(AsCoreType(aQuotas));
+}
+
+#if OPENTHREAD_CONFIG_MESSAGE_NUM_SHARED_BUFFER_CHAINS > 0
+void otMessageGetSharingCounters(otInstance *aInstance, otMessageSharingCounters *aCounters)
+{
+    *aCounters = AsCoreType(aInstance).Get<MessagePool>().GetSharingCounters();
+}
+#endif
+
 #endif // OPENTHREAD_MTD || OPENTHREAD_FTD
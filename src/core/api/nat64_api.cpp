@@ -56,6 +56,14 @@ otMessage *otIp4NewMessage(otInstance *aInstance, const otMessageSettings *aSett
     return AsCoreType(aInstance).Get<Nat64::Translator>().NewIp4Message(Message::Settings::From(aSettings));
 }
 
+otMessage *otIp4NewMessageWithOrigin(otInstance              *aInstance,
+                                     const otMessageSettings *aSettings,
+                                     otMessageOrigin          aOrigin)
+{
+    return AsCoreType(aInstance).Get<Nat64::Translator>().NewIp4Message(
+        Message::Settings::From(aSettings, MapEnum(aOrigin)));
+}
+
 otError otNat64Send(otInstance *aInstance, otMessage *aMessage)
 {
     return AsCoreType(aInstance).Get<Nat64::Translator>().SendMessage(OwnedPtr<Message>(AsCoreTypePtr(aMessage)));
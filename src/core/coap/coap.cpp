@@ -121,7 +121,7 @@ void Msg::UpdateMessageId(uint16_t aMessageId)
 CoapBase::CoapBase(Instance &aInstance, Transmitter aTransmitter)
     : InstanceLocator(aInstance)
     , mPendingRequests(aInstance, *this)
-    , mResponseCache(aInstance)
+    , mResponseCache(aInstance, *this)
     , mResourceHandler(nullptr)
     , mTransmitter(aTransmitter)
     , mMessageId(Random::NonCrypto::Generate<uint16_t>())
@@ -129,6 +129,7 @@ CoapBase::CoapBase(Instance &aInstance, Transmitter aTransmitter)
     , mLastResponse(nullptr)
 #endif
 {
+    mLookupCounters.Clear();
 }
 
 void CoapBase::ClearAllRequestsAndResponses(void)
@@ -137,12 +138,28 @@ void CoapBase::ClearAllRequestsAndResponses(void)
     mResponseCache.RemoveAll();
 }
 
-void CoapBase::AddResource(Resource &aResource) { IgnoreError(mResources.Add(aResource)); }
+void CoapBase::AddResource(Resource &aResource) { mResources.Add(aResource); }
 
-void CoapBase::RemoveResource(Resource &aResource)
+void CoapBase::RemoveResource(Resource &aResource) { mResources.Remove(aResource); }
+
+uint32_t CoapBase::HashUriPath(const char *aUriPath)
 {
-    IgnoreError(mResources.Remove(aResource));
-    aResource.SetNext(nullptr);
+    Fnv1aHash hash;
+
+    hash.FeedString(aUriPath);
+
+    return hash.GetHash();
+}
+
+uint16_t CoapBase::HashToken(const Token &aToken)
+{
+    // Hashes the token bytes, folded to 16 bits.
+
+    Fnv1aHash hash;
+
+    hash.FeedBytes(aToken.GetBytes(), aToken.GetLength());
+
+    return static_cast<uint16_t>(hash.GetHash() ^ (hash.GetHash() >> 16));
 }
 
 Message *CoapBase::AllocateAndInitPriorityConfirmablePostMessage(Uri aUri)
@@ -736,8 +753,12 @@ void CoapBase::ProcessReceivedRequest(Msg &aRxMsg)
         ExitNow();
     }
 
-    for (const Resource &resource : mResources)
+    mLookupCounters.mResourceLookups++;
+
+    for (const Resource &resource : mResources.GetListFor(uriPath))
     {
+        mLookupCounters.mResourceCompares++;
+
         if (StringMatch(resource.mUriPath, uriPath))
         {
             resource.HandleRequest(aRxMsg);
@@ -769,13 +790,9 @@ exit:
 
 #if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
 
-void CoapBase::AddBlockWiseResource(ResourceBlockWise &aResource) { IgnoreError(mBlockWiseResources.Add(aResource)); }
+void CoapBase::AddBlockWiseResource(ResourceBlockWise &aResource) { mBlockWiseResources.Add(aResource); }
 
-void CoapBase::RemoveBlockWiseResource(ResourceBlockWise &aResource)
-{
-    IgnoreError(mBlockWiseResources.Remove(aResource));
-    aResource.SetNext(nullptr);
-}
+void CoapBase::RemoveBlockWiseResource(ResourceBlockWise &aResource) { mBlockWiseResources.Remove(aResource); }
 
 Error CoapBase::ProcessBlockwiseSend(Msg &aMsg, const SendCallbacks &aCallbacks)
 {
@@ -938,8 +955,12 @@ Error CoapBase::ProcessBlockwiseRequest(Msg &aRxMsg, const Message::UriPathStrin
         SuccessOrExit(error = iterator.Advance());
     }
 
-    for (const ResourceBlockWise &resource : mBlockWiseResources)
+    mLookupCounters.mResourceLookups++;
+
+    for (const ResourceBlockWise &resource : mBlockWiseResources.GetListFor(aUriPath))
     {
+        mLookupCounters.mResourceCompares++;
+
         if (!StringMatch(resource.GetUriPath(), aUriPath))
         {
             continue;
@@ -1567,6 +1588,10 @@ Error CoapBase::PendingRequests::Add(const Msg           &aTxMsg,
 
     mRequestMessages.Enqueue(*aRequest.mMessage);
 
+    // If the index is full, the request is counted as not indexed
+    // and is found by searching through all pending requests.
+    IgnoreError(mRequestIndex.Add(*aRequest.mMessage, aTxMsg.GetMessageId(), HashToken(aTxMsg.GetToken())));
+
     mTimer.FireAtIfEarlier(aRequest.GetTimerFireTime());
 
 exit:
@@ -1577,43 +1602,74 @@ exit:
 void CoapBase::PendingRequests::Remove(Request &aRequest)
 {
     VerifyOrExit(aRequest.HasMessage());
-    mRequestMessages.DequeueAndFree(*aRequest.mMessage);
+    Dequeue(*aRequest.mMessage);
+    aRequest.mMessage->Free();
     aRequest.Clear();
 
 exit:
     return;
 }
 
+void CoapBase::PendingRequests::Dequeue(Message &aMessage)
+{
+    Token token;
+
+    token.Clear();
+    IgnoreError(aMessage.ReadToken(token));
+
+    IgnoreReturnValue(mRequestIndex.Remove(aMessage, aMessage.ReadMessageId(), HashToken(token)));
+    mRequestMessages.Dequeue(aMessage);
+}
+
 Error CoapBase::PendingRequests::FindRelatedRequest(const Msg &aMsg, Request &aRequest)
 {
-    Error error = kErrorNotFound;
+    using Index = MessageIndex<kRequestIndexSize>;
 
-    for (Message &message : mRequestMessages)
-    {
-        aRequest.InitFrom(message);
+    Error    error   = kErrorNotFound;
+    bool     isById  = (aMsg.GetType() == kTypeAck) || (aMsg.GetType() == kTypeReset);
+    uint16_t keyHash = isById ? aMsg.GetMessageId() : HashToken(aMsg.GetToken());
+    uint16_t entry;
 
-        if (aRequest.HasSamePeerAddrAndPort(aMsg.mMessageInfo) || aRequest.GetDestinationAddress().IsMulticast() ||
-            aRequest.GetDestinationAddress().GetIid().IsAnycastLocator())
-        {
-            switch (aMsg.GetType())
-            {
-            case kTypeReset:
-            case kTypeAck:
-                if (aMsg.GetMessageId() == message.ReadMessageId())
-                {
-                    ExitNow(error = kErrorNone);
-                }
+    mCoapBase.mLookupCounters.mRequestLookups++;
 
-                break;
+    if (isById ? mRequestIndex.HasUnindexedWithId(keyHash) : mRequestIndex.HasUnindexedWithToken(keyHash))
+    {
+        // A request which could not be added to `mRequestIndex` may
+        // have the same key, so we search through all the pending
+        // requests.
 
-            case kTypeConfirmable:
-            case kTypeNonConfirmable:
-                if (aMsg.mMessage.HasSameTokenAs(message))
-                {
-                    ExitNow(error = kErrorNone);
-                }
+        mCoapBase.mLookupCounters.mRequestFullScans++;
 
-                break;
+        for (Message &message : mRequestMessages)
+        {
+            aRequest.InitFrom(message);
+            if (IsRelatedRequest(aMsg, aRequest))
+            {
+                ExitNow(error = kErrorNone);
+            }
+        }
+    }
+    else if (isById)
+    {
+        for (entry = mRequestIndex.FindFirstWithId(keyHash); entry != Index::kNoEntry;
+             entry = mRequestIndex.FindNextWithId(entry))
+        {
+            aRequest.InitFrom(mRequestIndex.GetMessage(entry));
+            if (IsRelatedRequest(aMsg, aRequest))
+            {
+                ExitNow(error = kErrorNone);
+            }
+        }
+    }
+    else
+    {
+        for (entry = mRequestIndex.FindFirstWithToken(keyHash); entry != Index::kNoEntry;
+             entry = mRequestIndex.FindNextWithToken(entry))
+        {
+            aRequest.InitFrom(mRequestIndex.GetMessage(entry));
+            if (IsRelatedRequest(aMsg, aRequest))
+            {
+                ExitNow(error = kErrorNone);
             }
         }
     }
@@ -1624,6 +1680,33 @@ exit:
     return error;
 }
 
+bool CoapBase::PendingRequests::IsRelatedRequest(const Msg &aMsg, const Request &aRequest) const
+{
+    bool isRelated = false;
+
+    mCoapBase.mLookupCounters.mRequestCompares++;
+
+    VerifyOrExit(aRequest.HasSamePeerAddrAndPort(aMsg.mMessageInfo) ||
+                 aRequest.GetDestinationAddress().IsMulticast() ||
+                 aRequest.GetDestinationAddress().GetIid().IsAnycastLocator());
+
+    switch (aMsg.GetType())
+    {
+    case kTypeReset:
+    case kTypeAck:
+        isRelated = (aMsg.GetMessageId() == aRequest.GetMessage().ReadMessageId());
+        break;
+
+    case kTypeConfirmable:
+    case kTypeNonConfirmable:
+        isRelated = aMsg.mMessage.HasSameTokenAs(aRequest.GetMessage());
+        break;
+    }
+
+exit:
+    return isRelated;
+}
+
 void CoapBase::PendingRequests::FinalizeRequest(Request &aRequest, Error aResult)
 {
     FinalizeRequest(aRequest, aResult, /* aResponse */ nullptr);
@@ -1633,7 +1716,7 @@ void CoapBase::PendingRequests::FinalizeRequest(Request &aRequest, Error aResult
 {
     VerifyOrExit(aRequest.HasMessage());
 
-    mRequestMessages.Dequeue(*aRequest.mMessage);
+    Dequeue(*aRequest.mMessage);
 
     DispatchResponse(aRequest, aResult, aResponse);
 
@@ -1704,7 +1787,7 @@ Error CoapBase::PendingRequests::AbortAllMatching(const Matcher &aMatcher)
 
         if (aMatcher.Matches(request))
         {
-            mRequestMessages.Dequeue(message);
+            Dequeue(message);
             abortedMessages.Enqueue(message);
             error = kErrorNone;
         }
@@ -1781,7 +1864,7 @@ void CoapBase::PendingRequests::HandleTimer(void)
                 // even if the user callback (invoked during
                 // finalization) modifies any pending requests
 
-                mRequestMessages.Dequeue(message);
+                Dequeue(message);
                 expiredMessages.Enqueue(message);
                 continue;
             }
@@ -1830,8 +1913,9 @@ exit:
 //---------------------------------------------------------------------------------------------------------------------
 // CoapBase::ResponseCache
 
-CoapBase::ResponseCache::ResponseCache(Instance &aInstance)
-    : mTimer(aInstance, ResponseCache::HandleTimer, this)
+CoapBase::ResponseCache::ResponseCache(Instance &aInstance, CoapBase &aCoapBase)
+    : mCoapBase(aCoapBase)
+    , mTimer(aInstance, ResponseCache::HandleTimer, this)
 {
 }
 
@@ -1860,22 +1944,27 @@ exit:
 
 const Message *CoapBase::ResponseCache::FindMatching(const Msg &aRxMsg) const
 {
-    const Message *match        = nullptr;
-    uint16_t       requestMsgId = aRxMsg.GetMessageId();
+    using Index = MessageIdIndex<kMaxCacheSize>;
 
-    for (const Message &response : mResponses)
+    const Message *match = nullptr;
+    uint16_t       entry;
+
+    mCoapBase.mLookupCounters.mCachedResponseLookups++;
+
+    for (entry = mIndex.FindFirstWithId(aRxMsg.GetMessageId()); entry != Index::kNoEntry;
+         entry = mIndex.FindNextWithId(entry))
     {
-        if (response.ReadMessageId() == requestMsgId)
-        {
-            ResponseMetadata metadata;
+        const Message   &response = mIndex.GetMessage(entry);
+        ResponseMetadata metadata;
 
-            metadata.ReadFrom(response);
+        mCoapBase.mLookupCounters.mCachedResponseCompares++;
 
-            if (metadata.mMessageInfo.HasSamePeerAddrAndPort(aRxMsg.mMessageInfo))
-            {
-                match = &response;
-                break;
-            }
+        metadata.ReadFrom(response);
+
+        if (metadata.mMessageInfo.HasSamePeerAddrAndPort(aRxMsg.mMessageInfo))
+        {
+            match = &response;
+            break;
         }
     }
 
@@ -1902,6 +1991,9 @@ void CoapBase::ResponseCache::Add(const Msg &aTxMsg, uint32_t aExchangeLifetime)
 
     SuccessOrExit(metadata.AppendTo(*responseClone));
 
+    // `MaintainCacheSize()` ensures there is room in the index.
+    SuccessOrAssert(mIndex.Add(*responseClone, aTxMsg.GetMessageId()));
+
     mResponses.Enqueue(*responseClone);
     responseClone = nullptr;
 
@@ -1937,13 +2029,20 @@ void CoapBase::ResponseCache::MaintainCacheSize(void)
 
     if (count >= kMaxCacheSize)
     {
-        mResponses.DequeueAndFree(*msgToRemove);
+        Remove(*msgToRemove);
     }
 }
 
+void CoapBase::ResponseCache::Remove(Message &aResponse)
+{
+    IgnoreReturnValue(mIndex.Remove(aResponse, aResponse.ReadMessageId()));
+    mResponses.DequeueAndFree(aResponse);
+}
+
 void CoapBase::ResponseCache::RemoveAll(void)
 {
     mResponses.DequeueAndFreeAll();
+    mIndex.Clear();
     mTimer.Stop();
 }
 
@@ -1964,7 +2063,7 @@ void CoapBase::ResponseCache::HandleTimer(void)
 
         if (expireTime.GetNow() >= metadata.mExpireTime)
         {
-            mResponses.DequeueAndFree(response);
+            Remove(response);
         }
         else
         {
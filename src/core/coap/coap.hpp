@@ -36,7 +36,9 @@
 #include "coap/coap_message.hpp"
 #include "common/as_core_type.hpp"
 #include "common/callback.hpp"
+#include "common/clearable.hpp"
 #include "common/debug.hpp"
+#include "common/fnv_hash.hpp"
 #include "common/linked_list.hpp"
 #include "common/locator.hpp"
 #include "common/message.hpp"
@@ -294,6 +296,8 @@ class CoapBase
       public MessageAllocator<CoapBase, ReservedHeaderSize::kCoapMessage, Message::kTypeIp6, ot::Coap::Message>,
       private NonCopyable
 {
+    friend class ot::UnitTester;
+
 public:
     /**
      * Function pointer callback invoked before CoAP processing a received CoAP message.
@@ -306,6 +310,20 @@ public:
      */
     typedef Error (*Interceptor)(void *aContext, const Msg &aRxMsg);
 
+    /**
+     * Represents the counters tracking the lookups done by a CoAP agent when processing received messages.
+     */
+    struct LookupCounters : public Clearable<LookupCounters>
+    {
+        uint32_t mResourceLookups;        ///< Number of lookups of a resource by URI path.
+        uint32_t mResourceCompares;       ///< Number of resource URI paths compared during the lookups.
+        uint32_t mRequestLookups;         ///< Number of lookups of a pending request related to a message.
+        uint32_t mRequestCompares;        ///< Number of pending requests checked during the lookups.
+        uint32_t mRequestFullScans;       ///< Number of request lookups searching all pending requests (not indexed).
+        uint32_t mCachedResponseLookups;  ///< Number of lookups of a cached response matching a received request.
+        uint32_t mCachedResponseCompares; ///< Number of cached responses checked during the lookups.
+    };
+
     /**
      * Clears all requests and responses used by this CoAP agent and stops all timers.
      */
@@ -695,6 +713,18 @@ public:
      */
     void GetRequestAndCachedResponsesQueueInfo(MessageQueue::Info &aQueueInfo) const;
 
+    /**
+     * Gets the lookup counters.
+     *
+     * @returns The lookup counters.
+     */
+    const LookupCounters &GetLookupCounters(void) const { return mLookupCounters; }
+
+    /**
+     * Resets the lookup counters.
+     */
+    void ResetLookupCounters(void) { mLookupCounters.Clear(); }
+
     /**
      * Sends a CoAP message with custom transmission parameters using `ResponseHandlerSeparateParams` handle type.
      *
@@ -802,7 +832,11 @@ protected:
     void SetResourceHandler(ResourceHandler aHandler) { mResourceHandler = aHandler; }
 
 private:
-    static constexpr uint16_t kMaxBlockSize = OPENTHREAD_CONFIG_COAP_MAX_BLOCK_LENGTH;
+    static constexpr uint16_t kMaxBlockSize      = OPENTHREAD_CONFIG_COAP_MAX_BLOCK_LENGTH;
+    static constexpr uint16_t kResourceTableSize = OPENTHREAD_CONFIG_COAP_RESOURCE_TABLE_SIZE;
+    static constexpr uint16_t kRequestIndexSize  = OPENTHREAD_CONFIG_COAP_PENDING_REQUEST_INDEX_SIZE;
+
+    static_assert(kResourceTableSize != 0, "kResourceTableSize MUST be non-zero");
 
     struct SendCallbacks
     {
@@ -824,6 +858,320 @@ private:
 #endif
     };
 
+    template <typename ResourceType> class ResourceTable
+    {
+        // Holds the resources in `kResourceTableSize` lists, selected
+        // by the hash of their URI path, so that a lookup only compares
+        // the URI paths of the resources sharing the same list.
+
+    public:
+        void Add(ResourceType &aResource) { IgnoreError(GetListFor(aResource.GetUriPath()).Add(aResource)); }
+
+        void Remove(ResourceType &aResource)
+        {
+            if (GetListFor(aResource.GetUriPath()).Remove(aResource) != kErrorNone)
+            {
+                // The URI path may have been changed after the resource
+                // was added, so search all the lists.
+
+                for (LinkedList<ResourceType> &list : mLists)
+                {
+                    IgnoreError(list.Remove(aResource));
+                }
+            }
+
+            aResource.SetNext(nullptr);
+        }
+
+        LinkedList<ResourceType> &GetListFor(const char *aUriPath)
+        {
+            return mLists[HashUriPath(aUriPath) % kResourceTableSize];
+        }
+
+        const LinkedList<ResourceType> &GetListFor(const char *aUriPath) const
+        {
+            return mLists[HashUriPath(aUriPath) % kResourceTableSize];
+        }
+
+    private:
+        LinkedList<ResourceType> mLists[kResourceTableSize];
+    };
+
+    template <uint16_t kCapacity> class MessageIdIndex
+    {
+        // Indexes up to `kCapacity` queued messages by their CoAP
+        // message ID. The entries with the same message ID are kept
+        // in the order they were added, i.e., the same order as the
+        // messages in their queue.
+        //
+        // When the index is full, `Add()` counts the message as not
+        // indexed in the bucket of its message ID, until it is passed
+        // to `Remove()`. Only lookups of message IDs in those buckets
+        // need to search through all the queued messages.
+
+    public:
+        static constexpr uint16_t kNoEntry = 0xffff;
+
+        static_assert((kCapacity != 0) && (kCapacity < kNoEntry), "kCapacity is invalid");
+
+        MessageIdIndex(void) { Clear(); }
+
+        void Clear(void)
+        {
+            mNumEntries = 0;
+            mFreeHead   = 0;
+
+            for (uint16_t i = 0; i < kCapacity; i++)
+            {
+                mIdBuckets[i]         = kNoEntry;
+                mNumUnindexedById[i]  = 0;
+                mEntries[i].mMessage  = nullptr;
+                mEntries[i].mNextById = (i + 1 < kCapacity) ? i + 1 : kNoEntry;
+            }
+        }
+
+        uint16_t GetNumEntries(void) const { return mNumEntries; }
+
+        Error Add(Message &aMessage, uint16_t aMessageId)
+        {
+            return (AddEntry(aMessage, aMessageId) != kNoEntry) ? kErrorNone : kErrorNoBufs;
+        }
+
+        bool Remove(const Message &aMessage, uint16_t aMessageId)
+        {
+            // Returns whether `aMessage` was indexed. Otherwise it
+            // MUST have been counted as not indexed by `Add()`.
+
+            return (RemoveEntry(aMessage, aMessageId) != kNoEntry);
+        }
+
+        bool HasUnindexedWithId(uint16_t aMessageId) const
+        {
+            return mNumUnindexedById[aMessageId % kCapacity] > 0;
+        }
+
+        uint16_t FindFirstWithId(uint16_t aMessageId) const
+        {
+            return SkipToId(mIdBuckets[aMessageId % kCapacity], aMessageId);
+        }
+
+        uint16_t FindNextWithId(uint16_t aEntry) const
+        {
+            return SkipToId(mEntries[aEntry].mNextById, mEntries[aEntry].mMessageId);
+        }
+
+        Message &GetMessage(uint16_t aEntry) const { return *mEntries[aEntry].mMessage; }
+
+    protected:
+        uint16_t AddEntry(Message &aMessage, uint16_t aMessageId)
+        {
+            // Returns the new entry, or `kNoEntry` if the index is full.
+
+            uint16_t entry = mFreeHead;
+
+            if (entry == kNoEntry)
+            {
+                mNumUnindexedById[aMessageId % kCapacity]++;
+            }
+            else
+            {
+                uint16_t *link = &mIdBuckets[aMessageId % kCapacity];
+
+                mFreeHead = mEntries[entry].mNextById;
+
+                mEntries[entry].mMessage   = &aMessage;
+                mEntries[entry].mMessageId = aMessageId;
+                mEntries[entry].mNextById  = kNoEntry;
+
+                while (*link != kNoEntry)
+                {
+                    link = &mEntries[*link].mNextById;
+                }
+
+                *link = entry;
+                mNumEntries++;
+            }
+
+            return entry;
+        }
+
+        uint16_t RemoveEntry(const Message &aMessage, uint16_t aMessageId)
+        {
+            // Returns the removed entry (which is not reused before
+            // the next `AddEntry()`), or `kNoEntry` if `aMessage` was
+            // not indexed.
+
+            uint16_t *link = &mIdBuckets[aMessageId % kCapacity];
+            uint16_t  entry;
+
+            for (; *link != kNoEntry; link = &mEntries[*link].mNextById)
+            {
+                if ((mEntries[*link].mMessage == &aMessage) && (mEntries[*link].mMessageId == aMessageId))
+                {
+                    break;
+                }
+            }
+
+            entry = *link;
+
+            if (entry != kNoEntry)
+            {
+                *link = mEntries[entry].mNextById;
+
+                mEntries[entry].mMessage  = nullptr;
+                mEntries[entry].mNextById = mFreeHead;
+                mFreeHead                 = entry;
+                mNumEntries--;
+            }
+            else
+            {
+                OT_ASSERT(mNumUnindexedById[aMessageId % kCapacity] > 0);
+                mNumUnindexedById[aMessageId % kCapacity]--;
+            }
+
+            return entry;
+        }
+
+    private:
+        struct Entry
+        {
+            Message *mMessage;
+            uint16_t mMessageId;
+            uint16_t mNextById;
+        };
+
+        uint16_t SkipToId(uint16_t aEntry, uint16_t aMessageId) const
+        {
+            while ((aEntry != kNoEntry) && (mEntries[aEntry].mMessageId != aMessageId))
+            {
+                aEntry = mEntries[aEntry].mNextById;
+            }
+
+            return aEntry;
+        }
+
+        uint16_t mNumEntries;
+        uint16_t mFreeHead;
+        uint16_t mIdBuckets[kCapacity];
+        uint16_t mNumUnindexedById[kCapacity];
+        Entry    mEntries[kCapacity];
+    };
+
+    template <uint16_t kCapacity> class MessageIndex : public MessageIdIndex<kCapacity>
+    {
+        // Indexes up to `kCapacity` queued messages by their CoAP
+        // message ID and by the hash of their token. The token index
+        // follows the same rules as the message ID index.
+
+        using Base = MessageIdIndex<kCapacity>;
+
+    public:
+        using Base::kNoEntry;
+
+        MessageIndex(void) { ClearTokenIndex(); }
+
+        void Clear(void)
+        {
+            Base::Clear();
+            ClearTokenIndex();
+        }
+
+        Error Add(Message &aMessage, uint16_t aMessageId, uint16_t aTokenHash)
+        {
+            Error    error = kErrorNone;
+            uint16_t entry = Base::AddEntry(aMessage, aMessageId);
+
+            if (entry == kNoEntry)
+            {
+                mNumUnindexedByToken[aTokenHash % kCapacity]++;
+                error = kErrorNoBufs;
+            }
+            else
+            {
+                uint16_t *link = &mTokenBuckets[aTokenHash % kCapacity];
+
+                mTokenHashes[entry] = aTokenHash;
+                mNextByToken[entry] = kNoEntry;
+
+                while (*link != kNoEntry)
+                {
+                    link = &mNextByToken[*link];
+                }
+
+                *link = entry;
+            }
+
+            return error;
+        }
+
+        bool Remove(const Message &aMessage, uint16_t aMessageId, uint16_t aTokenHash)
+        {
+            // Returns whether `aMessage` was indexed. Otherwise it
+            // MUST have been counted as not indexed by `Add()`.
+
+            uint16_t entry = Base::RemoveEntry(aMessage, aMessageId);
+
+            if (entry != kNoEntry)
+            {
+                uint16_t *link = &mTokenBuckets[mTokenHashes[entry] % kCapacity];
+
+                while (*link != entry)
+                {
+                    link = &mNextByToken[*link];
+                }
+
+                *link = mNextByToken[entry];
+            }
+            else
+            {
+                OT_ASSERT(mNumUnindexedByToken[aTokenHash % kCapacity] > 0);
+                mNumUnindexedByToken[aTokenHash % kCapacity]--;
+            }
+
+            return (entry != kNoEntry);
+        }
+
+        bool HasUnindexedWithToken(uint16_t aTokenHash) const
+        {
+            return mNumUnindexedByToken[aTokenHash % kCapacity] > 0;
+        }
+
+        uint16_t FindFirstWithToken(uint16_t aTokenHash) const
+        {
+            return SkipToToken(mTokenBuckets[aTokenHash % kCapacity], aTokenHash);
+        }
+
+        uint16_t FindNextWithToken(uint16_t aEntry) const
+        {
+            return SkipToToken(mNextByToken[aEntry], mTokenHashes[aEntry]);
+        }
+
+    private:
+        void ClearTokenIndex(void)
+        {
+            for (uint16_t i = 0; i < kCapacity; i++)
+            {
+                mTokenBuckets[i]        = kNoEntry;
+                mNumUnindexedByToken[i] = 0;
+            }
+        }
+
+        uint16_t SkipToToken(uint16_t aEntry, uint16_t aTokenHash) const
+        {
+            while ((aEntry != kNoEntry) && (mTokenHashes[aEntry] != aTokenHash))
+            {
+                aEntry = mNextByToken[aEntry];
+            }
+
+            return aEntry;
+        }
+
+        uint16_t mTokenBuckets[kCapacity];
+        uint16_t mNumUnindexedByToken[kCapacity];
+        uint16_t mTokenHashes[kCapacity];
+        uint16_t mNextByToken[kCapacity];
+    };
+
     class PendingRequests;
 
     class Request
@@ -896,6 +1244,8 @@ private:
 
     class PendingRequests
     {
+        friend class ot::UnitTester;
+
         struct Iterator;
 
     public:
@@ -940,6 +1290,8 @@ private:
             void               *mContext;
         };
 
+        void        Dequeue(Message &aMessage);
+        bool        IsRelatedRequest(const Msg &aMsg, const Request &aRequest) const;
         Error       AbortAllMatching(const Matcher &aMatcher);
         void        FinalizeRemovedRequestsIn(MessageQueue &aQueue, Error aResult);
         void        RetransmitRequest(const Request &aRequest);
@@ -949,16 +1301,17 @@ private:
         Error ProcessObserveSend(const Msg &aTxMsg, Request &aRequest);
 #endif
 
-        CoapBase         &mCoapBase;
-        MessageQueue      mRequestMessages;
-        const Request    *mDispatchingRequest;
-        TimerMilliContext mTimer;
+        CoapBase                       &mCoapBase;
+        MessageQueue                    mRequestMessages;
+        MessageIndex<kRequestIndexSize> mRequestIndex;
+        const Request                  *mDispatchingRequest;
+        TimerMilliContext               mTimer;
     };
 
     class ResponseCache
     {
     public:
-        explicit ResponseCache(Instance &aInstance);
+        explicit ResponseCache(Instance &aInstance, CoapBase &aCoapBase);
 
         void  Add(const Msg &aTxMsg, uint32_t aExchangeLifetime);
         void  RemoveAll(void);
@@ -977,14 +1330,20 @@ private:
         };
 
         const Message *FindMatching(const Msg &aRxMsg) const;
+        void           Remove(Message &aResponse);
         void           MaintainCacheSize(void);
         static void    HandleTimer(Timer &aTimer);
         void           HandleTimer(void);
 
-        MessageQueue      mResponses;
-        TimerMilliContext mTimer;
+        CoapBase                     &mCoapBase;
+        MessageQueue                  mResponses;
+        MessageIdIndex<kMaxCacheSize> mIndex;
+        TimerMilliContext             mTimer;
     };
 
+    static uint32_t HashUriPath(const char *aUriPath);
+    static uint16_t HashToken(const Token &aToken);
+
     Message *InitMessage(Message *aMessage, Type aType, Uri aUri);
     Message *InitResponse(Message *aMessage, const Message &aRequest);
     bool     InvokeResponseFallback(Msg &aRxMsg) const;
@@ -1018,16 +1377,17 @@ private:
 
     PendingRequests            mPendingRequests;
     ResponseCache              mResponseCache;
-    LinkedList<Resource>       mResources;
+    ResourceTable<Resource>    mResources;
     Callback<Interceptor>      mInterceptor;
     Callback<RequestHandler>   mDefaultHandler;
     Callback<ResponseFallback> mResponseFallback;
     ResourceHandler            mResourceHandler;
     Transmitter                mTransmitter;
     uint16_t                   mMessageId;
+    LookupCounters             mLookupCounters;
 #if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
-    LinkedList<ResourceBlockWise> mBlockWiseResources;
-    Message                      *mLastResponse;
+    ResourceTable<ResourceBlockWise> mBlockWiseResources;
+    Message                         *mLastResponse;
 #endif
 };
 
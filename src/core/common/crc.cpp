@@ -35,11 +35,116 @@
 
 namespace ot {
 
+#if OPENTHREAD_CONFIG_CRC_LOOKUP_TABLE_ENABLE
+
+namespace {
+
+// The lookup tables are generated at compile time. Entry `[k][b]` of a
+// table is the CRC (starting from zero) of byte `b` followed by `k`
+// zero bytes, so row zero is the classic byte-wise table and the other
+// rows allow feeding eight bytes at a time (slicing-by-8).
+
+template <size_t... kIndexes> struct IndexList
+{
+};
+
+template <size_t kCount, size_t... kIndexes> struct MakeIndexList : MakeIndexList<kCount - 1, kCount - 1, kIndexes...>
+{
+};
+
+template <size_t... kIndexes> struct MakeIndexList<0, kIndexes...>
+{
+    typedef IndexList<kIndexes...> Type;
+};
+
+template <typename UintType> struct CrcTable
+{
+    UintType mRows[8][256];
+};
+
+template <typename UintType> constexpr UintType ShiftCrcBit(UintType aPolynomial, UintType aCrc)
+{
+    return static_cast<UintType>(aCrc << 1) ^ ((aCrc >> (sizeof(UintType) * 8 - 1)) ? aPolynomial : 0);
+}
+
+template <typename UintType> constexpr UintType FeedCrcBits(UintType aPolynomial, UintType aCrc, uint8_t aNumBits)
+{
+    return (aNumBits == 0) ? aCrc : FeedCrcBits<UintType>(aPolynomial, ShiftCrcBit(aPolynomial, aCrc), aNumBits - 1);
+}
+
+template <typename UintType> constexpr UintType CrcTableEntry(UintType aPolynomial, uint8_t aSlice, size_t aByte)
+{
+    return FeedCrcBits<UintType>(aPolynomial, static_cast<UintType>(aByte << (sizeof(UintType) * 8 - 8)),
+                                 static_cast<uint8_t>(8 * (aSlice + 1)));
+}
+
+template <typename UintType, size_t... kBytes>
+constexpr CrcTable<UintType> GenerateCrcTable(UintType aPolynomial, IndexList<kBytes...>)
+{
+    return CrcTable<UintType>{{
+        {CrcTableEntry<UintType>(aPolynomial, 0, kBytes)...},
+        {CrcTableEntry<UintType>(aPolynomial, 1, kBytes)...},
+        {CrcTableEntry<UintType>(aPolynomial, 2, kBytes)...},
+        {CrcTableEntry<UintType>(aPolynomial, 3, kBytes)...},
+        {CrcTableEntry<UintType>(aPolynomial, 4, kBytes)...},
+        {CrcTableEntry<UintType>(aPolynomial, 5, kBytes)...},
+        {CrcTableEntry<UintType>(aPolynomial, 6, kBytes)...},
+        {CrcTableEntry<UintType>(aPolynomial, 7, kBytes)...},
+    }};
+}
+
+constexpr CrcTable<uint16_t> kCrc16CcittTable =
+    GenerateCrcTable<uint16_t>(kCrc16CcittPolynomial, MakeIndexList<256>::Type());
+constexpr CrcTable<uint16_t> kCrc16AnsiTable =
+    GenerateCrcTable<uint16_t>(kCrc16AnsiPolynomial, MakeIndexList<256>::Type());
+constexpr CrcTable<uint32_t> kCrc32AnsiTable =
+    GenerateCrcTable<uint32_t>(kCrc32AnsiPolynomial, MakeIndexList<256>::Type());
+
+static_assert(kCrc16CcittTable.mRows[0][1] == kCrc16CcittPolynomial, "CRC16-CCITT table is incorrect");
+static_assert(kCrc16AnsiTable.mRows[0][1] == kCrc16AnsiPolynomial, "CRC16-ANSI table is incorrect");
+static_assert(kCrc32AnsiTable.mRows[0][1] == kCrc32AnsiPolynomial, "CRC32-ANSI table is incorrect");
+
+} // namespace
+
+template <> const CrcCalculator<uint16_t>::TableRow *CrcCalculator<uint16_t>::FindTable(uint16_t aPolynomial)
+{
+    const TableRow *table = nullptr;
+
+    switch (aPolynomial)
+    {
+    case kCrc16CcittPolynomial:
+        table = kCrc16CcittTable.mRows;
+        break;
+    case kCrc16AnsiPolynomial:
+        table = kCrc16AnsiTable.mRows;
+        break;
+    default:
+        break;
+    }
+
+    return table;
+}
+
+template <> const CrcCalculator<uint32_t>::TableRow *CrcCalculator<uint32_t>::FindTable(uint32_t aPolynomial)
+{
+    return (aPolynomial == kCrc32AnsiPolynomial) ? kCrc32AnsiTable.mRows : nullptr;
+}
+
+#endif // OPENTHREAD_CONFIG_CRC_LOOKUP_TABLE_ENABLE
+
 template <typename UintType> UintType CrcCalculator<UintType>::FeedByte(uint8_t aByte)
 {
     static constexpr UintType kMsb      = kIsUint16 ? (1u << 15) : (1u << 31);
     static constexpr uint8_t  kBitShift = kIsUint16 ? 8 : 24;
 
+#if OPENTHREAD_CONFIG_CRC_LOOKUP_TABLE_ENABLE
+    if (mTable != nullptr)
+    {
+        mCrc = static_cast<UintType>(mCrc << 8) ^ mTable[0][static_cast<uint8_t>((mCrc >> kBitShift) ^ aByte)];
+        ExitNow();
+    }
+#endif
+
     mCrc ^= (static_cast<UintType>(aByte) << kBitShift);
 
     for (uint8_t i = 8; i > 0; i--)
@@ -54,6 +159,9 @@ template <typename UintType> UintType CrcCalculator<UintType>::FeedByte(uint8_t
         }
     }
 
+#if OPENTHREAD_CONFIG_CRC_LOOKUP_TABLE_ENABLE
+exit:
+#endif
     return mCrc;
 }
 
@@ -61,6 +169,38 @@ template <typename UintType> UintType CrcCalculator<UintType>::FeedBytes(const v
 {
     const uint8_t *bytes = reinterpret_cast<const uint8_t *>(aBytes);
 
+#if OPENTHREAD_CONFIG_CRC_LOOKUP_TABLE_ENABLE
+    if (mTable != nullptr)
+    {
+        // Slicing-by-8: The current CRC is XORed into the leading bytes,
+        // then each of the eight bytes is looked up in the table row
+        // matching the number of bytes following it.
+
+        static constexpr uint8_t kCrcSize = sizeof(UintType);
+
+        while (aLength >= kNumTableSlices)
+        {
+            UintType crc = 0;
+
+            for (uint8_t i = 0; i < kNumTableSlices; i++)
+            {
+                uint8_t byte = bytes[i];
+
+                if (i < kCrcSize)
+                {
+                    byte ^= static_cast<uint8_t>(mCrc >> (8 * (kCrcSize - 1 - i)));
+                }
+
+                crc ^= mTable[kNumTableSlices - 1 - i][byte];
+            }
+
+            mCrc = crc;
+            bytes += kNumTableSlices;
+            aLength -= kNumTableSlices;
+        }
+    }
+#endif
+
     while (aLength-- > 0)
     {
         FeedByte(*bytes++);
@@ -72,15 +212,9 @@ template <typename UintType> UintType CrcCalculator<UintType>::FeedBytes(const v
 template <typename UintType>
 UintType CrcCalculator<UintType>::Feed(const Message &aMessage, const OffsetRange &aOffsetRange)
 {
-    uint16_t       length = aOffsetRange.GetLength();
-    Message::Chunk chunk;
-
-    aMessage.GetFirstChunk(aOffsetRange.GetOffset(), length, chunk);
-
-    while (chunk.GetLength() > 0)
+    for (Message::SpanIterator iterator(aMessage, aOffsetRange); !iterator.IsDone(); iterator.Advance())
     {
-        FeedBytes(chunk.GetBytes(), chunk.GetLength());
-        aMessage.GetNextChunk(length, chunk);
+        FeedBytes(iterator.GetBytes(), iterator.GetLength());
     }
 
     return mCrc;
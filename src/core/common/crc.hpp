@@ -72,6 +72,9 @@ public:
     explicit CrcCalculator(UintType aPolynomial)
         : mPolynomial(aPolynomial)
         , mCrc(0)
+#if OPENTHREAD_CONFIG_CRC_LOOKUP_TABLE_ENABLE
+        , mTable(FindTable(aPolynomial))
+#endif
     {
     }
 
@@ -127,8 +130,20 @@ public:
     UintType Feed(const Message &aMessage, const OffsetRange &aOffsetRange);
 
 private:
+#if OPENTHREAD_CONFIG_CRC_LOOKUP_TABLE_ENABLE
+    static constexpr uint8_t  kNumTableSlices = 8;
+    static constexpr uint16_t kTableRowSize   = 256;
+
+    typedef UintType TableRow[kTableRowSize];
+
+    static const TableRow *FindTable(UintType aPolynomial);
+#endif
+
     UintType mPolynomial;
     UintType mCrc;
+#if OPENTHREAD_CONFIG_CRC_LOOKUP_TABLE_ENABLE
+    const TableRow *mTable; // `kNumTableSlices` rows, or `nullptr` if there is no table for `mPolynomial`.
+#endif
 };
 
 } // namespace ot
@@ -0,0 +1,138 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the FNV-1a hash.
+ */
+
+#ifndef OT_CORE_COMMON_FNV_HASH_HPP_
+#define OT_CORE_COMMON_FNV_HASH_HPP_
+
+#include "openthread-core-config.h"
+
+#include <stdint.h>
+
+#include "common/string.hpp"
+
+namespace ot {
+
+/**
+ * Implements the 32-bit FNV-1a hash.
+ *
+ * FNV-1a is a fast non-cryptographic hash, used to distribute keys (e.g., names or tokens) over the buckets of lookup
+ * tables. It MUST NOT be used where an attacker choosing the keys is a concern for anything more than performance.
+ */
+class Fnv1aHash
+{
+public:
+    static constexpr uint32_t kOffsetBasis = 2166136261u; ///< The initial hash value (of no bytes).
+
+    /**
+     * Initializes the `Fnv1aHash` to the hash of no bytes.
+     */
+    Fnv1aHash(void)
+        : mHash(kOffsetBasis)
+    {
+    }
+
+    /**
+     * Initializes the `Fnv1aHash` to continue from a previously calculated hash value.
+     *
+     * @param[in] aHash  The hash value to continue from.
+     */
+    explicit Fnv1aHash(uint32_t aHash)
+        : mHash(aHash)
+    {
+    }
+
+    /**
+     * Gets the current hash value.
+     *
+     * @returns The current hash value.
+     */
+    uint32_t GetHash(void) const { return mHash; }
+
+    /**
+     * Feeds a byte into the hash.
+     *
+     * @param[in] aByte  The byte value.
+     */
+    void FeedByte(uint8_t aByte) { mHash = (mHash ^ aByte) * kPrime; }
+
+    /**
+     * Feeds a sequence of bytes into the hash.
+     *
+     * @param[in] aBytes   A pointer to the bytes.
+     * @param[in] aLength  Number of bytes in @p aBytes.
+     */
+    void FeedBytes(const void *aBytes, uint16_t aLength)
+    {
+        for (const uint8_t *byte = static_cast<const uint8_t *>(aBytes); aLength > 0; aLength--, byte++)
+        {
+            FeedByte(*byte);
+        }
+    }
+
+    /**
+     * Feeds the characters of a null-terminated string (excluding the null character) into the hash.
+     *
+     * @param[in] aString  The string.
+     */
+    void FeedString(const char *aString)
+    {
+        for (; *aString != kNullChar; aString++)
+        {
+            FeedByte(static_cast<uint8_t>(*aString));
+        }
+    }
+
+    /**
+     * Feeds the characters of a null-terminated string converted to lowercase into the hash.
+     *
+     * Strings which only differ in case give the same hash.
+     *
+     * @param[in] aString  The string.
+     */
+    void FeedLowercaseString(const char *aString)
+    {
+        for (; *aString != kNullChar; aString++)
+        {
+            FeedByte(static_cast<uint8_t>(ToLowercase(*aString)));
+        }
+    }
+
+private:
+    static constexpr uint32_t kPrime = 16777619u;
+
+    uint32_t mHash;
+};
+
+} // namespace ot
+
+#endif // OT_CORE_COMMON_FNV_HASH_HPP_
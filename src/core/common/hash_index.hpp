@@ -0,0 +1,256 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for a generic open-addressing hash index.
+ */
+
+#ifndef OT_CORE_COMMON_HASH_INDEX_HPP_
+#define OT_CORE_COMMON_HASH_INDEX_HPP_
+
+#include "openthread-core-config.h"
+
+#include <stdint.h>
+
+#include "common/code_utils.hpp"
+#include "common/error.hpp"
+
+namespace ot {
+
+/**
+ * Implements an open-addressing hash index.
+ *
+ * The index maps a 32-bit hash of a key to values of type `ValueType`, e.g., the index of an entry in a `Pool` or a
+ * pointer to an entry. The entries and their keys are owned by the user. A lookup returns all the values whose hash
+ * maps to the same slot, so the user MUST check each value found against the key (see `FindFirst()`/`FindNext()`).
+ *
+ * Collisions are resolved using linear probing. Every slot records the home slot of its value, so removal uses
+ * backward shifting (no tombstones are needed) without re-hashing the keys of the entries.
+ *
+ * @tparam ValueType  The value type. It MUST be default constructible, copyable and comparable using `==`.
+ * @tparam kSize      The number of slots. At most three quarters of the slots are used.
+ */
+template <typename ValueType, uint16_t kSize> class HashIndex
+{
+public:
+    static constexpr uint16_t kMaxEntries = static_cast<uint16_t>(kSize * 3UL / 4); ///< Max number of values.
+    static constexpr uint16_t kNotFound   = 0xffff;                                 ///< No (more) values found.
+
+    static_assert(kSize >= 2, "HashIndex kSize MUST be at least 2");
+    static_assert(kSize < kNotFound, "HashIndex kSize is too large");
+
+    /**
+     * Initializes the `HashIndex` as empty.
+     */
+    HashIndex(void) { Clear(); }
+
+    /**
+     * Removes all values from the index.
+     */
+    void Clear(void)
+    {
+        mNumEntries = 0;
+
+        for (Slot &slot : mSlots)
+        {
+            slot.mHome = kEmptySlot;
+        }
+    }
+
+    /**
+     * Returns the number of values in the index.
+     *
+     * @returns The number of values in the index.
+     */
+    uint16_t GetNumEntries(void) const { return mNumEntries; }
+
+    /**
+     * Adds a value to the index.
+     *
+     * @param[in] aHash   The hash of the key of the entry.
+     * @param[in] aValue  The value to add.
+     *
+     * @retval kErrorNone     Successfully added the value.
+     * @retval kErrorNoBufs   The index already contains `kMaxEntries` values.
+     */
+    Error Add(uint32_t aHash, const ValueType &aValue)
+    {
+        Error    error = kErrorNone;
+        uint16_t home  = HomeOf(aHash);
+        uint16_t slot  = home;
+
+        VerifyOrExit(mNumEntries < kMaxEntries, error = kErrorNoBufs);
+
+        while (mSlots[slot].mHome != kEmptySlot)
+        {
+            slot = NextSlot(slot);
+        }
+
+        mSlots[slot].mHome  = home;
+        mSlots[slot].mValue = aValue;
+        mNumEntries++;
+
+    exit:
+        return error;
+    }
+
+    /**
+     * Removes a value from the index.
+     *
+     * @param[in] aHash   The hash of the key of the entry (same as when it was added).
+     * @param[in] aValue  The value to remove.
+     *
+     * @retval kErrorNone       Successfully removed the value.
+     * @retval kErrorNotFound   The value was not found in the index.
+     */
+    Error Remove(uint32_t aHash, const ValueType &aValue)
+    {
+        Error    error = kErrorNone;
+        uint16_t slot;
+        uint16_t next;
+
+        for (slot = FindFirst(aHash); slot != kNotFound; slot = FindNext(aHash, slot))
+        {
+            if (mSlots[slot].mValue == aValue)
+            {
+                break;
+            }
+        }
+
+        VerifyOrExit(slot != kNotFound, error = kErrorNotFound);
+
+        // Shift back any following values in the probe sequence whose
+        // home slot is cyclically at or before the now vacant `slot`,
+        // so that a lookup can stop at the first empty slot.
+
+        for (next = NextSlot(slot); mSlots[next].mHome != kEmptySlot; next = NextSlot(next))
+        {
+            uint16_t home = mSlots[next].mHome;
+            bool     canMove;
+
+            if (slot <= next)
+            {
+                canMove = (home <= slot) || (home > next);
+            }
+            else
+            {
+                canMove = (home <= slot) && (home > next);
+            }
+
+            if (canMove)
+            {
+                mSlots[slot] = mSlots[next];
+                slot         = next;
+            }
+        }
+
+        mSlots[slot].mHome = kEmptySlot;
+        mNumEntries--;
+
+    exit:
+        return error;
+    }
+
+    /**
+     * Finds the first slot containing a value which may have been added with a given hash.
+     *
+     * The values found include all the values added with @p aHash, but can also include values added with other hashes.
+     *
+     * @param[in] aHash  The hash of the key.
+     *
+     * @returns The slot of the first value, or `kNotFound` if there is none.
+     */
+    uint16_t FindFirst(uint32_t aHash) const { return FindFrom(HomeOf(aHash), HomeOf(aHash)); }
+
+    /**
+     * Finds the next slot containing a value which may have been added with a given hash.
+     *
+     * The values in the index MUST NOT be added or removed during the iteration.
+     *
+     * @param[in] aHash  The hash of the key.
+     * @param[in] aSlot  The current slot (from `FindFirst()` or a previous `FindNext()`).
+     *
+     * @returns The slot of the next value, or `kNotFound` if there is none.
+     */
+    uint16_t FindNext(uint32_t aHash, uint16_t aSlot) const { return FindFrom(NextSlot(aSlot), HomeOf(aHash)); }
+
+    /**
+     * Returns the value in a given slot.
+     *
+     * @param[in] aSlot  The slot (from `FindFirst()` or `FindNext()`).
+     *
+     * @returns The value in @p aSlot.
+     */
+    const ValueType &GetValueAt(uint16_t aSlot) const { return mSlots[aSlot].mValue; }
+
+private:
+    static constexpr uint16_t kEmptySlot = 0xffff; // `mHome` value of an empty slot.
+
+    struct Slot
+    {
+        uint16_t  mHome;
+        ValueType mValue;
+    };
+
+    static uint16_t HomeOf(uint32_t aHash)
+    {
+        // Fibonacci (multiplicative) hashing spreads keys which
+        // differ only slightly, e.g., consecutive ports or pool
+        // indexes, over the table.
+
+        return static_cast<uint16_t>(((aHash * 0x9e3779b1) >> 16) % kSize);
+    }
+
+    static uint16_t NextSlot(uint16_t aSlot) { return (aSlot + 1 == kSize) ? 0 : aSlot + 1; }
+
+    uint16_t FindFrom(uint16_t aSlot, uint16_t aHome) const
+    {
+        uint16_t slot = aSlot;
+
+        for (; mSlots[slot].mHome != kEmptySlot; slot = NextSlot(slot))
+        {
+            if (mSlots[slot].mHome == aHome)
+            {
+                ExitNow();
+            }
+        }
+
+        slot = kNotFound;
+
+    exit:
+        return slot;
+    }
+
+    uint16_t mNumEntries;
+    Slot     mSlots[kSize];
+};
+
+} // namespace ot
+
+#endif // OT_CORE_COMMON_HASH_INDEX_HPP_
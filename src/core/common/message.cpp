@@ -52,10 +52,26 @@ MessagePool::MessagePool(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mNumAllocated(0)
     , mMaxAllocated(0)
+#if OPENTHREAD_CONFIG_MESSAGE_NUM_SHARED_BUFFER_CHAINS > 0
+    , mNumUnshareBuffers(0)
+#endif
 {
 #if OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT
     otPlatMessagePoolInit(&GetInstance(), kNumBuffers, sizeof(Buffer));
 #endif
+
+    mQuotas.Clear();
+    mQuotas.mReservedHighPriorityBuffers = OPENTHREAD_CONFIG_MESSAGE_POOL_RESERVED_HIGH_PRIORITY_BUFFERS;
+    mQuotas.mReservedNetPriorityBuffers  = OPENTHREAD_CONFIG_MESSAGE_POOL_RESERVED_NET_PRIORITY_BUFFERS;
+    mQuotas.mMaxHostUntrustedBuffers     = OPENTHREAD_CONFIG_MESSAGE_POOL_MAX_HOST_UNTRUSTED_BUFFERS;
+
+    ClearAllBytes(mPriorityUsage);
+    ClearAllBytes(mOriginUsage);
+
+#if OPENTHREAD_CONFIG_MESSAGE_NUM_SHARED_BUFFER_CHAINS > 0
+    ClearAllBytes(mSharedChains);
+    mSharingCounters.Clear();
+#endif
 }
 
 #if OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT
@@ -64,28 +80,36 @@ MessagePool::~MessagePool(void) { otPlatMessagePoolDeinit(&GetInstance()); }
 
 Message *MessagePool::Allocate(Message::Type aType, uint16_t aReserveHeader, const Message::Settings &aSettings)
 {
-    Error    error = kErrorNone;
-    Message *message;
+    Error    error   = kErrorNone;
+    Message *message = nullptr;
+
+    VerifyOrExit(aSettings.GetPriority() < Message::kNumPriorities, error = kErrorInvalidArgs);
 
-    VerifyOrExit((message = static_cast<Message *>(NewBuffer(aSettings.GetPriority()))) != nullptr);
+    message = static_cast<Message *>(NewBuffer(aSettings.GetPriority(), aSettings.GetOrigin()));
+    VerifyOrExit(message != nullptr);
 
     ClearAllBytes(*message);
 
 #if OPENTHREAD_CONFIG_MULTIPLE_INSTANCE_ENABLE
     message->GetMetadata().mInstance = &GetInstance();
 #endif
+
+    // The priority and origin are set directly as the head buffer is
+    // already accounted for them in the buffer usage.
+
+    message->GetMetadata().mPriority = aSettings.GetPriority();
+    message->GetMetadata().mOrigin   = aSettings.GetOrigin();
+
     message->SetType(aType);
     message->SetReserved(aReserveHeader);
     message->SetLinkSecurityEnabled(aSettings.IsLinkSecurityEnabled());
     message->SetLoopbackToHostAllowed(OPENTHREAD_CONFIG_IP6_ALLOW_LOOP_BACK_HOST_DATAGRAMS);
-    message->SetOrigin(Message::kOriginHostTrusted);
     message->MarkAsNotInAQueue();
 
-    SuccessOrExit(error = message->SetPriority(aSettings.GetPriority()));
     SuccessOrExit(error = message->SetLength(0));
 
 exit:
-    if (error != kErrorNone)
+    if ((error != kErrorNone) && (message != nullptr))
     {
         Free(message);
         message = nullptr;
@@ -105,22 +129,23 @@ void MessagePool::Free(Message *aMessage)
 {
     OT_ASSERT(!aMessage->IsInAQueue());
 
-    FreeBuffers(static_cast<Buffer *>(aMessage));
+#if OPENTHREAD_CONFIG_MESSAGE_NUM_SHARED_BUFFER_CHAINS > 0
+    if (aMessage->HasSharedBuffers())
+    {
+        ReleaseSharedBuffers(*aMessage);
+    }
+#endif
+
+    FreeBuffers(static_cast<Buffer *>(aMessage), aMessage->GetPriority(), aMessage->GetOrigin());
 }
 
-Buffer *MessagePool::NewBuffer(Message::Priority aPriority)
+Buffer *MessagePool::NewBuffer(Message::Priority aPriority, Message::Origin aOrigin)
 {
     Buffer *buffer = nullptr;
 
-    while ((
-#if OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE
-               buffer = static_cast<Buffer *>(Heap::CAlloc(1, sizeof(Buffer)))
-#elif OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT
-               buffer = static_cast<Buffer *>(otPlatMessagePoolNew(&GetInstance()))
-#else
-               buffer = mBufferPool.Allocate()
-#endif
-                   ) == nullptr)
+    VerifyOrExit(IsAdmitted(aPriority, aOrigin));
+
+    while ((buffer = AllocateBuffer()) == nullptr)
     {
         SuccessOrExit(ReclaimBuffers(aPriority));
     }
@@ -128,33 +153,60 @@ Buffer *MessagePool::NewBuffer(Message::Priority aPriority)
     mNumAllocated++;
     mMaxAllocated = Max(mMaxAllocated, mNumAllocated);
 
+    AddBufferUsage(aPriority, aOrigin, 1);
+
     buffer->SetNextBuffer(nullptr);
 
 exit:
     if (buffer == nullptr)
     {
+        mPriorityUsage[aPriority].mNumFailedAllocations++;
+        mOriginUsage[aOrigin].mNumFailedAllocations++;
+
         LogInfo("No available message buffer");
     }
 
     return buffer;
 }
 
-void MessagePool::FreeBuffers(Buffer *aBuffer)
+void MessagePool::FreeBuffers(Buffer *aBuffer, Message::Priority aPriority, Message::Origin aOrigin)
 {
+    uint16_t numBuffers = 0;
+
     while (aBuffer != nullptr)
     {
         Buffer *next = aBuffer->GetNextBuffer();
+
+        ReleaseBuffer(*aBuffer);
+        mNumAllocated--;
+        numBuffers++;
+
+        aBuffer = next;
+    }
+
+    RemoveBufferUsage(aPriority, aOrigin, numBuffers);
+}
+
+Buffer *MessagePool::AllocateBuffer(void)
+{
 #if OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE
-        Heap::Free(aBuffer);
+    return static_cast<Buffer *>(Heap::CAlloc(1, sizeof(Buffer)));
 #elif OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT
-        otPlatMessagePoolFree(&GetInstance(), aBuffer);
+    return static_cast<Buffer *>(otPlatMessagePoolNew(&GetInstance()));
 #else
-        mBufferPool.Free(*aBuffer);
+    return mBufferPool.Allocate();
 #endif
-        mNumAllocated--;
+}
 
-        aBuffer = next;
-    }
+void MessagePool::ReleaseBuffer(Buffer &aBuffer)
+{
+#if OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE
+    Heap::Free(&aBuffer);
+#elif OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT
+    otPlatMessagePoolFree(&GetInstance(), &aBuffer);
+#else
+    mBufferPool.Free(aBuffer);
+#endif
 }
 
 Error MessagePool::ReclaimBuffers(Message::Priority aPriority)
@@ -162,6 +214,372 @@ Error MessagePool::ReclaimBuffers(Message::Priority aPriority)
     return Get<MeshForwarder>().EvictMessage(aPriority, MeshForwarder::kEvictReasonNoMessageBuffer);
 }
 
+bool MessagePool::IsAdmitted(Message::Priority aPriority, Message::Origin aOrigin) const
+{
+    // A new buffer is admitted if the origin is within its quota and
+    // enough free buffers remain for the unused part of the
+    // reservations of all higher priority levels. Other messages are
+    // not evicted to make room for a buffer denied here (eviction may
+    // remove equal or higher priority indirect messages).
+
+    bool     admitted = false;
+    uint16_t maxCount = GetMaxBufferCount(aOrigin);
+    uint16_t headroom;
+
+    VerifyOrExit((maxCount == 0) || (mOriginUsage[aOrigin].mNumBuffers < maxCount));
+
+    headroom = GetHeadroom(aPriority);
+    admitted = (headroom == 0) || (GetFreeBufferCount() > headroom);
+
+exit:
+    return admitted;
+}
+
+uint16_t MessagePool::GetHeadroom(Message::Priority aPriority) const
+{
+    // Returns the number of free buffers a message with `aPriority`
+    // cannot use, i.e., the unused part of the reservations of all
+    // higher priority levels and the buffers kept free to copy the
+    // shared buffers.
+
+    uint16_t headroom = 0;
+
+    for (uint8_t priority = aPriority + 1; priority < Message::kNumPriorities; priority++)
+    {
+        uint16_t reserved = GetReservedBufferCount(priority);
+
+        headroom += reserved - Min(reserved, mPriorityUsage[priority].mNumBuffers);
+    }
+
+#if OPENTHREAD_CONFIG_MESSAGE_NUM_SHARED_BUFFER_CHAINS > 0
+    headroom += mNumUnshareBuffers;
+#endif
+
+    return headroom;
+}
+
+uint16_t MessagePool::GetReservedBufferCount(uint8_t aPriority) const
+{
+    uint16_t reserved = 0;
+
+    switch (aPriority)
+    {
+    case Message::kPriorityHigh:
+        reserved = mQuotas.mReservedHighPriorityBuffers;
+        break;
+    case Message::kPriorityNet:
+        reserved = mQuotas.mReservedNetPriorityBuffers;
+        break;
+    default:
+        break;
+    }
+
+    return reserved;
+}
+
+uint16_t MessagePool::GetMaxBufferCount(Message::Origin aOrigin) const
+{
+    uint16_t maxCount = 0;
+
+    switch (aOrigin)
+    {
+    case Message::kOriginThreadNetif:
+        maxCount = mQuotas.mMaxThreadNetifBuffers;
+        break;
+    case Message::kOriginHostTrusted:
+        maxCount = mQuotas.mMaxHostTrustedBuffers;
+        break;
+    case Message::kOriginHostUntrusted:
+        maxCount = mQuotas.mMaxHostUntrustedBuffers;
+        break;
+    }
+
+    return maxCount;
+}
+
+Error MessagePool::SetQuotas(const Quotas &aQuotas)
+{
+    Error error = kErrorNone;
+
+    VerifyOrExit(static_cast<uint32_t>(aQuotas.mReservedHighPriorityBuffers) + aQuotas.mReservedNetPriorityBuffers <
+                     GetTotalBufferCount(),
+                 error = kErrorInvalidArgs);
+
+    mQuotas = aQuotas;
+
+exit:
+    return error;
+}
+
+void MessagePool::GetUsage(Usage &aUsage) const
+{
+    aUsage.mLowPriority    = mPriorityUsage[Message::kPriorityLow];
+    aUsage.mNormalPriority = mPriorityUsage[Message::kPriorityNormal];
+    aUsage.mHighPriority   = mPriorityUsage[Message::kPriorityHigh];
+    aUsage.mNetPriority    = mPriorityUsage[Message::kPriorityNet];
+    aUsage.mThreadNetif    = mOriginUsage[Message::kOriginThreadNetif];
+    aUsage.mHostTrusted    = mOriginUsage[Message::kOriginHostTrusted];
+    aUsage.mHostUntrusted  = mOriginUsage[Message::kOriginHostUntrusted];
+}
+
+void MessagePool::ResetMaxUsedBufferCount(void)
+{
+    mMaxAllocated = mNumAllocated;
+
+    for (BufferUsage &usage : mPriorityUsage)
+    {
+        usage.mMaxUsedBuffers = usage.mNumBuffers;
+    }
+
+    for (BufferUsage &usage : mOriginUsage)
+    {
+        usage.mMaxUsedBuffers = usage.mNumBuffers;
+    }
+
+#if OPENTHREAD_CONFIG_MESSAGE_NUM_SHARED_BUFFER_CHAINS > 0
+    mSharingCounters.mMaxSharedBuffers = mSharingCounters.mCurSharedBuffers;
+#endif
+}
+
+void MessagePool::UpdateBufferUsage(const Message &aMessage, Message::Priority aPriority, Message::Origin aOrigin)
+{
+    // Moves the buffers of `aMessage` to the usage of the new
+    // priority and origin. The quotas are not checked here, they
+    // only apply to new buffer allocations. Shared buffers stay
+    // accounted for the message which first owned them.
+
+    uint16_t      numBuffers = 0;
+    const Buffer *endBuffer  = nullptr;
+
+#if OPENTHREAD_CONFIG_MESSAGE_NUM_SHARED_BUFFER_CHAINS > 0
+    if (aMessage.HasSharedBuffers())
+    {
+        endBuffer = GetSharedChain(aMessage).mBuffers;
+    }
+#endif
+
+    for (const Buffer *buffer = &aMessage; buffer != endBuffer; buffer = buffer->GetNextBuffer())
+    {
+        numBuffers++;
+    }
+
+    RemoveBufferUsage(aMessage.GetPriority(), aMessage.GetOrigin(), numBuffers);
+    AddBufferUsage(aPriority, aOrigin, numBuffers);
+}
+
+void MessagePool::AddBufferUsage(Message::Priority aPriority, Message::Origin aOrigin, uint16_t aNumBuffers)
+{
+    AddBufferUsage(mPriorityUsage[aPriority], aNumBuffers);
+    AddBufferUsage(mOriginUsage[aOrigin], aNumBuffers);
+}
+
+void MessagePool::AddBufferUsage(BufferUsage &aUsage, uint16_t aNumBuffers)
+{
+    aUsage.mNumBuffers += aNumBuffers;
+    aUsage.mMaxUsedBuffers = Max(aUsage.mMaxUsedBuffers, aUsage.mNumBuffers);
+}
+
+void MessagePool::RemoveBufferUsage(Message::Priority aPriority, Message::Origin aOrigin, uint16_t aNumBuffers)
+{
+    mPriorityUsage[aPriority].mNumBuffers -= aNumBuffers;
+    mOriginUsage[aOrigin].mNumBuffers -= aNumBuffers;
+}
+
+#if OPENTHREAD_CONFIG_MESSAGE_NUM_SHARED_BUFFER_CHAINS > 0
+
+Message *MessagePool::CloneSharingBuffers(const Message &aMessage)
+{
+    // Clones `aMessage` into a single new buffer which references the
+    // buffers of `aMessage` after its first buffer. The buffers needed
+    // to later copy the shared buffers (when either message is
+    // modified) are kept free, so a write never fails due to sharing.
+    // Returns `nullptr` if the buffers cannot be shared, e.g., when
+    // `aMessage` has private buffers ahead of its shared buffers.
+
+    Message         *clone      = nullptr;
+    Buffer          *buffers    = AsNonConst(aMessage.GetNextBuffer());
+    SharedChain     *chain      = nullptr;
+    uint16_t         numBuffers = 0;
+    LinkSecurityMode linkSecurityMode;
+
+    VerifyOrExit(buffers != nullptr);
+
+    if (aMessage.HasSharedBuffers())
+    {
+        chain = &GetSharedChain(aMessage);
+        VerifyOrExit(chain->mBuffers == buffers);
+        numBuffers = chain->mNumBuffers;
+    }
+    else
+    {
+        for (SharedChain &entry : mSharedChains)
+        {
+            if (entry.mBuffers == nullptr)
+            {
+                chain = &entry;
+                break;
+            }
+        }
+
+        VerifyOrExit(chain != nullptr);
+
+        for (const Buffer *buffer = buffers; buffer != nullptr; buffer = buffer->GetNextBuffer())
+        {
+            numBuffers++;
+        }
+    }
+
+    VerifyOrExit(chain->mNumRefs < NumericLimits<uint16_t>::kMax);
+    VerifyOrExit(GetFreeBufferCount() > static_cast<uint32_t>(GetHeadroom(aMessage.GetPriority())) + numBuffers);
+
+    linkSecurityMode = aMessage.IsLinkSecurityEnabled() ? kWithLinkSecurity : kNoLinkSecurity;
+    clone            = Allocate(aMessage.GetType(), 0,
+                                Message::Settings(linkSecurityMode, aMessage.GetPriority(), aMessage.GetOrigin()));
+    VerifyOrExit(clone != nullptr);
+
+    if (!aMessage.HasSharedBuffers())
+    {
+        // The buffers stay accounted for the priority and origin of
+        // `aMessage` until they are released or taken over.
+
+        chain->mBuffers    = buffers;
+        chain->mNumBuffers = numBuffers;
+        chain->mNumRefs    = 1;
+        chain->mPriority   = aMessage.GetPriority();
+        chain->mOrigin     = aMessage.GetOrigin();
+
+        AsNonConst(aMessage).GetMetadata().mSharedChain = static_cast<uint8_t>(chain - mSharedChains + 1);
+
+        mSharingCounters.mCurSharedBuffers += numBuffers;
+        mSharingCounters.mMaxSharedBuffers =
+            Max(mSharingCounters.mMaxSharedBuffers, mSharingCounters.mCurSharedBuffers);
+    }
+
+    chain->mNumRefs++;
+    mNumUnshareBuffers += numBuffers;
+
+    memcpy(clone->GetFirstData(), aMessage.GetFirstData(), Message::kHeadBufferDataSize);
+    clone->SetNextBuffer(buffers);
+    clone->GetMetadata().mSharedChain = aMessage.GetMetadata().mSharedChain;
+    clone->SetReserved(aMessage.GetReserved());
+    clone->GetMetadata().mLength = aMessage.GetLength();
+
+    mSharingCounters.mNumSharedClones++;
+    mSharingCounters.mNumSharedBuffers += numBuffers;
+
+exit:
+    return clone;
+}
+
+void MessagePool::UnshareBuffers(Message &aMessage)
+{
+    // Gives `aMessage` private copies of its shared buffers. The last
+    // message sharing the buffers takes them over instead.
+
+    SharedChain &chain = GetSharedChain(aMessage);
+
+    if (chain.mNumRefs == 1)
+    {
+        RemoveBufferUsage(chain.mPriority, chain.mOrigin, chain.mNumBuffers);
+        AddBufferUsage(aMessage.GetPriority(), aMessage.GetOrigin(), chain.mNumBuffers);
+
+        mSharingCounters.mCurSharedBuffers -= chain.mNumBuffers;
+        chain.mBuffers = nullptr;
+    }
+    else
+    {
+        Buffer *lastBuffer = GetLastPrivateBuffer(aMessage);
+
+        // The copies use the buffers kept free for them, so the
+        // allocations below cannot fail.
+
+        mNumUnshareBuffers -= chain.mNumBuffers;
+
+        for (const Buffer *buffer = chain.mBuffers; buffer != nullptr; buffer = buffer->GetNextBuffer())
+        {
+            Buffer *copy = AllocateBuffer();
+
+            OT_ASSERT(copy != nullptr);
+
+            memcpy(copy->GetData(), buffer->GetData(), Buffer::kBufferDataSize);
+            lastBuffer->SetNextBuffer(copy);
+            lastBuffer = copy;
+        }
+
+        lastBuffer->SetNextBuffer(nullptr);
+
+        mNumAllocated += chain.mNumBuffers;
+        mMaxAllocated = Max(mMaxAllocated, mNumAllocated);
+        AddBufferUsage(aMessage.GetPriority(), aMessage.GetOrigin(), chain.mNumBuffers);
+
+        chain.mNumRefs--;
+        mSharingCounters.mNumCopiedBuffers += chain.mNumBuffers;
+    }
+
+    aMessage.GetMetadata().mSharedChain = 0;
+}
+
+void MessagePool::ReleaseSharedBuffers(Message &aMessage)
+{
+    // Detaches the shared buffers from `aMessage`. They are freed
+    // once no other message shares them.
+
+    SharedChain &chain = GetSharedChain(aMessage);
+
+    GetLastPrivateBuffer(aMessage)->SetNextBuffer(nullptr);
+    aMessage.GetMetadata().mSharedChain = 0;
+
+    chain.mNumRefs--;
+
+    if (chain.mNumRefs == 0)
+    {
+        FreeBuffers(chain.mBuffers, chain.mPriority, chain.mOrigin);
+
+        mSharingCounters.mCurSharedBuffers -= chain.mNumBuffers;
+        chain.mBuffers = nullptr;
+    }
+    else
+    {
+        mNumUnshareBuffers -= chain.mNumBuffers;
+    }
+}
+
+MessagePool::SharedChain &MessagePool::GetSharedChain(const Message &aMessage)
+{
+    return mSharedChains[aMessage.GetMetadata().mSharedChain - 1];
+}
+
+uint16_t MessagePool::GetPrivateSize(const Message &aMessage)
+{
+    // Returns the size of the head buffer and the private buffers
+    // of `aMessage` ahead of its shared buffers.
+
+    const Buffer *sharedBuffers = GetSharedChain(aMessage).mBuffers;
+    uint16_t      size          = Message::kHeadBufferDataSize;
+
+    for (const Buffer *buffer = aMessage.GetNextBuffer(); buffer != sharedBuffers; buffer = buffer->GetNextBuffer())
+    {
+        size += Message::kBufferDataSize;
+    }
+
+    return size;
+}
+
+Buffer *MessagePool::GetLastPrivateBuffer(Message &aMessage)
+{
+    Buffer *sharedBuffers = GetSharedChain(aMessage).mBuffers;
+    Buffer *buffer        = &aMessage;
+
+    while (buffer->GetNextBuffer() != sharedBuffers)
+    {
+        buffer = buffer->GetNextBuffer();
+    }
+
+    return buffer;
+}
+
+#endif // OPENTHREAD_CONFIG_MESSAGE_NUM_SHARED_BUFFER_CHAINS > 0
+
 uint16_t MessagePool::GetFreeBufferCount(void) const
 {
     uint16_t rval;
@@ -201,17 +619,26 @@ uint16_t MessagePool::GetTotalBufferCount(void) const
 //---------------------------------------------------------------------------------------------------------------------
 // Message::Settings
 
-const otMessageSettings Message::Settings::kDefault = {kWithLinkSecurity, kPriorityNormal};
-
-Message::Settings::Settings(LinkSecurityMode aSecurityMode, Priority aPriority)
+Message::Settings::Settings(LinkSecurityMode aSecurityMode, Priority aPriority, Origin aOrigin)
 {
     mLinkSecurityEnabled = aSecurityMode;
     mPriority            = aPriority;
+    mOrigin              = aOrigin;
 }
 
-const Message::Settings &Message::Settings::From(const otMessageSettings *aSettings)
+Message::Settings Message::Settings::From(const otMessageSettings *aSettings, Origin aOrigin)
 {
-    return (aSettings == nullptr) ? GetDefault() : AsCoreType(aSettings);
+    Settings settings = GetDefault();
+
+    if (aSettings != nullptr)
+    {
+        settings.mLinkSecurityEnabled = aSettings->mLinkSecurityEnabled;
+        settings.mPriority            = aSettings->mPriority;
+    }
+
+    settings.mOrigin = aOrigin;
+
+    return settings;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -236,11 +663,37 @@ Error Message::ResizeMessage(uint16_t aLength)
     Buffer  *lastBuffer;
     uint16_t curLength = kHeadBufferDataSize;
 
+#if OPENTHREAD_CONFIG_MESSAGE_NUM_SHARED_BUFFER_CHAINS > 0
+    if (HasSharedBuffers())
+    {
+        // The shared buffers are kept while the new length ends within
+        // them. Otherwise they are released when no longer needed, or
+        // copied before more buffers are added after them.
+
+        MessagePool &pool        = Get<MessagePool>();
+        uint32_t     privateSize = pool.GetPrivateSize(*this);
+        uint32_t     sharedSize  = static_cast<uint32_t>(pool.GetSharedChain(*this).mNumBuffers) * kBufferDataSize;
+
+        if (aLength <= privateSize)
+        {
+            pool.ReleaseSharedBuffers(*this);
+        }
+        else if (aLength <= privateSize + sharedSize)
+        {
+            ExitNow();
+        }
+        else
+        {
+            pool.UnshareBuffers(*this);
+        }
+    }
+#endif
+
     while (curLength < aLength)
     {
         if (curBuffer->GetNextBuffer() == nullptr)
         {
-            curBuffer->SetNextBuffer(Get<MessagePool>().NewBuffer(GetPriority()));
+            curBuffer->SetNextBuffer(Get<MessagePool>().NewBuffer(GetPriority(), GetOrigin()));
             VerifyOrExit(curBuffer->GetNextBuffer() != nullptr, error = kErrorNoBufs);
         }
 
@@ -252,7 +705,7 @@ Error Message::ResizeMessage(uint16_t aLength)
     curBuffer  = curBuffer->GetNextBuffer();
     lastBuffer->SetNextBuffer(nullptr);
 
-    Get<MessagePool>().FreeBuffers(curBuffer);
+    Get<MessagePool>().FreeBuffers(curBuffer, GetPriority(), GetOrigin());
 
 exit:
     return error;
@@ -268,6 +721,21 @@ void Message::Free(void)
     Get<MessagePool>().Free(this);
 }
 
+#if OPENTHREAD_CONFIG_MESSAGE_NUM_SHARED_BUFFER_CHAINS > 0
+Message &Message::PrepareWrite(uint16_t aOffset, uint16_t aLength)
+{
+    // Copies the shared buffers before a write to them.
+
+    if (HasSharedBuffers() && (aLength > 0) &&
+        (static_cast<uint32_t>(GetReserved()) + aOffset + aLength > Get<MessagePool>().GetPrivateSize(*this)))
+    {
+        Get<MessagePool>().UnshareBuffers(*this);
+    }
+
+    return *this;
+}
+#endif
+
 Error Message::SetLength(uint16_t aLength)
 {
     Error    error;
@@ -343,12 +811,19 @@ Error Message::SetPriority(Priority aPriority)
 
     VerifyOrExit(!IsInAPriorityQueue(), error = kErrorInvalidState);
 
+    Get<MessagePool>().UpdateBufferUsage(*this, aPriority, GetOrigin());
     GetMetadata().mPriority = priority;
 
 exit:
     return error;
 }
 
+void Message::SetOrigin(Origin aOrigin)
+{
+    Get<MessagePool>().UpdateBufferUsage(*this, GetPriority(), aOrigin);
+    GetMetadata().mOrigin = aOrigin;
+}
+
 const char *Message::PriorityToString(Priority aPriority)
 {
 #define PriorityMapList(_)       \
@@ -421,6 +896,28 @@ exit:
     return error;
 }
 
+Error Message::GetSpans(const OffsetRange &aOffsetRange, otMessageSpan *aSpans, uint16_t &aNumSpans) const
+{
+    Error    error    = kErrorNone;
+    uint16_t numSpans = 0;
+
+    VerifyOrExit(aOffsetRange.GetEndOffset() <= GetLength(), error = kErrorParse);
+
+    for (SpanIterator iterator(*this, aOffsetRange); !iterator.IsDone(); iterator.Advance())
+    {
+        VerifyOrExit(numSpans < aNumSpans, error = kErrorNoBufs);
+
+        aSpans[numSpans].mBytes  = iterator.GetBytes();
+        aSpans[numSpans].mLength = iterator.GetLength();
+        numSpans++;
+    }
+
+    aNumSpans = numSpans;
+
+exit:
+    return error;
+}
+
 Error Message::PrependBytes(const void *aBuf, uint16_t aLength)
 {
     Error   error     = kErrorNone;
@@ -428,7 +925,8 @@ Error Message::PrependBytes(const void *aBuf, uint16_t aLength)
 
     while (aLength > GetReserved())
     {
-        VerifyOrExit((newBuffer = Get<MessagePool>().NewBuffer(GetPriority())) != nullptr, error = kErrorNoBufs);
+        VerifyOrExit((newBuffer = Get<MessagePool>().NewBuffer(GetPriority(), GetOrigin())) != nullptr,
+                     error = kErrorNoBufs);
 
         newBuffer->SetNextBuffer(GetNextBuffer());
         SetNextBuffer(newBuffer);
@@ -742,6 +1240,7 @@ void Message::WriteBytes(uint16_t aOffset, const void *aBuf, uint16_t aLength)
     OT_ASSERT(CanAddSafely<uint16_t>(aOffset, aLength));
     OT_ASSERT(aOffset + aLength <= GetLength());
 
+    PrepareWrite(aOffset, aLength);
     GetFirstChunk(aOffset, aLength, chunk);
 
     while (chunk.GetLength() > 0)
@@ -803,39 +1302,68 @@ Message *Message::Clone(uint16_t aLength, uint16_t aReserveHeader) const
     Message         *clone;
     LinkSecurityMode linkSecurityMode = IsLinkSecurityEnabled() ? kWithLinkSecurity : kNoLinkSecurity;
 
-    clone = Get<MessagePool>().Allocate(GetType(), aReserveHeader, Settings(linkSecurityMode, GetPriority()));
+    // The clone is allocated with the same origin, so that its buffers
+    // are accounted for (and limited by the quota of) that origin.
+
+    clone = Get<MessagePool>().Allocate(GetType(), aReserveHeader,
+                                        Settings(linkSecurityMode, GetPriority(), GetOrigin()));
     VerifyOrExit(clone != nullptr, error = kErrorNoBufs);
 
     aLength = Min(aLength, GetLength());
 
     SuccessOrExit(error = clone->AppendBytesFromMessage(*this, 0, aLength));
 
-    // Copy selected message information.
-
     clone->SetOffset(Min(GetOffset(), aLength));
-
-    clone->SetSubType(GetSubType());
-    clone->SetLoopbackToHostAllowed(IsLoopbackToHostAllowed());
-    clone->SetOrigin(GetOrigin());
-    clone->SetTimestamp(GetTimestamp());
-    clone->SetMeshDest(GetMeshDest());
-    clone->SetPanId(GetPanId());
-    clone->SetChannel(GetChannel());
-    clone->SetRssAverager(GetRssAverager());
-    clone->SetLqiAverager(GetLqiAverager());
-#if OPENTHREAD_CONFIG_TIME_SYNC_ENABLE
-    clone->SetTimeSync(IsTimeSync());
-#endif
+    clone->CopyInfoFrom(*this);
 
 exit:
     FreeAndNullMessageOnError(clone, error);
     return clone;
 }
 
+void Message::CopyInfoFrom(const Message &aMessage)
+{
+    // Copy selected message information.
+
+    SetSubType(aMessage.GetSubType());
+    SetLoopbackToHostAllowed(aMessage.IsLoopbackToHostAllowed());
+    SetTimestamp(aMessage.GetTimestamp());
+    SetMeshDest(aMessage.GetMeshDest());
+    SetPanId(aMessage.GetPanId());
+    SetChannel(aMessage.GetChannel());
+    SetRssAverager(aMessage.GetRssAverager());
+    SetLqiAverager(aMessage.GetLqiAverager());
+#if OPENTHREAD_CONFIG_TIME_SYNC_ENABLE
+    SetTimeSync(aMessage.IsTimeSync());
+#endif
+}
+
 template <> Message *Message::Clone<kNoReservedHeader>(void) const { return Clone(GetLength(), 0); }
 
 template <> Message *Message::Clone<kSameReservedHeader>(void) const { return Clone(GetLength(), GetReserved()); }
 
+template <> Message *Message::Clone<kShareBuffers>(void) const
+{
+    Message *clone = nullptr;
+
+#if OPENTHREAD_CONFIG_MESSAGE_NUM_SHARED_BUFFER_CHAINS > 0
+    clone = Get<MessagePool>().CloneSharingBuffers(*this);
+
+    if (clone != nullptr)
+    {
+        clone->SetOffset(GetOffset());
+        clone->CopyInfoFrom(*this);
+    }
+#endif
+
+    if (clone == nullptr)
+    {
+        clone = Clone<kSameReservedHeader>();
+    }
+
+    return clone;
+}
+
 template <> Message *Message::Clone<kNoReservedHeader>(uint16_t aLength) const { return Clone(aLength, 0); }
 
 template <> Message *Message::Clone<kSameReservedHeader>(uint16_t aLength) const
@@ -71,15 +71,6 @@ struct otMessage
 namespace ot {
 
 class UnitTester;
-template <typename UintType> class CrcCalculator;
-
-namespace Crypto {
-
-class AesCcm;
-class Sha256;
-class HmacSha256;
-
-} // namespace Crypto
 
 /**
  * @addtogroup core-message
@@ -161,8 +152,9 @@ enum LinkSecurityMode : bool
  */
 enum CloneMode : uint8_t
 {
-    kNoReservedHeader,  ///< The clone message will have no reserved header.
-    kSameReservedHeader ///< The clone message will have the same reserved header size as the original `Message`.
+    kNoReservedHeader,   ///< The clone message will have no reserved header.
+    kSameReservedHeader, ///< The clone message will have the same reserved header size as the original `Message`.
+    kShareBuffers,       ///< As `kSameReservedHeader`, sharing the buffers after the first one when supported.
 };
 
 /**
@@ -171,6 +163,7 @@ enum CloneMode : uint8_t
 class Buffer : public otMessageBuffer, public LinkedListEntry<Buffer>
 {
     friend class Message;
+    friend class MessagePool;
 
 public:
     static constexpr uint16_t kSize = OPENTHREAD_CONFIG_MESSAGE_BUFFER_SIZE; ///< Size of buffer in bytes.
@@ -229,6 +222,9 @@ protected:
         uint8_t mSubType : 4; // The message sub type.
         uint8_t mMleCommand;  // The MLE command type (used when `mSubType is `Mle`).
         uint8_t mChannel;     // The message channel (used for MLE Announce).
+#if OPENTHREAD_CONFIG_MESSAGE_NUM_SHARED_BUFFER_CHAINS > 0
+        uint8_t mSharedChain; // One plus the index of the shared buffer chain in `MessagePool` (zero if none).
+#endif
 #if OPENTHREAD_CONFIG_TIME_SYNC_ENABLE
         uint8_t mTimeSyncSeq; // The time sync sequence.
 #endif
@@ -287,12 +283,6 @@ static_assert(sizeof(Buffer) >= Buffer::kSize,
  */
 class Message : public otMessage, public Buffer, public GetProvider<Message>
 {
-    friend class Checksum;
-    friend class CrcCalculator<uint16_t>;
-    friend class CrcCalculator<uint32_t>;
-    friend class Crypto::HmacSha256;
-    friend class Crypto::Sha256;
-    friend class Crypto::AesCcm;
     friend class MessagePool;
     friend class MessageQueue;
     friend class PriorityQueue;
@@ -346,23 +336,44 @@ public:
         kOriginHostUntrusted = OT_MESSAGE_ORIGIN_HOST_UNTRUSTED, // Message from an untrusted source on host.
     };
 
+    static constexpr uint8_t kNumOrigins = 3; ///< Number of origins.
+
     /**
      * Represents settings used for creating a new message.
+     *
+     * The message origin is part of the settings so that the `MessagePool` accounts the buffers of a new message for
+     * (and limits them by the quota of) its origin from the start.
      */
     class Settings : public otMessageSettings
     {
     public:
+        /**
+         * Initializes the `Settings` object.
+         *
+         * The origin is set to `kOriginHostTrusted`.
+         *
+         * @param[in]  aSecurityMode  A link security mode.
+         * @param[in]  aPriority      A message priority.
+         */
+        Settings(LinkSecurityMode aSecurityMode, Priority aPriority)
+            : Settings(aSecurityMode, aPriority, kOriginHostTrusted)
+        {
+        }
+
         /**
          * Initializes the `Settings` object.
          *
          * @param[in]  aSecurityMode  A link security mode.
          * @param[in]  aPriority      A message priority.
+         * @param[in]  aOrigin        A message origin.
          */
-        Settings(LinkSecurityMode aSecurityMode, Priority aPriority);
+        Settings(LinkSecurityMode aSecurityMode, Priority aPriority, Origin aOrigin);
 
         /**
          * Initializes the `Settings` with a given message priority and link security enabled.
          *
+         * The origin is set to `kOriginHostTrusted`.
+         *
          * @param[in]  aPriority      A message priority.
          */
         explicit Settings(Priority aPriority)
@@ -377,6 +388,13 @@ public:
          */
         Priority GetPriority(void) const { return static_cast<Priority>(mPriority); }
 
+        /**
+         * Sets the message priority.
+         *
+         * @param[in]  aPriority  A message priority.
+         */
+        void SetPriority(Priority aPriority) { mPriority = aPriority; }
+
         /**
          * Indicates whether the link security should be enabled.
          *
@@ -385,24 +403,33 @@ public:
         bool IsLinkSecurityEnabled(void) const { return mLinkSecurityEnabled; }
 
         /**
-         * Converts a pointer to an `otMessageSettings` to a `Settings`.
+         * Gets the message origin.
+         *
+         * @returns The message origin.
+         */
+        Origin GetOrigin(void) const { return static_cast<Origin>(mOrigin); }
+
+        /**
+         * Creates a `Settings` from an `otMessageSettings`.
          *
          * @param[in] aSettings  A pointer to `otMessageSettings` to convert from.
          *                       If it is `nullptr`, then the default settings `GetDefault()` will be used.
+         * @param[in] aOrigin    The message origin.
          *
-         * @returns A reference to the converted `Settings` or the default if @p aSettings is `nullptr`.
+         * @returns The `Settings` from @p aSettings (or the default if @p aSettings is `nullptr`) and @p aOrigin.
          */
-        static const Settings &From(const otMessageSettings *aSettings);
+        static Settings From(const otMessageSettings *aSettings, Origin aOrigin = kOriginHostTrusted);
 
         /**
-         * Returns the default settings with link security enabled and `kPriorityNormal` priority.
+         * Returns the default settings with link security enabled, `kPriorityNormal` priority and
+         * `kOriginHostTrusted` origin.
          *
-         * @returns A reference to the default settings (link security enable and `kPriorityNormal` priority).
+         * @returns The default settings.
          */
-        static const Settings &GetDefault(void) { return static_cast<const Settings &>(kDefault); }
+        static Settings GetDefault(void) { return Settings(kWithLinkSecurity, kPriorityNormal); }
 
     private:
-        static const otMessageSettings kDefault;
+        uint8_t mOrigin;
     };
 
     /**
@@ -883,6 +910,23 @@ public:
      */
     uint16_t ReadBytes(const OffsetRange &aOffsetRange, void *aBuf) const;
 
+    /**
+     * Gets the spans covering a given offset range in the message without copying the message content.
+     *
+     * Each span is a contiguous sequence of message bytes stored in a single message buffer, so the spans can be used
+     * directly as an I/O vector (e.g., with `writev()`). Spans point into the message buffers and remain valid only
+     * while the message content is not modified.
+     *
+     * @param[in]     aOffsetRange  The offset range in the message.
+     * @param[out]    aSpans        An array to output the spans.
+     * @param[in,out] aNumSpans     On input, the number of entries in @p aSpans. On output, the number of spans.
+     *
+     * @retval kErrorNone     Successfully got the spans. @p aNumSpans is updated.
+     * @retval kErrorParse    The offset range extends beyond the end of the message.
+     * @retval kErrorNoBufs   The @p aSpans array is too small to cover the entire offset range.
+     */
+    Error GetSpans(const OffsetRange &aOffsetRange, otMessageSpan *aSpans, uint16_t &aNumSpans) const;
+
     /**
      * Reads a given number of bytes from the message.
      *
@@ -1391,9 +1435,11 @@ public:
     /**
      * Sets the message origin.
      *
+     * The buffers of the message are accounted to the new origin in the `MessagePool` buffer usage.
+     *
      * @param[in]  aOrigin  An enum representing the origin of the message.
      */
-    void SetOrigin(Origin aOrigin) { GetMetadata().mOrigin = aOrigin; }
+    void SetOrigin(Origin aOrigin);
 
     /**
      * Indicates whether or not the message origin is Thread Netif.
@@ -1663,6 +1709,117 @@ private:
         AsConst(this)->GetNextChunk(aLength, static_cast<Chunk &>(aChunk));
     }
 
+public:
+    /**
+     * Iterates over the spans covering an offset range in a message.
+     *
+     * Each span is a contiguous sequence of message bytes stored in a single message buffer. This allows the message
+     * content to be consumed directly from the message buffers without copying it. If the offset range extends beyond
+     * the end of the message, only the available bytes are covered.
+     */
+    class SpanIterator
+    {
+    public:
+        /**
+         * Initializes the `SpanIterator` and positions it at the first span.
+         *
+         * @param[in] aMessage      The message.
+         * @param[in] aOffsetRange  The offset range in @p aMessage to iterate over.
+         */
+        SpanIterator(const Message &aMessage, const OffsetRange &aOffsetRange)
+            : SpanIterator(aMessage, aOffsetRange.GetOffset(), aOffsetRange.GetLength())
+        {
+        }
+
+        /**
+         * Initializes the `SpanIterator` and positions it at the first span.
+         *
+         * @param[in] aMessage  The message.
+         * @param[in] aOffset   The start offset in @p aMessage.
+         * @param[in] aLength   The number of bytes to iterate over.
+         */
+        SpanIterator(const Message &aMessage, uint16_t aOffset, uint16_t aLength)
+            : mMessage(aMessage)
+            , mLength(aLength)
+        {
+            mMessage.GetFirstChunk(aOffset, mLength, mChunk);
+        }
+
+        /**
+         * Indicates whether the iterator has reached the end (there are no more spans).
+         *
+         * @retval TRUE   The iterator has reached the end.
+         * @retval FALSE  The iterator is positioned at a span.
+         */
+        bool IsDone(void) const { return mChunk.GetLength() == 0; }
+
+        /**
+         * Gets a pointer to the bytes of the current span.
+         *
+         * @returns A pointer to the bytes of the current span.
+         */
+        const uint8_t *GetBytes(void) const { return mChunk.GetBytes(); }
+
+        /**
+         * Gets the length (number of bytes) of the current span.
+         *
+         * @returns The length of the current span.
+         */
+        uint16_t GetLength(void) const { return mChunk.GetLength(); }
+
+        /**
+         * Advances the iterator to the next span.
+         */
+        void Advance(void) { mMessage.GetNextChunk(mLength, mChunk); }
+
+    protected:
+        uint8_t *GetMutableBytes(void) const { return AsNonConst(mChunk.GetBytes()); }
+
+    private:
+        const Message &mMessage;
+        uint16_t       mLength;
+        Chunk          mChunk;
+    };
+
+    /**
+     * Iterates over the spans covering an offset range in a message, allowing the spans to be modified in place.
+     */
+    class MutableSpanIterator : public SpanIterator
+    {
+    public:
+        /**
+         * Initializes the `MutableSpanIterator` and positions it at the first span.
+         *
+         * @param[in] aMessage      The message.
+         * @param[in] aOffsetRange  The offset range in @p aMessage to iterate over.
+         */
+        MutableSpanIterator(Message &aMessage, const OffsetRange &aOffsetRange)
+            : SpanIterator(aMessage.PrepareWrite(aOffsetRange.GetOffset(), aOffsetRange.GetLength()), aOffsetRange)
+        {
+        }
+
+        /**
+         * Initializes the `MutableSpanIterator` and positions it at the first span.
+         *
+         * @param[in] aMessage  The message.
+         * @param[in] aOffset   The start offset in @p aMessage.
+         * @param[in] aLength   The number of bytes to iterate over.
+         */
+        MutableSpanIterator(Message &aMessage, uint16_t aOffset, uint16_t aLength)
+            : SpanIterator(aMessage.PrepareWrite(aOffset, aLength), aOffset, aLength)
+        {
+        }
+
+        /**
+         * Gets a pointer to the bytes of the current span.
+         *
+         * @returns A pointer to the bytes of the current span.
+         */
+        uint8_t *GetBytes(void) { return GetMutableBytes(); }
+    };
+
+private:
+
     void MarkAsNotInAQueue(void);
     bool IsInAQueue(void) const { return (Prev() != this); }
     bool IsInAPriorityQueue(void) const { return GetMetadata().mInPriorityQ; }
@@ -1679,6 +1836,14 @@ private:
     static const Message *NextOf(const Message *aMessage) { return (aMessage != nullptr) ? aMessage->Next() : nullptr; }
 
     Error ResizeMessage(uint16_t aLength);
+    void  CopyInfoFrom(const Message &aMessage);
+
+#if OPENTHREAD_CONFIG_MESSAGE_NUM_SHARED_BUFFER_CHAINS > 0
+    bool     HasSharedBuffers(void) const { return GetMetadata().mSharedChain != 0; }
+    Message &PrepareWrite(uint16_t aOffset, uint16_t aLength);
+#else
+    Message &PrepareWrite(uint16_t, uint16_t) { return *this; }
+#endif
 };
 
 /**
@@ -2030,25 +2195,126 @@ public:
      *
      * @sa GetMaxUsedBufferCount
      */
-    void ResetMaxUsedBufferCount(void) { mMaxAllocated = mNumAllocated; }
+    void ResetMaxUsedBufferCount(void);
+
+    /**
+     * Represents the buffer usage per message priority level and per message origin.
+     */
+    class Usage : public otMessagePoolUsage, public Clearable<Usage>
+    {
+    };
+
+    /**
+     * Represents the buffer reservations and quotas.
+     */
+    class Quotas : public otMessagePoolQuotas, public Clearable<Quotas>
+    {
+    };
+
+    /**
+     * Gets the buffer usage per message priority level and per message origin.
+     *
+     * @param[out] aUsage   A reference to a `Usage` to output the buffer usage.
+     */
+    void GetUsage(Usage &aUsage) const;
+
+    /**
+     * Gets the buffer reservations and quotas.
+     *
+     * @param[out] aQuotas   A reference to a `Quotas` to output the reservations and quotas.
+     */
+    void GetQuotas(Quotas &aQuotas) const { aQuotas = mQuotas; }
+
+    /**
+     * Sets the buffer reservations and quotas.
+     *
+     * A new buffer for a message is only allocated if the origin of the message is within its quota and enough free
+     * buffers remain for the unused part of the reservations of the priority levels above the message priority.
+     *
+     * @param[in] aQuotas   The reservations and quotas.
+     *
+     * @retval kErrorNone         Successfully set the reservations and quotas.
+     * @retval kErrorInvalidArgs  The reservations together are not smaller than the total number of buffers.
+     */
+    Error SetQuotas(const Quotas &aQuotas);
+
+#if OPENTHREAD_CONFIG_MESSAGE_NUM_SHARED_BUFFER_CHAINS > 0
+    /**
+     * Represents the counters of the message buffers shared between messages.
+     */
+    class SharingCounters : public otMessageSharingCounters, public Clearable<SharingCounters>
+    {
+    };
+
+    /**
+     * Gets the counters of the message buffers shared between messages.
+     *
+     * @returns The buffer sharing counters.
+     */
+    const SharingCounters &GetSharingCounters(void) const { return mSharingCounters; }
+#endif
 
 private:
     static constexpr uint16_t kNumBuffers = OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS;
 
-    Buffer *NewBuffer(Message::Priority aPriority);
-    void    FreeBuffers(Buffer *aBuffer);
-    Error   ReclaimBuffers(Message::Priority aPriority);
+    typedef otMessageBufferUsage BufferUsage;
+
+    Buffer  *NewBuffer(Message::Priority aPriority, Message::Origin aOrigin);
+    void     FreeBuffers(Buffer *aBuffer, Message::Priority aPriority, Message::Origin aOrigin);
+    Error    ReclaimBuffers(Message::Priority aPriority);
+    Buffer  *AllocateBuffer(void);
+    void     ReleaseBuffer(Buffer &aBuffer);
+    bool     IsAdmitted(Message::Priority aPriority, Message::Origin aOrigin) const;
+    uint16_t GetHeadroom(Message::Priority aPriority) const;
+    uint16_t GetReservedBufferCount(uint8_t aPriority) const;
+    uint16_t GetMaxBufferCount(Message::Origin aOrigin) const;
+    void     UpdateBufferUsage(const Message &aMessage, Message::Priority aPriority, Message::Origin aOrigin);
+    void     AddBufferUsage(Message::Priority aPriority, Message::Origin aOrigin, uint16_t aNumBuffers);
+    void     RemoveBufferUsage(Message::Priority aPriority, Message::Origin aOrigin, uint16_t aNumBuffers);
+
+    static void AddBufferUsage(BufferUsage &aUsage, uint16_t aNumBuffers);
+
+#if OPENTHREAD_CONFIG_MESSAGE_NUM_SHARED_BUFFER_CHAINS > 0
+    static constexpr uint16_t kNumSharedChains = OPENTHREAD_CONFIG_MESSAGE_NUM_SHARED_BUFFER_CHAINS;
+
+    static_assert(kNumSharedChains <= 255, "OPENTHREAD_CONFIG_MESSAGE_NUM_SHARED_BUFFER_CHAINS is too large");
+
+    struct SharedChain
+    {
+        Buffer           *mBuffers;    // The first buffer of the chain (`nullptr` if the entry is unused).
+        uint16_t          mNumBuffers; // The number of buffers in the chain.
+        uint16_t          mNumRefs;    // The number of messages sharing the chain.
+        Message::Priority mPriority;   // The priority the chain buffers are accounted for.
+        Message::Origin   mOrigin;     // The origin the chain buffers are accounted for.
+    };
+
+    Message     *CloneSharingBuffers(const Message &aMessage);
+    void         UnshareBuffers(Message &aMessage);
+    void         ReleaseSharedBuffers(Message &aMessage);
+    SharedChain &GetSharedChain(const Message &aMessage);
+    uint16_t     GetPrivateSize(const Message &aMessage);
+    Buffer      *GetLastPrivateBuffer(Message &aMessage);
+#endif
 
 #if !OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT && !OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE
     Pool<Buffer, kNumBuffers> mBufferPool;
 #endif
-    uint16_t mNumAllocated;
-    uint16_t mMaxAllocated;
+    uint16_t    mNumAllocated;
+    uint16_t    mMaxAllocated;
+    Quotas      mQuotas;
+    BufferUsage mPriorityUsage[Message::kNumPriorities];
+    BufferUsage mOriginUsage[Message::kNumOrigins];
+#if OPENTHREAD_CONFIG_MESSAGE_NUM_SHARED_BUFFER_CHAINS > 0
+    SharedChain     mSharedChains[kNumSharedChains];
+    uint16_t        mNumUnshareBuffers; // The number of free buffers kept to copy the shared buffers.
+    SharingCounters mSharingCounters;
+#endif
 };
 
 // Declare specializations of `Message::Clone<CloneMode>()` (implemented in `message.cpp`).
 template <> Message *Message::Clone<kNoReservedHeader>(void) const;
 template <> Message *Message::Clone<kSameReservedHeader>(void) const;
+template <> Message *Message::Clone<kShareBuffers>(void) const;
 template <> Message *Message::Clone<kNoReservedHeader>(uint16_t aLength) const;
 template <> Message *Message::Clone<kSameReservedHeader>(uint16_t aLength) const;
 
@@ -2057,9 +2323,10 @@ template <> Message *Message::Clone<kSameReservedHeader>(uint16_t aLength) const
  */
 
 DefineCoreType(otMessageBuffer, Buffer);
-DefineCoreType(otMessageSettings, Message::Settings);
 DefineCoreType(otMessage, Message);
 DefineCoreType(otMessageQueue, MessageQueue);
+DefineCoreType(otMessagePoolUsage, MessagePool::Usage);
+DefineCoreType(otMessagePoolQuotas, MessagePool::Quotas);
 
 DefineMapEnum(otMessageOrigin, Message::Origin);
 
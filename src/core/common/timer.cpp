@@ -33,6 +33,7 @@
 
 #include "timer.hpp"
 
+#include "common/serial_number.hpp"
 #include "instance/instance.hpp"
 
 namespace ot {
@@ -152,6 +153,210 @@ void TimerMilli::RemoveAll(Instance &aInstance) { aInstance.Get<Scheduler>().Rem
 //---------------------------------------------------------------------------------------------------------------------
 // `Timer::Scheduler`
 
+Timer *Timer::Scheduler::GetHead(void) const
+{
+#if OPENTHREAD_CONFIG_TIMER_SCHEDULER_HEAP_ENABLE
+    return mHeapRoot;
+#else
+    return AsNonConst(mTimerList.GetHead());
+#endif
+}
+
+#if OPENTHREAD_CONFIG_TIMER_SCHEDULER_HEAP_ENABLE
+
+bool Timer::Scheduler::IsBefore(const Timer &aFirst, const Timer &aSecond, Time aNow)
+{
+    // Timers with the same fire time are ordered by the sequence
+    // number assigned when they were added, so that they fire in
+    // the same order as with the sorted list.
+
+    bool retval = aFirst.DoesFireBefore(aSecond, aNow);
+
+    if (!retval && !aSecond.DoesFireBefore(aFirst, aNow))
+    {
+        retval = SerialNumber::IsLess(aFirst.mSeqNumber, aSecond.mSeqNumber);
+    }
+
+    return retval;
+}
+
+Timer *Timer::Scheduler::Meld(Timer *aFirst, Timer *aSecond, Time aNow)
+{
+    // Melds two heap roots (with no siblings) and returns the
+    // new root. The root which fires later becomes the left-most
+    // child of the other.
+
+    if (IsBefore(*aSecond, *aFirst, aNow))
+    {
+        Timer *temp = aFirst;
+
+        aFirst  = aSecond;
+        aSecond = temp;
+    }
+
+    aSecond->mPrev = aFirst;
+    aSecond->mNext = aFirst->mChild;
+
+    if (aFirst->mChild != nullptr)
+    {
+        aFirst->mChild->mPrev = aSecond;
+    }
+
+    aFirst->mChild = aSecond;
+
+    return aFirst;
+}
+
+Timer *Timer::Scheduler::MergePairs(Timer *aFirstSibling, Time aNow)
+{
+    // Standard two-pass pairing: meld siblings in pairs from left
+    // to right (collecting the results in reverse order), then meld
+    // the results from right to left into a single root.
+
+    Timer *pairs = nullptr;
+    Timer *root  = nullptr;
+
+    while (aFirstSibling != nullptr)
+    {
+        Timer *first  = aFirstSibling;
+        Timer *second = first->mNext;
+
+        aFirstSibling = (second != nullptr) ? second->mNext : nullptr;
+
+        first->mPrev = nullptr;
+        first->mNext = nullptr;
+
+        if (second != nullptr)
+        {
+            second->mPrev = nullptr;
+            second->mNext = nullptr;
+            first         = Meld(first, second, aNow);
+        }
+
+        first->mNext = pairs;
+        pairs        = first;
+    }
+
+    while (pairs != nullptr)
+    {
+        Timer *next = pairs->mNext;
+
+        pairs->mNext = nullptr;
+        root         = (root == nullptr) ? pairs : Meld(root, pairs, aNow);
+        pairs        = next;
+    }
+
+    return root;
+}
+
+void Timer::Scheduler::Add(Timer &aTimer, const AlarmApi &aAlarmApi)
+{
+    Time now(aAlarmApi.AlarmGetNow());
+
+    Remove(aTimer, aAlarmApi);
+
+    aTimer.mNext      = nullptr;
+    aTimer.mPrev      = nullptr;
+    aTimer.mChild     = nullptr;
+    aTimer.mSeqNumber = mSeqNumber++;
+
+    mHeapRoot = (mHeapRoot == nullptr) ? &aTimer : Meld(mHeapRoot, &aTimer, now);
+
+    if (mHeapRoot == &aTimer)
+    {
+        SetAlarm(aAlarmApi);
+    }
+}
+
+void Timer::Scheduler::Remove(Timer &aTimer, const AlarmApi &aAlarmApi)
+{
+    Time   now(aAlarmApi.AlarmGetNow());
+    Timer *subHeap;
+
+    VerifyOrExit(aTimer.IsRunning());
+
+    subHeap = MergePairs(aTimer.mChild, now);
+
+    if (mHeapRoot == &aTimer)
+    {
+        mHeapRoot = subHeap;
+        SetAlarm(aAlarmApi);
+    }
+    else
+    {
+        Timer *oldRoot = mHeapRoot;
+
+        if (aTimer.mPrev->mChild == &aTimer)
+        {
+            aTimer.mPrev->mChild = aTimer.mNext;
+        }
+        else
+        {
+            aTimer.mPrev->mNext = aTimer.mNext;
+        }
+
+        if (aTimer.mNext != nullptr)
+        {
+            aTimer.mNext->mPrev = aTimer.mPrev;
+        }
+
+        if (subHeap != nullptr)
+        {
+            mHeapRoot = Meld(mHeapRoot, subHeap, now);
+        }
+
+        if (mHeapRoot != oldRoot)
+        {
+            SetAlarm(aAlarmApi);
+        }
+    }
+
+    aTimer.mChild = nullptr;
+    aTimer.mPrev  = nullptr;
+    aTimer.SetNext(&aTimer);
+
+exit:
+    return;
+}
+
+void Timer::Scheduler::RemoveAll(const AlarmApi &aAlarmApi)
+{
+    // Walks the heap using `mPrev` as the link of a stack of timers
+    // still to visit. A timer's siblings are always pushed (by its
+    // parent) before the timer itself is visited, so its `mNext`
+    // can be safely reset once it is popped.
+
+    Timer *stack = mHeapRoot;
+
+    if (stack != nullptr)
+    {
+        stack->mPrev = nullptr;
+    }
+
+    mHeapRoot = nullptr;
+
+    while (stack != nullptr)
+    {
+        Timer *timer = stack;
+
+        stack = timer->mPrev;
+
+        for (Timer *child = timer->mChild; child != nullptr; child = child->mNext)
+        {
+            child->mPrev = stack;
+            stack        = child;
+        }
+
+        timer->mChild = nullptr;
+        timer->mPrev  = nullptr;
+        timer->SetNext(timer);
+    }
+
+    SetAlarm(aAlarmApi);
+}
+
+#else // OPENTHREAD_CONFIG_TIMER_SCHEDULER_HEAP_ENABLE
+
 void Timer::Scheduler::Add(Timer &aTimer, const AlarmApi &aAlarmApi)
 {
     Timer *prev = nullptr;
@@ -200,9 +405,25 @@ exit:
     return;
 }
 
+void Timer::Scheduler::RemoveAll(const AlarmApi &aAlarmApi)
+{
+    Timer *timer;
+
+    while ((timer = mTimerList.Pop()) != nullptr)
+    {
+        timer->SetNext(timer);
+    }
+
+    SetAlarm(aAlarmApi);
+}
+
+#endif // OPENTHREAD_CONFIG_TIMER_SCHEDULER_HEAP_ENABLE
+
 void Timer::Scheduler::SetAlarm(const AlarmApi &aAlarmApi)
 {
-    if (mTimerList.IsEmpty())
+    Timer *head = GetHead();
+
+    if (head == nullptr)
     {
         aAlarmApi.AlarmStop(&GetInstance());
     }
@@ -211,7 +432,7 @@ void Timer::Scheduler::SetAlarm(const AlarmApi &aAlarmApi)
         Time     now(aAlarmApi.AlarmGetNow());
         uint32_t remaining;
 
-        remaining = mTimerList.GetHead()->mFireTime.DetermineRemainingDurationFrom(now);
+        remaining = head->mFireTime.DetermineRemainingDurationFrom(now);
 
         aAlarmApi.AlarmStartAt(&GetInstance(), now.GetValue(), remaining);
     }
@@ -219,7 +440,7 @@ void Timer::Scheduler::SetAlarm(const AlarmApi &aAlarmApi)
 
 void Timer::Scheduler::ProcessTimers(const AlarmApi &aAlarmApi)
 {
-    Timer *timer = mTimerList.GetHead();
+    Timer *timer = GetHead();
 
     if (timer)
     {
@@ -239,18 +460,6 @@ exit:
     return;
 }
 
-void Timer::Scheduler::RemoveAll(const AlarmApi &aAlarmApi)
-{
-    Timer *timer;
-
-    while ((timer = mTimerList.Pop()) != nullptr)
-    {
-        timer->SetNext(timer);
-    }
-
-    SetAlarm(aAlarmApi);
-}
-
 extern "C" void otPlatAlarmMilliFired(otInstance *aInstance)
 {
     VerifyOrExit(otInstanceIsInitialized(aInstance));
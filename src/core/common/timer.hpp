@@ -224,22 +224,48 @@ protected:
 
         explicit Scheduler(Instance &aInstance)
             : InstanceLocator(aInstance)
+#if OPENTHREAD_CONFIG_TIMER_SCHEDULER_HEAP_ENABLE
+            , mHeapRoot(nullptr)
+            , mSeqNumber(0)
+#endif
         {
         }
 
-        void Add(Timer &aTimer, const AlarmApi &aAlarmApi);
-        void Remove(Timer &aTimer, const AlarmApi &aAlarmApi);
-        void RemoveAll(const AlarmApi &aAlarmApi);
-        void ProcessTimers(const AlarmApi &aAlarmApi);
-        void SetAlarm(const AlarmApi &aAlarmApi);
-
+        void   Add(Timer &aTimer, const AlarmApi &aAlarmApi);
+        void   Remove(Timer &aTimer, const AlarmApi &aAlarmApi);
+        void   RemoveAll(const AlarmApi &aAlarmApi);
+        void   ProcessTimers(const AlarmApi &aAlarmApi);
+        void   SetAlarm(const AlarmApi &aAlarmApi);
+        Timer *GetHead(void) const;
+
+#if OPENTHREAD_CONFIG_TIMER_SCHEDULER_HEAP_ENABLE
+        // The running timers are kept in an intrusive pairing heap
+        // ordered by fire time, with ties broken by the order in
+        // which timers were added (same as the sorted list). In the
+        // heap, `mNext` links a timer to its right sibling, `mChild`
+        // to its left-most child, and `mPrev` to its left sibling or
+        // (for a left-most child) its parent.
+
+        static bool   IsBefore(const Timer &aFirst, const Timer &aSecond, Time aNow);
+        static Timer *Meld(Timer *aFirst, Timer *aSecond, Time aNow);
+        static Timer *MergePairs(Timer *aFirstSibling, Time aNow);
+
+        Timer   *mHeapRoot;
+        uint32_t mSeqNumber;
+#else
         LinkedList<Timer> mTimerList;
+#endif
     };
 
     Timer(Instance &aInstance, Handler aHandler)
         : InstanceLocator(aInstance)
         , mHandler(aHandler)
         , mNext(this)
+#if OPENTHREAD_CONFIG_TIMER_SCHEDULER_HEAP_ENABLE
+        , mChild(nullptr)
+        , mPrev(nullptr)
+        , mSeqNumber(0)
+#endif
     {
     }
 
@@ -249,6 +275,11 @@ protected:
     Handler mHandler;
     Time    mFireTime;
     Timer  *mNext;
+#if OPENTHREAD_CONFIG_TIMER_SCHEDULER_HEAP_ENABLE
+    Timer   *mChild;
+    Timer   *mPrev;
+    uint32_t mSeqNumber;
+#endif
 };
 
 extern "C" void otPlatAlarmMilliFired(otInstance *aInstance);
@@ -54,6 +54,32 @@
 #define OPENTHREAD_CONFIG_COAP_SERVER_MAX_CACHED_RESPONSES 10
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_COAP_RESOURCE_TABLE_SIZE
+ *
+ * Number of lists (selected by the hash of the URI path) over which the resources of a CoAP agent are distributed.
+ *
+ * A received request only compares its URI path against the resources in one list.
+ */
+#ifndef OPENTHREAD_CONFIG_COAP_RESOURCE_TABLE_SIZE
+#define OPENTHREAD_CONFIG_COAP_RESOURCE_TABLE_SIZE 8
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_COAP_PENDING_REQUEST_INDEX_SIZE
+ *
+ * Maximum number of pending requests of a CoAP agent indexed by message ID and token.
+ *
+ * When more requests are pending, a received message whose message ID or token shares an index bucket with a request
+ * which could not be indexed is matched by searching through all the pending requests.
+ *
+ * Each entry uses about 20 bytes of RAM (24 bytes on 64-bit platforms). Devices which keep many requests pending
+ * (e.g., a border agent or a commissioner) may increase it.
+ */
+#ifndef OPENTHREAD_CONFIG_COAP_PENDING_REQUEST_INDEX_SIZE
+#define OPENTHREAD_CONFIG_COAP_PENDING_REQUEST_INDEX_SIZE 16
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_COAP_API_ENABLE
  *
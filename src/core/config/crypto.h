@@ -68,6 +68,19 @@
 #define OPENTHREAD_CONFIG_CRYPTO_PLATFORM_ALLOCS_CONTEXT 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_AES_KEY_SCHEDULE_CACHE_SIZE
+ *
+ * Specifies the number of AES key schedules (AES contexts with their key already set) cached by `KeyManager` for the
+ * MLE keys and the MAC key ID mode 1 keys, so that the AES key is not set up again for every secured frame or MLE
+ * message. Each entry holds one AES context. MUST be at least one.
+ *
+ * Cached key schedules are only reused when `OPENTHREAD_CONFIG_PLATFORM_KEY_REFERENCES_ENABLE` is not enabled.
+ */
+#ifndef OPENTHREAD_CONFIG_AES_KEY_SCHEDULE_CACHE_SIZE
+#define OPENTHREAD_CONFIG_AES_KEY_SCHEDULE_CACHE_SIZE 4
+#endif
+
 #if OPENTHREAD_CONFIG_CRYPTO_LIB == OPENTHREAD_CONFIG_CRYPTO_LIB_PLATFORM
 
 /**
@@ -207,6 +207,34 @@
 #define OPENTHREAD_CONFIG_TCP_ENABLE 1
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_UDP_SOCKET_INDEX_SIZE
+ *
+ * Number of slots of the hash index (by local port) over the bound UDP sockets. Zero disables the index.
+ *
+ * When enabled, a received UDP datagram is only matched against the sockets bound to its destination port instead of
+ * all the open sockets. At most three quarters of the slots are used. When more sockets are bound, received datagrams
+ * are matched by searching through all the open sockets until enough of them are closed.
+ */
+#ifndef OPENTHREAD_CONFIG_UDP_SOCKET_INDEX_SIZE
+#define OPENTHREAD_CONFIG_UDP_SOCKET_INDEX_SIZE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_TCP_INDEX_SIZE
+ *
+ * Number of slots of the hash indices of the connected TCP endpoints (by their ports and peer address) and of the
+ * listening TCP listeners (by their port). Zero disables the indices.
+ *
+ * When enabled, a received TCP segment is only matched against the endpoints connected with the same ports and peer
+ * address and against the listeners on its destination port, instead of all the initialized endpoints and listeners.
+ * At most three quarters of the slots are used. When more endpoints are connected (or more listeners are listening),
+ * segments are matched by searching through all of them until enough of them are closed.
+ */
+#ifndef OPENTHREAD_CONFIG_TCP_INDEX_SIZE
+#define OPENTHREAD_CONFIG_TCP_INDEX_SIZE 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_TLS_ENABLE
  *
@@ -143,6 +143,33 @@
 #define OPENTHREAD_CONFIG_VERHOEFF_CHECKSUM_ENABLE OPENTHREAD_CONFIG_BORDER_AGENT_EPHEMERAL_KEY_ENABLE
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_TIMER_SCHEDULER_HEAP_ENABLE
+ *
+ * Define to 1 to use a pairing heap (instead of a sorted linked list) to track the running `TimerMilli` and
+ * `TimerMicro` timers.
+ *
+ * With the heap, starting or stopping a timer takes O(log n) amortized time instead of O(n), where n is the number of
+ * running timers. Timers fire in the same order with both schemes. The heap adds two pointers and a sequence number to
+ * every timer object, so it is intended for devices (e.g., border routers) with many concurrently running timers.
+ */
+#ifndef OPENTHREAD_CONFIG_TIMER_SCHEDULER_HEAP_ENABLE
+#define OPENTHREAD_CONFIG_TIMER_SCHEDULER_HEAP_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_CRC_LOOKUP_TABLE_ENABLE
+ *
+ * Define to 1 to use compile-time generated lookup tables in `CrcCalculator` for the well-known CRC16-CCITT,
+ * CRC16-ANSI and CRC32-ANSI polynomials (with slicing-by-8 when feeding multiple bytes).
+ *
+ * This speeds up CRC calculation over large data at the cost of about 16 KB of read-only data. When disabled, the
+ * CRC is calculated bit by bit.
+ */
+#ifndef OPENTHREAD_CONFIG_CRC_LOOKUP_TABLE_ENABLE
+#define OPENTHREAD_CONFIG_CRC_LOOKUP_TABLE_ENABLE 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_MULTIPLE_INSTANCE_ENABLE
  *
@@ -199,6 +226,55 @@
 #define OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS 44
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MESSAGE_POOL_RESERVED_HIGH_PRIORITY_BUFFERS
+ *
+ * The default number of message buffers reserved for high priority messages, which low and normal priority messages
+ * cannot use.
+ *
+ * The reservations and quotas can be changed at run-time using `otMessageSetPoolQuotas()`.
+ */
+#ifndef OPENTHREAD_CONFIG_MESSAGE_POOL_RESERVED_HIGH_PRIORITY_BUFFERS
+#define OPENTHREAD_CONFIG_MESSAGE_POOL_RESERVED_HIGH_PRIORITY_BUFFERS 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MESSAGE_POOL_RESERVED_NET_PRIORITY_BUFFERS
+ *
+ * The default number of message buffers reserved for network control messages (e.g., MLE), which all other messages
+ * cannot use. Keeps a burst of data messages (e.g., a UDP flood from host) from starving MLE.
+ */
+#ifndef OPENTHREAD_CONFIG_MESSAGE_POOL_RESERVED_NET_PRIORITY_BUFFERS
+#define OPENTHREAD_CONFIG_MESSAGE_POOL_RESERVED_NET_PRIORITY_BUFFERS 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MESSAGE_POOL_MAX_HOST_UNTRUSTED_BUFFERS
+ *
+ * The default maximum number of message buffers used by messages from an untrusted source on host. Zero indicates
+ * no limit.
+ */
+#ifndef OPENTHREAD_CONFIG_MESSAGE_POOL_MAX_HOST_UNTRUSTED_BUFFERS
+#define OPENTHREAD_CONFIG_MESSAGE_POOL_MAX_HOST_UNTRUSTED_BUFFERS 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MESSAGE_NUM_SHARED_BUFFER_CHAINS
+ *
+ * The maximum number of buffer chains shared between messages at the same time. Zero disables buffer sharing.
+ *
+ * A message cloned on a multi-consumer path (e.g., a multicast datagram passed to the host and received locally)
+ * then references the buffers of the original message after its first buffer instead of copying them. The shared
+ * buffers are copied when a message sharing them is modified (copy-on-write). The buffers needed for the copies are
+ * kept free in the buffer pool, so modifying a message never fails due to buffer sharing.
+ *
+ * Requires the message buffers to be allocated from the OpenThread buffer pool, i.e., it cannot be used with
+ * OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE or OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT.
+ */
+#ifndef OPENTHREAD_CONFIG_MESSAGE_NUM_SHARED_BUFFER_CHAINS
+#define OPENTHREAD_CONFIG_MESSAGE_NUM_SHARED_BUFFER_CHAINS 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_MESSAGE_BUFFER_SIZE
  *
@@ -310,6 +386,24 @@
 #endif
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_HEAP_SLAB_ENABLE
+ *
+ * Define to 1 to enable the size-class slab layer of the internal heap.
+ *
+ * Small allocations are then served from slabs, i.e., heap blocks divided into equal size chunks of a few size
+ * classes. Allocating and freeing a chunk does not walk the free block list, and the many small, short-lived objects
+ * (e.g., heap strings and SRP server entries) no longer fragment the heap. A slab is returned to the heap once all of
+ * its chunks are freed.
+ *
+ * A slab holds 16 chunks and stays allocated while any of its chunks is in use, e.g., a single 64-byte allocation
+ * keeps about 1.1 KB of the heap. Free chunks of a slab are not included in `Heap::GetFreeSize()`. So this is
+ * intended for large internal heaps with many small allocations.
+ */
+#ifndef OPENTHREAD_CONFIG_HEAP_SLAB_ENABLE
+#define OPENTHREAD_CONFIG_HEAP_SLAB_ENABLE 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_MESHCOP_STEERING_DATA_API_ENABLE
  *
@@ -569,6 +663,18 @@
 #define OPENTHREAD_CONFIG_ALLOW_EMPTY_NETWORK_NAME 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_DNS_NAME_COMPRESS_DICTIONARY_SIZE
+ *
+ * Specifies the number of entries in a DNS name compression dictionary (`Dns::Name::CompressDictionary`).
+ *
+ * Each entry maps the hash of a name (or name suffix) appended in a DNS message to its offset. This many entries are
+ * kept in the dictionary itself. Further entries are allocated from the heap as needed.
+ */
+#ifndef OPENTHREAD_CONFIG_DNS_NAME_COMPRESS_DICTIONARY_SIZE
+#define OPENTHREAD_CONFIG_DNS_NAME_COMPRESS_DICTIONARY_SIZE 32
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_OPERATIONAL_DATASET_AUTO_INIT
  *
@@ -82,6 +82,50 @@
 #define OPENTHREAD_CONFIG_MLE_IP_ADDRS_PER_CHILD 4
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+ *
+ * Define as 1 to maintain indices over the child table mapping RLOC16, extended address and registered IPv6 addresses
+ * to child entries.
+ *
+ * When enabled, finding a child by its MAC or IPv6 address (e.g., when forwarding a frame or a message) no longer scans
+ * the whole child table. This is intended for parents with a large `OPENTHREAD_CONFIG_MLE_MAX_CHILDREN`. The indices
+ * use about `6 * OPENTHREAD_CONFIG_MLE_MAX_CHILDREN * (OPENTHREAD_CONFIG_MLE_IP_ADDRS_PER_CHILD + 2)` bytes of
+ * additional RAM.
+ */
+#ifndef OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+#define OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MLE_ROUTE_CACHE_ENABLE
+ *
+ * Define as 1 for `RouterTable` to cache the next hop and path cost towards each router ID.
+ *
+ * When enabled and the device is a router or leader, determining the next hop towards a router (e.g., for every
+ * forwarded mesh frame) reads the cached entry. An entry is recomputed on its next lookup after the next hop or cost
+ * of the router changes, or after the state or link quality of a neighbor changes. The cache uses about
+ * `4 * (OT_NETWORK_MAX_ROUTER_ID + 1)` bytes of additional RAM.
+ */
+#ifndef OPENTHREAD_CONFIG_MLE_ROUTE_CACHE_ENABLE
+#define OPENTHREAD_CONFIG_MLE_ROUTE_CACHE_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_NETDATA_LOOKUP_TABLE_ENABLE
+ *
+ * Define as 1 for `NetworkData::Leader` to keep a lookup table compiled from the Prefix TLVs in the Network Data.
+ *
+ * When enabled, the route, on-mesh and 6LoWPAN context lookups (e.g., for every forwarded or compressed IPv6 message)
+ * use the lookup table instead of parsing the Network Data TLVs. The table is rebuilt on the first lookup after the
+ * Network Data changes. It uses about 2 KB of additional RAM. When
+ * `OPENTHREAD_CONFIG_BORDER_ROUTER_SIGNAL_NETWORK_DATA_FULL` is enabled, this also adds to the stack usage when
+ * checking whether the Network Data is getting full.
+ */
+#ifndef OPENTHREAD_CONFIG_NETDATA_LOOKUP_TABLE_ENABLE
+#define OPENTHREAD_CONFIG_NETDATA_LOOKUP_TABLE_ENABLE 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_MLE_DEVICE_PROPERTY_LEADER_WEIGHT_ENABLE
  *
@@ -702,4 +702,11 @@
 #error "OPENTHREAD_CONFIG_MLE_IP_ADDRS_TO_REGISTER is removed. All addresses are now registered."
 #endif
 
+// Copy-on-write of shared buffers relies on the buffer pool keeping enough free buffers for the copies, which cannot
+// be checked when the buffers come from the heap or the platform.
+#if (OPENTHREAD_CONFIG_MESSAGE_NUM_SHARED_BUFFER_CHAINS > 0) && \
+    (OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE || OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT)
+#error "OPENTHREAD_CONFIG_MESSAGE_NUM_SHARED_BUFFER_CHAINS requires message buffers from the OpenThread buffer pool."
+#endif
+
 #endif // OT_CORE_CONFIG_OPENTHREAD_CORE_CONFIG_CHECK_H_
@@ -138,6 +138,19 @@
 #define OPENTHREAD_CONFIG_SRP_SERVER_FAST_START_MODE_ENABLE 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_SIZE
+ *
+ * Specifies the number of hash buckets used by SRP server to index the registered hosts (by host name) and services
+ * (by service instance name and by service name).
+ *
+ * The index is used when processing SRP updates and when the DNS-SD server resolves queries using the SRP server
+ * entries, avoiding a search through all hosts and services.
+ */
+#ifndef OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_SIZE
+#define OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_SIZE 64
+#endif
+
 /**
  * @}
  */
@@ -59,6 +59,19 @@
 #endif
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE
+ *
+ * Define as 1 to maintain a hash index over the EID-to-RLOC cache entries.
+ *
+ * When enabled, looking up an EID in the address cache no longer scans all the cache entry lists. This is intended for
+ * devices with a large `OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_ENTRIES` (e.g., border routers). The index uses about
+ * `12 * OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_ENTRIES` bytes of additional RAM.
+ */
+#ifndef OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE
+#define OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_MAX_SNOOP_ENTRIES
  *
@@ -36,6 +36,7 @@
 #include "common/code_utils.hpp"
 #include "common/debug.hpp"
 #include "common/encoding.hpp"
+#include "common/num_utils.hpp"
 
 namespace ot {
 namespace Crypto {
@@ -119,7 +120,7 @@ void AesCcm::Init(uint32_t    aHeaderLength,
     }
 
     // encrypt initial block
-    mEcb.Encrypt(mBlock, mBlock);
+    mKeyedEcb->Encrypt(mBlock, mBlock);
 
     // process header
     if (aHeaderLength > 0)
@@ -167,7 +168,7 @@ void AesCcm::Header(const void *aHeader, uint32_t aHeaderLength)
     {
         if (mBlockLength == sizeof(mBlock))
         {
-            mEcb.Encrypt(mBlock, mBlock);
+            mKeyedEcb->Encrypt(mBlock, mBlock);
             mBlockLength = 0;
         }
 
@@ -181,7 +182,7 @@ void AesCcm::Header(const void *aHeader, uint32_t aHeaderLength)
         // process remainder
         if (mBlockLength != 0)
         {
-            mEcb.Encrypt(mBlock, mBlock);
+            mKeyedEcb->Encrypt(mBlock, mBlock);
         }
 
         mBlockLength = 0;
@@ -208,7 +209,7 @@ void AesCcm::Payload(void *aPlainText, void *aCipherText, uint32_t aLength, Mode
                 }
             }
 
-            mEcb.Encrypt(mCtr, mCtrPad);
+            mKeyedEcb->Encrypt(mCtr, mCtrPad);
             mCtrLength = 0;
         }
 
@@ -233,7 +234,7 @@ void AesCcm::Payload(void *aPlainText, void *aCipherText, uint32_t aLength, Mode
 
         if (mBlockLength == sizeof(mBlock))
         {
-            mEcb.Encrypt(mBlock, mBlock);
+            mKeyedEcb->Encrypt(mBlock, mBlock);
             mBlockLength = 0;
         }
 
@@ -246,7 +247,7 @@ void AesCcm::Payload(void *aPlainText, void *aCipherText, uint32_t aLength, Mode
     {
         if (mBlockLength != 0)
         {
-            mEcb.Encrypt(mBlock, mBlock);
+            mKeyedEcb->Encrypt(mBlock, mBlock);
         }
 
         // reset counter
@@ -257,14 +258,9 @@ void AesCcm::Payload(void *aPlainText, void *aCipherText, uint32_t aLength, Mode
 #if OPENTHREAD_FTD || OPENTHREAD_MTD
 void AesCcm::Payload(Message &aMessage, uint16_t aOffset, uint16_t aLength, Mode aMode)
 {
-    Message::MutableChunk chunk;
-
-    aMessage.GetFirstChunk(aOffset, aLength, chunk);
-
-    while (chunk.GetLength() > 0)
+    for (Message::MutableSpanIterator iterator(aMessage, aOffset, aLength); !iterator.IsDone(); iterator.Advance())
     {
-        Payload(chunk.GetBytes(), chunk.GetBytes(), chunk.GetLength(), aMode);
-        aMessage.GetNextChunk(aLength, chunk);
+        Payload(iterator.GetBytes(), iterator.GetBytes(), iterator.GetLength(), aMode);
     }
 }
 #endif
@@ -275,7 +271,7 @@ void AesCcm::Finalize(void *aTag)
 
     OT_ASSERT(mPlainTextCur == mPlainTextLength);
 
-    mEcb.Encrypt(mCtr, mCtrPad);
+    mKeyedEcb->Encrypt(mCtr, mCtrPad);
 
     for (int i = 0; i < mTagLength; i++)
     {
@@ -297,5 +293,195 @@ void AesCcm::GenerateNonce(const Mac::ExtAddress &aAddress,
     aNonce[0] = aSecurityLevel;
 }
 
+void AesCcm::ProcessBatch(AesEcb &aKeyedEcb, const Operation *aOperations, uint16_t aNumOperations)
+{
+    while (aNumOperations > 0)
+    {
+        uint8_t numOperations = static_cast<uint8_t>(Min<uint16_t>(aNumOperations, kMaxParallelOperations));
+
+        ProcessParallel(aKeyedEcb, aOperations, numOperations);
+
+        aOperations += numOperations;
+        aNumOperations -= numOperations;
+    }
+}
+
+void AesCcm::ProcessParallel(AesEcb &aKeyedEcb, const Operation *aOperations, uint8_t aNumOperations)
+{
+    // The CBC-MAC of an operation is a chain of dependent block
+    // encryptions, while its counter blocks are independent. The
+    // operations are processed together in steps. Each step
+    // encrypts, for every operation, its next CBC-MAC block along
+    // with any counter block needed by the next step:
+    //
+    // - Step 0 processes the initial block B0 and the counter block
+    //   A0 (used for the tag).
+    // - Steps 1 to `mNumHeaderBlocks` process the header blocks.
+    // - The remaining steps process the payload blocks. The counter
+    //   block A(j+1) for payload block j is encrypted one step before
+    //   the block is added to the CBC-MAC, so that in `kDecrypt` mode
+    //   the plaintext is available when it is needed.
+
+    static constexpr uint8_t kMaxBlocks = kMaxParallelOperations * kMaxBlocksPerStep;
+
+    OperationState states[kMaxParallelOperations];
+    uint8_t        blocks[kMaxBlocks][AesEcb::kBlockSize];
+    uint8_t       *outputs[kMaxBlocks];
+    uint16_t       numSteps = 0;
+
+    for (uint8_t i = 0; i < aNumOperations; i++)
+    {
+        const Operation &operation = aOperations[i];
+        OperationState  &state     = states[i];
+
+        OT_ASSERT(((operation.mTagLength & 0x1) == 0) && (kMinTagLength <= operation.mTagLength) &&
+                  (operation.mTagLength <= kMaxTagLength));
+        OT_ASSERT(operation.mHeaderLength < kMaxBatchHeaderLength);
+
+        memset(state.mMac, 0, sizeof(state.mMac));
+
+        // The header is encoded along with its length (two bytes).
+        state.mNumHeaderBlocks =
+            (operation.mHeaderLength == 0)
+                ? 0
+                : DivideAndRoundUp<uint16_t>(operation.mHeaderLength + sizeof(uint16_t), AesEcb::kBlockSize);
+        state.mNumPayloadBlocks = DivideAndRoundUp<uint16_t>(operation.mPayloadLength, AesEcb::kBlockSize);
+
+        numSteps = Max<uint16_t>(numSteps, 1 + state.mNumHeaderBlocks + state.mNumPayloadBlocks);
+    }
+
+    for (uint16_t step = 0; step < numSteps; step++)
+    {
+        uint8_t numBlocks = 0;
+
+        for (uint8_t i = 0; i < aNumOperations; i++)
+        {
+            const Operation &operation = aOperations[i];
+            OperationState  &state     = states[i];
+
+            if (step <= state.mNumHeaderBlocks + state.mNumPayloadBlocks)
+            {
+                PrepareMacBlock(operation, state, step, blocks[numBlocks]);
+                outputs[numBlocks++] = state.mMac;
+            }
+
+            if (step == 0)
+            {
+                PrepareCounterBlock(operation, 0, blocks[numBlocks]);
+                outputs[numBlocks++] = state.mTagPad;
+            }
+
+            if ((step >= state.mNumHeaderBlocks) && (step - state.mNumHeaderBlocks < state.mNumPayloadBlocks))
+            {
+                PrepareCounterBlock(operation, step - state.mNumHeaderBlocks + 1, blocks[numBlocks]);
+                outputs[numBlocks++] = state.mPayloadPad;
+            }
+        }
+
+        aKeyedEcb.EncryptBlocks(blocks[0], blocks[0], numBlocks);
+
+        for (uint8_t index = 0; index < numBlocks; index++)
+        {
+            memcpy(outputs[index], blocks[index], AesEcb::kBlockSize);
+        }
+    }
+
+    for (uint8_t i = 0; i < aNumOperations; i++)
+    {
+        uint8_t *tagBytes = reinterpret_cast<uint8_t *>(aOperations[i].mTag);
+
+        for (uint8_t index = 0; index < aOperations[i].mTagLength; index++)
+        {
+            tagBytes[index] = states[i].mMac[index] ^ states[i].mTagPad[index];
+        }
+    }
+}
+
+void AesCcm::PrepareMacBlock(const Operation &aOperation, OperationState &aState, uint16_t aStep, uint8_t *aBlock)
+{
+    // Prepares the CBC-MAC input for `aStep`, i.e., the block
+    // processed in this step XORed with the current CBC-MAC. For a
+    // payload block, this also outputs its ciphertext (`kEncrypt`)
+    // or plaintext (`kDecrypt`) using `mPayloadPad`.
+
+    memset(aBlock, 0, AesEcb::kBlockSize);
+
+    if (aStep == 0)
+    {
+        aBlock[0] = (static_cast<uint8_t>((aOperation.mHeaderLength != 0) << 6) |
+                     static_cast<uint8_t>(((aOperation.mTagLength - 2) >> 1) << 3) |
+                     static_cast<uint8_t>(kBatchLengthFieldSize - 1));
+        memcpy(&aBlock[1], aOperation.mNonce, kNonceSize);
+        BigEndian::WriteUint16(aOperation.mPayloadLength, &aBlock[1 + kNonceSize]);
+    }
+    else if (aStep <= aState.mNumHeaderBlocks)
+    {
+        const uint8_t *header = reinterpret_cast<const uint8_t *>(aOperation.mHeader);
+        uint32_t       start  = static_cast<uint32_t>(aStep - 1) * AesEcb::kBlockSize;
+        uint32_t       end    = Min<uint32_t>(start + AesEcb::kBlockSize, aOperation.mHeaderLength + sizeof(uint16_t));
+
+        for (uint32_t index = start; index < end; index++)
+        {
+            uint8_t byte;
+
+            if (index == 0)
+            {
+                byte = static_cast<uint8_t>(aOperation.mHeaderLength >> 8);
+            }
+            else if (index == 1)
+            {
+                byte = static_cast<uint8_t>(aOperation.mHeaderLength & 0xff);
+            }
+            else
+            {
+                byte = header[index - sizeof(uint16_t)];
+            }
+
+            aBlock[index - start] = byte;
+        }
+    }
+    else
+    {
+        uint16_t offset     = (aStep - 1 - aState.mNumHeaderBlocks) * AesEcb::kBlockSize;
+        uint16_t length     = Min<uint16_t>(aOperation.mPayloadLength - offset, AesEcb::kBlockSize);
+        uint8_t *plainText  = reinterpret_cast<uint8_t *>(aOperation.mPlainText);
+        uint8_t *cipherText = reinterpret_cast<uint8_t *>(aOperation.mCipherText);
+
+        for (uint16_t index = 0; index < length; index++)
+        {
+            if (aOperation.mMode == kEncrypt)
+            {
+                aBlock[index] = plainText[offset + index];
+
+                if (cipherText != nullptr)
+                {
+                    cipherText[offset + index] = aBlock[index] ^ aState.mPayloadPad[index];
+                }
+            }
+            else
+            {
+                aBlock[index] = cipherText[offset + index] ^ aState.mPayloadPad[index];
+
+                if (plainText != nullptr)
+                {
+                    plainText[offset + index] = aBlock[index];
+                }
+            }
+        }
+    }
+
+    for (uint8_t index = 0; index < AesEcb::kBlockSize; index++)
+    {
+        aBlock[index] ^= aState.mMac[index];
+    }
+}
+
+void AesCcm::PrepareCounterBlock(const Operation &aOperation, uint16_t aCounter, uint8_t *aBlock)
+{
+    aBlock[0] = kBatchLengthFieldSize - 1;
+    memcpy(&aBlock[1], aOperation.mNonce, kNonceSize);
+    BigEndian::WriteUint16(aCounter, &aBlock[1 + kNonceSize]);
+}
+
 } // namespace Crypto
 } // namespace ot
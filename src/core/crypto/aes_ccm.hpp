@@ -74,12 +74,54 @@ public:
         kDecrypt, // Decryption mode.
     };
 
+    /**
+     * Represents an AES CCM operation processed as part of a batch by `ProcessBatch()`.
+     *
+     * The operation uses an IEEE 802.15.4 nonce (`kNonceSize` bytes).
+     */
+    struct Operation
+    {
+        const uint8_t *mNonce;         ///< The nonce (`kNonceSize` bytes).
+        const void    *mHeader;        ///< The header (can be `nullptr` if `mHeaderLength` is zero).
+        void          *mPlainText;     ///< The plaintext (can be `nullptr` in `kDecrypt` mode if not needed).
+        void          *mCipherText;    ///< The ciphertext (can be `nullptr` in `kEncrypt` mode if not needed).
+        void          *mTag;           ///< A buffer to output the tag (`mTagLength` bytes).
+        uint16_t       mHeaderLength;  ///< The header length in bytes (MUST be less than `kMaxBatchHeaderLength`).
+        uint16_t       mPayloadLength; ///< The payload length in bytes.
+        uint8_t        mTagLength;     ///< The tag length (even and in `[kMinTagLength, kMaxTagLength]`).
+        Mode           mMode;          ///< The mode, encryption (`kEncrypt`) or decryption (`kDecrypt`).
+    };
+
+    static constexpr uint16_t kMaxBatchHeaderLength = 0xff00; ///< Header length limit of `Operation`.
+
+    /**
+     * Initializes the `AesCcm` object.
+     */
+    AesCcm(void)
+        : mKeyedEcb(&mEcb)
+    {
+    }
+
     /**
      * Sets the key.
      *
      * @param[in]  aKey    Crypto Key used in AES operation
      */
-    void SetKey(const Key &aKey) { mEcb.SetKey(aKey); }
+    void SetKey(const Key &aKey)
+    {
+        mEcb.SetKey(aKey);
+        mKeyedEcb = &mEcb;
+    }
+
+    /**
+     * Sets the key using an `AesEcb` whose key is already set.
+     *
+     * Allows an `AesEcb` with a prepared key schedule to be shared by many AES CCM computations, so the key is not set
+     * up again for each one. The @p aKeyedEcb MUST stay valid while this `AesCcm` is used.
+     *
+     * @param[in]  aKeyedEcb   The `AesEcb` (with its key already set) to use for AES operation.
+     */
+    void SetKey(AesEcb &aKeyedEcb) { mKeyedEcb = &aKeyedEcb; }
 
     /**
      * Sets the key.
@@ -187,8 +229,45 @@ public:
                               uint8_t                aSecurityLevel,
                               uint8_t               *aNonce);
 
+    /**
+     * Processes a batch of independent AES CCM operations which use the same key.
+     *
+     * The result of each operation is the same as processing it with `Init()`, `Header()`, `Payload()` and
+     * `Finalize()`. The operations are processed in groups and the AES blocks of all operations in a group are
+     * encrypted together (using `otPlatCryptoAesEncryptBlocks()`), which allows the platform to pipeline them.
+     *
+     * When decrypting, the generated tag is written to `mTag` and the caller is responsible for comparing it with the
+     * received tag.
+     *
+     * The processing state for a group of operations is kept on the stack, so a single operation is better processed
+     * using `Init()`, `Header()`, `Payload()` and `Finalize()`.
+     *
+     * @param[in]  aKeyedEcb        The `AesEcb` (with its key already set) to use for AES operation.
+     * @param[in]  aOperations      An array of operations.
+     * @param[in]  aNumOperations   The number of operations in @p aOperations.
+     */
+    static void ProcessBatch(AesEcb &aKeyedEcb, const Operation *aOperations, uint16_t aNumOperations);
+
 private:
+    static constexpr uint8_t kMaxParallelOperations = 4;
+    static constexpr uint8_t kMaxBlocksPerStep      = 3; // CBC-MAC block, tag counter block and payload counter block.
+    static constexpr uint8_t kBatchLengthFieldSize  = AesEcb::kBlockSize - 1 - kNonceSize; // "L" with `kNonceSize`.
+
+    struct OperationState
+    {
+        uint8_t  mMac[AesEcb::kBlockSize];
+        uint8_t  mTagPad[AesEcb::kBlockSize];
+        uint8_t  mPayloadPad[AesEcb::kBlockSize];
+        uint16_t mNumHeaderBlocks;
+        uint16_t mNumPayloadBlocks;
+    };
+
+    static void ProcessParallel(AesEcb &aKeyedEcb, const Operation *aOperations, uint8_t aNumOperations);
+    static void PrepareMacBlock(const Operation &aOperation, OperationState &aState, uint16_t aStep, uint8_t *aBlock);
+    static void PrepareCounterBlock(const Operation &aOperation, uint16_t aCounter, uint8_t *aBlock);
+
     AesEcb   mEcb;
+    AesEcb  *mKeyedEcb;
     uint8_t  mBlock[AesEcb::kBlockSize];
     uint8_t  mCtr[AesEcb::kBlockSize];
     uint8_t  mCtrPad[AesEcb::kBlockSize];
@@ -47,7 +47,40 @@ void AesEcb::Encrypt(const uint8_t aInput[kBlockSize], uint8_t aOutput[kBlockSiz
     SuccessOrAssert(otPlatCryptoAesEncrypt(&mContext, aInput, aOutput));
 }
 
+void AesEcb::EncryptBlocks(const uint8_t *aInput, uint8_t *aOutput, uint16_t aNumBlocks)
+{
+    SuccessOrAssert(otPlatCryptoAesEncryptBlocks(&mContext, aInput, aOutput, aNumBlocks));
+}
+
 AesEcb::~AesEcb(void) { SuccessOrAssert(otPlatCryptoAesFree(&mContext)); }
 
 } // namespace Crypto
 } // namespace ot
+
+#if OPENTHREAD_CONFIG_CRYPTO_LIB != OPENTHREAD_CONFIG_CRYPTO_LIB_PSA
+
+// Default implementation, which encrypts the blocks one at a time
+// using `otPlatCryptoAesEncrypt()`. The PSA crypto platform provides
+// its own default, which passes all the blocks in one call.
+
+OT_TOOL_WEAK otError otPlatCryptoAesEncryptBlocks(otCryptoContext *aContext,
+                                                  const uint8_t   *aInput,
+                                                  uint8_t         *aOutput,
+                                                  uint16_t         aNumBlocks)
+{
+    otError error = OT_ERROR_NONE;
+
+    VerifyOrExit(aInput != nullptr && aOutput != nullptr, error = OT_ERROR_INVALID_ARGS);
+
+    for (; aNumBlocks > 0; aNumBlocks--)
+    {
+        SuccessOrExit(error = otPlatCryptoAesEncrypt(aContext, aInput, aOutput));
+        aInput += ot::Crypto::AesEcb::kBlockSize;
+        aOutput += ot::Crypto::AesEcb::kBlockSize;
+    }
+
+exit:
+    return error;
+}
+
+#endif // OPENTHREAD_CONFIG_CRYPTO_LIB != OPENTHREAD_CONFIG_CRYPTO_LIB_PSA
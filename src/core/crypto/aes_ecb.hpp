@@ -84,6 +84,17 @@ public:
      */
     void Encrypt(const uint8_t aInput[kBlockSize], uint8_t aOutput[kBlockSize]);
 
+    /**
+     * Encrypts a number of independent blocks.
+     *
+     * @p aInput and @p aOutput can point to the same buffer.
+     *
+     * @param[in]   aInput      A pointer to the input buffer (@p aNumBlocks blocks).
+     * @param[out]  aOutput     A pointer to the output buffer (@p aNumBlocks blocks).
+     * @param[in]   aNumBlocks  The number of blocks.
+     */
+    void EncryptBlocks(const uint8_t *aInput, uint8_t *aOutput, uint16_t aNumBlocks);
+
 private:
     ContextWith<kAesContextSize> mContext;
 };
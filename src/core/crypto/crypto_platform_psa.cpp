@@ -382,6 +382,31 @@ exit:
     return error;
 }
 
+OT_TOOL_WEAK otError otPlatCryptoAesEncryptBlocks(otCryptoContext *aContext,
+                                                  const uint8_t   *aInput,
+                                                  uint8_t         *aOutput,
+                                                  uint16_t         aNumBlocks)
+{
+    // All the blocks are passed to the PSA driver in one call.
+
+    Error         error  = kErrorNone;
+    const size_t  length = aNumBlocks * PSA_BLOCK_CIPHER_BLOCK_LENGTH(PSA_KEY_TYPE_AES);
+    psa_status_t  status = PSA_SUCCESS;
+    psa_key_id_t *keyRef;
+    size_t        cipherLen;
+
+    SuccessOrExit(error = ValidateContext(aContext, sizeof(psa_key_id_t)));
+    VerifyOrExit(aInput != nullptr && aOutput != nullptr, error = kErrorInvalidArgs);
+
+    keyRef = static_cast<psa_key_id_t *>(aContext->mContext);
+    status = psa_cipher_encrypt(*keyRef, PSA_ALG_ECB_NO_PADDING, aInput, length, aOutput, length, &cipherLen);
+
+    error = PsaToOtError(status);
+
+exit:
+    return error;
+}
+
 OT_TOOL_WEAK otError otPlatCryptoAesFree(otCryptoContext *aContext)
 {
     OT_UNUSED_VARIABLE(aContext);
@@ -53,14 +53,9 @@ void Sha256::Update(const void *aBuf, uint16_t aBufLength)
 
 void Sha256::Update(const Message &aMessage, uint16_t aOffset, uint16_t aLength)
 {
-    Message::Chunk chunk;
-
-    aMessage.GetFirstChunk(aOffset, aLength, chunk);
-
-    while (chunk.GetLength() > 0)
+    for (Message::SpanIterator iterator(aMessage, aOffset, aLength); !iterator.IsDone(); iterator.Advance())
     {
-        Update(chunk.GetBytes(), chunk.GetLength());
-        aMessage.GetNextChunk(aLength, chunk);
+        Update(iterator.GetBytes(), iterator.GetLength());
     }
 }
 
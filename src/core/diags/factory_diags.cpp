@@ -623,6 +623,10 @@ Error Diags::TransmitPacket(void)
         }
     }
 
+    // The frame is written directly into the PSDU, so any header layout
+    // cached by MAC for an earlier frame in this buffer is discarded.
+    static_cast<Mac::TxFrame *>(mTxPacket)->InvalidateHeaderLayout();
+
     error = Get<Radio>().Transmit(*static_cast<Mac::TxFrame *>(mTxPacket));
     if (error == kErrorNone)
     {
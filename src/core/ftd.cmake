@@ -28,30 +28,48 @@
 
 add_library(openthread-ftd)
 
-target_compile_definitions(openthread-ftd PRIVATE
-    OPENTHREAD_FTD=1
-    OPENTHREAD_MTD=0
-    OPENTHREAD_RADIO=0
-)
-
-target_compile_options(openthread-ftd PRIVATE
-    ${OT_CFLAGS}
-    -Wundef
-)
-
-if(APPLE)
-    target_compile_options(openthread-ftd PRIVATE -Wimplicit-int-conversion)
+set(OT_FTD_LIBRARIES openthread-ftd)
+
+if(BUILD_TESTING)
+    # `ot-ftd-test` is built from the same sources as `openthread-ftd`, with
+    # the optional features given by `ot-config-ftd-test` (set by the unit
+    # tests). It is only linked by unit tests, so `openthread-ftd` and apps
+    # keep the default configuration.
+    add_library(ot-config-ftd-test INTERFACE)
+    add_library(ot-ftd-test EXCLUDE_FROM_ALL)
+    list(APPEND OT_FTD_LIBRARIES ot-ftd-test)
 endif()
 
-target_include_directories(openthread-ftd PUBLIC ${OT_PUBLIC_INCLUDES} PRIVATE ${COMMON_INCLUDES})
+foreach(ftd_library ${OT_FTD_LIBRARIES})
+    target_compile_definitions(${ftd_library} PRIVATE
+        OPENTHREAD_FTD=1
+        OPENTHREAD_MTD=0
+        OPENTHREAD_RADIO=0
+    )
+
+    target_compile_options(${ftd_library} PRIVATE
+        ${OT_CFLAGS}
+        -Wundef
+    )
+
+    if(APPLE)
+        target_compile_options(${ftd_library} PRIVATE -Wimplicit-int-conversion)
+    endif()
 
-target_sources(openthread-ftd PRIVATE ${COMMON_SOURCES})
+    target_include_directories(${ftd_library} PUBLIC ${OT_PUBLIC_INCLUDES} PRIVATE ${COMMON_INCLUDES})
 
-target_link_libraries(openthread-ftd
-    PRIVATE
-        ${OT_MBEDTLS}
-        ot-config-ftd
-        ot-config
-)
+    target_sources(${ftd_library} PRIVATE ${COMMON_SOURCES})
+
+    target_link_libraries(${ftd_library}
+        PRIVATE
+            ${OT_MBEDTLS}
+            ot-config-ftd
+            ot-config
+    )
+endforeach()
 
 target_link_libraries(openthread-ftd PRIVATE tcplp-ftd)
+
+if(BUILD_TESTING)
+    target_link_libraries(ot-ftd-test PUBLIC ot-config-ftd-test PRIVATE tcplp-ftd-test)
+endif()
@@ -200,6 +200,10 @@ Error LinkRaw::Transmit(otLinkRawTransmitDone aCallback)
 
     VerifyOrExit(IsEnabled(), error = kErrorInvalidState);
 
+    // The frame is written directly into the PSDU by the caller, so
+    // any header layout cached from an earlier frame is discarded.
+    GetTransmitFrame().InvalidateHeaderLayout();
+
     SuccessOrExit(error = mSubMac.Send());
     mTransmitDoneCallback = aCallback;
 
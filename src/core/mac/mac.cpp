@@ -1625,7 +1625,14 @@ Error Mac::ProcessReceiveSecurity(RxFrame &aFrame, const Address &aSrcAddr, Neig
         ExitNow();
     }
 
-    SuccessOrExit(aFrame.ProcessReceiveAesCcm(*extAddress, *macKey));
+    if (keyIdMode == Frame::kKeyIdMode1)
+    {
+        SuccessOrExit(aFrame.ProcessReceiveAesCcm(*extAddress, keyManager.GetMacKeySchedule(*macKey, keySequence)));
+    }
+    else
+    {
+        SuccessOrExit(aFrame.ProcessReceiveAesCcm(*extAddress, *macKey));
+    }
 
     if ((keyIdMode == Frame::kKeyIdMode1) && aNeighbor->IsStateValid())
     {
@@ -1808,6 +1815,12 @@ void Mac::HandleReceivedFrame(RxFrame *aFrame, Error aError)
     VerifyOrExit(aFrame != nullptr, error = kErrorNoFrameReceived);
     VerifyOrExit(IsEnabled(), error = kErrorInvalidState);
 
+    // Parse the header once so that the frame accessors used while
+    // processing the frame (including `ValidatePsdu()`) use the
+    // cached field positions. The layout is invalidated at `exit`
+    // since the radio reuses the frame buffer for the next frame.
+    aFrame->ParseHeaderLayout();
+
     // Ensure we have a valid frame before attempting to read any contents of
     // the buffer received from the radio.
     SuccessOrExit(error = aFrame->ValidatePsdu());
@@ -2114,6 +2127,11 @@ exit:
         }
     }
 #endif // OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
+
+    if (aFrame != nullptr)
+    {
+        aFrame->InvalidateHeaderLayout();
+    }
 }
 
 void Mac::UpdateNeighborLinkInfo(Neighbor &aNeighbor, const RxFrame &aRxFrame)
@@ -49,6 +49,9 @@
 namespace ot {
 namespace Mac {
 
+Frame::HeaderLayout Frame::sHeaderLayouts[kNumHeaderLayouts];
+uint8_t             Frame::sNextHeaderLayout = 0;
+
 void TxFrame::Info::PrepareHeadersIn(TxFrame &aTxFrame) const
 {
     uint16_t     fcf;
@@ -252,6 +255,7 @@ void TxFrame::Info::PrepareHeadersIn(TxFrame &aTxFrame) const
     builder.AppendLength(micSize + aTxFrame.GetFcsSize());
 
     aTxFrame.mLength = builder.GetLength();
+    aTxFrame.ParseHeaderLayout();
 }
 
 void Frame::SetFrameControlField(uint16_t aFcf)
@@ -385,6 +389,10 @@ void Frame::SetIePresent(bool aIePresent)
     }
 
     SetFrameControlField(fcf);
+
+    // Header IE Present flag determines whether Header IEs are parsed
+    // before the payload, so the cached layout no longer applies.
+    InvalidateHeaderLayout();
 }
 
 uint8_t Frame::SkipSequenceIndex(void) const
@@ -402,8 +410,10 @@ uint8_t Frame::SkipSequenceIndex(void) const
 
 uint8_t Frame::FindDstPanIdIndex(void) const
 {
-    uint8_t index;
+    const HeaderLayout *layout = GetHeaderLayout();
+    uint8_t             index;
 
+    VerifyOrExit(layout == nullptr, index = layout->mDstPanIdIndex);
     VerifyOrExit(IsDstPanIdPresent(), index = kInvalidIndex);
 
     index = SkipSequenceIndex();
@@ -499,7 +509,17 @@ void Frame::SetSequence(uint8_t aSequence)
     GetPsdu()[GetFcfSize(GetFrameControlField())] = aSequence;
 }
 
-uint8_t Frame::FindDstAddrIndex(void) const { return SkipSequenceIndex() + (IsDstPanIdPresent() ? sizeof(PanId) : 0); }
+uint8_t Frame::FindDstAddrIndex(void) const
+{
+    const HeaderLayout *layout = GetHeaderLayout();
+    uint8_t             index;
+
+    VerifyOrExit(layout == nullptr, index = layout->mDstAddrIndex);
+    index = SkipSequenceIndex() + (IsDstPanIdPresent() ? sizeof(PanId) : 0);
+
+exit:
+    return index;
+}
 
 Error Frame::GetDstAddr(Address &aAddress) const
 {
@@ -529,9 +549,11 @@ exit:
 
 uint8_t Frame::FindSrcPanIdIndex(void) const
 {
-    uint16_t fcf = GetFrameControlField();
-    uint8_t  index;
+    const HeaderLayout *layout = GetHeaderLayout();
+    uint16_t            fcf    = GetFrameControlField();
+    uint8_t             index;
 
+    VerifyOrExit(layout == nullptr, index = layout->mSrcPanIdIndex);
     VerifyOrExit(IsSrcPanIdPresent(fcf), index = kInvalidIndex);
 
     index = SkipSequenceIndex();
@@ -622,8 +644,13 @@ exit:
 
 uint8_t Frame::FindSrcAddrIndex(void) const
 {
-    uint16_t fcf   = GetFrameControlField();
-    uint8_t  index = SkipSequenceIndex();
+    const HeaderLayout *layout = GetHeaderLayout();
+    uint16_t            fcf    = GetFrameControlField();
+    uint8_t             index;
+
+    VerifyOrExit(layout == nullptr, index = layout->mSrcAddrIndex);
+
+    index = SkipSequenceIndex();
 
     if (IsDstPanIdPresent(fcf))
     {
@@ -646,6 +673,7 @@ uint8_t Frame::FindSrcAddrIndex(void) const
         index += sizeof(PanId);
     }
 
+exit:
     return index;
 }
 
@@ -696,8 +724,10 @@ exit:
 
 uint8_t Frame::FindSecurityHeaderIndex(void) const
 {
-    uint8_t index;
+    const HeaderLayout *layout = GetHeaderLayout();
+    uint8_t             index;
 
+    VerifyOrExit(layout == nullptr, index = layout->mSecurityHeaderIndex);
     VerifyOrExit(kFcfSize < mLength, index = kInvalidIndex);
     VerifyOrExit(GetSecurityEnabled(), index = kInvalidIndex);
     index = SkipAddrFieldIndex();
@@ -878,8 +908,14 @@ uint8_t Frame::GetHeaderLength(void) const { return static_cast<uint8_t>(GetPayl
 
 uint8_t Frame::GetFooterLength(void) const
 {
-    uint8_t footerLength = static_cast<uint8_t>(GetFcsSize());
-    uint8_t index        = FindSecurityHeaderIndex();
+    const HeaderLayout *layout = GetHeaderLayout();
+    uint8_t             footerLength;
+    uint8_t             index;
+
+    VerifyOrExit(layout == nullptr, footerLength = layout->mFooterLength);
+
+    footerLength = static_cast<uint8_t>(GetFcsSize());
+    index        = FindSecurityHeaderIndex();
 
     VerifyOrExit(index != kInvalidIndex);
     footerLength += CalculateMicSize(mPsdu[index]);
@@ -1070,8 +1106,12 @@ uint8_t Frame::FindPayloadIndex(void) const
     // We use `uint16_t` for `index` to handle its potential roll-over
     // while parsing and verifying Header IE(s).
 
-    uint16_t index = SkipSecurityHeaderIndex();
+    const HeaderLayout *layout = GetHeaderLayout();
+    uint16_t            index;
 
+    VerifyOrExit(layout == nullptr, index = layout->mPayloadIndex);
+
+    index = SkipSecurityHeaderIndex();
     VerifyOrExit(index != kInvalidIndex);
 
 #if OPENTHREAD_CONFIG_MAC_HEADER_IE_SUPPORT
@@ -1139,11 +1179,73 @@ exit:
 
 const uint8_t *Frame::GetFooter(void) const { return mPsdu + mLength - GetFooterLength(); }
 
+void Frame::ParseHeaderLayout(void)
+{
+    // The `Find{Item}Index()` methods parse the header while the
+    // layout is invalid, so it is invalidated first and its key
+    // (`mPsdu`) is set only after all positions are determined.
+
+    HeaderLayout *layout;
+
+    InvalidateHeaderLayout();
+
+    layout            = &sHeaderLayouts[sNextHeaderLayout];
+    sNextHeaderLayout = (sNextHeaderLayout + 1) % kNumHeaderLayouts;
+    layout->mPsdu     = nullptr;
+
+    layout->mDstPanIdIndex       = FindDstPanIdIndex();
+    layout->mDstAddrIndex        = FindDstAddrIndex();
+    layout->mSrcPanIdIndex       = FindSrcPanIdIndex();
+    layout->mSrcAddrIndex        = FindSrcAddrIndex();
+    layout->mSecurityHeaderIndex = FindSecurityHeaderIndex();
+#if OPENTHREAD_CONFIG_MAC_HEADER_IE_SUPPORT
+    layout->mHeaderIeIndex = FindHeaderIeIndex();
+#else
+    layout->mHeaderIeIndex = kInvalidIndex;
+#endif
+    layout->mPayloadIndex = FindPayloadIndex();
+    layout->mFooterLength = GetFooterLength();
+
+    layout->mPsdu = mPsdu;
+}
+
+void Frame::InvalidateHeaderLayout(void)
+{
+    for (HeaderLayout &layout : sHeaderLayouts)
+    {
+        if (layout.mPsdu == mPsdu)
+        {
+            layout.mPsdu = nullptr;
+        }
+    }
+}
+
+const Frame::HeaderLayout *Frame::GetHeaderLayout(void) const
+{
+    const HeaderLayout *match = nullptr;
+
+    VerifyOrExit(mPsdu != nullptr);
+
+    for (const HeaderLayout &layout : sHeaderLayouts)
+    {
+        if (layout.mPsdu == mPsdu)
+        {
+            match = &layout;
+            break;
+        }
+    }
+
+exit:
+    return match;
+}
+
 #if OPENTHREAD_CONFIG_MAC_HEADER_IE_SUPPORT
 uint8_t Frame::FindHeaderIeIndex(void) const
 {
-    uint8_t index;
+    const HeaderLayout *layout = GetHeaderLayout();
+    uint8_t             index;
 
+    VerifyOrExit(layout == nullptr, index = layout->mHeaderIeIndex);
     VerifyOrExit(IsIePresent(), index = kInvalidIndex);
 
     index = SkipSecurityHeaderIndex();
@@ -1353,6 +1455,9 @@ void TxFrame::CopyFrom(const TxFrame &aFromFrame)
     mRadioType = radioType;
 #endif
 
+    // The copied header layout refers to `aFromFrame` PSDU.
+    InvalidateHeaderLayout();
+
     memcpy(mPsdu, aFromFrame.mPsdu, aFromFrame.mLength);
 
     // mIeInfo may be null when TIME_SYNC is not enabled.
@@ -1454,6 +1559,7 @@ void TxFrame::GenerateImmAck(const RxFrame &aFrame, bool aIsFramePending)
     mPsdu[kFcfSize] = aFrame.GetSequence();
 
     mLength = kImmAckLength;
+    InvalidateHeaderLayout();
 }
 
 #if OPENTHREAD_CONFIG_THREAD_VERSION >= OT_THREAD_VERSION_1_2
@@ -1589,6 +1695,7 @@ Error TxFrame::GenerateWakeupFrame(PanId aPanId, const WakeupRequest &aWakeupReq
     builder.AppendLength(CalculateMicSize(secCtl) + GetFcsSize());
 
     mLength = builder.GetLength();
+    ParseHeaderLayout();
 
 exit:
     return error;
@@ -1624,14 +1731,47 @@ exit:
 Error RxFrame::ProcessReceiveAesCcm(const ExtAddress &aExtAddress, const KeyMaterial &aMacKey)
 {
 #if OPENTHREAD_FTD || OPENTHREAD_MTD
-    Error          error        = kErrorSecurity;
-    uint32_t       frameCounter = 0;
-    uint8_t        securityLevel;
-    uint8_t        nonce[Crypto::AesCcm::kNonceSize];
-    uint8_t        tag[kMaxMicSize];
-    uint8_t        tagLength;
     Crypto::AesCcm aesCcm;
 
+    aesCcm.SetKey(aMacKey);
+
+    return ProcessReceiveAesCcm(aExtAddress, aesCcm);
+#else
+    OT_UNUSED_VARIABLE(aExtAddress);
+    OT_UNUSED_VARIABLE(aMacKey);
+
+    return kErrorNone;
+#endif // OPENTHREAD_FTD || OPENTHREAD_MTD
+}
+
+Error RxFrame::ProcessReceiveAesCcm(const ExtAddress &aExtAddress, Crypto::AesEcb &aKeySchedule)
+{
+#if OPENTHREAD_FTD || OPENTHREAD_MTD
+    Crypto::AesCcm aesCcm;
+
+    aesCcm.SetKey(aKeySchedule);
+
+    return ProcessReceiveAesCcm(aExtAddress, aesCcm);
+#else
+    OT_UNUSED_VARIABLE(aExtAddress);
+    OT_UNUSED_VARIABLE(aKeySchedule);
+
+    return kErrorNone;
+#endif // OPENTHREAD_FTD || OPENTHREAD_MTD
+}
+
+Error RxFrame::ProcessReceiveAesCcm(const ExtAddress &aExtAddress, Crypto::AesCcm &aAesCcm)
+{
+    // `aAesCcm` is expected to have its key already set.
+
+#if OPENTHREAD_FTD || OPENTHREAD_MTD
+    Error    error        = kErrorSecurity;
+    uint32_t frameCounter = 0;
+    uint8_t  securityLevel;
+    uint8_t  nonce[Crypto::AesCcm::kNonceSize];
+    uint8_t  tag[kMaxMicSize];
+    uint8_t  tagLength;
+
     VerifyOrExit(GetSecurityEnabled(), error = kErrorNone);
 
     SuccessOrExit(GetSecurityLevel(securityLevel));
@@ -1639,18 +1779,17 @@ Error RxFrame::ProcessReceiveAesCcm(const ExtAddress &aExtAddress, const KeyMate
 
     Crypto::AesCcm::GenerateNonce(aExtAddress, frameCounter, securityLevel, nonce);
 
-    aesCcm.SetKey(aMacKey);
     tagLength = GetFooterLength() - GetFcsSize();
 
-    aesCcm.Init(GetHeaderLength(), GetPayloadLength(), tagLength, nonce, sizeof(nonce));
-    aesCcm.Header(GetHeader(), GetHeaderLength());
+    aAesCcm.Init(GetHeaderLength(), GetPayloadLength(), tagLength, nonce, sizeof(nonce));
+    aAesCcm.Header(GetHeader(), GetHeaderLength());
 #ifndef FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION
-    aesCcm.Payload(GetPayload(), GetPayload(), GetPayloadLength(), Crypto::AesCcm::kDecrypt);
+    aAesCcm.Payload(GetPayload(), GetPayload(), GetPayloadLength(), Crypto::AesCcm::kDecrypt);
 #else
     // For fuzz tests, execute AES but do not alter the payload. A large
-    aesCcm.Payload(nullptr, GetPayload(), GetPayloadLength(), Crypto::AesCcm::kDecrypt);
+    aAesCcm.Payload(nullptr, GetPayload(), GetPayloadLength(), Crypto::AesCcm::kDecrypt);
 #endif
-    aesCcm.Finalize(tag);
+    aAesCcm.Finalize(tag);
 
 #ifndef FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION
     VerifyOrExit(memcmp(tag, GetFooter(), tagLength) == 0);
@@ -1662,7 +1801,7 @@ exit:
     return error;
 #else
     OT_UNUSED_VARIABLE(aExtAddress);
-    OT_UNUSED_VARIABLE(aMacKey);
+    OT_UNUSED_VARIABLE(aAesCcm);
 
     return kErrorNone;
 #endif // OPENTHREAD_FTD || OPENTHREAD_MTD
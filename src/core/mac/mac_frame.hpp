@@ -45,6 +45,12 @@
 #include "meshcop/network_name.hpp"
 
 namespace ot {
+
+namespace Crypto {
+class AesCcm;
+class AesEcb;
+} // namespace Crypto
+
 namespace Mac {
 
 /**
@@ -733,9 +739,46 @@ public:
      *
      * @param[in] aRadioType  A radio link type.
      */
-    void SetRadioType(RadioType aRadioType) { mRadioType = static_cast<uint8_t>(aRadioType); }
+    void SetRadioType(RadioType aRadioType)
+    {
+        if (GetRadioType() != aRadioType)
+        {
+            // FCS size depends on the radio link type.
+            mRadioType = static_cast<uint8_t>(aRadioType);
+            InvalidateHeaderLayout();
+        }
+    }
 #endif
 
+    /**
+     * Parses the MAC header of the frame and caches the position of its fields.
+     *
+     * While the cached header layout is valid, the frame accessors use it instead of parsing the Frame Control field
+     * and the header on every call.
+     *
+     * The cached layout is invalidated when the Header IE Present flag or the radio link type of the frame is changed.
+     * Any other change to the frame header that changes its layout (e.g., writing a new Frame Control field directly
+     * into PSDU) MUST be followed by a call to `ParseHeaderLayout()` or `InvalidateHeaderLayout()`.
+     *
+     * The layouts are cached by the core (keyed on the PSDU buffer) rather than in the frame itself, and only for a
+     * few frames at a time. Parsing the header of another frame may evict the cached layout, after which the frame
+     * accessors parse the header again.
+     */
+    void ParseHeaderLayout(void);
+
+    /**
+     * Invalidates the cached header layout of the frame (if any).
+     */
+    void InvalidateHeaderLayout(void);
+
+    /**
+     * Indicates whether or not the frame has a valid cached header layout.
+     *
+     * @retval TRUE   The frame has a valid cached header layout.
+     * @retval FALSE  The frame does not have a valid cached header layout.
+     */
+    bool HasHeaderLayout(void) const { return GetHeaderLayout() != nullptr; }
+
     /**
      * Returns the maximum transmission unit size (MTU).
      *
@@ -860,6 +903,25 @@ protected:
     static constexpr uint8_t kInvalidSize  = kInvalidIndex;
     static constexpr uint8_t kMaxPsduSize  = kInvalidSize - 1;
 
+    // Number of cached header layouts, enough for the received frame
+    // being processed and the frame being prepared for transmission.
+    static constexpr uint8_t kNumHeaderLayouts = 2;
+
+    struct HeaderLayout
+    {
+        const uint8_t *mPsdu; // The PSDU the layout was parsed from (`nullptr` if unused).
+        uint8_t        mDstPanIdIndex;
+        uint8_t        mDstAddrIndex;
+        uint8_t        mSrcPanIdIndex;
+        uint8_t        mSrcAddrIndex;
+        uint8_t        mSecurityHeaderIndex;
+        uint8_t        mHeaderIeIndex;
+        uint8_t        mPayloadIndex;
+        uint8_t        mFooterLength;
+    };
+
+    const HeaderLayout *GetHeaderLayout(void) const;
+
     void    SetFrameControlField(uint16_t aFcf);
     uint8_t SkipSequenceIndex(void) const;
     uint8_t FindDstPanIdIndex(void) const;
@@ -931,6 +993,9 @@ protected:
     static uint8_t CalculateSecurityHeaderSize(uint8_t aSecurityControl);
     static uint8_t CalculateKeySourceSize(uint8_t aSecurityControl);
     static uint8_t CalculateMicSize(uint8_t aSecurityControl);
+
+    static HeaderLayout sHeaderLayouts[kNumHeaderLayouts];
+    static uint8_t      sNextHeaderLayout;
 };
 
 /**
@@ -1030,6 +1095,18 @@ public:
      */
     Error ProcessReceiveAesCcm(const ExtAddress &aExtAddress, const KeyMaterial &aMacKey);
 
+    /**
+     * Performs AES CCM on the frame which is received using a prepared AES key schedule.
+     *
+     * @param[in]  aExtAddress    A reference to the extended address, which will be used to generate nonce
+     *                            for AES CCM computation.
+     * @param[in]  aKeySchedule   An `AesEcb` with its key set to the MAC key to decrypt the received frame.
+     *
+     * @retval kErrorNone      Process of received frame AES CCM succeeded.
+     * @retval kErrorSecurity  Received frame MIC check failed.
+     */
+    Error ProcessReceiveAesCcm(const ExtAddress &aExtAddress, Crypto::AesEcb &aKeySchedule);
+
 #if OPENTHREAD_CONFIG_TIME_SYNC_ENABLE
     /**
      * Gets the offset to network time.
@@ -1048,6 +1125,9 @@ public:
      */
     uint8_t ReadTimeSyncSeq(void) const { return GetTimeIe()->GetSequence(); }
 #endif // OPENTHREAD_CONFIG_TIME_SYNC_ENABLE
+
+private:
+    Error ProcessReceiveAesCcm(const ExtAddress &aExtAddress, Crypto::AesCcm &aAesCcm);
 };
 
 /**
@@ -59,6 +59,8 @@ SubMac::SubMac(Instance &aInstance)
     , mWedTimer(aInstance, SubMac::HandleWedTimer)
 #endif
 {
+    mTransmitFrame.InvalidateHeaderLayout();
+
 #if OPENTHREAD_CONFIG_MAC_CSL_RECEIVER_ENABLE
     mCslParentAccuracy.Init();
 #endif
@@ -33,6 +33,8 @@
 
 #include "checksum.hpp"
 
+#include <string.h>
+
 #include "common/code_utils.hpp"
 #include "common/log.hpp"
 #include "common/message.hpp"
@@ -74,12 +76,75 @@ void Checksum::AddUint16(uint16_t aUint16)
 
 void Checksum::AddData(const uint8_t *aBuffer, uint16_t aLength)
 {
-    for (uint16_t i = 0; i < aLength; i++)
+    // The data is summed one 32-bit word at a time (in host byte
+    // order) into a 64-bit accumulator, deferring the end-around
+    // carry to the final fold. The one's complement sum is byte order
+    // independent (RFC 1071), so the folded 16-bit sum only needs to
+    // be converted to big-endian. If the data starts at an odd index,
+    // every byte contributes with swapped weight, which is the same
+    // as swapping the bytes of the sum.
+
+    uint64_t sum   = 0;
+    bool     isOdd = (aLength & 1);
+    uint16_t value;
+
+    while (aLength >= sizeof(uint32_t))
     {
-        AddUint8(aBuffer[i]);
+        uint32_t word;
+
+        memcpy(&word, aBuffer, sizeof(word));
+        sum += word;
+        aBuffer += sizeof(uint32_t);
+        aLength -= sizeof(uint32_t);
+    }
+
+    if (aLength >= sizeof(uint16_t))
+    {
+        uint16_t word;
+
+        memcpy(&word, aBuffer, sizeof(word));
+        sum += word;
+        aBuffer += sizeof(uint16_t);
+        aLength -= sizeof(uint16_t);
+    }
+
+    if (aLength > 0)
+    {
+        // Trailing byte is the MSB of a big-endian word padded with zero.
+        uint8_t  bytes[sizeof(uint16_t)] = {aBuffer[0], 0};
+        uint16_t word;
+
+        memcpy(&word, bytes, sizeof(word));
+        sum += word;
+    }
+
+    sum = (sum & 0xffffffff) + (sum >> 32);
+    sum = (sum & 0xffffffff) + (sum >> 32);
+    sum = (sum & 0xffff) + (sum >> 16);
+    sum = (sum & 0xffff) + (sum >> 16);
+
+    value = BigEndian::HostSwap16(static_cast<uint16_t>(sum));
+
+    if (mAtOddIndex)
+    {
+        value = Swap16(value);
+    }
+
+    AddToValue(value);
+
+    if (isOdd)
+    {
+        mAtOddIndex = !mAtOddIndex;
     }
 }
 
+void Checksum::AddToValue(uint16_t aValue)
+{
+    uint32_t sum = static_cast<uint32_t>(mValue) + aValue;
+
+    mValue = static_cast<uint16_t>((sum & 0xffff) + (sum >> 16));
+}
+
 void Checksum::WriteToMessage(uint16_t aOffset, Message &aMessage) const
 {
     uint16_t checksum = GetValue();
@@ -99,8 +164,7 @@ void Checksum::Calculate(const Ip6::Address &aSource,
                          uint8_t             aIpProto,
                          const Message      &aMessage)
 {
-    Message::Chunk chunk;
-    uint16_t       length = aMessage.DetermineLengthAfterOffset();
+    uint16_t length = aMessage.DetermineLengthAfterOffset();
 
     // Pseudo-header for checksum calculation (RFC-2460).
 
@@ -111,12 +175,9 @@ void Checksum::Calculate(const Ip6::Address &aSource,
 
     // Add message content (from offset to the end) to checksum.
 
-    aMessage.GetFirstChunk(aMessage.GetOffset(), length, chunk);
-
-    while (chunk.GetLength() > 0)
+    for (Message::SpanIterator iterator(aMessage, aMessage.GetOffset(), length); !iterator.IsDone(); iterator.Advance())
     {
-        AddData(chunk.GetBytes(), chunk.GetLength());
-        aMessage.GetNextChunk(length, chunk);
+        AddData(iterator.GetBytes(), iterator.GetLength());
     }
 }
 
@@ -125,8 +186,7 @@ void Checksum::Calculate(const Ip4::Address &aSource,
                          uint8_t             aIpProto,
                          const Message      &aMessage)
 {
-    Message::Chunk chunk;
-    uint16_t       length = aMessage.DetermineLengthAfterOffset();
+    uint16_t length = aMessage.DetermineLengthAfterOffset();
 
     // Pseudo-header for checksum calculation (RFC-768/792/793).
     // Note: ICMP checksum won't count the pseudo header like TCP and UDP.
@@ -140,12 +200,9 @@ void Checksum::Calculate(const Ip4::Address &aSource,
 
     // Add message content (from offset to the end) to checksum.
 
-    aMessage.GetFirstChunk(aMessage.GetOffset(), length, chunk);
-
-    while (chunk.GetLength() > 0)
+    for (Message::SpanIterator iterator(aMessage, aMessage.GetOffset(), length); !iterator.IsDone(); iterator.Advance())
     {
-        AddData(chunk.GetBytes(), chunk.GetLength());
-        aMessage.GetNextChunk(length, chunk);
+        AddData(iterator.GetBytes(), iterator.GetLength());
     }
 }
 
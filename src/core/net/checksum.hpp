@@ -115,6 +115,7 @@ private:
     void     AddUint8(uint8_t aUint8);
     void     AddUint16(uint16_t aUint16);
     void     AddData(const uint8_t *aBuffer, uint16_t aLength);
+    void     AddToValue(uint16_t aValue);
     void     WriteToMessage(uint16_t aOffset, Message &aMessage) const;
     void     Calculate(const Ip6::Address &aSource,
                        const Ip6::Address &aDestination,
@@ -210,6 +210,40 @@ exit:
     return error;
 }
 
+Error Name::AppendTo(Message &aMessage, CompressDictionary &aDictionary) const
+{
+    Error error;
+
+    if (IsFromCString())
+    {
+        error = AppendName(GetAsCString(), aMessage, aDictionary);
+    }
+    else if (IsFromMessage())
+    {
+        Buffer   name;
+        uint16_t offset = mOffset;
+
+        // A name read from a message is compressed only if it can be
+        // represented as a C string, i.e., none of its labels contain
+        // a dot character. Otherwise it is appended as is.
+
+        if (ReadName(*mMessage, offset, name) == kErrorNone)
+        {
+            error = AppendName(name, aMessage, aDictionary);
+        }
+        else
+        {
+            error = AppendTo(aMessage);
+        }
+    }
+    else
+    {
+        error = AppendTerminator(aMessage);
+    }
+
+    return error;
+}
+
 Error Name::AppendLabel(const char *aLabel, Message &aMessage)
 {
     return AppendLabel(aLabel, static_cast<uint8_t>(StringLength(aLabel, kMaxLabelSize)), aMessage);
@@ -326,6 +360,379 @@ exit:
     return error;
 }
 
+Error Name::AppendName(const char *aName, Message &aMessage, CompressDictionary &aDictionary)
+{
+    uint16_t nameOffset;
+
+    return AppendName(/* aFirstLabel */ nullptr, aName, aMessage, aDictionary, nameOffset);
+}
+
+Error Name::AppendName(const char         *aFirstLabel,
+                       const char         *aLabels,
+                       Message            &aMessage,
+                       CompressDictionary &aDictionary,
+                       uint16_t           &aNameOffset)
+{
+    // The labels are processed from the last one to the first one,
+    // computing the hash of each name suffix from the hash of the
+    // previous (shorter) one. The longest suffix present in
+    // `aDictionary` is replaced by a pointer label and only the
+    // labels before it are appended.
+    //
+    // `labelsEnd` is the length of `aLabels` excluding any trailing
+    // dot. `appendEnd` tracks the end of the prefix of `aLabels`
+    // that still needs to be appended (excluding the dot before the
+    // matched suffix).
+
+    Error    error        = kErrorNone;
+    uint16_t startOffset  = aMessage.GetLength() - aMessage.GetOffset();
+    uint8_t  firstLength  = 0;
+    uint16_t firstSize    = 0;
+    uint16_t labelsEnd    = 0;
+    uint16_t appendEnd    = 0;
+    uint16_t matchOffset  = CompressDictionary::kUnknownOffset;
+    uint32_t matchHash    = CompressDictionary::kRootHash;
+    uint32_t hash         = CompressDictionary::kRootHash;
+    bool     matching     = true;
+    bool     firstMatched = false;
+    uint16_t end;
+
+    if (aFirstLabel != nullptr)
+    {
+        firstLength = static_cast<uint8_t>(StringLength(aFirstLabel, kMaxLabelSize));
+        VerifyOrExit((0 < firstLength) && (firstLength <= kMaxLabelLength), error = kErrorInvalidArgs);
+        firstSize = firstLength + 1;
+    }
+
+    if (aLabels != nullptr)
+    {
+        labelsEnd = StringLength(aLabels, kMaxEncodedLength);
+        VerifyOrExit(labelsEnd < kMaxEncodedLength, error = kErrorInvalidArgs);
+
+        if ((labelsEnd > 0) && (aLabels[labelsEnd - 1] == kLabelSeparatorChar))
+        {
+            labelsEnd--;
+        }
+    }
+
+    // Encoded length: the first label, the labels in `aLabels` (each
+    // label takes its length plus one byte) and the terminator.
+
+    VerifyOrExit(firstSize + ((labelsEnd > 0) ? labelsEnd + 1 : 0) + 1 <= kMaxEncodedLength,
+                 error = kErrorInvalidArgs);
+
+    // Validate the labels and find the longest matching suffix.
+
+    appendEnd = labelsEnd;
+    end       = labelsEnd;
+
+    while (end > 0)
+    {
+        uint16_t start = end;
+
+        while ((start > 0) && (aLabels[start - 1] != kLabelSeparatorChar))
+        {
+            start--;
+        }
+
+        VerifyOrExit((start < end) && (end - start <= kMaxLabelLength), error = kErrorInvalidArgs);
+
+        hash = CompressDictionary::HashLabel(&aLabels[start], static_cast<uint8_t>(end - start), hash);
+
+        if (matching)
+        {
+            uint16_t offset = aDictionary.Find(aMessage, hash, nullptr, nullptr, &aLabels[start]);
+
+            if (offset != CompressDictionary::kUnknownOffset)
+            {
+                matchOffset = offset;
+                matchHash   = hash;
+                appendEnd   = (start > 0) ? start - 1 : 0;
+            }
+            else
+            {
+                matching = false;
+            }
+        }
+
+        if (start == 0)
+        {
+            break;
+        }
+
+        end = start - 1;
+        VerifyOrExit(end > 0, error = kErrorInvalidArgs);
+    }
+
+    if (matching && (aFirstLabel != nullptr))
+    {
+        uint16_t offset;
+
+        hash   = CompressDictionary::HashLabel(aFirstLabel, firstLength, hash);
+        offset = aDictionary.Find(aMessage, hash, aFirstLabel, nullptr, (aLabels != nullptr) ? aLabels : "");
+
+        if (offset != CompressDictionary::kUnknownOffset)
+        {
+            matchOffset  = offset;
+            firstMatched = true;
+        }
+    }
+
+    // Add the suffixes which are going to be appended to the
+    // dictionary, continuing from the hash of the matched suffix.
+
+    hash = matchHash;
+    end  = appendEnd;
+
+    while (end > 0)
+    {
+        uint16_t start = end;
+
+        while ((start > 0) && (aLabels[start - 1] != kLabelSeparatorChar))
+        {
+            start--;
+        }
+
+        hash = CompressDictionary::HashLabel(&aLabels[start], static_cast<uint8_t>(end - start), hash);
+        aDictionary.Add(hash, startOffset + firstSize + start);
+
+        end = (start > 0) ? start - 1 : 0;
+    }
+
+    if ((aFirstLabel != nullptr) && !firstMatched)
+    {
+        aDictionary.Add(CompressDictionary::HashLabel(aFirstLabel, firstLength, hash), startOffset);
+        SuccessOrExit(error = AppendLabel(aFirstLabel, firstLength, aMessage));
+    }
+
+    // Append the labels before the matched suffix, then either a
+    // pointer label to the matched suffix or the terminator.
+
+    if (appendEnd > 0)
+    {
+        uint16_t start = 0;
+
+        for (uint16_t index = 0; index <= appendEnd; index++)
+        {
+            if ((index == appendEnd) || (aLabels[index] == kLabelSeparatorChar))
+            {
+                SuccessOrExit(error = AppendLabel(&aLabels[start], static_cast<uint8_t>(index - start), aMessage));
+                start = index + 1;
+            }
+        }
+    }
+
+    if (matchOffset != CompressDictionary::kUnknownOffset)
+    {
+        SuccessOrExit(error = AppendPointerLabel(matchOffset, aMessage));
+    }
+    else
+    {
+        SuccessOrExit(error = AppendTerminator(aMessage));
+    }
+
+    // If nothing was appended before the pointer label, the name
+    // offset is the offset of its earlier occurrence.
+
+    aNameOffset = startOffset;
+
+    if ((matchOffset != CompressDictionary::kUnknownOffset) &&
+        (firstMatched || ((aFirstLabel == nullptr) && (appendEnd == 0))))
+    {
+        aNameOffset = matchOffset;
+    }
+
+exit:
+    return error;
+}
+
+void Name::CompressDictionary::Clear(void)
+{
+    mNumEntries = 0;
+    mExtraEntries.Clear();
+
+    for (uint16_t &bucket : mBuckets)
+    {
+        bucket = kNoEntry;
+    }
+}
+
+void Name::CompressDictionary::RestoreNumEntries(uint16_t aNumEntries)
+{
+    // Entries are always added at the head of their bucket list, so
+    // the entries added after `aNumEntries` can be removed in reverse
+    // order from the heads of their bucket lists.
+
+    while (mNumEntries > aNumEntries)
+    {
+        const Entry &entry = GetEntry(--mNumEntries);
+
+        mBuckets[GetBucket(entry.mHash)] = entry.mNext;
+
+        if (mNumEntries >= kNumEntries)
+        {
+            mExtraEntries.PopBack();
+        }
+    }
+}
+
+const Name::CompressDictionary::Entry &Name::CompressDictionary::GetEntry(uint16_t aIndex) const
+{
+    return (aIndex < kNumEntries) ? mEntries[aIndex] : mExtraEntries[aIndex - kNumEntries];
+}
+
+uint16_t Name::CompressDictionary::Find(const Message &aMessage,
+                                        const char    *aFirstLabel,
+                                        const char    *aLabels,
+                                        const char    *aDomain) const
+{
+    return Find(aMessage, HashName(aFirstLabel, aLabels, aDomain), aFirstLabel, aLabels, aDomain);
+}
+
+uint16_t Name::CompressDictionary::Find(const Message &aMessage,
+                                        uint32_t       aHash,
+                                        const char    *aFirstLabel,
+                                        const char    *aLabels,
+                                        const char    *aDomain) const
+{
+    uint16_t offset = kUnknownOffset;
+
+    for (uint16_t index = mBuckets[GetBucket(aHash)]; index != kNoEntry; index = GetEntry(index).mNext)
+    {
+        const Entry &entry = GetEntry(index);
+
+        if ((entry.mHash == aHash) && Matches(aMessage, entry.mOffset, aFirstLabel, aLabels, aDomain))
+        {
+            offset = entry.mOffset;
+            break;
+        }
+    }
+
+    return offset;
+}
+
+void Name::CompressDictionary::Add(const char *aFirstLabel, const char *aLabels, const char *aDomain, uint16_t aOffset)
+{
+    Add(HashName(aFirstLabel, aLabels, aDomain), aOffset);
+}
+
+void Name::CompressDictionary::Add(uint32_t aHash, uint16_t aOffset)
+{
+    uint8_t bucket = GetBucket(aHash);
+    Entry  *entry;
+
+    VerifyOrExit(aOffset != kUnknownOffset);
+    VerifyOrExit(aOffset <= kMaxOffset);
+    VerifyOrExit(mNumEntries < kNoEntry - 1);
+
+    if (mNumEntries < kNumEntries)
+    {
+        entry = &mEntries[mNumEntries];
+    }
+    else
+    {
+        entry = mExtraEntries.PushBack();
+        VerifyOrExit(entry != nullptr);
+    }
+
+    entry->mHash     = aHash;
+    entry->mOffset   = aOffset;
+    entry->mNext     = mBuckets[bucket];
+    mBuckets[bucket] = mNumEntries;
+    mNumEntries++;
+
+exit:
+    return;
+}
+
+uint32_t Name::CompressDictionary::HashLabel(const char *aLabel, uint8_t aLength, uint32_t aHash)
+{
+    // Hashes the encoded label (length byte followed by the label
+    // chars in lowercase) continuing from `aHash`, which is the hash
+    // of the suffix following the label.
+
+    Fnv1aHash hash(aHash);
+
+    hash.FeedByte(aLength);
+
+    for (; aLength > 0; aLength--, aLabel++)
+    {
+        hash.FeedByte(static_cast<uint8_t>(ToLowercase(*aLabel)));
+    }
+
+    return hash.GetHash();
+}
+
+uint32_t Name::CompressDictionary::HashLabels(const char *aLabels, uint32_t aHash)
+{
+    // Hashes a sequence of dot-separated labels from the last label
+    // to the first one.
+
+    uint16_t end;
+
+    VerifyOrExit(aLabels != nullptr);
+
+    end = StringLength(aLabels, kMaxEncodedLength);
+
+    if ((end > 0) && (aLabels[end - 1] == kLabelSeparatorChar))
+    {
+        end--;
+    }
+
+    while (end > 0)
+    {
+        uint16_t start = end;
+
+        while ((start > 0) && (aLabels[start - 1] != kLabelSeparatorChar))
+        {
+            start--;
+        }
+
+        aHash = HashLabel(&aLabels[start], static_cast<uint8_t>(end - start), aHash);
+        end   = (start > 0) ? start - 1 : 0;
+    }
+
+exit:
+    return aHash;
+}
+
+uint32_t Name::CompressDictionary::HashName(const char *aFirstLabel, const char *aLabels, const char *aDomain)
+{
+    uint32_t hash = HashLabels(aLabels, HashLabels(aDomain, kRootHash));
+
+    if (aFirstLabel != nullptr)
+    {
+        hash = HashLabel(aFirstLabel, static_cast<uint8_t>(StringLength(aFirstLabel, kMaxLabelSize)), hash);
+    }
+
+    return hash;
+}
+
+bool Name::CompressDictionary::Matches(const Message &aMessage,
+                                       uint16_t       aOffset,
+                                       const char    *aFirstLabel,
+                                       const char    *aLabels,
+                                       const char    *aDomain)
+{
+    bool     matches = false;
+    uint16_t offset  = aMessage.GetOffset() + aOffset;
+
+    if (aFirstLabel != nullptr)
+    {
+        SuccessOrExit(CompareLabel(aMessage, offset, aFirstLabel));
+    }
+
+    if ((aLabels != nullptr) && (*aLabels != kNullChar))
+    {
+        SuccessOrExit(CompareMultipleLabels(aMessage, offset, aLabels));
+    }
+
+    matches = (CompareName(aMessage, offset, (aDomain != nullptr) ? aDomain : "") == kErrorNone);
+
+exit:
+    return matches;
+}
+
 Error Name::ParseName(const Message &aMessage, uint16_t &aOffset)
 {
     Error         error;
@@ -46,7 +46,10 @@
 #include "common/data.hpp"
 #include "common/encoding.hpp"
 #include "common/equatable.hpp"
+#include "common/fnv_hash.hpp"
+#include "common/heap_array.hpp"
 #include "common/message.hpp"
+#include "common/non_copyable.hpp"
 #include "common/owned_ptr.hpp"
 #include "common/string.hpp"
 #include "common/type_traits.hpp"
@@ -468,6 +471,128 @@ public:
      */
     typedef char LabelBuffer[kMaxLabelSize];
 
+    /**
+     * Represents a DNS name compression dictionary associated with a message being prepared.
+     *
+     * The dictionary maps the hash of every name (and name suffix) appended to the message to the offset where it was
+     * appended. A later occurrence of the same name (or of a name sharing a suffix with it) can then be replaced by a
+     * pointer label after a single lookup, instead of comparing it against names in the message one by one.
+     *
+     * Names are hashed case-insensitively from the last label to the first one. A hash match is always verified
+     * against the message content before the offset is used. The first entries (up to
+     * `OPENTHREAD_CONFIG_DNS_NAME_COMPRESS_DICTIONARY_SIZE`) are kept in the dictionary itself and further entries are
+     * allocated from the heap. If this fails, the name is not added and a later occurrence of it is not compressed.
+     */
+    class CompressDictionary : private NonCopyable
+    {
+        friend class Name;
+
+    public:
+        /**
+         * Offset value indicating that a name is not in the dictionary (a name never starts at the DNS header).
+         */
+        static constexpr uint16_t kUnknownOffset = 0;
+
+        /**
+         * Initializes the `CompressDictionary` as empty.
+         */
+        CompressDictionary(void) { Clear(); }
+
+        /**
+         * Clears the dictionary, removing all entries.
+         */
+        void Clear(void);
+
+        /**
+         * Gets the number of entries in the dictionary.
+         *
+         * Along with `RestoreNumEntries()`, this can be used to revert the dictionary to an earlier state when a
+         * message is truncated back to an earlier length.
+         *
+         * @returns The number of entries.
+         */
+        uint16_t GetNumEntries(void) const { return mNumEntries; }
+
+        /**
+         * Removes all entries added after the dictionary had a given number of entries.
+         *
+         * @param[in] aNumEntries   The number of entries to keep (a value earlier returned by `GetNumEntries()`).
+         */
+        void RestoreNumEntries(uint16_t aNumEntries);
+
+        /**
+         * Searches the dictionary for a name given as separate components and returns its offset.
+         *
+         * @p aFirstLabel and @p aLabels follow the same rules as in `Matches()`, i.e., @p aFirstLabel (if not
+         * `nullptr`) is treated as a single label and @p aLabels (if not `nullptr`) is a sequence of dot-separated
+         * labels. @p aDomain can be `nullptr` (then treated as root).
+         *
+         * @param[in] aMessage      The message associated with the dictionary. `aMessage.GetOffset()` MUST point to the
+         *                          start of DNS header.
+         * @param[in] aFirstLabel   The first label. Can be `nullptr`.
+         * @param[in] aLabels       A string of dot-separated labels. Can be `nullptr`.
+         * @param[in] aDomain       The domain name. Can be `nullptr`.
+         *
+         * @returns The offset (from start of DNS header) of the name in @p aMessage, or `kUnknownOffset` if not found.
+         */
+        uint16_t Find(const Message &aMessage, const char *aFirstLabel, const char *aLabels, const char *aDomain) const;
+
+        /**
+         * Adds a name given as separate components, which is already appended in a message, to the dictionary.
+         *
+         * Only the full name is added (not its suffixes). Does nothing if @p aOffset is `kUnknownOffset` or cannot be
+         * used in a pointer label, or if the entry cannot be allocated.
+         *
+         * @param[in] aFirstLabel   The first label. Can be `nullptr`.
+         * @param[in] aLabels       A string of dot-separated labels. Can be `nullptr`.
+         * @param[in] aDomain       The domain name. Can be `nullptr`.
+         * @param[in] aOffset       The offset (from start of DNS header) of the name in the message.
+         */
+        void Add(const char *aFirstLabel, const char *aLabels, const char *aDomain, uint16_t aOffset);
+
+    private:
+        static constexpr uint16_t kNumEntries        = OPENTHREAD_CONFIG_DNS_NAME_COMPRESS_DICTIONARY_SIZE;
+        static constexpr uint8_t  kNumBuckets        = 16;
+        static constexpr uint16_t kNoEntry           = 0xffff;
+        static constexpr uint16_t kExtraEntriesDelta = 16;
+        static constexpr uint32_t kRootHash          = Fnv1aHash::kOffsetBasis;
+        static constexpr uint16_t kMaxOffset         = 0x3fff; // Largest offset a pointer label can encode.
+
+        static_assert(kNumEntries > 0, "OPENTHREAD_CONFIG_DNS_NAME_COMPRESS_DICTIONARY_SIZE must not be zero");
+        static_assert(kNumEntries < kMaxOffset, "OPENTHREAD_CONFIG_DNS_NAME_COMPRESS_DICTIONARY_SIZE is too large");
+
+        struct Entry
+        {
+            uint32_t mHash;
+            uint16_t mOffset;
+            uint16_t mNext;
+        };
+
+        const Entry &GetEntry(uint16_t aIndex) const;
+
+        uint16_t Find(const Message &aMessage,
+                      uint32_t       aHash,
+                      const char    *aFirstLabel,
+                      const char    *aLabels,
+                      const char    *aDomain) const;
+        void     Add(uint32_t aHash, uint16_t aOffset);
+
+        static uint8_t  GetBucket(uint32_t aHash) { return static_cast<uint8_t>(aHash % kNumBuckets); }
+        static uint32_t HashLabel(const char *aLabel, uint8_t aLength, uint32_t aHash);
+        static uint32_t HashLabels(const char *aLabels, uint32_t aHash);
+        static uint32_t HashName(const char *aFirstLabel, const char *aLabels, const char *aDomain);
+        static bool     Matches(const Message &aMessage,
+                                uint16_t       aOffset,
+                                const char    *aFirstLabel,
+                                const char    *aLabels,
+                                const char    *aDomain);
+
+        Entry                                  mEntries[kNumEntries];
+        Heap::Array<Entry, kExtraEntriesDelta> mExtraEntries;
+        uint16_t                               mBuckets[kNumBuckets];
+        uint16_t                               mNumEntries;
+    };
+
     /**
      * Represents the name type.
      */
@@ -631,6 +756,23 @@ public:
      */
     Error AppendTo(Message &aMessage) const;
 
+    /**
+     * Encodes and appends the name to a message using a compression dictionary.
+     *
+     * Behaves similar to `AppendTo(Message &)` but uses the static `AppendName()` with @p aDictionary to compress the
+     * name against the names previously appended to @p aMessage and to add the new name (and its suffixes) to
+     * @p aDictionary. If the name is from a message and contains a label with a dot character, it is appended
+     * uncompressed.
+     *
+     * @param[in] aMessage        The message to append to.
+     * @param[in] aDictionary     The compression dictionary associated with @p aMessage.
+     *
+     * @retval kErrorNone         Successfully encoded and appended the name to @p aMessage.
+     * @retval kErrorInvalidArgs  Name is not valid.
+     * @retval kErrorNoBufs       Insufficient available buffers to grow the message.
+     */
+    Error AppendTo(Message &aMessage, CompressDictionary &aDictionary) const;
+
     /**
      * Encodes and appends a single name label to a message.
      *
@@ -714,6 +856,50 @@ public:
      */
     static Error AppendName(const char *aName, Message &aMessage);
 
+    /**
+     * Encodes and appends a full name to a message using a compression dictionary.
+     *
+     * The @p aName follows the same format as in `AppendName(const char *aName, Message &)`.
+     *
+     * The longest suffix of @p aName found in @p aDictionary is replaced by a pointer label. The remaining labels are
+     * appended and the name along with each of its new suffixes are added to @p aDictionary. The cost is linear in the
+     * length of @p aName, independent of the number of names already in @p aMessage.
+     *
+     * @param[in]  aName              A name string. Can be `nullptr` (then treated as "." or root).
+     * @param[in]  aMessage           The message to append to. `aMessage.GetOffset()` MUST point to the start of DNS
+     *                                header.
+     * @param[in]  aDictionary        The compression dictionary associated with @p aMessage.
+     *
+     * @retval kErrorNone         Successfully encoded and appended the name to @p aMessage.
+     * @retval kErrorInvalidArgs  Name @p aName is not valid.
+     * @retval kErrorNoBufs       Insufficient available buffers to grow the message.
+     */
+    static Error AppendName(const char *aName, Message &aMessage, CompressDictionary &aDictionary);
+
+    /**
+     * Encodes and appends a full name given as a first label and a sequence of labels using a compression dictionary.
+     *
+     * @p aFirstLabel (if not `nullptr`) is appended as a single label and can itself include dot `.` character (e.g.,
+     * a service instance label). @p aLabels follows the same format as the name in `AppendName()`.
+     *
+     * @param[in]  aFirstLabel        The first label. Can be `nullptr`.
+     * @param[in]  aLabels            A string of dot-separated labels. Can be `nullptr`.
+     * @param[in]  aMessage           The message to append to. `aMessage.GetOffset()` MUST point to the start of DNS
+     *                                header.
+     * @param[in]  aDictionary        The compression dictionary associated with @p aMessage.
+     * @param[out] aNameOffset        On success, the offset (from start of DNS header) of the name in @p aMessage. If
+     *                                the full name was compressed, this is the offset of its earlier occurrence.
+     *
+     * @retval kErrorNone         Successfully encoded and appended the name to @p aMessage.
+     * @retval kErrorInvalidArgs  The name is not valid.
+     * @retval kErrorNoBufs       Insufficient available buffers to grow the message.
+     */
+    static Error AppendName(const char         *aFirstLabel,
+                            const char         *aLabels,
+                            Message            &aMessage,
+                            CompressDictionary &aDictionary,
+                            uint16_t           &aNameOffset);
+
     /**
      * Parses and skips over a full name in a message.
      *
@@ -383,7 +383,7 @@ Server::ResponseCode Server::Response::AddQuestionsFrom(const Request &aRequest)
     // service instance names with dot characters in the instance
     // label, are appended correctly.
 
-    SuccessOrExit(Name(*aRequest.mMessage, kQueryNameOffset).AppendTo(*mMessage));
+    SuccessOrExit(Name(*aRequest.mMessage, kQueryNameOffset).AppendTo(*mMessage, mCompressDictionary));
 
     mHeader.SetQuestionCount(aRequest.mHeader.GetQuestionCount());
 
@@ -469,6 +469,7 @@ Error Server::Response::ParseQueryName(void)
         if (Name::CompareName(*mMessage, comapreOffset, kDefaultDomainName) == kErrorNone)
         {
             mOffsets.mDomainName = offset;
+            AddDomainNameToCompressDictionary();
             ExitNow();
         }
 
@@ -485,6 +486,23 @@ exit:
     return error;
 }
 
+void Server::Response::AddDomainNameToCompressDictionary(void)
+{
+    // The domain name is normally already in the dictionary as a
+    // suffix of the query name. It is added explicitly when the
+    // query name could not be added (e.g., its instance label
+    // contains a dot character) or when the response is restored
+    // from a `ProxyQuery`.
+
+    VerifyOrExit(mCompressDictionary.Find(*mMessage, nullptr, nullptr, kDefaultDomainName) ==
+                 Name::CompressDictionary::kUnknownOffset);
+
+    mCompressDictionary.Add(nullptr, nullptr, kDefaultDomainName, mOffsets.mDomainName);
+
+exit:
+    return;
+}
+
 void Server::Response::ReadQueryName(Name::Buffer &aName) const { Server::ReadQueryName(*mMessage, aName); }
 
 bool Server::Response::QueryNameMatches(const char *aName) const { return Server::QueryNameMatches(*mMessage, aName); }
@@ -573,9 +591,12 @@ Error Server::Response::AppendSrvRecord(const char *aHostName,
     recordOffset = mMessage->GetLength();
     SuccessOrExit(error = mMessage->Append(srvRecord));
 
-    mOffsets.mHostName = mMessage->GetLength();
-    SuccessOrExit(error = Name::AppendMultipleLabels(hostLabels, *mMessage));
-    SuccessOrExit(error = Name::AppendPointerLabel(mOffsets.mDomainName, *mMessage));
+    // The host name is compressed against the previously appended
+    // names, so the same host name in multiple SRV records (or the
+    // domain name) is appended as a single pointer label.
+
+    SuccessOrExit(error = Name::AppendName(/* aFirstLabel */ nullptr, aHostName, *mMessage, mCompressDictionary,
+                                           mOffsets.mHostName));
 
     ResourceRecord::UpdateRecordLengthInMessage(*mMessage, recordOffset);
 
@@ -841,42 +862,49 @@ void Server::Response::Log(void) const
 
 Error Server::Response::ResolveBySrp(void)
 {
+    // The SRP server indexes its hosts and services by name, so we
+    // look up the query name directly instead of comparing it
+    // against every registered host and service.
+
     Error                       error          = kErrorNone;
+    const Srp::Server          &srpServer      = Get<Srp::Server>();
+    const Srp::Server::Host    *host           = nullptr;
+    const Srp::Server::Service *service        = nullptr;
     const Srp::Server::Service *matchedService = nullptr;
+    Name::Buffer                name;
 
     mSection = kAnswerSection;
 
-    for (const Srp::Server::Host &host : Get<Srp::Server>().GetHosts())
+    ReadQueryName(name);
+
+    host = srpServer.FindHost(name);
+
+    if ((host != nullptr) && !host->IsDeleted())
     {
-        if (host.IsDeleted())
-        {
-            continue;
-        }
+        error = ResolveUsingSrpHost(*host);
+        ExitNow();
+    }
 
-        if (QueryNameMatches(host.GetFullName()))
+    while ((service = srpServer.FindNextServiceByInstanceName(name, service)) != nullptr)
+    {
+        if (!service->IsDeleted() && !service->GetHost().IsDeleted())
         {
-            error = ResolveUsingSrpHost(host);
+            error = ResolveUsingSrpService(*service);
             ExitNow();
         }
+    }
 
-        for (const Srp::Server::Service &service : host.GetServices())
+    if (mQuestions.IsFor(kRrTypePtr) || mQuestions.IsFor(kRrTypeAny))
+    {
+        while ((service = srpServer.FindNextServiceByServiceName(name, service)) != nullptr)
         {
-            if (service.IsDeleted())
+            if (service->IsDeleted() || service->GetHost().IsDeleted())
             {
                 continue;
             }
 
-            if (QueryNameMatches(service.GetInstanceName()))
-            {
-                error = ResolveUsingSrpService(service);
-                ExitNow();
-            }
-
-            if ((mQuestions.IsFor(kRrTypePtr) || mQuestions.IsFor(kRrTypeAny)) && QueryNameMatchesService(service))
-            {
-                SuccessOrExit(error = AppendPtrRecord(service));
-                matchedService = &service;
-            }
+            SuccessOrExit(error = AppendPtrRecord(*service));
+            matchedService = service;
         }
     }
 
@@ -939,25 +967,6 @@ exit:
     return error;
 }
 
-bool Server::Response::QueryNameMatchesService(const Srp::Server::Service &aService) const
-{
-    // Check if the query name matches the base service name or any
-    // sub-type service names associated with `aService`.
-
-    bool matches = QueryNameMatches(aService.GetServiceName());
-
-    VerifyOrExit(!matches);
-
-    for (uint16_t index = 0; index < aService.GetNumberOfSubTypes(); index++)
-    {
-        matches = QueryNameMatches(aService.GetSubTypeServiceNameAt(index));
-        VerifyOrExit(!matches);
-    }
-
-exit:
-    return matches;
-}
-
 #endif // OPENTHREAD_CONFIG_SRP_SERVER_ENABLE
 
 #if OPENTHREAD_CONFIG_SRP_SERVER_ENABLE || OPENTHREAD_CONFIG_DNSSD_DISCOVERY_PROXY_ENABLE
@@ -1412,6 +1421,9 @@ void Server::Response::InitFrom(ProxyQuery &aQuery, const ProxyQueryInfo &aInfo)
     IgnoreError(mMessage->Read(0, mHeader));
     mQuestions = aInfo.mQuestions;
     mOffsets   = aInfo.mOffsets;
+
+    mCompressDictionary.Clear();
+    AddDomainNameToCompressDictionary();
 }
 
 void Server::Response::Answer(const ServiceInstanceInfo &aInstanceInfo, const Ip6::MessageInfo &aMessageInfo)
@@ -427,6 +427,7 @@ private:
         void  SetResponseCode(ResponseCode aResponseCode) { mHeader.SetResponseCode(aResponseCode); }
         bool  IsEmpty(void) const;
         Error ParseQueryName(void);
+        void  AddDomainNameToCompressDictionary(void);
         void  ReadQueryName(Name::Buffer &aName) const;
         bool  QueryNameMatches(const char *aName) const;
         bool  QueryNameIsForDomain(const char *aDomainName) const;
@@ -455,7 +456,6 @@ private:
         Error ResolveBySrp(void);
         Error ResolveUsingSrpHost(const Srp::Server::Host &aHost);
         Error ResolveUsingSrpService(const Srp::Server::Service &aService);
-        bool  QueryNameMatchesService(const Srp::Server::Service &aService) const;
         Error AppendPtrRecord(const Srp::Server::Service &aService);
         Error AppendSrvRecord(const Srp::Server::Service &aService);
         Error AppendTxtRecord(const Srp::Server::Service &aService);
@@ -482,11 +482,12 @@ private:
         void Log(void) const;
 #endif
 
-        OwnedPtr<Message> mMessage;
-        Header            mHeader;
-        Questions         mQuestions;
-        Section           mSection;
-        NameOffsets       mOffsets;
+        OwnedPtr<Message>        mMessage;
+        Header                   mHeader;
+        Questions                mQuestions;
+        Section                  mSection;
+        NameOffsets              mOffsets;
+        Name::CompressDictionary mCompressDictionary;
     };
 
     struct ProxyQueryInfo : Message::FooterData<ProxyQueryInfo>
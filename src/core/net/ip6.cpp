@@ -182,7 +182,7 @@ Error Ip6::PrepareMulticastToLargerThanRealmLocal(Message &aMessage, const Heade
     if (aHeader.GetDestination().IsMulticastLargerThanRealmLocal() &&
         Get<ChildTable>().HasSleepyChildWithAddress(aHeader.GetDestination()))
     {
-        Message *messageCopy = aMessage.Clone<kSameReservedHeader>();
+        Message *messageCopy = aMessage.Clone<kShareBuffers>();
 
         if (messageCopy != nullptr)
         {
@@ -908,7 +908,7 @@ Error Ip6::TakeOrCopyMessagePtr(OwnedPtr<Message> &aTargetPtr,
         break;
 
     case kCopyMessageToUse:
-        aTargetPtr.Reset(aMessagePtr->Clone<kNoReservedHeader>());
+        aTargetPtr.Reset(aMessagePtr->Clone<kShareBuffers>());
         break;
     }
 
@@ -413,7 +413,7 @@ void Mpl::HandleRetransmissionTimer(void)
 
             nextTime.UpdateIfEarlier(metadata.mTransmissionTime);
 
-            messageCopy = message.Clone<kSameReservedHeader>();
+            messageCopy = message.Clone<kShareBuffers>();
         }
         else
         {
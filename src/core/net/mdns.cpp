@@ -621,6 +621,16 @@ void Core::UpdateCompressOffset(uint16_t &aOffset, uint16_t aNewOffset)
     }
 }
 
+void Core::ConstructSubServiceType(const char *aServiceType, Name::Buffer &aSubServiceType)
+{
+    // Constructs the labels "_sub.<service type>" following a sub-type
+    // label in a sub-type service name.
+
+    StringWriter writer(aSubServiceType, sizeof(aSubServiceType));
+
+    writer.Append("%s.%s", kSubServiceLabel, aServiceType);
+}
+
 bool Core::QuestionMatches(uint16_t aQuestionRrType, uint16_t aRrType)
 {
     return (aQuestionRrType == aRrType) || (aQuestionRrType == ResourceRecord::kTypeAny);
@@ -2404,15 +2414,7 @@ void Core::HostEntry::AppendEntryName(Entry &aEntry, TxMessage &aTxMessage, Sect
 
 void Core::HostEntry::AppendNameTo(TxMessage &aTxMessage, Section aSection)
 {
-    AppendOutcome outcome;
-
-    outcome = aTxMessage.AppendMultipleLabels(aSection, mName.AsCString(), mNameOffset);
-    VerifyOrExit(outcome != kAppendedFullNameAsCompressed);
-
-    aTxMessage.AppendDomainName(aSection);
-
-exit:
-    return;
+    aTxMessage.AppendHostName(aSection, mName.AsCString(), mNameOffset);
 }
 
 void Core::HostEntry::MarkToAppendAddrRecordsInAdditionalData(void)
@@ -3057,8 +3059,11 @@ exit:
 void Core::ServiceEntry::DiscoverOffsetsAndHost(HostEntry *&aHostEntry)
 {
     // Discovers the `HostEntry` associated with this `ServiceEntry`
-    // and name compression offsets from the previously appended
-    // entries.
+    // and the host name compression offset from it. The compression
+    // offsets of names shared with other previously appended entries
+    // (service type, sub-types, host name) are found from the
+    // compression dictionary of `TxMessage` as the names are
+    // appended.
 
     // TODO: Need to handle name matching host name
 
@@ -3073,57 +3078,6 @@ void Core::ServiceEntry::DiscoverOffsetsAndHost(HostEntry *&aHostEntry)
     {
         UpdateCompressOffset(mHostNameOffset, aHostEntry->mNameOffset);
     }
-
-    for (ServiceEntry &other : Get<Core>().mServiceEntries)
-    {
-        // We only need to search up to `this` entry in the list,
-        // since entries after `this` are not yet processed and not
-        // yet appended in the response or the probe message.
-
-        if (&other == this)
-        {
-            break;
-        }
-
-        if (other.GetState() != GetState())
-        {
-            // Validate that both entries are in the same state,
-            // ensuring their records are appended in the same
-            // message, i.e., a probe or a response message.
-
-            continue;
-        }
-
-        if (NameMatch(mHostName, other.mHostName))
-        {
-            UpdateCompressOffset(mHostNameOffset, other.mHostNameOffset);
-        }
-
-        if (NameMatch(mServiceType, other.mServiceType))
-        {
-            UpdateCompressOffset(mServiceTypeOffset, other.mServiceTypeOffset);
-
-            if (GetState() == kProbing)
-            {
-                // No need to search for sub-type service offsets when
-                // we are still probing.
-
-                continue;
-            }
-
-            UpdateCompressOffset(mSubServiceTypeOffset, other.mSubServiceTypeOffset);
-
-            for (SubType &subType : mSubTypes)
-            {
-                const SubType *otherSubType = other.mSubTypes.FindMatching(subType.mLabel.AsCString());
-
-                if (otherSubType != nullptr)
-                {
-                    UpdateCompressOffset(subType.mSubServiceNameOffset, otherSubType->mSubServiceNameOffset);
-                }
-            }
-        }
-    }
 }
 
 void Core::ServiceEntry::UpdateServiceTypes(void)
@@ -3346,7 +3300,7 @@ void Core::ServiceEntry::AppendSubServiceTypeTo(TxMessage &aTxMessage, Section a
 {
     AppendOutcome outcome;
 
-    outcome = aTxMessage.AppendLabel(aSection, kSubServiceLabel, mSubServiceTypeOffset);
+    outcome = aTxMessage.AppendLabel(aSection, kSubServiceLabel, mServiceType.AsCString(), mSubServiceTypeOffset);
     VerifyOrExit(outcome != kAppendedFullNameAsCompressed);
 
     AppendServiceTypeTo(aTxMessage, aSection);
@@ -3358,8 +3312,12 @@ exit:
 void Core::ServiceEntry::AppendSubServiceNameTo(TxMessage &aTxMessage, Section aSection, SubType &aSubType)
 {
     AppendOutcome outcome;
+    Name::Buffer  subServiceType;
+
+    ConstructSubServiceType(mServiceType.AsCString(), subServiceType);
 
-    outcome = aTxMessage.AppendLabel(aSection, aSubType.mLabel.AsCString(), aSubType.mSubServiceNameOffset);
+    outcome = aTxMessage.AppendLabel(aSection, aSubType.mLabel.AsCString(), subServiceType,
+                                     aSubType.mSubServiceNameOffset);
     VerifyOrExit(outcome != kAppendedFullNameAsCompressed);
 
     AppendSubServiceTypeTo(aTxMessage, aSection);
@@ -3370,15 +3328,7 @@ exit:
 
 void Core::ServiceEntry::AppendHostNameTo(TxMessage &aTxMessage, Section aSection)
 {
-    AppendOutcome outcome;
-
-    outcome = aTxMessage.AppendMultipleLabels(aSection, mHostName.AsCString(), mHostNameOffset);
-    VerifyOrExit(outcome != kAppendedFullNameAsCompressed);
-
-    aTxMessage.AppendDomainName(aSection);
-
-exit:
-    return;
+    aTxMessage.AppendHostName(aSection, mHostName.AsCString(), mHostNameOffset);
 }
 
 #if OPENTHREAD_CONFIG_MULTICAST_DNS_ENTRY_ITERATION_API_ENABLE
@@ -3551,42 +3501,24 @@ void Core::ServiceType::PrepareResponse(EntryContext &aContext)
 
 void Core::ServiceType::PrepareResponseRecords(EntryContext &aContext)
 {
-    uint16_t serviceTypeOffset = kUnspecifiedOffset;
-
     VerifyOrExit(mServicesPtr.ShouldAppendTo(aContext));
 
-    // Discover compress offset for `mServiceType` if previously
-    // appended from any `ServiceEntry`.
-
-    for (const ServiceEntry &serviceEntry : Get<Core>().mServiceEntries)
-    {
-        if (serviceEntry.GetState() != Entry::kRegistered)
-        {
-            continue;
-        }
-
-        if (NameMatch(mServiceType, serviceEntry.mServiceType))
-        {
-            UpdateCompressOffset(serviceTypeOffset, serviceEntry.mServiceTypeOffset);
-
-            if (serviceTypeOffset != kUnspecifiedOffset)
-            {
-                break;
-            }
-        }
-    }
+    // The compress offset for `mServiceType` (if previously appended
+    // from any `ServiceEntry`) is found from the compression
+    // dictionary of the response message.
 
-    AppendPtrRecordTo(aContext.mResponseMessage, serviceTypeOffset);
+    AppendPtrRecordTo(aContext.mResponseMessage);
 
 exit:
     return;
 }
 
-void Core::ServiceType::AppendPtrRecordTo(TxMessage &aResponse, uint16_t aServiceTypeOffset)
+void Core::ServiceType::AppendPtrRecordTo(TxMessage &aResponse)
 {
     Message  *message;
     PtrRecord ptr;
     uint16_t  offset;
+    uint16_t  serviceTypeOffset = kUnspecifiedOffset;
 
     VerifyOrExit(mServicesPtr.CanAppend());
     mServicesPtr.MarkAsAppended(aResponse, kAnswerSection);
@@ -3606,7 +3538,7 @@ void Core::ServiceType::AppendPtrRecordTo(TxMessage &aResponse, uint16_t aServic
     aResponse.AppendServicesDnssdName(kAnswerSection);
     offset = message->GetLength();
     SuccessOrAssert(message->Append(ptr));
-    aResponse.AppendServiceType(kAnswerSection, mServiceType.AsCString(), aServiceTypeOffset);
+    aResponse.AppendServiceType(kAnswerSection, mServiceType.AsCString(), serviceTypeOffset);
     ResourceRecord::UpdateRecordLengthInMessage(*message, offset);
 
     aResponse.IncrementRecordCount(kAnswerSection);
@@ -3642,13 +3574,16 @@ void Core::TxMessage::Init(Type aType, uint16_t aMessageId)
 
     mRecordCounts.Clear();
     mSavedRecordCounts.Clear();
-    mSavedMsgLength      = 0;
-    mSavedExtraMsgLength = 0;
-    mDomainOffset        = kUnspecifiedOffset;
-    mUdpOffset           = kUnspecifiedOffset;
-    mTcpOffset           = kUnspecifiedOffset;
-    mServicesDnssdOffset = kUnspecifiedOffset;
-    mType                = aType;
+    mSavedMsgLength          = 0;
+    mSavedExtraMsgLength     = 0;
+    mSavedNumCompressEntries = 0;
+    mDomainOffset            = kUnspecifiedOffset;
+    mUdpOffset               = kUnspecifiedOffset;
+    mTcpOffset               = kUnspecifiedOffset;
+    mServicesDnssdOffset     = kUnspecifiedOffset;
+    mType                    = aType;
+
+    mCompressDictionary.Clear();
 
     // Allocate messages. The main `mMsgPtr` is always allocated.
     // The Authority and Addition section messages are allocated
@@ -3729,6 +3664,40 @@ Core::AppendOutcome Core::TxMessage::AppendLabel(Section aSection, const char *a
     return AppendLabels(aSection, aLabel, kIsSingleLabel, aCompressOffset);
 }
 
+Core::AppendOutcome Core::TxMessage::AppendLabel(Section     aSection,
+                                                 const char *aLabel,
+                                                 const char *aNextLabels,
+                                                 uint16_t   &aCompressOffset)
+{
+    // Appends `aLabel` as the first label of the name formed by
+    // `aLabel`, `aNextLabels` and the `local.` domain. The caller
+    // then appends the rest of the name unless the full name is
+    // appended as compressed.
+    //
+    // If `aCompressOffset` is not yet known, the name is searched in
+    // the compression dictionary (it may be appended before by
+    // another entry). If the label is appended now, the name is added
+    // to the dictionary.
+
+    static_assert(kUnspecifiedOffset == Name::CompressDictionary::kUnknownOffset, "kUnspecifiedOffset is invalid");
+
+    AppendOutcome outcome;
+
+    if (aCompressOffset == kUnspecifiedOffset)
+    {
+        aCompressOffset = mCompressDictionary.Find(*mMsgPtr, aLabel, aNextLabels, kLocalDomain);
+    }
+
+    outcome = AppendLabel(aSection, aLabel, aCompressOffset);
+
+    if (outcome == kAppendedLabels)
+    {
+        mCompressDictionary.Add(aLabel, aNextLabels, kLocalDomain, aCompressOffset);
+    }
+
+    return outcome;
+}
+
 Core::AppendOutcome Core::TxMessage::AppendMultipleLabels(Section     aSection,
                                                           const char *aLabels,
                                                           uint16_t   &aCompressOffset)
@@ -3790,6 +3759,11 @@ void Core::TxMessage::AppendServiceType(Section aSection, const char *aServiceTy
     Name::Buffer  labelsBuffer;
     AppendOutcome outcome;
 
+    if (aCompressOffset == kUnspecifiedOffset)
+    {
+        aCompressOffset = mCompressDictionary.Find(*mMsgPtr, nullptr, aServiceType, kLocalDomain);
+    }
+
     if (Name::ExtractLabels(serviceLabels, kUdpServiceLabel, labelsBuffer) == kErrorNone)
     {
         isUdp         = true;
@@ -3804,6 +3778,8 @@ void Core::TxMessage::AppendServiceType(Section aSection, const char *aServiceTy
     outcome = AppendMultipleLabels(aSection, serviceLabels, aCompressOffset);
     VerifyOrExit(outcome != kAppendedFullNameAsCompressed);
 
+    mCompressDictionary.Add(nullptr, aServiceType, kLocalDomain, aCompressOffset);
+
     if (isUdp)
     {
         outcome = AppendLabel(aSection, kUdpServiceLabel, mUdpOffset);
@@ -3821,6 +3797,31 @@ exit:
     return;
 }
 
+void Core::TxMessage::AppendHostName(Section aSection, const char *aHostName, uint16_t &aCompressOffset)
+{
+    // Appends a host name (labels followed by `local.` domain) to the
+    // message in the specified section, using compression if
+    // possible. The same host name can be appended by a `HostEntry`
+    // and multiple `ServiceEntry` so it is also searched in and
+    // added to the compression dictionary.
+
+    AppendOutcome outcome;
+
+    if (aCompressOffset == kUnspecifiedOffset)
+    {
+        aCompressOffset = mCompressDictionary.Find(*mMsgPtr, nullptr, aHostName, kLocalDomain);
+    }
+
+    outcome = AppendMultipleLabels(aSection, aHostName, aCompressOffset);
+    VerifyOrExit(outcome != kAppendedFullNameAsCompressed);
+
+    mCompressDictionary.Add(nullptr, aHostName, kLocalDomain, aCompressOffset);
+    AppendDomainName(aSection);
+
+exit:
+    return;
+}
+
 void Core::TxMessage::AppendDomainName(Section aSection)
 {
     Message &message = SelectMessageFor(aSection);
@@ -3907,9 +3908,10 @@ bool Core::TxMessage::IsOverSizeLimit(void) const
 
 void Core::TxMessage::SaveCurrentState(void)
 {
-    mSavedRecordCounts   = mRecordCounts;
-    mSavedMsgLength      = mMsgPtr->GetLength();
-    mSavedExtraMsgLength = mExtraMsgPtr.IsNull() ? 0 : mExtraMsgPtr->GetLength();
+    mSavedRecordCounts       = mRecordCounts;
+    mSavedMsgLength          = mMsgPtr->GetLength();
+    mSavedExtraMsgLength     = mExtraMsgPtr.IsNull() ? 0 : mExtraMsgPtr->GetLength();
+    mSavedNumCompressEntries = mCompressDictionary.GetNumEntries();
 }
 
 void Core::TxMessage::RestoreToSavedState(void)
@@ -3917,6 +3919,7 @@ void Core::TxMessage::RestoreToSavedState(void)
     mRecordCounts = mSavedRecordCounts;
 
     IgnoreError(mMsgPtr->SetLength(mSavedMsgLength));
+    mCompressDictionary.RestoreNumEntries(mSavedNumCompressEntries);
 
     if (!mExtraMsgPtr.IsNull())
     {
@@ -6175,8 +6178,6 @@ void Core::BrowseCache::PreparePtrQuestion(TxMessage &aQuery, TimeMilli aNow)
 {
     Question question;
 
-    DiscoverCompressOffsets();
-
     question.SetType(ResourceRecord::kTypePtr);
     question.SetClass(ResourceRecord::kClassInternet);
 
@@ -6196,57 +6197,19 @@ void Core::BrowseCache::PreparePtrQuestion(TxMessage &aQuery, TimeMilli aNow)
     }
 }
 
-void Core::BrowseCache::DiscoverCompressOffsets(void)
-{
-    for (const BrowseCache &browseCache : Get<Core>().mBrowseCacheList)
-    {
-        if (&browseCache == this)
-        {
-            break;
-        }
-
-        if (NameMatch(browseCache.mServiceType, mServiceType))
-        {
-            UpdateCompressOffset(mServiceTypeOffset, browseCache.mServiceTypeOffset);
-            UpdateCompressOffset(mSubServiceTypeOffset, browseCache.mSubServiceTypeOffset);
-            VerifyOrExit(mSubServiceTypeOffset == kUnspecifiedOffset);
-        }
-    }
-
-    VerifyOrExit(mServiceTypeOffset == kUnspecifiedOffset);
-
-    for (const SrvCache &srvCache : Get<Core>().mSrvCacheList)
-    {
-        if (NameMatch(srvCache.mServiceType, mServiceType))
-        {
-            UpdateCompressOffset(mServiceTypeOffset, srvCache.mServiceTypeOffset);
-            VerifyOrExit(mServiceTypeOffset == kUnspecifiedOffset);
-        }
-    }
-
-    for (const TxtCache &txtCache : Get<Core>().mTxtCacheList)
-    {
-        if (NameMatch(txtCache.mServiceType, mServiceType))
-        {
-            UpdateCompressOffset(mServiceTypeOffset, txtCache.mServiceTypeOffset);
-            VerifyOrExit(mServiceTypeOffset == kUnspecifiedOffset);
-        }
-    }
-
-exit:
-    return;
-}
-
 void Core::BrowseCache::AppendServiceTypeOrSubTypeTo(TxMessage &aTxMessage, Section aSection)
 {
     if (!mSubTypeLabel.IsNull())
     {
         AppendOutcome outcome;
+        Name::Buffer  subServiceType;
 
-        outcome = aTxMessage.AppendLabel(aSection, mSubTypeLabel.AsCString(), mSubServiceNameOffset);
+        ConstructSubServiceType(mServiceType.AsCString(), subServiceType);
+
+        outcome = aTxMessage.AppendLabel(aSection, mSubTypeLabel.AsCString(), subServiceType, mSubServiceNameOffset);
         VerifyOrExit(outcome != kAppendedFullNameAsCompressed);
 
-        outcome = aTxMessage.AppendLabel(aSection, kSubServiceLabel, mSubServiceTypeOffset);
+        outcome = aTxMessage.AppendLabel(aSection, kSubServiceLabel, mServiceType.AsCString(), mSubServiceTypeOffset);
         VerifyOrExit(outcome != kAppendedFullNameAsCompressed);
     }
 
@@ -6415,7 +6378,8 @@ void Core::ServiceCache::AppendServiceNameTo(TxMessage &aTxMessage, Section aSec
 {
     AppendOutcome outcome;
 
-    outcome = aTxMessage.AppendLabel(aSection, mServiceInstance.AsCString(), mServiceNameOffset);
+    outcome =
+        aTxMessage.AppendLabel(aSection, mServiceInstance.AsCString(), mServiceType.AsCString(), mServiceNameOffset);
     VerifyOrExit(outcome != kAppendedFullNameAsCompressed);
 
     aTxMessage.AppendServiceType(aSection, mServiceType.AsCString(), mServiceTypeOffset);
@@ -6564,31 +6528,9 @@ exit:
 
 void Core::SrvCache::PrepareSrvQuestion(TxMessage &aQuery)
 {
-    DiscoverCompressOffsets();
     PrepareQueryQuestion(aQuery, ResourceRecord::kTypeSrv);
 }
 
-void Core::SrvCache::DiscoverCompressOffsets(void)
-{
-    for (const SrvCache &srvCache : Get<Core>().mSrvCacheList)
-    {
-        if (&srvCache == this)
-        {
-            break;
-        }
-
-        if (NameMatch(srvCache.mServiceType, mServiceType))
-        {
-            UpdateCompressOffset(mServiceTypeOffset, srvCache.mServiceTypeOffset);
-        }
-
-        if (mServiceTypeOffset != kUnspecifiedOffset)
-        {
-            break;
-        }
-    }
-}
-
 void Core::SrvCache::ProcessExpiredRecords(TimeMilli aNow)
 {
     if (mRecord.ShouldExpire(aNow))
@@ -6734,48 +6676,9 @@ exit:
 
 void Core::TxtCache::PrepareTxtQuestion(TxMessage &aQuery)
 {
-    DiscoverCompressOffsets();
     PrepareQueryQuestion(aQuery, ResourceRecord::kTypeTxt);
 }
 
-void Core::TxtCache::DiscoverCompressOffsets(void)
-{
-    for (const SrvCache &srvCache : Get<Core>().mSrvCacheList)
-    {
-        if (!NameMatch(srvCache.mServiceType, mServiceType))
-        {
-            continue;
-        }
-
-        UpdateCompressOffset(mServiceTypeOffset, srvCache.mServiceTypeOffset);
-
-        if (NameMatch(srvCache.mServiceInstance, mServiceInstance))
-        {
-            UpdateCompressOffset(mServiceNameOffset, srvCache.mServiceNameOffset);
-        }
-
-        VerifyOrExit(mServiceNameOffset == kUnspecifiedOffset);
-    }
-
-    for (const TxtCache &txtCache : Get<Core>().mTxtCacheList)
-    {
-        if (&txtCache == this)
-        {
-            break;
-        }
-
-        if (NameMatch(txtCache.mServiceType, mServiceType))
-        {
-            UpdateCompressOffset(mServiceTypeOffset, txtCache.mServiceTypeOffset);
-        }
-
-        VerifyOrExit(mServiceTypeOffset == kUnspecifiedOffset);
-    }
-
-exit:
-    return;
-}
-
 void Core::TxtCache::ProcessExpiredRecords(TimeMilli aNow)
 {
     if (mRecord.ShouldExpire(aNow))
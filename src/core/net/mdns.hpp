@@ -1472,7 +1472,7 @@ private:
 
     private:
         void PrepareResponseRecords(EntryContext &aContext);
-        void AppendPtrRecordTo(TxMessage &aResponse, uint16_t aServiceTypeOffset);
+        void AppendPtrRecordTo(TxMessage &aResponse);
 
         ServiceType *mNext;
         Heap::String mServiceType;
@@ -1499,8 +1499,13 @@ private:
         Type          GetType(void) const { return mType; }
         Message      &SelectMessageFor(Section aSection);
         AppendOutcome AppendLabel(Section aSection, const char *aLabel, uint16_t &aCompressOffset);
+        AppendOutcome AppendLabel(Section     aSection,
+                                  const char *aLabel,
+                                  const char *aNextLabels,
+                                  uint16_t   &aCompressOffset);
         AppendOutcome AppendMultipleLabels(Section aSection, const char *aLabels, uint16_t &aCompressOffset);
         void          AppendServiceType(Section aSection, const char *aServiceType, uint16_t &aCompressOffset);
+        void          AppendHostName(Section aSection, const char *aHostName, uint16_t &aCompressOffset);
         void          AppendDomainName(Section aSection);
         void          AppendServicesDnssdName(Section aSection);
         void          AddQuestionFrom(const Message &aMessage);
@@ -1526,18 +1531,20 @@ private:
 
         static const char *TypeToString(Type aType);
 
-        RecordCounts      mRecordCounts;
-        OwnedPtr<Message> mMsgPtr;
-        OwnedPtr<Message> mExtraMsgPtr;
-        RecordCounts      mSavedRecordCounts;
-        uint16_t          mSavedMsgLength;
-        uint16_t          mSavedExtraMsgLength;
-        uint16_t          mDomainOffset;        // Offset for domain name `.local.` for name compression.
-        uint16_t          mUdpOffset;           // Offset to `_udp.local.`
-        uint16_t          mTcpOffset;           // Offset to `_tcp.local.`
-        uint16_t          mServicesDnssdOffset; // Offset to `_services._dns-sd`
-        AddressInfo       mUnicastDest;
-        Type              mType;
+        RecordCounts             mRecordCounts;
+        OwnedPtr<Message>        mMsgPtr;
+        OwnedPtr<Message>        mExtraMsgPtr;
+        RecordCounts             mSavedRecordCounts;
+        uint16_t                 mSavedMsgLength;
+        uint16_t                 mSavedExtraMsgLength;
+        uint16_t                 mSavedNumCompressEntries;
+        uint16_t                 mDomainOffset;        // Offset for domain name `.local.` for name compression.
+        uint16_t                 mUdpOffset;           // Offset to `_udp.local.`
+        uint16_t                 mTcpOffset;           // Offset to `_tcp.local.`
+        uint16_t                 mServicesDnssdOffset; // Offset to `_services._dns-sd`
+        Name::CompressDictionary mCompressDictionary;  // Names shared by entries (service types, host names).
+        AddressInfo              mUnicastDest;
+        Type                     mType;
     };
 
     // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -1945,7 +1952,6 @@ private:
         Error Init(Instance &aInstance, const Browser &aBrowser);
         void  AppendServiceTypeOrSubTypeTo(TxMessage &aTxMessage, Section aSection);
         void  AppendKnownAnswer(TxMessage &aTxMessage, const PtrEntry &aPtrEntry, TimeMilli aNow);
-        void  DiscoverCompressOffsets(void);
 
         BrowseCache         *mNext;
         Heap::String         mServiceType;
@@ -2029,7 +2035,6 @@ private:
         Error Init(Instance &aInstance, const ServiceName &aServiceName);
         Error Init(Instance &aInstance, const SrvResolver &aResolver);
         void  PrepareSrvQuestion(TxMessage &aQuery);
-        void  DiscoverCompressOffsets(void);
         void  ProcessExpiredRecords(TimeMilli aNow);
         void  ReportResultTo(ResultCallback &aCallback) const;
         void  ConvertTo(SrvResult &aResult) const;
@@ -2067,7 +2072,6 @@ private:
         Error Init(Instance &aInstance, const ServiceName &aServiceName);
         Error Init(Instance &aInstance, const TxtResolver &aResolver);
         void  PrepareTxtQuestion(TxMessage &aQuery);
-        void  DiscoverCompressOffsets(void);
         void  ProcessExpiredRecords(TimeMilli aNow);
         void  ReportResultTo(ResultCallback &aCallback) const;
         void  ConvertTo(TxtResult &aResult) const;
@@ -2371,6 +2375,7 @@ private:
                                            Section         aSection,
                                            bool            aIsLegacyUnicast = false);
     static void     UpdateCompressOffset(uint16_t &aOffset, uint16_t aNewOffse);
+    static void     ConstructSubServiceType(const char *aServiceType, Name::Buffer &aSubServiceType);
     static bool     QuestionMatches(uint16_t aQuestionRrType, uint16_t aRrType);
     static bool     RrClassIsInternetOrAny(uint16_t aRrClass);
 
@@ -59,6 +59,7 @@ Translator::Translator(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mState(kStateDisabled)
     , mMappingPool(aInstance)
+    , mLeastRecentlyUsed(nullptr)
     , mMinHostId(0)
     , mMaxHostId(0)
     , mNextHostId(0)
@@ -132,7 +133,7 @@ Error Translator::TranslateIp6ToIp4(Message &aMessage)
         ExitNow(error = kErrorAbort);
     }
 
-    mapping = mActiveMappings.FindMatching(ip6Headers);
+    mapping = FindMapping(ip6Headers);
 
     if (mapping == nullptr)
     {
@@ -147,7 +148,7 @@ Error Translator::TranslateIp6ToIp4(Message &aMessage)
         ExitNow(error = kErrorDrop);
     }
 
-    mapping->Touch(ip6Headers.GetIpProto());
+    MarkMappingAsUsed(*mapping, ip6Headers.GetIpProto());
 
 #if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
     srcPortOrId = mapping->mTranslatedPortOrId;
@@ -232,7 +233,7 @@ Error Translator::TranslateIp4ToIp6(Message &aMessage)
         ExitNow(error = kErrorDrop);
     }
 
-    mapping = mActiveMappings.FindMatching(ip4Headers);
+    mapping = FindMapping(ip4Headers);
 
     if (mapping == nullptr)
     {
@@ -241,7 +242,7 @@ Error Translator::TranslateIp4ToIp6(Message &aMessage)
         ExitNow(error = kErrorDrop);
     }
 
-    mapping->Touch(ip4Headers.GetIpProto());
+    MarkMappingAsUsed(*mapping, ip4Headers.GetIpProto());
 
 #if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
     dstPortOrId = mapping->mSrcPortOrId;
@@ -376,7 +377,7 @@ uint16_t Translator::AllocateSourcePort(uint16_t aSrcPort)
             port++;
         }
 
-    } while (mActiveMappings.ContainsMatching(port));
+    } while (FindMapping(mIp4Index, DetermineIp4Key(port), port) != nullptr);
 
     return port;
 }
@@ -415,7 +416,7 @@ Error Translator::AllocateIp4Address(Ip4::Address &aIp4Address)
     do
     {
         GetNextIp4Address(aIp4Address);
-    } while (mActiveMappings.ContainsMatching(aIp4Address));
+    } while (FindMapping(mIp4Index, DetermineIp4Key(aIp4Address), aIp4Address) != nullptr);
 
 exit:
     return error;
@@ -453,7 +454,6 @@ Translator::Mapping *Translator::AllocateMapping(const Ip6::Headers &aIp6Headers
 
     VerifyOrExit(mapping != nullptr);
 
-    mActiveMappings.Push(*mapping);
     mapping->mCounters.Clear();
     mapping->mId         = ++mNextMappingId;
     mapping->mIp6Address = aIp6Headers.GetSourceAddress();
@@ -462,6 +462,9 @@ Translator::Mapping *Translator::AllocateMapping(const Ip6::Headers &aIp6Headers
     mapping->mSrcPortOrId        = GetSourcePortOrIcmp6Id(aIp6Headers);
     mapping->mTranslatedPortOrId = AllocateSourcePort(mapping->mSrcPortOrId);
 #endif
+    mapping->mLastUseTime = TimerMilli::GetNow();
+
+    AddMapping(*mapping);
 
     LogInfo("Mapping created: %s", mapping->ToString().AsCString());
 
@@ -543,36 +546,212 @@ void Translator::EvictStaleMapping(void)
     // First tries to remove expired mappings, if there is no expired
     // mapping, it will then try to evict a stale mapping.
 
-    TimeMilli      now            = TimerMilli::GetNow();
-    const Mapping *evictCandidate = nullptr;
-    bool           didRemoveAny;
+    TimeMilli now            = TimerMilli::GetNow();
+    Mapping  *evictCandidate = nullptr;
 
-    didRemoveAny = mActiveMappings.RemoveAndFreeAllMatching(ExpirationChecker(now));
+    VerifyOrExit(!RemoveExpiredMappings(now));
 
-    VerifyOrExit(!didRemoveAny);
+    // Mappings are ordered by their last use, so we only need to
+    // check them starting from the least recently used one until
+    // we reach a mapping that is not yet eligible for eviction.
 
-    for (const Mapping &mapping : mActiveMappings)
+    for (Mapping *mapping = mLeastRecentlyUsed; mapping != nullptr; mapping = mapping->mPrev)
     {
-        if (!mapping.IsEligibleForEviction(now))
+        if (!mapping->IsEligibleForEviction(now))
         {
-            continue;
+            break;
         }
 
-        if ((evictCandidate == nullptr) || mapping.IsBetterEvictionCandidateOver(*evictCandidate, now))
+        if ((evictCandidate == nullptr) || mapping->IsBetterEvictionCandidateOver(*evictCandidate, now))
         {
-            evictCandidate = &mapping;
+            evictCandidate = mapping;
         }
     }
 
     if (evictCandidate != nullptr)
     {
-        mActiveMappings.RemoveMatching(*evictCandidate);
+        RemoveMapping(*evictCandidate);
     }
 
 exit:
     return;
 }
 
+Translator::Mapping *Translator::FindMapping(const Ip6::Headers &aIp6Headers)
+{
+    uint16_t srcPortOrId = 0;
+
+#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+    srcPortOrId = GetSourcePortOrIcmp6Id(aIp6Headers);
+#endif
+
+    return FindMapping(mIp6Index, DetermineIp6Key(aIp6Headers.GetSourceAddress(), srcPortOrId), aIp6Headers);
+}
+
+Translator::Mapping *Translator::FindMapping(const Ip4::Headers &aIp4Headers)
+{
+#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+    uint32_t key = DetermineIp4Key(GetDestinationPortOrIcmp4Id(aIp4Headers));
+#else
+    uint32_t key = DetermineIp4Key(aIp4Headers.GetDestinationAddress());
+#endif
+
+    return FindMapping(mIp4Index, key, aIp4Headers);
+}
+
+template <typename MatcherType>
+Translator::Mapping *Translator::FindMapping(const MappingIndex &aIndex, uint32_t aKey, const MatcherType &aMatcher)
+{
+    Mapping *mapping = nullptr;
+
+    for (uint16_t slot = aIndex.FindFirst(aKey); slot != MappingIndex::kNotFound; slot = aIndex.FindNext(aKey, slot))
+    {
+        Mapping &candidate = mMappingPool.GetEntryAt(aIndex.GetValueAt(slot));
+
+        if (candidate.Matches(aMatcher))
+        {
+            mapping = &candidate;
+            break;
+        }
+    }
+
+    return mapping;
+}
+
+void Translator::AddMapping(Mapping &aMapping)
+{
+    LinkMappingAtHead(aMapping);
+    SuccessOrAssert(mIp6Index.Add(DetermineIp6Key(aMapping), mMappingPool.GetIndexOf(aMapping)));
+    SuccessOrAssert(mIp4Index.Add(DetermineIp4Key(aMapping), mMappingPool.GetIndexOf(aMapping)));
+}
+
+void Translator::RemoveMapping(Mapping &aMapping)
+{
+    // Removes the mapping from the active list and the indexes, and
+    // frees it.
+
+    IgnoreError(mIp6Index.Remove(DetermineIp6Key(aMapping), mMappingPool.GetIndexOf(aMapping)));
+    IgnoreError(mIp4Index.Remove(DetermineIp4Key(aMapping), mMappingPool.GetIndexOf(aMapping)));
+    UnlinkMapping(aMapping);
+    aMapping.Free();
+}
+
+void Translator::RemoveAllMappings(void)
+{
+    mActiveMappings.Free();
+    mLeastRecentlyUsed = nullptr;
+    mIp6Index.Clear();
+    mIp4Index.Clear();
+}
+
+bool Translator::RemoveExpiredMappings(TimeMilli aNow)
+{
+    // A mapping can only be expired if it has not been used for at
+    // least the shorter of the two timeouts, so we only need to
+    // check mappings starting from the least recently used one
+    // until we reach one that is used more recently than that.
+
+    bool              didRemoveAny = false;
+    ExpirationChecker checker(aNow);
+    Mapping          *mapping = mLeastRecentlyUsed;
+
+    while ((mapping != nullptr) && (mapping->DetermineDurationSinceUse(aNow) >= Min(kIdleTimeout, kIcmpTimeout)))
+    {
+        Mapping *prev = mapping->mPrev;
+
+        if (mapping->Matches(checker))
+        {
+            RemoveMapping(*mapping);
+            didRemoveAny = true;
+        }
+
+        mapping = prev;
+    }
+
+    return didRemoveAny;
+}
+
+void Translator::LinkMappingAtHead(Mapping &aMapping)
+{
+    Mapping *head = mActiveMappings.GetHead();
+
+    aMapping.mPrev = nullptr;
+    mActiveMappings.Push(aMapping);
+
+    if (head != nullptr)
+    {
+        head->mPrev = &aMapping;
+    }
+    else
+    {
+        mLeastRecentlyUsed = &aMapping;
+    }
+}
+
+void Translator::UnlinkMapping(Mapping &aMapping)
+{
+    Mapping *next = aMapping.GetNext();
+
+    mActiveMappings.PopAfter(aMapping.mPrev);
+
+    if (next != nullptr)
+    {
+        next->mPrev = aMapping.mPrev;
+    }
+    else
+    {
+        mLeastRecentlyUsed = aMapping.mPrev;
+    }
+}
+
+void Translator::MarkMappingAsUsed(Mapping &aMapping, uint8_t aProtocol)
+{
+    aMapping.Touch(aProtocol);
+
+    if (mActiveMappings.GetHead() != &aMapping)
+    {
+        UnlinkMapping(aMapping);
+        LinkMappingAtHead(aMapping);
+    }
+}
+
+uint32_t Translator::DetermineIp6Key(const Ip6::Address &aAddress, uint16_t aPortOrId)
+{
+    uint32_t key = aPortOrId;
+
+    for (uint8_t i = 0; i < Ip6::Address::kSize; i += sizeof(uint32_t))
+    {
+        key = (key << 5) ^ (key >> 27) ^ BigEndian::ReadUint32(&aAddress.GetBytes()[i]);
+    }
+
+    return key;
+}
+
+#if !OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+uint32_t Translator::DetermineIp4Key(const Ip4::Address &aAddress)
+{
+    return BigEndian::ReadUint32(aAddress.GetBytes());
+}
+#endif
+
+uint32_t Translator::DetermineIp6Key(const Mapping &aMapping)
+{
+#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+    return DetermineIp6Key(aMapping.mIp6Address, aMapping.mSrcPortOrId);
+#else
+    return DetermineIp6Key(aMapping.mIp6Address, 0);
+#endif
+}
+
+uint32_t Translator::DetermineIp4Key(const Mapping &aMapping)
+{
+#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+    return DetermineIp4Key(aMapping.mTranslatedPortOrId);
+#else
+    return DetermineIp4Key(aMapping.mIp4Address);
+#endif
+}
+
 void Translator::Mapping::Touch(uint8_t aProtocol)
 {
     uint32_t timeout;
@@ -711,7 +890,7 @@ Error Translator::SetIp4Cidr(const Ip4::Cidr &aCidr)
 
     mNextHostId = mMinHostId;
 
-    mActiveMappings.Free();
+    RemoveAllMappings();
 
     LogInfo("IPv4 CIDR for NAT64: %s (%lu addresses)", aCidr.ToString().AsCString(),
             ToUlong(mMaxHostId - mMinHostId + 1));
@@ -733,7 +912,7 @@ void Translator::ClearIp4Cidr(void)
     LogInfo("Clearing IPv4 CIDR");
 
     mIp4Cidr.Clear();
-    mActiveMappings.Free();
+    RemoveAllMappings();
 
     UpdateState();
 
@@ -785,7 +964,7 @@ exit:
 
 void Translator::HandleTimer(void)
 {
-    mActiveMappings.RemoveAndFreeAllMatching(ExpirationChecker(TimerMilli::GetNow()));
+    IgnoreReturnValue(RemoveExpiredMappings(TimerMilli::GetNow()));
     mTimer.Start(Min(kIcmpTimeout, kIdleTimeout));
 }
 
@@ -874,7 +1053,7 @@ void Translator::SetState(State aState)
     case kStateDisabled:
     case kStateNotRunning:
     case kStateIdle:
-        mActiveMappings.Free();
+        RemoveAllMappings();
         break;
     case kStateActive:
         break;
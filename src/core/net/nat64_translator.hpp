@@ -36,6 +36,7 @@
 
 #include "openthread-core-config.h"
 
+#include "common/hash_index.hpp"
 #include "common/locator.hpp"
 #include "common/owning_list.hpp"
 #include "common/pool.hpp"
@@ -287,6 +288,8 @@ private:
 
     static constexpr uint32_t kPoolSize = OPENTHREAD_CONFIG_NAT64_MAX_MAPPINGS;
 
+    static_assert(kPoolSize < 0x7fff, "OPENTHREAD_CONFIG_NAT64_MAX_MAPPINGS is too large");
+
 #if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
     static constexpr uint16_t kMinTranslationPort = 49152;
     static constexpr uint16_t kMaxTranslationPort = 65535;
@@ -332,6 +335,7 @@ private:
         static bool IsCounterZero(const ProtocolCounters::Counters &aCounters);
 
         Mapping         *mNext;
+        Mapping         *mPrev;
         uint64_t         mId;
         TimeMilli        mLastUseTime;
         TimeMilli        mExpirationTime;
@@ -344,6 +348,24 @@ private:
 #endif
     };
 
+    typedef Pool<Mapping, kPoolSize> MappingPool;
+
+    // Maps the key of an active mapping to its index in the
+    // `MappingPool`. `mIp6Index` uses the IPv6 key and `mIp4Index`
+    // the IPv4 key (see `DetermineIp6Key()`/`DetermineIp4Key()`).
+    // Since the index has twice as many slots as there are mappings,
+    // adding a mapping never fails.
+    typedef HashIndex<uint16_t, 2 * kPoolSize> MappingIndex;
+
+    static uint32_t DetermineIp6Key(const Ip6::Address &aAddress, uint16_t aPortOrId);
+#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+    static uint32_t DetermineIp4Key(uint16_t aPortOrId) { return aPortOrId; }
+#else
+    static uint32_t DetermineIp4Key(const Ip4::Address &aAddress);
+#endif
+    static uint32_t DetermineIp6Key(const Mapping &aMapping);
+    static uint32_t DetermineIp4Key(const Mapping &aMapping);
+
     bool     IsEnabled(void) const { return mState != kStateDisabled; }
     bool     HasValidPrefixAndCidr(void) const;
     void     SetState(State aState);
@@ -354,6 +376,17 @@ private:
     Error    AllocateIp4Address(Ip4::Address &aIp4Address);
     Mapping *AllocateMapping(const Ip6::Headers &aIp6Headers);
     void     EvictStaleMapping(void);
+    Mapping *FindMapping(const Ip6::Headers &aIp6Headers);
+    Mapping *FindMapping(const Ip4::Headers &aIp4Headers);
+    template <typename MatcherType>
+    Mapping *FindMapping(const MappingIndex &aIndex, uint32_t aKey, const MatcherType &aMatcher);
+    void     AddMapping(Mapping &aMapping);
+    void     RemoveMapping(Mapping &aMapping);
+    void     RemoveAllMappings(void);
+    bool     RemoveExpiredMappings(TimeMilli aNow);
+    void     LinkMappingAtHead(Mapping &aMapping);
+    void     UnlinkMapping(Mapping &aMapping);
+    void     MarkMappingAsUsed(Mapping &aMapping, uint8_t aProtocol);
     void     HandleTimer(void);
 #if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
     uint16_t AllocateSourcePort(uint16_t aSrcPort);
@@ -364,18 +397,26 @@ private:
 
     using TranslatorTimer = TimerMilliIn<Translator, &Translator::HandleTimer>;
 
-    State                    mState;
-    uint64_t                 mNextMappingId;
-    Pool<Mapping, kPoolSize> mMappingPool;
-    OwningList<Mapping>      mActiveMappings;
-    Ip6::Prefix              mNat64Prefix;
-    Ip4::Cidr                mIp4Cidr;
-    uint32_t                 mMinHostId;
-    uint32_t                 mMaxHostId;
-    uint32_t                 mNextHostId;
-    TranslatorTimer          mTimer;
-    ProtocolCounters         mCounters;
-    ErrorCounters            mErrorCounters;
+    // `mActiveMappings` is ordered by last use (most recently used
+    // at head), with `mLeastRecentlyUsed` tracking its tail. This
+    // allows idle expiry and eviction to only inspect the mappings
+    // that have been idle long enough.
+
+    State               mState;
+    uint64_t            mNextMappingId;
+    MappingPool         mMappingPool;
+    OwningList<Mapping> mActiveMappings;
+    Mapping            *mLeastRecentlyUsed;
+    MappingIndex        mIp6Index;
+    MappingIndex        mIp4Index;
+    Ip6::Prefix         mNat64Prefix;
+    Ip4::Cidr           mIp4Cidr;
+    uint32_t            mMinHostId;
+    uint32_t            mMaxHostId;
+    uint32_t            mNextHostId;
+    TranslatorTimer     mTimer;
+    ProtocolCounters    mCounters;
+    ErrorCounters       mErrorCounters;
 };
 #endif // OPENTHREAD_CONFIG_NAT64_TRANSLATOR_ENABLE
 
@@ -404,7 +404,7 @@ void AdvertisingProxy::Advertise(Host &aHost, const Server::MessageMetadata &aMe
         }
     }
 
-    existingHost = Get<Server>().mHosts.FindMatching(aHost.GetFullName());
+    existingHost = Get<Server>().mNameIndex.FindHost(aHost.GetFullName());
 
     if (existingHost != nullptr)
     {
@@ -465,6 +465,7 @@ void Server::RemoveHost(Host *aHost, RetainName aRetainName)
     {
         aHost->SetKeyLease(0);
         IgnoreError(mHosts.Remove(*aHost));
+        mNameIndex.RemoveHost(*aHost);
         LogInfo("Fully remove host %s", aHost->GetFullName());
     }
 
@@ -499,7 +500,7 @@ exit:
 bool Server::HasNameConflictsWith(Host &aHost) const
 {
     bool        hasConflicts = false;
-    const Host *existingHost = mHosts.FindMatching(aHost.GetFullName());
+    const Host *existingHost = mNameIndex.FindHost(aHost.GetFullName());
 
     if ((existingHost != nullptr) && (aHost.mKey != existingHost->mKey))
     {
@@ -507,17 +508,17 @@ bool Server::HasNameConflictsWith(Host &aHost) const
         ExitNow(hasConflicts = true);
     }
 
-    for (const Host &host : mHosts)
+    // Verify that no allocated services (of other hosts) have the
+    // same instance name.
+
+    for (const Service &service : aHost.mServices)
     {
-        if (aHost.mKey == host.mKey)
-        {
-            continue;
-        }
+        const Service *existingService = nullptr;
 
-        // Verify that no allocated services have the same instance name.
-        for (const Service &service : aHost.mServices)
+        while ((existingService = mNameIndex.FindNextServiceByInstanceName(service.GetInstanceName(),
+                                                                          existingService)) != nullptr)
         {
-            if (host.HasService(service.GetInstanceName()))
+            if (aHost.mKey != existingService->GetHost().mKey)
             {
                 LogWarn("Name conflict: service name %s has already been allocated", service.GetInstanceName());
                 ExitNow(hasConflicts = true);
@@ -617,7 +618,13 @@ void Server::CommitSrpUpdate(Error                    aError,
     grantedKeyLease = useShortLease ? grantedLease : aLeaseConfig.GrantKeyLease(hostKeyLease);
     grantedTtl      = aTtlConfig.GrantTtl(grantedLease, aHost.GetTtl());
 
-    existingHost = mHosts.RemoveMatching(aHost.GetFullName());
+    existingHost = mNameIndex.FindHost(aHost.GetFullName());
+
+    if (existingHost != nullptr)
+    {
+        IgnoreError(mHosts.Remove(*existingHost));
+        mNameIndex.RemoveHost(*existingHost);
+    }
 
     LogInfo("Committing update for %s host %s", (existingHost != nullptr) ? "existing" : "new", aHost.GetFullName());
     LogInfo("    Granted lease:%lu, key-lease:%lu, ttl:%lu", ToUlong(grantedLease), ToUlong(grantedKeyLease),
@@ -707,6 +714,8 @@ void Server::CommitSrpUpdate(Error                    aError,
         }
     }
 
+    mNameIndex.AddHost(aHost);
+
 #if OPENTHREAD_CONFIG_SRP_SERVER_PORT_SWITCH_ENABLE
     if (!mHasRegisteredAnyService &&
         ((mAddressMode == kAddressModeUnicast) || (mAddressMode == kAddressModeUnicastForceAdd)))
@@ -1505,7 +1514,7 @@ void Server::HandleUpdate(Host &aHost, const MessageMetadata &aMetadata)
 
     aHost.ClearResources();
 
-    existingHost = mHosts.FindMatching(aHost.GetFullName());
+    existingHost = mNameIndex.FindHost(aHost.GetFullName());
     VerifyOrExit(existingHost != nullptr);
 
     // The client may not include all services it has registered before
@@ -2003,6 +2012,7 @@ Error Server::Service::Init(const char *aInstanceName, const char *aInstanceLabe
     mPort        = 0;
     mIsDeleted   = false;
     mIsCommitted = false;
+    mIsIndexed   = false;
 #if OPENTHREAD_CONFIG_SRP_SERVER_ADVERTISING_PROXY_ENABLE
     mIsRegistered      = false;
     mIsKeyRegistered   = false;
@@ -2146,6 +2156,8 @@ exit:
 Server::Host::Host(Instance &aInstance, TimeMilli aUpdateTime)
     : InstanceLocator(aInstance)
     , mNext(nullptr)
+    , mNextInIndex(nullptr)
+    , mFullNameHash(0)
     , mParsedKey(false)
     , mUseShortLeaseOption(false)
 #if OPENTHREAD_CONFIG_SRP_SERVER_ADVERTISING_PROXY_ENABLE
@@ -2250,6 +2262,7 @@ void Server::Host::RemoveService(Service *aService, RetainName aRetainName, Noti
     if (!aRetainName)
     {
         IgnoreError(mServices.Remove(*aService));
+        server.mNameIndex.RemoveService(*aService);
         aService->Free();
     }
 
@@ -2301,6 +2314,178 @@ exit:
     return error;
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+// Server::NameIndex
+
+void Server::NameIndex::AddHost(Host &aHost)
+{
+    uint16_t bucket;
+
+    aHost.mFullNameHash = HashName(aHost.GetFullName());
+    bucket              = BucketFor(aHost.mFullNameHash);
+
+    aHost.mNextInIndex   = mHostBuckets[bucket];
+    mHostBuckets[bucket] = &aHost;
+
+    for (Service &service : aHost.mServices)
+    {
+        AddService(service);
+    }
+}
+
+void Server::NameIndex::RemoveHost(Host &aHost)
+{
+    for (Host **link = &mHostBuckets[BucketFor(aHost.mFullNameHash)]; *link != nullptr; link = &(*link)->mNextInIndex)
+    {
+        if (*link == &aHost)
+        {
+            *link              = aHost.mNextInIndex;
+            aHost.mNextInIndex = nullptr;
+            break;
+        }
+    }
+
+    for (Service &service : aHost.mServices)
+    {
+        RemoveService(service);
+    }
+}
+
+void Server::NameIndex::AddService(Service &aService)
+{
+    uint16_t bucket;
+
+    VerifyOrExit(!aService.mIsIndexed);
+
+    aService.mInstanceNameHash = HashName(aService.GetInstanceName());
+    bucket                     = BucketFor(aService.mInstanceNameHash);
+
+    aService.mNextInInstanceIndex = mInstanceBuckets[bucket];
+    mInstanceBuckets[bucket]      = &aService;
+
+    aService.mServiceNameHash = HashName(aService.GetServiceName());
+    bucket                    = BucketFor(aService.mServiceNameHash);
+
+    aService.mNextInServiceIndex = mServiceBuckets[bucket];
+    mServiceBuckets[bucket]      = &aService;
+
+    aService.mIsIndexed = true;
+
+exit:
+    return;
+}
+
+void Server::NameIndex::RemoveService(Service &aService)
+{
+    VerifyOrExit(aService.mIsIndexed);
+
+    for (Service **link = &mInstanceBuckets[BucketFor(aService.mInstanceNameHash)]; *link != nullptr;
+         link           = &(*link)->mNextInInstanceIndex)
+    {
+        if (*link == &aService)
+        {
+            *link = aService.mNextInInstanceIndex;
+            break;
+        }
+    }
+
+    for (Service **link = &mServiceBuckets[BucketFor(aService.mServiceNameHash)]; *link != nullptr;
+         link           = &(*link)->mNextInServiceIndex)
+    {
+        if (*link == &aService)
+        {
+            *link = aService.mNextInServiceIndex;
+            break;
+        }
+    }
+
+    aService.mNextInInstanceIndex = nullptr;
+    aService.mNextInServiceIndex  = nullptr;
+    aService.mIsIndexed           = false;
+
+exit:
+    return;
+}
+
+Server::Host *Server::NameIndex::FindHost(const char *aFullName) const
+{
+    uint32_t hash = HashName(aFullName);
+    Host    *host;
+
+    for (host = mHostBuckets[BucketFor(hash)]; host != nullptr; host = host->mNextInIndex)
+    {
+        if ((host->mFullNameHash == hash) && host->Matches(aFullName))
+        {
+            break;
+        }
+    }
+
+    return host;
+}
+
+Server::Service *Server::NameIndex::FindNextServiceByInstanceName(const char    *aInstanceName,
+                                                                  const Service *aPrevService) const
+{
+    uint32_t hash = HashName(aInstanceName);
+    Service *service;
+
+    service = (aPrevService == nullptr) ? mInstanceBuckets[BucketFor(hash)] : aPrevService->mNextInInstanceIndex;
+
+    for (; service != nullptr; service = service->mNextInInstanceIndex)
+    {
+        if ((service->mInstanceNameHash == hash) && service->MatchesInstanceName(aInstanceName))
+        {
+            break;
+        }
+    }
+
+    return service;
+}
+
+Server::Service *Server::NameIndex::FindNextServiceByServiceName(const char    *aServiceName,
+                                                                 const Service *aPrevService) const
+{
+    // Services are indexed by their base service name. For a sub-type
+    // service name we look up its base service name (the part after
+    // the "._sub." label) and then check the sub-type.
+
+    const char *baseName  = aServiceName;
+    const char *subPos    = StringFind(aServiceName, kServiceSubTypeLabel, kStringCaseInsensitiveMatch);
+    bool        isSubType = (subPos != nullptr);
+    uint32_t    hash;
+    Service    *service;
+
+    if (isSubType)
+    {
+        baseName = subPos + sizeof(kServiceSubTypeLabel) - 1;
+    }
+
+    hash    = HashName(baseName);
+    service = (aPrevService == nullptr) ? mServiceBuckets[BucketFor(hash)] : aPrevService->mNextInServiceIndex;
+
+    for (; service != nullptr; service = service->mNextInServiceIndex)
+    {
+        if ((service->mServiceNameHash == hash) && service->MatchesServiceName(baseName) &&
+            (!isSubType || service->HasSubTypeServiceName(aServiceName)))
+        {
+            break;
+        }
+    }
+
+    return service;
+}
+
+uint32_t Server::NameIndex::HashName(const char *aName)
+{
+    // Names differing only in case hash to the same bucket.
+
+    Fnv1aHash hash;
+
+    hash.FeedLowercaseString(aName);
+
+    return hash.GetHash();
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 // Server::UpdateMetadata
 
@@ -57,6 +57,7 @@
 #include "common/as_core_type.hpp"
 #include "common/callback.hpp"
 #include "common/clearable.hpp"
+#include "common/fnv_hash.hpp"
 #include "common/heap.hpp"
 #include "common/heap_allocatable.hpp"
 #include "common/heap_array.hpp"
@@ -116,6 +117,7 @@ class Server : public InstanceLocator, private NonCopyable
     friend class Host;
     friend class Dns::ServiceDiscovery::Server;
     friend class AdvertisingProxy;
+    friend class ServerTester;
 #if OPENTHREAD_CONFIG_BORDER_ROUTING_ENABLE
     friend class BorderRouter::RoutingManager;
 #endif
@@ -255,6 +257,7 @@ public:
         friend class LinkedListEntry<Service>;
         friend class Heap::Allocatable<Service>;
         friend class AdvertisingProxy;
+        friend class ServerTester;
 
     public:
         /**
@@ -428,8 +431,13 @@ public:
         uint16_t                  mPriority;
         uint16_t                  mWeight;
         uint16_t                  mPort;
+        Service                  *mNextInInstanceIndex;
+        Service                  *mNextInServiceIndex;
+        uint32_t                  mInstanceNameHash;
+        uint32_t                  mServiceNameHash;
         bool                      mIsDeleted : 1;
         bool                      mIsCommitted : 1;
+        bool                      mIsIndexed : 1;
         bool                      mParsedDeleteAllRrset : 1;
         bool                      mParsedSrv : 1;
         bool                      mParsedTxt : 1;
@@ -458,6 +466,7 @@ public:
         friend class LinkedListEntry<Host>;
         friend class Heap::Allocatable<Host>;
         friend class AdvertisingProxy;
+        friend class ServerTester;
 
     public:
         typedef Crypto::Ecdsa::P256::PublicKey Key; ///< Host key (public ECDSA P256 key).
@@ -544,6 +553,8 @@ public:
         Error          AddIp6Address(const Ip6::Address &aIp6Address);
 
         Host                     *mNext;
+        Host                     *mNextInIndex;
+        uint32_t                  mFullNameHash;
         Heap::String              mFullName;
         Heap::Array<Ip6::Address> mAddresses;
         Key                       mKey;
@@ -813,6 +824,50 @@ public:
      */
     const Host *GetNextHost(const Host *aHost);
 
+    /**
+     * Finds a registered SRP host by its full name.
+     *
+     * The name comparison is case-insensitive. The returned host may be deleted (with its name retained).
+     *
+     * @param[in]  aFullName  The full host name.
+     *
+     * @returns  A pointer to the host or `nullptr` if no host with @p aFullName is registered.
+     */
+    const Host *FindHost(const char *aFullName) const { return mNameIndex.FindHost(aFullName); }
+
+    /**
+     * Finds the next registered SRP service with a given service instance name.
+     *
+     * The name comparison is case-insensitive. The returned services may be deleted (with their names retained).
+     *
+     * @param[in]  aInstanceName  The full service instance name.
+     * @param[in]  aPrevService   The previously found service or `nullptr` to find the first one.
+     *
+     * @returns  A pointer to the next matching service or `nullptr` if no more can be found.
+     */
+    const Service *FindNextServiceByInstanceName(const char *aInstanceName, const Service *aPrevService) const
+    {
+        return mNameIndex.FindNextServiceByInstanceName(aInstanceName, aPrevService);
+    }
+
+    /**
+     * Finds the next registered SRP service with a given service name or sub-type service name.
+     *
+     * If @p aServiceName is a sub-type service name (i.e., "<sub-label>._sub.<service-labels>.<domain>.") the services
+     * with the matching sub-type are found, otherwise the services with @p aServiceName as their base service name.
+     *
+     * The name comparison is case-insensitive. The returned services may be deleted (with their names retained).
+     *
+     * @param[in]  aServiceName  The service name or sub-type service name.
+     * @param[in]  aPrevService  The previously found service or `nullptr` to find the first one.
+     *
+     * @returns  A pointer to the next matching service or `nullptr` if no more can be found.
+     */
+    const Service *FindNextServiceByServiceName(const char *aServiceName, const Service *aPrevService) const
+    {
+        return mNameIndex.FindNextServiceByServiceName(aServiceName, aPrevService);
+    }
+
     /**
      * Returns the response counters of the SRP server.
      *
@@ -864,6 +919,39 @@ private:
         const Ip6::MessageInfo *mMessageInfo; // Set to `nullptr` when from SRPL.
     };
 
+    // Hashed index of registered hosts (by full name) and of their
+    // services (by instance name and by base service name). Each
+    // index is an array of buckets chaining the entries through
+    // their `mNextIn{Name}Index` pointers. A host is in the index
+    // while it is in `mHosts`. Names are hashed case-insensitively,
+    // the name of each entry in the bucket is still compared.
+    class NameIndex : public Clearable<NameIndex>
+    {
+    public:
+        NameIndex(void) { Clear(); }
+
+        void AddHost(Host &aHost);
+        void RemoveHost(Host &aHost);
+        void AddService(Service &aService);
+        void RemoveService(Service &aService);
+
+        Host    *FindHost(const char *aFullName) const;
+        Service *FindNextServiceByInstanceName(const char *aInstanceName, const Service *aPrevService) const;
+        Service *FindNextServiceByServiceName(const char *aServiceName, const Service *aPrevService) const;
+
+    private:
+        static constexpr uint16_t kNumBuckets = OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_SIZE;
+
+        static_assert(kNumBuckets > 0, "OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_SIZE must be non-zero");
+
+        static uint32_t HashName(const char *aName);
+        static uint16_t BucketFor(uint32_t aHash) { return static_cast<uint16_t>(aHash % kNumBuckets); }
+
+        Host    *mHostBuckets[kNumBuckets];
+        Service *mInstanceBuckets[kNumBuckets];
+        Service *mServiceBuckets[kNumBuckets];
+    };
+
     // This class includes metadata for processing a SRP update (register, deregister)
     // and sending DNS response to the client.
     class UpdateMetadata : public InstanceLocator,
@@ -1000,6 +1088,7 @@ private:
     LeaseConfig mLeaseConfig;
 
     LinkedList<Host> mHosts;
+    NameIndex        mNameIndex;
     LeaseTimer       mLeaseTimer;
 
     UpdateTimer                mOutstandingUpdatesTimer;
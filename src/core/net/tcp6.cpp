@@ -60,6 +60,10 @@ Tcp::Tcp(Instance &aInstance)
     , mTimer(aInstance)
     , mTasklet(aInstance)
     , mEphemeralPort(kDynamicPortMin)
+#if OPENTHREAD_CONFIG_TCP_INDEX_SIZE > 0
+    , mNumUnindexedListeners(0)
+    , mEndpointIndexIncomplete(false)
+#endif
 {
     OT_UNUSED_VARIABLE(mEphemeralPort);
 }
@@ -146,10 +150,24 @@ Error Tcp::Endpoint::Bind(const SockAddr &aSockName)
     VerifyOrExit(!AsCoreType(&aSockName.mAddress).IsUnspecified(), error = kErrorInvalidArgs);
     VerifyOrExit(Get<Tcp>().CanBind(aSockName), error = kErrorInvalidState);
 
+#if OPENTHREAD_CONFIG_TCP_INDEX_SIZE > 0
+    if (!IsClosed())
+    {
+        Get<Tcp>().UnindexEndpoint(*this);
+    }
+#endif
+
     memcpy(&tp.laddr, &aSockName.mAddress, sizeof(tp.laddr));
     tp.lport = BigEndian::HostSwap16(aSockName.mPort);
     error    = kErrorNone;
 
+#if OPENTHREAD_CONFIG_TCP_INDEX_SIZE > 0
+    if (!IsClosed())
+    {
+        Get<Tcp>().IndexEndpoint(*this);
+    }
+#endif
+
 exit:
     return error;
 }
@@ -563,11 +581,22 @@ Error Tcp::Listener::Listen(const SockAddr &aSockName)
 
     VerifyOrExit(Get<Tcp>().CanBind(aSockName), error = kErrorInvalidState);
 
+#if OPENTHREAD_CONFIG_TCP_INDEX_SIZE > 0
+    if (!IsClosed())
+    {
+        Get<Tcp>().UnindexListener(*this);
+    }
+#endif
+
     memcpy(&tpl->laddr, &aSockName.mAddress, sizeof(tpl->laddr));
     tpl->lport   = port;
     tpl->t_state = TCP6S_LISTEN;
     error        = kErrorNone;
 
+#if OPENTHREAD_CONFIG_TCP_INDEX_SIZE > 0
+    Get<Tcp>().IndexListener(*this);
+#endif
+
 exit:
     return error;
 }
@@ -576,6 +605,13 @@ Error Tcp::Listener::StopListening(void)
 {
     struct tcpcb_listen *tpl = &GetTcbListen();
 
+#if OPENTHREAD_CONFIG_TCP_INDEX_SIZE > 0
+    if (!IsClosed())
+    {
+        Get<Tcp>().UnindexListener(*this);
+    }
+#endif
+
     ClearAllBytes(tpl->laddr);
     tpl->lport   = 0;
     tpl->t_state = TCP6S_CLOSED;
@@ -589,6 +625,13 @@ Error Tcp::Listener::Deinitialize(void)
     SuccessOrExit(error = Get<Tcp>().mListeners.Remove(*this));
     SetNext(nullptr);
 
+#if OPENTHREAD_CONFIG_TCP_INDEX_SIZE > 0
+    if (!IsClosed())
+    {
+        Get<Tcp>().UnindexListener(*this);
+    }
+#endif
+
 exit:
     return error;
 }
@@ -658,7 +701,7 @@ Error Tcp::HandleMessage(ot::Ip6::Header &aIp6Header, Message &aMessage, Message
     aMessageInfo.mPeerPort = BigEndian::HostSwap16(tcpHeader->th_sport);
     aMessageInfo.mSockPort = BigEndian::HostSwap16(tcpHeader->th_dport);
 
-    endpoint = mEndpoints.FindMatching(aMessageInfo);
+    endpoint = FindEndpoint(aMessageInfo);
 
     if (endpoint != nullptr)
     {
@@ -677,7 +720,7 @@ Error Tcp::HandleMessage(ot::Ip6::Header &aIp6Header, Message &aMessage, Message
         /* If the matching socket was in the TIME-WAIT state, then we try passive sockets. */
     }
 
-    listener = mListeners.FindMatching(aMessageInfo);
+    listener = FindListener(aMessageInfo);
 
     if (listener != nullptr)
     {
@@ -688,6 +731,16 @@ Error Tcp::HandleMessage(ot::Ip6::Header &aIp6Header, Message &aMessage, Message
         OT_ASSERT(nextAction != RELOOKUP_REQUIRED);
         if (sig.accepted_connection != nullptr)
         {
+#if OPENTHREAD_CONFIG_TCP_INDEX_SIZE > 0
+            Endpoint &accepted = Endpoint::FromTcb(*sig.accepted_connection);
+
+            // The accepted endpoint is indexed here, since its ports
+            // and addresses are only set after it enters SYN-RECEIVED.
+            if (IsInitialized(accepted) && !accepted.IsClosed())
+            {
+                IndexEndpoint(accepted);
+            }
+#endif
             ProcessSignals(Tcp::Endpoint::FromTcb(*sig.accepted_connection), nullptr, 0, sig);
         }
         ExitNow();
@@ -700,6 +753,202 @@ exit:
     return error;
 }
 
+Tcp::Endpoint *Tcp::FindEndpoint(const MessageInfo &aMessageInfo)
+{
+    Endpoint *endpoint;
+
+#if OPENTHREAD_CONFIG_TCP_INDEX_SIZE > 0
+    if (!mEndpointIndexIncomplete)
+    {
+        // When more than one endpoint matches (e.g., one bound to the
+        // destination address and one with an unspecified address), we
+        // search `mEndpoints` so that the first matching one is
+        // selected, same as without the index.
+
+        uint32_t hash       = HashOf(aMessageInfo);
+        uint16_t slot       = mEndpointIndex.FindFirst(hash);
+        uint8_t  numMatches = 0;
+
+        endpoint = nullptr;
+
+        for (; slot != EndpointIndex::kNotFound; slot = mEndpointIndex.FindNext(hash, slot))
+        {
+            Endpoint *candidate = mEndpointIndex.GetValueAt(slot);
+
+            if (!candidate->Matches(aMessageInfo))
+            {
+                continue;
+            }
+
+            if (++numMatches > 1)
+            {
+                break;
+            }
+
+            endpoint = candidate;
+        }
+
+        VerifyOrExit(numMatches > 1);
+    }
+#endif
+
+    endpoint = mEndpoints.FindMatching(aMessageInfo);
+
+#if OPENTHREAD_CONFIG_TCP_INDEX_SIZE > 0
+exit:
+#endif
+    return endpoint;
+}
+
+Tcp::Listener *Tcp::FindListener(const MessageInfo &aMessageInfo)
+{
+    Listener *listener;
+
+#if OPENTHREAD_CONFIG_TCP_INDEX_SIZE > 0
+    if (mNumUnindexedListeners == 0)
+    {
+        uint32_t hash       = aMessageInfo.GetSockPort();
+        uint16_t slot       = mListenerIndex.FindFirst(hash);
+        uint8_t  numMatches = 0;
+
+        listener = nullptr;
+
+        for (; slot != ListenerIndex::kNotFound; slot = mListenerIndex.FindNext(hash, slot))
+        {
+            Listener *candidate = mListenerIndex.GetValueAt(slot);
+
+            if (!candidate->Matches(aMessageInfo))
+            {
+                continue;
+            }
+
+            if (++numMatches > 1)
+            {
+                break;
+            }
+
+            listener = candidate;
+        }
+
+        VerifyOrExit(numMatches > 1);
+    }
+#endif
+
+    listener = mListeners.FindMatching(aMessageInfo);
+
+#if OPENTHREAD_CONFIG_TCP_INDEX_SIZE > 0
+exit:
+#endif
+    return listener;
+}
+
+#if OPENTHREAD_CONFIG_TCP_INDEX_SIZE > 0
+
+uint32_t Tcp::HashOf(uint16_t aLocalPort, uint16_t aPeerPort, const Address &aPeerAddress)
+{
+    // The local address is left out, since an endpoint with an
+    // unspecified local address matches any destination address.
+
+    Fnv1aHash hash;
+
+    hash.FeedBytes(&aLocalPort, sizeof(aLocalPort));
+    hash.FeedBytes(&aPeerPort, sizeof(aPeerPort));
+    hash.FeedBytes(aPeerAddress.GetBytes(), sizeof(aPeerAddress));
+
+    return hash.GetHash();
+}
+
+uint32_t Tcp::HashOf(const MessageInfo &aMessageInfo)
+{
+    return HashOf(aMessageInfo.GetSockPort(), aMessageInfo.GetPeerPort(), aMessageInfo.GetPeerAddr());
+}
+
+uint32_t Tcp::HashOf(const Endpoint &aEndpoint)
+{
+    const struct tcpcb &tp = aEndpoint.GetTcb();
+
+    return HashOf(BigEndian::HostSwap16(tp.lport), BigEndian::HostSwap16(tp.fport), aEndpoint.GetForeignIp6Address());
+}
+
+uint32_t Tcp::HashOf(const Listener &aListener) { return BigEndian::HostSwap16(aListener.GetTcbListen().lport); }
+
+bool Tcp::IsIndexed(const Endpoint &aEndpoint) const
+{
+    uint32_t hash = HashOf(aEndpoint);
+    uint16_t slot = mEndpointIndex.FindFirst(hash);
+
+    for (; slot != EndpointIndex::kNotFound; slot = mEndpointIndex.FindNext(hash, slot))
+    {
+        if (mEndpointIndex.GetValueAt(slot) == &aEndpoint)
+        {
+            break;
+        }
+    }
+
+    return slot != EndpointIndex::kNotFound;
+}
+
+void Tcp::IndexEndpoint(Endpoint &aEndpoint)
+{
+    // An endpoint is indexed while it is connected (not closed), its
+    // ports and addresses do not change in the meantime other than
+    // through `Endpoint::Bind()`, which re-indexes it.
+
+    VerifyOrExit(!IsIndexed(aEndpoint));
+
+    if (mEndpointIndex.Add(HashOf(aEndpoint), &aEndpoint) != kErrorNone)
+    {
+        mEndpointIndexIncomplete = true;
+    }
+
+exit:
+    return;
+}
+
+void Tcp::UnindexEndpoint(Endpoint &aEndpoint)
+{
+    // Removing an endpoint which is not indexed is harmless (e.g., an
+    // accepted endpoint closed before it is indexed).
+
+    IgnoreError(mEndpointIndex.Remove(HashOf(aEndpoint), &aEndpoint));
+
+    VerifyOrExit(mEndpointIndexIncomplete);
+
+    // Retry to index the other connected endpoints, now that a slot
+    // is free, so that the index is used again once they all fit.
+
+    mEndpointIndexIncomplete = false;
+
+    for (Endpoint &endpoint : mEndpoints)
+    {
+        if ((&endpoint != &aEndpoint) && !endpoint.IsClosed())
+        {
+            IndexEndpoint(endpoint);
+        }
+    }
+
+exit:
+    return;
+}
+
+void Tcp::IndexListener(Listener &aListener)
+{
+    if (mListenerIndex.Add(HashOf(aListener), &aListener) != kErrorNone)
+    {
+        mNumUnindexedListeners++;
+    }
+}
+
+void Tcp::UnindexListener(Listener &aListener)
+{
+    if (mListenerIndex.Remove(HashOf(aListener), &aListener) != kErrorNone)
+    {
+        mNumUnindexedListeners--;
+    }
+}
+
+#endif // OPENTHREAD_CONFIG_TCP_INDEX_SIZE > 0
+
 void Tcp::ProcessSignals(Endpoint             &aEndpoint,
                          otLinkedBuffer       *aPriorHead,
                          size_t                aPriorBacklog,
@@ -1100,8 +1349,32 @@ void tcplp_sys_connection_lost(struct tcpcb *aTcb, uint8_t aErrNum)
 
 void tcplp_sys_on_state_change(struct tcpcb *aTcb, int aNewState)
 {
+#if OPENTHREAD_CONFIG_TCP_INDEX_SIZE > 0
+    Tcp::Endpoint &endpoint = Tcp::Endpoint::FromTcb(*aTcb);
+
+    // An actively opened endpoint is indexed when it enters SYN-SENT
+    // (with its ports and addresses set). A passively opened endpoint
+    // is indexed once it is accepted (see `Tcp::HandleMessage()`).
+    // The TCB is closed before it is re-initialized, so an endpoint
+    // is removed with the same hash it was added with.
+
+    switch (aNewState)
+    {
+    case TCP6S_SYN_SENT:
+        endpoint.Get<Tcp>().IndexEndpoint(endpoint);
+        break;
+
+    case TCP6S_CLOSED:
+        endpoint.Get<Tcp>().UnindexEndpoint(endpoint);
+        break;
+
+    default:
+        break;
+    }
+#else
     OT_UNUSED_VARIABLE(aTcb);
     OT_UNUSED_VARIABLE(aNewState);
+#endif
 
     /* Any adaptive changes to the sleep interval would go here. */
 }
@@ -42,6 +42,8 @@
 
 #include "common/as_core_type.hpp"
 #include "common/clearable.hpp"
+#include "common/fnv_hash.hpp"
+#include "common/hash_index.hpp"
 #include "common/linked_list.hpp"
 #include "common/locator.hpp"
 #include "common/non_copyable.hpp"
@@ -68,6 +70,8 @@ void tcplp_sys_set_timer(struct tcpcb *aTcb, uint8_t aTimerFlag, uint32_t aDelay
 
 // NOLINTNEXTLINE(readability-inconsistent-declaration-parameter-name)
 void tcplp_sys_stop_timer(struct tcpcb *aTcb, uint8_t aTimerFlag);
+
+void tcplp_sys_on_state_change(struct tcpcb *aTcb, int aNewState);
 }
 
 namespace ot {
@@ -394,6 +398,7 @@ public:
      */
     class Listener : public otTcpListener, public LinkedListEntry<Listener>, public GetProvider<Listener>
     {
+        friend class Tcp;
         friend class LinkedList<Listener>;
 
     public:
@@ -553,6 +558,8 @@ public:
     bool IsInitialized(const Listener &aListener) const { return mListeners.Contains(aListener); }
 
 private:
+    friend void ::tcplp_sys_on_state_change(struct tcpcb *aTcb, int aNewState);
+
     static constexpr uint16_t kDynamicPortMin = 49152;
     static constexpr uint16_t kDynamicPortMax = 65535;
 
@@ -569,8 +576,29 @@ private:
                         size_t                aPriorBacklog,
                         struct tcplp_signals &aSignals) const;
 
+#if OPENTHREAD_CONFIG_TCP_INDEX_SIZE > 0
+    // Map the local port, peer port and peer address of a connected
+    // endpoint to the endpoint, and the local port of a listening
+    // listener to the listener.
+    typedef HashIndex<Endpoint *, OPENTHREAD_CONFIG_TCP_INDEX_SIZE> EndpointIndex;
+    typedef HashIndex<Listener *, OPENTHREAD_CONFIG_TCP_INDEX_SIZE> ListenerIndex;
+#endif
+
     static Error BsdErrorToOtError(int aBsdError);
     bool         CanBind(const SockAddr &aSockName);
+    Endpoint    *FindEndpoint(const MessageInfo &aMessageInfo);
+    Listener    *FindListener(const MessageInfo &aMessageInfo);
+#if OPENTHREAD_CONFIG_TCP_INDEX_SIZE > 0
+    static uint32_t HashOf(uint16_t aLocalPort, uint16_t aPeerPort, const Address &aPeerAddress);
+    static uint32_t HashOf(const MessageInfo &aMessageInfo);
+    static uint32_t HashOf(const Endpoint &aEndpoint);
+    static uint32_t HashOf(const Listener &aListener);
+    bool            IsIndexed(const Endpoint &aEndpoint) const;
+    void            IndexEndpoint(Endpoint &aEndpoint);
+    void            UnindexEndpoint(Endpoint &aEndpoint);
+    void            IndexListener(Listener &aListener);
+    void            UnindexListener(Listener &aListener);
+#endif
 
     void HandleTimer(void);
 
@@ -585,6 +613,12 @@ private:
     LinkedList<Endpoint> mEndpoints;
     LinkedList<Listener> mListeners;
     uint16_t             mEphemeralPort;
+#if OPENTHREAD_CONFIG_TCP_INDEX_SIZE > 0
+    EndpointIndex mEndpointIndex;
+    ListenerIndex mListenerIndex;
+    uint16_t      mNumUnindexedListeners;
+    bool          mEndpointIndexIncomplete;
+#endif
 };
 
 } // namespace Ip6
@@ -199,6 +199,9 @@ Error Udp::Plat::LeaveMulticastGroup(SocketHandle &aSocket, NetifIdentifier aNet
 Udp::Udp(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mEphemeralPort(kDynamicPortMin)
+#if OPENTHREAD_CONFIG_UDP_SOCKET_INDEX_SIZE > 0
+    , mNumUnindexedSockets(0)
+#endif
 {
 }
 
@@ -243,6 +246,9 @@ exit:
 Error Udp::Bind(SocketHandle &aSocket, const SockAddr &aSockAddr)
 {
     Error error = kErrorNone;
+#if OPENTHREAD_CONFIG_UDP_SOCKET_INDEX_SIZE > 0
+    bool isOpen = IsOpen(aSocket);
+#endif
 
 #if OPENTHREAD_CONFIG_PLATFORM_UDP_ENABLE
     SuccessOrExit(error = Plat::BindToNetif(aSocket));
@@ -252,6 +258,13 @@ Error Udp::Bind(SocketHandle &aSocket, const SockAddr &aSockAddr)
                      Get<ThreadNetif>().HasUnicastAddress(aSockAddr.GetAddress()),
                  error = kErrorInvalidArgs);
 
+#if OPENTHREAD_CONFIG_UDP_SOCKET_INDEX_SIZE > 0
+    if (isOpen)
+    {
+        UnindexSocket(aSocket);
+    }
+#endif
+
     aSocket.mSockName = aSockAddr;
 
     if (!aSocket.IsBound())
@@ -271,6 +284,13 @@ Error Udp::Bind(SocketHandle &aSocket, const SockAddr &aSockAddr)
     }
 #endif
 
+#if OPENTHREAD_CONFIG_UDP_SOCKET_INDEX_SIZE > 0
+    if (isOpen)
+    {
+        IndexSocket(aSocket);
+    }
+#endif
+
 exit:
     return error;
 }
@@ -375,6 +395,10 @@ void Udp::RemoveSocket(SocketHandle &aSocket)
 
     SuccessOrExit(mSockets.Find(aSocket, prev));
 
+#if OPENTHREAD_CONFIG_UDP_SOCKET_INDEX_SIZE > 0
+    UnindexSocket(aSocket);
+#endif
+
     mSockets.PopAfter(prev);
     aSocket.SetNext(nullptr);
 
@@ -382,6 +406,90 @@ exit:
     return;
 }
 
+Udp::SocketHandle *Udp::FindSocket(const MessageInfo &aMessageInfo)
+{
+    SocketHandle *socket;
+
+#if OPENTHREAD_CONFIG_UDP_SOCKET_INDEX_SIZE > 0
+    if ((mNumUnindexedSockets == 0) && (aMessageInfo.GetSockPort() != 0))
+    {
+        // When more than one socket matches, we search `mSockets` so
+        // that the first matching one is selected, same as without
+        // the index.
+
+        VerifyOrExit(FindIndexedSocket(aMessageInfo, socket) > 1);
+    }
+#endif
+
+    socket = mSockets.FindMatching(aMessageInfo);
+
+#if OPENTHREAD_CONFIG_UDP_SOCKET_INDEX_SIZE > 0
+exit:
+#endif
+    return socket;
+}
+
+#if OPENTHREAD_CONFIG_UDP_SOCKET_INDEX_SIZE > 0
+
+void Udp::IndexSocket(SocketHandle &aSocket)
+{
+    VerifyOrExit(aSocket.IsBound());
+
+    if (mSocketIndex.Add(aSocket.GetSockName().GetPort(), &aSocket) != kErrorNone)
+    {
+        mNumUnindexedSockets++;
+    }
+
+exit:
+    return;
+}
+
+void Udp::UnindexSocket(SocketHandle &aSocket)
+{
+    VerifyOrExit(aSocket.IsBound());
+
+    if (mSocketIndex.Remove(aSocket.GetSockName().GetPort(), &aSocket) != kErrorNone)
+    {
+        mNumUnindexedSockets--;
+    }
+
+exit:
+    return;
+}
+
+uint8_t Udp::FindIndexedSocket(const MessageInfo &aMessageInfo, SocketHandle *&aSocket) const
+{
+    // Returns the number of matching sockets (counting up to two) and
+    // sets `aSocket` to the first one found, or `nullptr` if none.
+
+    uint16_t port       = aMessageInfo.GetSockPort();
+    uint16_t slot       = mSocketIndex.FindFirst(port);
+    uint8_t  numMatches = 0;
+
+    aSocket = nullptr;
+
+    for (; slot != SocketIndex::kNotFound; slot = mSocketIndex.FindNext(port, slot))
+    {
+        SocketHandle *socket = mSocketIndex.GetValueAt(slot);
+
+        if (!socket->Matches(aMessageInfo))
+        {
+            continue;
+        }
+
+        if (++numMatches > 1)
+        {
+            break;
+        }
+
+        aSocket = socket;
+    }
+
+    return numMatches;
+}
+
+#endif // OPENTHREAD_CONFIG_UDP_SOCKET_INDEX_SIZE > 0
+
 uint16_t Udp::GetEphemeralPort(void)
 {
     do
@@ -459,7 +567,7 @@ void Udp::HandlePayload(Message &aMessage, MessageInfo &aMessageInfo)
 {
     SocketHandle *socket;
 
-    socket = mSockets.FindMatching(aMessageInfo);
+    socket = FindSocket(aMessageInfo);
     VerifyOrExit(socket != nullptr);
 
     aMessage.RemoveHeader(aMessage.GetOffset());
@@ -42,6 +42,7 @@
 #include "common/as_core_type.hpp"
 #include "common/callback.hpp"
 #include "common/clearable.hpp"
+#include "common/hash_index.hpp"
 #include "common/linked_list.hpp"
 #include "common/locator.hpp"
 #include "common/message_allocator.hpp"
@@ -550,14 +551,29 @@ private:
     };
 #endif
 
+#if OPENTHREAD_CONFIG_UDP_SOCKET_INDEX_SIZE > 0
+    // Maps the port of a bound socket to the socket.
+    typedef HashIndex<SocketHandle *, OPENTHREAD_CONFIG_UDP_SOCKET_INDEX_SIZE> SocketIndex;
+#endif
+
     static bool IsPortReserved(uint16_t aPort);
 
-    void AddSocket(SocketHandle &aSocket);
-    void RemoveSocket(SocketHandle &aSocket);
+    void          AddSocket(SocketHandle &aSocket);
+    void          RemoveSocket(SocketHandle &aSocket);
+    SocketHandle *FindSocket(const MessageInfo &aMessageInfo);
+#if OPENTHREAD_CONFIG_UDP_SOCKET_INDEX_SIZE > 0
+    void    IndexSocket(SocketHandle &aSocket);
+    void    UnindexSocket(SocketHandle &aSocket);
+    uint8_t FindIndexedSocket(const MessageInfo &aMessageInfo, SocketHandle *&aSocket) const;
+#endif
 
     uint16_t                 mEphemeralPort;
     LinkedList<Receiver>     mReceivers;
     LinkedList<SocketHandle> mSockets;
+#if OPENTHREAD_CONFIG_UDP_SOCKET_INDEX_SIZE > 0
+    SocketIndex mSocketIndex;
+    uint16_t    mNumUnindexedSockets;
+#endif
 #if OPENTHREAD_CONFIG_UDP_FORWARD_ENABLE
     Callback<otUdpForwarder> mUdpForwarder;
 #endif
@@ -43,10 +43,17 @@ AddressResolver::AddressResolver(Instance &aInstance)
     : InstanceLocator(aInstance)
 #if OPENTHREAD_FTD
     , mCacheEntryPool(aInstance)
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE
+    , mCachedList(kCachedListId)
+    , mSnoopedList(kSnoopedListId)
+    , mQueryList(kQueryListId)
+    , mQueryRetryList(kQueryRetryListId)
+#endif
     , mIcmpHandler(&AddressResolver::HandleIcmpReceive, this)
 #endif
 {
 #if OPENTHREAD_FTD
+    mCounters.Clear();
     IgnoreError(Get<Ip6::Icmp>().RegisterHandler(mIcmpHandler));
 #endif
 }
@@ -71,6 +78,10 @@ void AddressResolver::Clear(void)
             mCacheEntryPool.Free(*entry);
         }
     }
+
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE
+    mCacheIndex.Clear();
+#endif
 }
 
 Error AddressResolver::GetNextCacheEntry(EntryInfo &aInfo, Iterator &aIterator) const
@@ -178,7 +189,7 @@ void AddressResolver::Remove(uint16_t aRloc16, bool aMatchRouterId)
                 (!aMatchRouterId && (entry->GetRloc16() == aRloc16)))
             {
                 RemoveCacheEntry(*entry, *list, prev, aMatchRouterId ? kReasonRemovingRouterId : kReasonRemovingRloc16);
-                mCacheEntryPool.Free(*entry);
+                FreeCacheEntry(*entry);
 
                 // If the entry is removed from list, we keep the same
                 // `prev` pointer.
@@ -198,12 +209,38 @@ AddressResolver::CacheEntry *AddressResolver::FindCacheEntry(const Ip6::Address
     CacheEntry     *entry   = nullptr;
     CacheEntryList *lists[] = {&mCachedList, &mSnoopedList, &mQueryList, &mQueryRetryList};
 
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE
+    // The index locates the entry (or determines there is none)
+    // directly. The entry tracks the list it belongs to and its
+    // previous entry in that list (needed to pop the entry from
+    // the list), so no list is walked.
+
+    uint32_t hash = HashOf(aEid);
+    uint16_t slot = mCacheIndex.FindFirst(hash);
+
+    for (; slot != CacheIndex::kNotFound; slot = mCacheIndex.FindNext(hash, slot))
+    {
+        CacheEntry &candidate = mCacheEntryPool.GetEntryAt(mCacheIndex.GetValueAt(slot));
+
+        if (candidate.Matches(aEid))
+        {
+            entry = &candidate;
+            break;
+        }
+    }
+
+    VerifyOrExit(entry != nullptr, aList = nullptr);
+
+    aList      = lists[entry->GetListId()];
+    aPrevEntry = entry->GetPrev(*aList);
+#else
     for (CacheEntryList *list : lists)
     {
         aList = list;
         entry = aList->FindMatchingWithPrev(aPrevEntry, aEid);
         VerifyOrExit(entry == nullptr);
     }
+#endif
 
 exit:
     return entry;
@@ -221,7 +258,7 @@ void AddressResolver::Remove(const Ip6::Address &aEid, Reason aReason)
     VerifyOrExit(entry != nullptr);
 
     RemoveCacheEntry(*entry, *list, prev, aReason);
-    mCacheEntryPool.Free(*entry);
+    FreeCacheEntry(*entry);
 
 exit:
     return;
@@ -284,6 +321,10 @@ AddressResolver::CacheEntry *AddressResolver::NewCacheEntry(bool aSnoopedEntry)
         if (newEntry != nullptr)
         {
             RemoveCacheEntry(*newEntry, *list, prevEntry, kReasonEvictingForNewEntry);
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE
+            UnindexCacheEntry(*newEntry);
+#endif
+            mCounters.mEvictions++;
             ExitNow();
         }
 
@@ -309,6 +350,14 @@ exit:
     return newEntry;
 }
 
+void AddressResolver::FreeCacheEntry(CacheEntry &aEntry)
+{
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE
+    UnindexCacheEntry(aEntry);
+#endif
+    mCacheEntryPool.Free(aEntry);
+}
+
 void AddressResolver::RemoveCacheEntry(CacheEntry     &aEntry,
                                        CacheEntryList &aList,
                                        CacheEntry     *aPrevEntry,
@@ -404,6 +453,9 @@ void AddressResolver::UpdateSnoopedCacheEntry(const Ip6::Address &aEid, uint16_t
 
     entry->SetTarget(aEid);
     entry->SetRloc16(aRloc16);
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE
+    IndexCacheEntry(*entry);
+#endif
 
     if (numNonEvictable < kMaxNonEvictableSnoopedEntries)
     {
@@ -449,6 +501,9 @@ void AddressResolver::RestartAddressQueries(void)
 
     for (CacheEntry &entry : mQueryList)
     {
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE
+        entry.SetListId(kQueryListId);
+#endif
         IgnoreError(SendAddressQuery(entry.GetTarget()));
 
         entry.SetTimeout(kAddressQueryTimeout);
@@ -500,7 +555,7 @@ Error AddressResolver::Resolve(const Ip6::Address &aEid, uint16_t &aRloc16, bool
 
         if (!isFresh && (Get<RouterTable>().GetNextHop(entry->GetRloc16()) == Mle::kInvalidRloc16))
         {
-            mCacheEntryPool.Free(*entry);
+            FreeCacheEntry(*entry);
             entry = nullptr;
         }
 
@@ -515,10 +570,13 @@ Error AddressResolver::Resolve(const Ip6::Address &aEid, uint16_t &aRloc16, bool
 
             mCachedList.Push(*entry);
             aRloc16 = entry->GetRloc16();
+            mCounters.mHits++;
             ExitNow();
         }
     }
 
+    mCounters.mMisses++;
+
     if (entry == nullptr)
     {
         // If the entry is not present in any of the lists, try to
@@ -536,6 +594,9 @@ Error AddressResolver::Resolve(const Ip6::Address &aEid, uint16_t &aRloc16, bool
         entry->SetRetryDelay(kAddressQueryInitialRetryDelay);
         entry->SetCanEvict(false);
         list = nullptr;
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE
+        IndexCacheEntry(*entry);
+#endif
     }
 
     // Note that if `aAllowAddressQuery` is `false` then the `entry`
@@ -564,7 +625,7 @@ Error AddressResolver::Resolve(const Ip6::Address &aEid, uint16_t &aRloc16, bool
     entry->SetTimeout(kAddressQueryTimeout);
 
     error = SendAddressQuery(aEid);
-    VerifyOrExit(error == kErrorNone, mCacheEntryPool.Free(*entry));
+    VerifyOrExit(error == kErrorNone, FreeCacheEntry(*entry));
 
     if (list == nullptr)
     {
@@ -1092,10 +1153,59 @@ void AddressResolver::CacheEntry::SetNext(CacheEntry *aEntry)
     VerifyOrExit(aEntry != nullptr, mNextIndex = kNoNextIndex);
     mNextIndex = Get<AddressResolver>().GetCacheEntryPool().GetIndexOf(*aEntry);
 
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE
+    // All links within a list are set through `SetNext()`, so this
+    // keeps `mPrevIndex` of every entry which is not the head of
+    // its list up to date.
+    aEntry->mPrevIndex = Get<AddressResolver>().GetCacheEntryPool().GetIndexOf(*this);
+#endif
+
 exit:
     return;
 }
 
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE
+
+AddressResolver::CacheEntry *AddressResolver::CacheEntry::GetPrev(CacheEntryList &aList)
+{
+    CacheEntry *prev = nullptr;
+
+    VerifyOrExit(aList.GetHead() != this);
+
+    prev = &Get<AddressResolver>().GetCacheEntryPool().GetEntryAt(mPrevIndex);
+    OT_ASSERT(prev->GetNext() == this);
+
+exit:
+    return prev;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// AddressResolver cache index
+
+void AddressResolver::IndexCacheEntry(const CacheEntry &aEntry)
+{
+    SuccessOrAssert(mCacheIndex.Add(HashOf(aEntry.GetTarget()), mCacheEntryPool.GetIndexOf(aEntry)));
+}
+
+void AddressResolver::UnindexCacheEntry(const CacheEntry &aEntry)
+{
+    IgnoreError(mCacheIndex.Remove(HashOf(aEntry.GetTarget()), mCacheEntryPool.GetIndexOf(aEntry)));
+}
+
+uint32_t AddressResolver::HashOf(const Ip6::Address &aEid)
+{
+    uint32_t hash = 0;
+
+    for (uint8_t i = 0; i < Ip6::Address::kSize; i += sizeof(uint32_t))
+    {
+        hash = (hash << 5) ^ (hash >> 27) ^ BigEndian::ReadUint32(&aEid.GetBytes()[i]);
+    }
+
+    return hash;
+}
+
+#endif // OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE
+
 #endif // OPENTHREAD_FTD
 
 } // namespace ot
@@ -40,6 +40,7 @@
 
 #include "coap/coap.hpp"
 #include "common/as_core_type.hpp"
+#include "common/hash_index.hpp"
 #include "common/linked_list.hpp"
 #include "common/locator.hpp"
 #include "common/non_copyable.hpp"
@@ -53,6 +54,8 @@
 
 namespace ot {
 
+class UnitTester;
+
 /**
  * @addtogroup core-arp
  *
@@ -69,6 +72,7 @@ class AddressResolver : public InstanceLocator, private NonCopyable
 {
     friend class TimeTicker;
     friend class Tmf::Agent;
+    friend class UnitTester;
 
     class CacheEntry;
     class CacheEntryList;
@@ -105,6 +109,13 @@ public:
         };
     };
 
+    /**
+     * Represents the EID cache counters.
+     */
+    class Counters : public otCacheCounters, public Clearable<Counters>
+    {
+    };
+
     /**
      * Initializes the object.
      */
@@ -129,6 +140,18 @@ public:
      */
     Error GetNextCacheEntry(EntryInfo &aInfo, Iterator &aIterator) const;
 
+    /**
+     * Gets the EID cache counters.
+     *
+     * @returns A reference to the EID cache counters.
+     */
+    const Counters &GetCounters(void) const { return mCounters; }
+
+    /**
+     * Resets the EID cache counters.
+     */
+    void ResetCounters(void) { mCounters.Clear(); }
+
     /**
      * Removes the EID-to-RLOC cache entries corresponding to an RLOC16.
      *
@@ -284,6 +307,12 @@ private:
 
         bool Matches(const Ip6::Address &aEid) const { return GetTarget() == aEid; }
 
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE
+        uint8_t     GetListId(void) const { return mListId; }
+        void        SetListId(uint8_t aListId) { mListId = aListId; }
+        CacheEntry *GetPrev(CacheEntryList &aList);
+#endif
+
     private:
         static constexpr uint16_t kNoNextIndex          = 0x3fff;     // `mNextIndex` value when at end of list.
         static constexpr uint32_t kInvalidLastTransTime = 0xffffffff; // Value when `mLastTransactionTime` is invalid.
@@ -295,6 +324,10 @@ private:
         uint16_t     mRloc16;
         uint16_t     mNextIndex : 14;
         uint8_t      mFreshnessTimeout : 2;
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE
+        uint8_t  mListId;
+        uint16_t mPrevIndex; // Valid unless the entry is the head of its list.
+#endif
 
         union
         {
@@ -319,8 +352,41 @@ private:
 
     class CacheEntryList : public LinkedList<CacheEntry>
     {
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE
+    public:
+        explicit CacheEntryList(uint8_t aListId)
+            : mListId(aListId)
+        {
+        }
+
+        uint8_t GetListId(void) const { return mListId; }
+
+        void Push(CacheEntry &aEntry)
+        {
+            aEntry.SetListId(mListId);
+            LinkedList<CacheEntry>::Push(aEntry);
+        }
+
+    private:
+        uint8_t mListId;
+#endif
     };
 
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE
+    enum ListId : uint8_t
+    {
+        kCachedListId,
+        kSnoopedListId,
+        kQueryListId,
+        kQueryRetryListId,
+    };
+
+    // Maps the hash of an EID to the index of its `CacheEntry` in the
+    // `CacheEntryPool`. Since the index has twice as many slots as
+    // there are entries, adding an entry never fails.
+    typedef HashIndex<uint16_t, 2 * kCacheEntries> CacheIndex;
+#endif
+
     enum EntryChange : uint8_t
     {
         kEntryAdded,
@@ -347,6 +413,13 @@ private:
     void        Remove(const Ip6::Address &aEid, Reason aReason);
     CacheEntry *FindCacheEntry(const Ip6::Address &aEid, CacheEntryList *&aList, CacheEntry *&aPrevEntry);
     CacheEntry *NewCacheEntry(bool aSnoopedEntry);
+    void        FreeCacheEntry(CacheEntry &aEntry);
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE
+    void IndexCacheEntry(const CacheEntry &aEntry);
+    void UnindexCacheEntry(const CacheEntry &aEntry);
+
+    static uint32_t HashOf(const Ip6::Address &aEid);
+#endif
     void        RemoveCacheEntry(CacheEntry &aEntry, CacheEntryList &aList, CacheEntry *aPrevEntry, Reason aReason);
     Error       UpdateCacheEntry(const Ip6::Address &aEid, uint16_t aRloc16);
     Error       SendAddressQuery(const Ip6::Address &aEid);
@@ -389,7 +462,11 @@ private:
     CacheEntryList     mSnoopedList;
     CacheEntryList     mQueryList;
     CacheEntryList     mQueryRetryList;
+    Counters           mCounters;
     Ip6::Icmp::Handler mIcmpHandler;
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE
+    CacheIndex mCacheIndex;
+#endif
 
 #endif // OPENTHREAD_FTD
 };
@@ -406,6 +483,7 @@ DeclareTmfHandler(AddressResolver, kUriAddressNotify);
 
 DefineCoreType(otCacheEntryIterator, AddressResolver::Iterator);
 DefineCoreType(otCacheEntryInfo, AddressResolver::EntryInfo);
+DefineCoreType(otCacheCounters, AddressResolver::Counters);
 DefineMapEnum(otCacheEntryState, AddressResolver::EntryInfo::State);
 
 } // namespace ot
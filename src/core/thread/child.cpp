@@ -80,6 +80,10 @@ void Child::Clear(void)
 
     ClearAllBytes(*this);
     Init(instance);
+
+#if OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+    Get<ChildTable>().UpdateIndices(*this);
+#endif
 }
 
 void Child::ClearIp6Addresses(void)
@@ -89,6 +93,10 @@ void Child::ClearIp6Addresses(void)
 #if OPENTHREAD_CONFIG_TMF_PROXY_MLR_ENABLE
     mMlrRegisteredSet.Clear();
 #endif
+
+#if OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+    Get<ChildTable>().UpdateIndices(*this);
+#endif
 }
 
 void Child::SetDeviceMode(Mle::DeviceMode aMode)
@@ -167,6 +175,12 @@ Error Child::AddIp6Address(const Ip6::Address &aAddress)
     error = mIp6Addresses.PushBack(aAddress);
 
 exit:
+#if OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+    if (error == kErrorNone)
+    {
+        Get<ChildTable>().UpdateIndices(*this);
+    }
+#endif
     return error;
 }
 
@@ -207,6 +221,12 @@ Error Child::RemoveIp6Address(const Ip6::Address &aAddress)
     error = kErrorNone;
 
 exit:
+#if OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+    if (error == kErrorNone)
+    {
+        Get<ChildTable>().UpdateIndices(*this);
+    }
+#endif
     return error;
 }
 
@@ -85,6 +85,10 @@ ChildTable::ChildTable(Instance &aInstance)
     , mNextChildId(Mle::kMaxChildId)
     , mMaxChildrenAllowed(kMaxChildren)
 {
+#if OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+    ClearAllBytes(mIndexedHashes);
+#endif
+
     for (Child &child : mChildren)
     {
         child.Init(aInstance);
@@ -146,6 +150,21 @@ const Child *ChildTable::FindChild(const Child::AddressMatcher &aMatcher) const
 {
     const Child *child = mChildren;
 
+#if OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+    if (IsIndexed(aMatcher.mStateFilter))
+    {
+        if (aMatcher.mShortAddress != Mac::kShortAddrInvalid)
+        {
+            ExitNow(child = FindChild(mRloc16Index, HashOf(aMatcher.mShortAddress), aMatcher));
+        }
+
+        if (aMatcher.mExtAddress != nullptr)
+        {
+            ExitNow(child = FindChild(mExtAddressIndex, HashOf(*aMatcher.mExtAddress), aMatcher));
+        }
+    }
+#endif
+
     for (uint16_t num = mMaxChildrenAllowed; num != 0; num--, child++)
     {
         if (child->Matches(aMatcher))
@@ -160,6 +179,50 @@ exit:
     return child;
 }
 
+const Child *ChildTable::FindChild(const Ip6::Address &aIp6Address, Child::StateFilter aFilter, bool aSleepyOnly) const
+{
+    const Child *match = nullptr;
+
+#if OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+    if (IsIndexed(aFilter))
+    {
+        uint32_t hash = Get<Mle::Mle>().IsMeshLocalAddress(aIp6Address) ? HashOf(aIp6Address.GetIid())
+                                                                          : HashOf(aIp6Address);
+
+        // Select the matching child with the smallest index, the
+        // same one the table scan below would find.
+
+        for (uint16_t slot = mIp6AddressIndex.FindFirst(hash); slot != Ip6AddressIndex::kNotFound;
+             slot          = mIp6AddressIndex.FindNext(hash, slot))
+        {
+            uint16_t     childIndex = mIp6AddressIndex.GetValueAt(slot) / kNumIp6Slots;
+            const Child &child      = mChildren[childIndex];
+
+            if ((childIndex < mMaxChildrenAllowed) && ((match == nullptr) || (&child < match)) &&
+                child.MatchesFilter(aFilter) && (!aSleepyOnly || !child.IsRxOnWhenIdle()) &&
+                child.HasIp6Address(aIp6Address))
+            {
+                match = &child;
+            }
+        }
+
+        ExitNow();
+    }
+#endif
+
+    for (const Child *child = mChildren; child < &mChildren[mMaxChildrenAllowed]; child++)
+    {
+        if (child->MatchesFilter(aFilter) && (!aSleepyOnly || !child->IsRxOnWhenIdle()) &&
+            child->HasIp6Address(aIp6Address))
+        {
+            ExitNow(match = child);
+        }
+    }
+
+exit:
+    return match;
+}
+
 Child *ChildTable::FindChild(uint16_t aRloc16, Child::StateFilter aFilter)
 {
     return FindChild(Child::AddressMatcher(aRloc16, aFilter));
@@ -175,6 +238,11 @@ Child *ChildTable::FindChild(const Mac::Address &aMacAddress, Child::StateFilter
     return FindChild(Child::AddressMatcher(aMacAddress, aFilter));
 }
 
+Child *ChildTable::FindChild(const Ip6::Address &aIp6Address, Child::StateFilter aFilter)
+{
+    return FindChild(aIp6Address, aFilter, /* aSleepyOnly */ false);
+}
+
 bool ChildTable::HasChildren(Child::StateFilter aFilter) const
 {
     return (FindChild(Child::AddressMatcher(aFilter)) != nullptr);
@@ -361,19 +429,7 @@ exit:
 
 bool ChildTable::HasSleepyChildWithAddress(const Ip6::Address &aIp6Address) const
 {
-    bool         hasChild = false;
-    const Child *child    = &mChildren[0];
-
-    for (uint16_t num = mMaxChildrenAllowed; num != 0; num--, child++)
-    {
-        if (child->IsStateValidOrRestoring() && !child->IsRxOnWhenIdle() && child->HasIp6Address(aIp6Address))
-        {
-            hasChild = true;
-            break;
-        }
-    }
-
-    return hasChild;
+    return (FindChild(aIp6Address, Child::kInStateValidOrRestoring, /* aSleepyOnly */ true) != nullptr);
 }
 
 #if OPENTHREAD_CONFIG_REFERENCE_DEVICE_ENABLE
@@ -391,6 +447,126 @@ exit:
 
 #endif
 
+#if OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+
+bool ChildTable::IsIndexed(Child::StateFilter aFilter)
+{
+    // Only children in a state other than `kStateInvalid` are
+    // indexed.
+
+    bool isIndexed = false;
+
+    switch (aFilter)
+    {
+    case Child::kInStateValid:
+    case Child::kInStateValidOrRestoring:
+    case Child::kInStateChildIdRequest:
+    case Child::kInStateValidOrAttaching:
+    case Child::kInStateAnyExceptInvalid:
+    case Child::kInStateLinkRequest:
+        isIndexed = true;
+        break;
+
+    case Child::kInStateInvalid:
+    case Child::kInStateAnyExceptValidOrRestoring:
+    case Child::kInStateAny:
+        break;
+    }
+
+    return isIndexed;
+}
+
+uint32_t ChildTable::HashOf(const uint8_t *aBytes, uint8_t aLength)
+{
+    Fnv1aHash hash;
+
+    hash.FeedBytes(aBytes, aLength);
+
+    return hash.GetHash();
+}
+
+const Child *ChildTable::FindChild(const ChildIndex                &aIndex,
+                                   uint32_t                         aHash,
+                                   const Child::AddressMatcher &aMatcher) const
+{
+    // Selects the matching child with the smallest index, the same
+    // one a scan of the table would find.
+
+    const Child *match = nullptr;
+
+    for (uint16_t slot = aIndex.FindFirst(aHash); slot != ChildIndex::kNotFound; slot = aIndex.FindNext(aHash, slot))
+    {
+        uint16_t     childIndex = aIndex.GetValueAt(slot);
+        const Child &child      = mChildren[childIndex];
+
+        if ((childIndex < mMaxChildrenAllowed) && ((match == nullptr) || (&child < match)) && child.Matches(aMatcher))
+        {
+            match = &child;
+        }
+    }
+
+    return match;
+}
+
+void ChildTable::UpdateIndices(const Neighbor &aNeighbor)
+{
+    // Called after any change to the state, RLOC16, extended address
+    // or IPv6 addresses of `aNeighbor`. Removes all the values of the
+    // child (if it is one from the table) using the hashes they were
+    // added with and adds them back from its current values.
+
+    const Child   *child;
+    uint16_t       childIndex;
+    uint16_t       entry;
+    uint16_t       slot;
+    IndexedHashes *hashes;
+
+    VerifyOrExit(Contains(aNeighbor));
+
+    child      = static_cast<const Child *>(&aNeighbor);
+    childIndex = GetChildIndex(*child);
+    entry      = childIndex * kNumIp6Slots;
+    hashes     = &mIndexedHashes[childIndex];
+
+    IgnoreError(mRloc16Index.Remove(hashes->mRloc16, childIndex));
+    IgnoreError(mExtAddressIndex.Remove(hashes->mExtAddress, childIndex));
+
+    for (slot = 0; slot < kNumIp6Slots; slot++)
+    {
+        IgnoreError(mIp6AddressIndex.Remove(hashes->mIp6Addresses[slot], entry + slot));
+    }
+
+    VerifyOrExit(!child->IsStateInvalid());
+
+    // The indices have enough slots for all the children and their
+    // addresses, so adding a value never fails.
+
+    hashes->mRloc16     = HashOf(child->GetRloc16());
+    hashes->mExtAddress = HashOf(child->GetExtAddress());
+    SuccessOrAssert(mRloc16Index.Add(hashes->mRloc16, childIndex));
+    SuccessOrAssert(mExtAddressIndex.Add(hashes->mExtAddress, childIndex));
+
+    if (!child->GetMeshLocalIid().IsUnspecified())
+    {
+        hashes->mIp6Addresses[0] = HashOf(child->GetMeshLocalIid());
+        SuccessOrAssert(mIp6AddressIndex.Add(hashes->mIp6Addresses[0], entry));
+    }
+
+    slot = 0;
+
+    for (const Ip6::Address &address : child->GetIp6Addresses())
+    {
+        slot++;
+        hashes->mIp6Addresses[slot] = HashOf(address);
+        SuccessOrAssert(mIp6AddressIndex.Add(hashes->mIp6Addresses[slot], entry + slot));
+    }
+
+exit:
+    return;
+}
+
+#endif // OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+
 } // namespace ot
 
 #endif // OPENTHREAD_FTD
@@ -39,6 +39,8 @@
 #if OPENTHREAD_FTD
 
 #include "common/const_cast.hpp"
+#include "common/fnv_hash.hpp"
+#include "common/hash_index.hpp"
 #include "common/iterator_utils.hpp"
 #include "common/locator.hpp"
 #include "common/non_copyable.hpp"
@@ -52,6 +54,10 @@ namespace ot {
 class ChildTable : public InstanceLocator, private NonCopyable
 {
     friend class NeighborTable;
+#if OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+    friend class Neighbor;
+    friend class Child;
+#endif
     class IteratorBuilder;
 
 public:
@@ -174,6 +180,17 @@ public:
      */
     Child *FindChild(const Mac::Address &aMacAddress, Child::StateFilter aFilter);
 
+    /**
+     * Searches the child table for a `Child` which has registered a given IPv6 address also matching a given state
+     * filter.
+     *
+     * @param[in]  aIp6Address A reference to an IPv6 address.
+     * @param[in]  aFilter     A child state filter.
+     *
+     * @returns  A pointer to the `Child` entry if one is found, or `nullptr` otherwise.
+     */
+    Child *FindChild(const Ip6::Address &aIp6Address, Child::StateFilter aFilter);
+
     /**
      * Indicates whether the child table contains any child matching a given state filter.
      *
@@ -370,15 +387,61 @@ private:
 
     Child *FindChild(const Child::AddressMatcher &aMatcher) { return AsNonConst(AsConst(this)->FindChild(aMatcher)); }
 
+    Child *FindChild(const Ip6::Address &aIp6Address, Child::StateFilter aFilter, bool aSleepyOnly)
+    {
+        return AsNonConst(AsConst(this)->FindChild(aIp6Address, aFilter, aSleepyOnly));
+    }
+
     const Child *FindChild(const Child::AddressMatcher &aMatcher) const;
+    const Child *FindChild(const Ip6::Address &aIp6Address, Child::StateFilter aFilter, bool aSleepyOnly) const;
     void         RefreshStoredChildren(void);
 
+#if OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+    // Each child in a state other than `kStateInvalid` is added to
+    // three hash indices: by RLOC16 (hashed by child ID), by extended
+    // address, and by its registered IPv6 addresses. An IPv6 index
+    // value identifies the child and the address slot: slot zero is
+    // the mesh-local IID (hashed by IID only), followed by
+    // `Child::GetIp6Addresses()`. The hashes a child was added with
+    // are kept in `mIndexedHashes`, so that its values can be removed
+    // once the child has changed. Lookups always verify candidates
+    // against the child entry.
+
+    static constexpr uint16_t kNumIp6Slots = Child::kNumIp6Addresses + 1;
+
+    typedef HashIndex<uint16_t, 2 * kMaxChildren>                ChildIndex;
+    typedef HashIndex<uint16_t, 2 * kMaxChildren * kNumIp6Slots> Ip6AddressIndex;
+
+    struct IndexedHashes
+    {
+        uint32_t mRloc16;
+        uint32_t mExtAddress;
+        uint32_t mIp6Addresses[kNumIp6Slots];
+    };
+
+    static bool     IsIndexed(Child::StateFilter aFilter);
+    static uint32_t HashOf(const uint8_t *aBytes, uint8_t aLength);
+    static uint32_t HashOf(uint16_t aRloc16) { return Mle::ChildIdFromRloc16(aRloc16); }
+    static uint32_t HashOf(const Mac::ExtAddress &aExtAddress) { return HashOf(aExtAddress.m8, sizeof(aExtAddress)); }
+    static uint32_t HashOf(const Ip6::InterfaceIdentifier &aIid) { return HashOf(aIid.GetBytes(), sizeof(aIid)); }
+    static uint32_t HashOf(const Ip6::Address &aAddress) { return HashOf(aAddress.GetBytes(), sizeof(aAddress)); }
+
+    const Child *FindChild(const ChildIndex &aIndex, uint32_t aHash, const Child::AddressMatcher &aMatcher) const;
+    void         UpdateIndices(const Neighbor &aNeighbor);
+#endif
+
 #if OPENTHREAD_CONFIG_REFERENCE_DEVICE_ENABLE
     uint8_t mMaxChildIpAddresses;
 #endif
     uint16_t mNextChildId;
     uint16_t mMaxChildrenAllowed;
-    Child    mChildren[kMaxChildren];
+#if OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+    ChildIndex      mRloc16Index;
+    ChildIndex      mExtAddressIndex;
+    Ip6AddressIndex mIp6AddressIndex;
+    IndexedHashes   mIndexedHashes[kMaxChildren];
+#endif
+    Child mChildren[kMaxChildren];
 };
 
 } // namespace ot
@@ -334,6 +334,8 @@ void KeyManager::UpdateKeyMaterial(void)
 {
     HashKeys hashKeys;
 
+    mKeyScheduleCache.Clear();
+
     ComputeKeys(mKeySequence, hashKeys);
 
     mMleKey.SetFrom(hashKeys.GetMleKey());
@@ -441,6 +443,43 @@ const Mle::KeyMaterial &KeyManager::GetTemporaryMacKey(uint32_t aKeySequence)
 }
 #endif
 
+Crypto::AesEcb &KeyManager::GetMleKeySchedule(uint32_t aKeySequence)
+{
+    const Mle::KeyMaterial *key = &mMleKey;
+    Crypto::AesEcb         *ecb;
+
+    if (aKeySequence != mKeySequence)
+    {
+        key = &mTemporaryMleKey;
+    }
+
+    ecb = mKeyScheduleCache.Find(*key, aKeySequence);
+
+    if (ecb == nullptr)
+    {
+        if (key == &mTemporaryMleKey)
+        {
+            key = &GetTemporaryMleKey(aKeySequence);
+        }
+
+        ecb = &mKeyScheduleCache.Add(*key, aKeySequence);
+    }
+
+    return *ecb;
+}
+
+Crypto::AesEcb &KeyManager::GetMacKeySchedule(const Mac::KeyMaterial &aMacKey, uint32_t aKeySequence)
+{
+    Crypto::AesEcb *ecb = mKeyScheduleCache.Find(aMacKey, aKeySequence);
+
+    if (ecb == nullptr)
+    {
+        ecb = &mKeyScheduleCache.Add(aMacKey, aKeySequence);
+    }
+
+    return *ecb;
+}
+
 #if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
 const Mac::KeyMaterial &KeyManager::GetTemporaryTrelMacKey(uint32_t aKeySequence)
 {
@@ -711,4 +750,75 @@ void KeyManager::DestroyPersistentKeys(void) { Get<Crypto::Storage::KeyRefManage
 
 #endif // OPENTHREAD_CONFIG_PLATFORM_KEY_REFERENCES_ENABLE
 
+//---------------------------------------------------------------------------------------------------------------------
+// KeyManager::KeyScheduleCache
+
+void KeyManager::KeyScheduleCache::Clear(void)
+{
+    for (Entry &entry : mEntries)
+    {
+        entry.mKey = nullptr;
+    }
+
+    mUseCounter = 0;
+}
+
+Crypto::AesEcb *KeyManager::KeyScheduleCache::Find(const Mac::KeyMaterial &aKey, uint32_t aKeySequence)
+{
+    Crypto::AesEcb *ecb = nullptr;
+
+#if OPENTHREAD_CONFIG_PLATFORM_KEY_REFERENCES_ENABLE
+    // With key references, the AES context only tracks the key
+    // reference (which may be destroyed and replaced when the key
+    // material is computed again), so a cached entry is never
+    // reused and the key is always set again.
+    OT_UNUSED_VARIABLE(aKey);
+    OT_UNUSED_VARIABLE(aKeySequence);
+#else
+    for (Entry &entry : mEntries)
+    {
+        if ((entry.mKey == &aKey) && (entry.mKeySequence == aKeySequence))
+        {
+            entry.mLastUsed = ++mUseCounter;
+            ecb             = &entry.mEcb;
+            break;
+        }
+    }
+#endif
+
+    return ecb;
+}
+
+Crypto::AesEcb &KeyManager::KeyScheduleCache::Add(const Mac::KeyMaterial &aKey, uint32_t aKeySequence)
+{
+    // Uses an unused entry if there is one, otherwise replaces the
+    // least recently used entry.
+
+    Entry      *entry = &mEntries[0];
+    Crypto::Key cryptoKey;
+
+    for (Entry &candidate : mEntries)
+    {
+        if (candidate.mKey == nullptr)
+        {
+            entry = &candidate;
+            break;
+        }
+
+        if (candidate.mLastUsed < entry->mLastUsed)
+        {
+            entry = &candidate;
+        }
+    }
+
+    aKey.ConvertToCryptoKey(cryptoKey);
+    entry->mEcb.SetKey(cryptoKey);
+
+    entry->mKey         = &aKey;
+    entry->mKeySequence = aKeySequence;
+    entry->mLastUsed    = ++mUseCounter;
+
+    return entry->mEcb;
+}
+
 } // namespace ot
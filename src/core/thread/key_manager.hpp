@@ -49,6 +49,7 @@
 #include "common/non_copyable.hpp"
 #include "common/random.hpp"
 #include "common/timer.hpp"
+#include "crypto/aes_ecb.hpp"
 #include "crypto/hmac_sha256.hpp"
 #include "mac/mac_types.hpp"
 #include "thread/mle_types.hpp"
@@ -376,6 +377,37 @@ public:
      */
     const Mle::KeyMaterial &GetTemporaryMacKey(uint32_t aKeySequence);
 
+    /**
+     * Returns an `AesEcb` with its key set to the MLE key for a given key sequence.
+     *
+     * The prepared AES key schedules are cached, so for a recently used key sequence neither the MLE key is computed
+     * again nor the AES key is set up again. The cache is cleared whenever the key material is updated (e.g., on key
+     * rotation or when the network key changes).
+     *
+     * The returned `AesEcb` can be used until the next call to `GetMleKeySchedule()` or `GetMacKeySchedule()`.
+     *
+     * @param[in]  aKeySequence  The key sequence value.
+     *
+     * @returns The `AesEcb` to use for the MLE key of @p aKeySequence.
+     */
+    Crypto::AesEcb &GetMleKeySchedule(uint32_t aKeySequence);
+
+    /**
+     * Returns an `AesEcb` with its key set to a given MAC key (used with key ID mode 1).
+     *
+     * The cached key schedules are looked up by the @p aMacKey instance and @p aKeySequence. So @p aMacKey MUST be one
+     * of the MAC key materials maintained for the key sequences (e.g., the current, previous or next MAC key from
+     * `SubMac` or a TREL MAC key from `KeyManager`), and its content MUST only depend on @p aKeySequence.
+     *
+     * The returned `AesEcb` can be used until the next call to `GetMleKeySchedule()` or `GetMacKeySchedule()`.
+     *
+     * @param[in]  aMacKey       The MAC key material.
+     * @param[in]  aKeySequence  The key sequence of @p aMacKey.
+     *
+     * @returns The `AesEcb` to use for @p aMacKey.
+     */
+    Crypto::AesEcb &GetMacKeySchedule(const Mac::KeyMaterial &aMacKey, uint32_t aKeySequence);
+
 #if OPENTHREAD_CONFIG_RADIO_LINK_IEEE_802_15_4_ENABLE
     /**
      * Returns the current MAC Frame Counter value for 15.4 radio link.
@@ -593,6 +625,38 @@ private:
         const Mac::Key &GetMacKey(void) const { return mKeys.mMacKey; }
     };
 
+    class KeyScheduleCache
+    {
+        // Caches `AesEcb` instances with their key already set. An
+        // entry is identified by the `KeyMaterial` instance it was
+        // set from along with the key sequence, so for temporary key
+        // materials (whose content changes with the key sequence) the
+        // entry can be found before computing the key again.
+
+    public:
+        KeyScheduleCache(void) { Clear(); }
+
+        void            Clear(void);
+        Crypto::AesEcb *Find(const Mac::KeyMaterial &aKey, uint32_t aKeySequence);
+        Crypto::AesEcb &Add(const Mac::KeyMaterial &aKey, uint32_t aKeySequence);
+
+    private:
+        static constexpr uint8_t kNumEntries = OPENTHREAD_CONFIG_AES_KEY_SCHEDULE_CACHE_SIZE;
+
+        static_assert(kNumEntries > 0, "OPENTHREAD_CONFIG_AES_KEY_SCHEDULE_CACHE_SIZE must be at least one");
+
+        struct Entry
+        {
+            Crypto::AesEcb          mEcb;
+            const Mac::KeyMaterial *mKey;
+            uint32_t                mKeySequence;
+            uint32_t                mLastUsed;
+        };
+
+        Entry    mEntries[kNumEntries];
+        uint32_t mUseCounter;
+    };
+
     void ComputeKeys(uint32_t aKeySequence, HashKeys &aHashKeys) const;
 
 #if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
@@ -628,6 +692,7 @@ private:
     uint32_t         mKeySequence;
     Mle::KeyMaterial mMleKey;
     Mle::KeyMaterial mTemporaryMleKey;
+    KeyScheduleCache mKeyScheduleCache;
 
 #if OPENTHREAD_CONFIG_WAKEUP_END_DEVICE_ENABLE
     Mle::KeyMaterial mTemporaryMacKey;
@@ -159,6 +159,37 @@ exit:
     return;
 }
 
+void LinkQualityInfo::SetLinkQualityIn(LinkQuality aLinkQuality)
+{
+    VerifyOrExit(GetLinkQualityIn() != aLinkQuality);
+    mLinkQualityIn = aLinkQuality;
+    HandleLinkQualityChanged();
+
+exit:
+    return;
+}
+
+void LinkQualityInfo::SetLinkQualityOut(LinkQuality aLinkQuality)
+{
+    VerifyOrExit(GetLinkQualityOut() != aLinkQuality);
+    mLinkQualityOut = aLinkQuality;
+    HandleLinkQualityChanged();
+
+exit:
+    return;
+}
+
+void LinkQualityInfo::HandleLinkQualityChanged(void)
+{
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MLE_ROUTE_CACHE_ENABLE
+    // The link cost to a neighboring router is derived from its
+    // link quality. The `LinkQualityInfo` may belong to any type of
+    // neighbor, so all cached routes are marked as stale.
+
+    Get<RouterTable>().InvalidateRoutes();
+#endif
+}
+
 uint8_t LinkQualityInfo::GetLinkMargin(void) const
 {
     return ComputeLinkMargin(Get<Mac::SubMac>().GetNoiseFloor(), GetAverageRss());
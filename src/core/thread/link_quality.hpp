@@ -421,7 +421,7 @@ public:
      *
      * @param[in]  aLinkQuality  The link quality out value.
      */
-    void SetLinkQualityOut(LinkQuality aLinkQuality) { mLinkQualityOut = aLinkQuality; }
+    void SetLinkQualityOut(LinkQuality aLinkQuality);
 
 private:
     // Constants for obtaining link quality from link margin:
@@ -438,7 +438,8 @@ private:
 
     static constexpr uint8_t kNoLinkQuality = 0xff; // Indicate that there is no previous/last link quality.
 
-    void SetLinkQualityIn(LinkQuality aLinkQuality) { mLinkQualityIn = aLinkQuality; }
+    void SetLinkQualityIn(LinkQuality aLinkQuality);
+    void HandleLinkQualityChanged(void);
 
     static LinkQuality CalculateLinkQuality(uint8_t aLinkMargin, uint8_t aLastLinkQuality);
 
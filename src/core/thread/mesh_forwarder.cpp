@@ -1242,7 +1242,8 @@ Error MeshForwarder::FrameToMessage(RxInfo &aRxInfo, uint16_t aDatagramSize, Mes
 
     SuccessOrExit(error = GetFramePriority(aRxInfo, priority));
 
-    aMessage = Get<MessagePool>().Allocate(Message::kTypeIp6, /* aReserveHeader */ 0, Message::Settings(priority));
+    aMessage = Get<MessagePool>().Allocate(Message::kTypeIp6, /* aReserveHeader */ 0,
+                                           Message::Settings(kWithLinkSecurity, priority, Message::kOriginThreadNetif));
     VerifyOrExit(aMessage, error = kErrorNoBufs);
 
     SuccessOrExit(error = Get<Lowpan::Lowpan>().Decompress(*aMessage, aRxInfo.mMacAddrs, frameData, aDatagramSize));
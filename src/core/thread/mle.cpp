@@ -968,7 +968,10 @@ bool Mle::IsCslSupported(void) const { return IsChild() && GetParent().IsThreadV
 
 void Mle::InitNeighbor(Neighbor &aNeighbor, const RxInfo &aRxInfo)
 {
-    aNeighbor.GetExtAddress().SetFromIid(aRxInfo.mMessageInfo.GetPeerAddr().GetIid());
+    Mac::ExtAddress extAddress;
+
+    extAddress.SetFromIid(aRxInfo.mMessageInfo.GetPeerAddr().GetIid());
+    aNeighbor.SetExtAddress(extAddress);
     aNeighbor.GetLinkInfo().Clear();
     aNeighbor.GetLinkInfo().AddRss(aRxInfo.mMessage.GetAverageRss());
     aNeighbor.ResetLinkFailures();
@@ -1553,9 +1556,7 @@ Error Mle::ProcessMessageSecurity(Crypto::AesCcm::Mode    aMode,
 
     keySequence = aHeader.GetKeyId();
 
-    aesCcm.SetKey(keySequence == Get<KeyManager>().GetCurrentKeySequence()
-                      ? Get<KeyManager>().GetCurrentMleKey()
-                      : Get<KeyManager>().GetTemporaryMleKey(keySequence));
+    aesCcm.SetKey(Get<KeyManager>().GetMleKeySchedule(keySequence));
 
     aesCcm.Init(sizeof(Ip6::Address) + sizeof(Ip6::Address) + sizeof(SecurityHeader), payloadLength,
                 kMleSecurityTagSize, nonce, sizeof(nonce));
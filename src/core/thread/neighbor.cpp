@@ -47,10 +47,44 @@ void Neighbor::SetState(State aState)
         mConnectionStart = Get<UptimeTracker>().GetUptimeInSeconds();
     }
 
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+    Get<ChildTable>().UpdateIndices(*this);
+#endif
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MLE_ROUTE_CACHE_ENABLE
+    if (Get<RouterTable>().Contains(*this))
+    {
+        Get<RouterTable>().InvalidateRoutes();
+    }
+#endif
+
 exit:
     return;
 }
 
+void Neighbor::SetExtAddress(const Mac::ExtAddress &aAddress)
+{
+    mMacAddr = aAddress;
+
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+    Get<ChildTable>().UpdateIndices(*this);
+#endif
+}
+
+void Neighbor::SetRloc16(uint16_t aRloc16)
+{
+    mRloc16 = aRloc16;
+
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+    Get<ChildTable>().UpdateIndices(*this);
+#endif
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MLE_ROUTE_CACHE_ENABLE
+    if (Get<RouterTable>().Contains(*this))
+    {
+        Get<RouterTable>().InvalidateRoutes();
+    }
+#endif
+}
+
 uint32_t Neighbor::GetConnectionTime(void) const
 {
     return IsStateValid() ? Get<UptimeTracker>().GetUptimeInSeconds() - mConnectionStart : 0;
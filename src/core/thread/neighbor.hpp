@@ -174,6 +174,10 @@ public:
         bool Matches(const Neighbor &aNeighbor) const;
 
     private:
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+        friend class ChildTable;
+#endif
+
         AddressMatcher(StateFilter aStateFilter, Mac::ShortAddress aShortAddress, const Mac::ExtAddress *aExtAddress)
             : mStateFilter(aStateFilter)
             , mShortAddress(aShortAddress)
@@ -354,7 +358,7 @@ public:
      *
      * @param[in]  aAddress  The Extended Address value to set.
      */
-    void SetExtAddress(const Mac::ExtAddress &aAddress) { mMacAddr = aAddress; }
+    void SetExtAddress(const Mac::ExtAddress &aAddress);
 
     /**
      * Gets the key sequence value.
@@ -454,7 +458,7 @@ public:
      *
      * @param[in]  aRloc16  The RLOC16 value.
      */
-    void SetRloc16(uint16_t aRloc16) { mRloc16 = aRloc16; }
+    void SetRloc16(uint16_t aRloc16);
 
 #if OPENTHREAD_CONFIG_MULTI_RADIO
     /**
@@ -165,13 +165,7 @@ Neighbor *NeighborTable::FindNeighbor(const Ip6::Address &aIp6Address, Neighbor:
         ExitNow();
     }
 
-    for (Child &child : Get<ChildTable>().Iterate(aFilter))
-    {
-        if (child.HasIp6Address(aIp6Address))
-        {
-            ExitNow(neighbor = &child);
-        }
-    }
+    neighbor = Get<ChildTable>().FindChild(aIp6Address, aFilter);
 
 exit:
     return neighbor;
@@ -159,6 +159,15 @@ const PrefixTlv *Leader::FindNextMatchingPrefixTlv(const Ip6::Address &aAddress,
 }
 
 void Leader::FindContextForAddress(const Ip6::Address &aAddress, Lowpan::Context &aContext) const
+{
+#if OPENTHREAD_CONFIG_NETDATA_LOOKUP_TABLE_ENABLE
+    FindContextForAddressInLookupTable(aAddress, aContext);
+#else
+    FindContextForAddressInTlvs(aAddress, aContext);
+#endif
+}
+
+void Leader::FindContextForAddressInTlvs(const Ip6::Address &aAddress, Lowpan::Context &aContext) const
 {
     const PrefixTlv  *prefixTlv = nullptr;
     const ContextTlv *contextTlv;
@@ -206,6 +215,15 @@ const PrefixTlv *Leader::FindPrefixTlvForContextId(uint8_t aContextId, const Con
 }
 
 void Leader::FindContextForId(uint8_t aContextId, Lowpan::Context &aContext) const
+{
+#if OPENTHREAD_CONFIG_NETDATA_LOOKUP_TABLE_ENABLE
+    FindContextForIdInLookupTable(aContextId, aContext);
+#else
+    FindContextForIdInTlvs(aContextId, aContext);
+#endif
+}
+
+void Leader::FindContextForIdInTlvs(uint8_t aContextId, Lowpan::Context &aContext) const
 {
     const PrefixTlv  *prefixTlv;
     const ContextTlv *contextTlv;
@@ -228,6 +246,15 @@ exit:
 }
 
 bool Leader::IsOnMesh(const Ip6::Address &aAddress) const
+{
+#if OPENTHREAD_CONFIG_NETDATA_LOOKUP_TABLE_ENABLE
+    return IsOnMeshInLookupTable(aAddress);
+#else
+    return IsOnMeshInTlvs(aAddress);
+#endif
+}
+
+bool Leader::IsOnMeshInTlvs(const Ip6::Address &aAddress) const
 {
     const PrefixTlv *prefixTlv = nullptr;
     bool             isOnMesh  = false;
@@ -257,6 +284,37 @@ exit:
 }
 
 Error Leader::RouteLookup(const Ip6::Address &aSource, const Ip6::Address &aDestination, uint16_t &aRloc16) const
+{
+    Error error;
+
+#if OPENTHREAD_CONFIG_NETDATA_LOOKUP_TABLE_ENABLE
+    error = RouteLookupInLookupTable(aSource, aDestination, aRloc16);
+#else
+    error = RouteLookupInTlvs(aSource, aDestination, aRloc16);
+#endif
+    VerifyOrExit(error != kErrorNone);
+
+#if OPENTHREAD_CONFIG_IP6_SLAAC_ENABLE
+    {
+        // The `Slaac` module keeps track of the associated Domain IDs
+        // for deprecating SLAAC prefixes, even if the related
+        // Prefix TLV has already been removed from the Network
+        // Data.
+
+        uint8_t domainId;
+
+        if (Get<Ip6::Slaac>().FindDomainIdFor(aSource, domainId) == kErrorNone)
+        {
+            error = ExternalRouteLookup(domainId, aDestination, aRloc16);
+        }
+    }
+#endif
+
+exit:
+    return error;
+}
+
+Error Leader::RouteLookupInTlvs(const Ip6::Address &aSource, const Ip6::Address &aDestination, uint16_t &aRloc16) const
 {
     Error            error     = kErrorNoRoute;
     const PrefixTlv *prefixTlv = nullptr;
@@ -268,7 +326,7 @@ Error Leader::RouteLookup(const Ip6::Address &aSource, const Ip6::Address &aDest
             continue;
         }
 
-        if (ExternalRouteLookup(prefixTlv->GetDomainId(), aDestination, aRloc16) == kErrorNone)
+        if (ExternalRouteLookupInTlvs(prefixTlv->GetDomainId(), aDestination, aRloc16) == kErrorNone)
         {
             ExitNow(error = kErrorNone);
         }
@@ -279,22 +337,6 @@ Error Leader::RouteLookup(const Ip6::Address &aSource, const Ip6::Address &aDest
         }
     }
 
-#if OPENTHREAD_CONFIG_IP6_SLAAC_ENABLE
-    {
-        // The `Slaac` module keeps track of the associated Domain IDs
-        // for deprecating SLAAC prefixes, even if the related
-        // Prefix TLV has already been removed from the Network
-        // Data.
-
-        uint8_t domainId;
-
-        if (Get<Ip6::Slaac>().FindDomainIdFor(aSource, domainId) == kErrorNone)
-        {
-            error = ExternalRouteLookup(domainId, aDestination, aRloc16);
-        }
-    }
-#endif
-
 exit:
     return error;
 }
@@ -356,6 +398,15 @@ exit:
 }
 
 Error Leader::ExternalRouteLookup(uint8_t aDomainId, const Ip6::Address &aDestination, uint16_t &aRloc16) const
+{
+#if OPENTHREAD_CONFIG_NETDATA_LOOKUP_TABLE_ENABLE
+    return ExternalRouteLookupInLookupTable(aDomainId, aDestination, aRloc16);
+#else
+    return ExternalRouteLookupInTlvs(aDomainId, aDestination, aRloc16);
+#endif
+}
+
+Error Leader::ExternalRouteLookupInTlvs(uint8_t aDomainId, const Ip6::Address &aDestination, uint16_t &aRloc16) const
 {
     Error                error           = kErrorNoRoute;
     const PrefixTlv     *prefixTlv       = nullptr;
@@ -447,6 +498,275 @@ Error Leader::DefaultRouteLookup(const PrefixTlv &aPrefix, uint16_t &aRloc16) co
     return LookupRouteIn(aPrefix, IsEntryDefaultRoute, aRloc16);
 }
 
+#if OPENTHREAD_CONFIG_NETDATA_LOOKUP_TABLE_ENABLE
+
+const Leader::LookupTable &Leader::GetLookupTable(void) const
+{
+    if (mLookupTable.mIsStale)
+    {
+        AsNonConst(this)->BuildLookupTable();
+    }
+
+    return mLookupTable;
+}
+
+void Leader::BuildLookupTable(void)
+{
+    LookupTable     &table = mLookupTable;
+    TlvIterator      tlvIterator(GetTlvsStart(), GetTlvsEnd());
+    const PrefixTlv *prefixTlv;
+
+    table.mNumPrefixes = 0;
+    table.mNumRoutes   = 0;
+    memset(table.mContextPrefixes, LookupTable::kNoPrefix, sizeof(table.mContextPrefixes));
+
+    while ((prefixTlv = tlvIterator.Iterate<PrefixTlv>()) != nullptr)
+    {
+        PrefixEntry           &entry      = table.mPrefixes[table.mNumPrefixes];
+        const ContextTlv      *contextTlv = prefixTlv->FindSubTlv<ContextTlv>();
+        TlvIterator            hasRouteIterator(*prefixTlv);
+        TlvIterator            brIterator(*prefixTlv);
+        const HasRouteTlv     *hasRouteTlv;
+        const BorderRouterTlv *brTlv;
+        uint8_t                index;
+
+        prefixTlv->CopyPrefixTo(entry.mPrefix);
+        entry.mDomainId           = prefixTlv->GetDomainId();
+        entry.mContextId          = (contextTlv != nullptr) ? contextTlv->GetContextId() : 0;
+        entry.mHasContext         = (contextTlv != nullptr);
+        entry.mCompressFlag       = (contextTlv != nullptr) && contextTlv->IsCompress();
+        entry.mHasBorderRouterTlv = (prefixTlv->FindSubTlv<BorderRouterTlv>() != nullptr);
+        entry.mHasOnMeshEntry     = false;
+
+        if (entry.mHasContext && (table.mContextPrefixes[entry.mContextId] == LookupTable::kNoPrefix))
+        {
+            table.mContextPrefixes[entry.mContextId] = table.mNumPrefixes;
+        }
+
+        entry.mRoutesStart = table.mNumRoutes;
+
+        while ((hasRouteTlv = hasRouteIterator.Iterate<HasRouteTlv>()) != nullptr)
+        {
+            for (const HasRouteEntry *routeEntry = hasRouteTlv->GetFirstEntry();
+                 routeEntry <= hasRouteTlv->GetLastEntry(); routeEntry = routeEntry->GetNext())
+            {
+                table.mRoutes[table.mNumRoutes].mRloc16     = routeEntry->GetRloc();
+                table.mRoutes[table.mNumRoutes].mPreference = routeEntry->GetPreference();
+                table.mNumRoutes++;
+            }
+        }
+
+        entry.mNumRoutes          = table.mNumRoutes - entry.mRoutesStart;
+        entry.mDefaultRoutesStart = table.mNumRoutes;
+
+        while ((brTlv = brIterator.Iterate<BorderRouterTlv>()) != nullptr)
+        {
+            for (const BorderRouterEntry *brEntry = brTlv->GetFirstEntry(); brEntry <= brTlv->GetLastEntry();
+                 brEntry                          = brEntry->GetNext())
+            {
+                if (brEntry->IsOnMesh())
+                {
+                    entry.mHasOnMeshEntry = true;
+                }
+
+                if (brEntry->IsDefaultRoute())
+                {
+                    table.mRoutes[table.mNumRoutes].mRloc16     = brEntry->GetRloc();
+                    table.mRoutes[table.mNumRoutes].mPreference = brEntry->GetPreference();
+                    table.mNumRoutes++;
+                }
+            }
+        }
+
+        entry.mNumDefaultRoutes = table.mNumRoutes - entry.mDefaultRoutesStart;
+
+        // Insert the new entry in `mLongestFirst[]` after all entries
+        // with the same or a longer prefix length, so that entries of
+        // the same length stay in Network Data order.
+
+        for (index = table.mNumPrefixes; index > 0; index--)
+        {
+            if (table.mPrefixes[table.mLongestFirst[index - 1]].mPrefix.GetLength() >= entry.mPrefix.GetLength())
+            {
+                break;
+            }
+
+            table.mLongestFirst[index] = table.mLongestFirst[index - 1];
+        }
+
+        table.mLongestFirst[index] = table.mNumPrefixes;
+        table.mNumPrefixes++;
+    }
+
+    table.mIsStale = false;
+}
+
+void Leader::InitContextFrom(const PrefixEntry &aEntry, Lowpan::Context &aContext)
+{
+    aContext.mPrefix       = aEntry.mPrefix;
+    aContext.mContextId    = aEntry.mContextId;
+    aContext.mCompressFlag = aEntry.mCompressFlag;
+    aContext.mIsValid      = true;
+}
+
+void Leader::FindContextForAddressInLookupTable(const Ip6::Address &aAddress, Lowpan::Context &aContext) const
+{
+    const LookupTable &table = GetLookupTable();
+
+    aContext.Clear();
+
+    if (Get<Mle::Mle>().IsMeshLocalAddress(aAddress))
+    {
+        aContext.InitForMeshLocalPrefix(GetInstance());
+    }
+
+    // The first matching entry with a context in `mLongestFirst[]`
+    // order is the longest match. It is used only if it is longer
+    // than the mesh-local prefix (when the address is mesh-local).
+
+    for (uint8_t i = 0; i < table.mNumPrefixes; i++)
+    {
+        const PrefixEntry &entry = table.mPrefixes[table.mLongestFirst[i]];
+
+        if (entry.mPrefix.GetLength() <= aContext.mPrefix.GetLength())
+        {
+            break;
+        }
+
+        if (entry.mHasContext && aAddress.MatchesPrefix(entry.mPrefix))
+        {
+            InitContextFrom(entry, aContext);
+            break;
+        }
+    }
+}
+
+void Leader::FindContextForIdInLookupTable(uint8_t aContextId, Lowpan::Context &aContext) const
+{
+    const LookupTable &table = GetLookupTable();
+
+    aContext.Clear();
+
+    if (aContextId == Mle::kMeshLocalPrefixContextId)
+    {
+        aContext.InitForMeshLocalPrefix(GetInstance());
+        ExitNow();
+    }
+
+    VerifyOrExit(aContextId < LookupTable::kNumContextIds);
+    VerifyOrExit(table.mContextPrefixes[aContextId] != LookupTable::kNoPrefix);
+
+    InitContextFrom(table.mPrefixes[table.mContextPrefixes[aContextId]], aContext);
+
+exit:
+    return;
+}
+
+bool Leader::IsOnMeshInLookupTable(const Ip6::Address &aAddress) const
+{
+    const LookupTable &table    = GetLookupTable();
+    bool               isOnMesh = false;
+
+    VerifyOrExit(!Get<Mle::Mle>().IsMeshLocalAddress(aAddress), isOnMesh = true);
+
+    for (uint8_t i = 0; i < table.mNumPrefixes; i++)
+    {
+        const PrefixEntry &entry = table.mPrefixes[i];
+
+        if (entry.mHasOnMeshEntry && aAddress.MatchesPrefix(entry.mPrefix))
+        {
+            ExitNow(isOnMesh = true);
+        }
+    }
+
+exit:
+    return isOnMesh;
+}
+
+Error Leader::RouteLookupInLookupTable(const Ip6::Address &aSource,
+                                       const Ip6::Address &aDestination,
+                                       uint16_t           &aRloc16) const
+{
+    const LookupTable &table = GetLookupTable();
+    Error              error = kErrorNoRoute;
+
+    for (uint8_t i = 0; i < table.mNumPrefixes; i++)
+    {
+        const PrefixEntry &entry = table.mPrefixes[i];
+
+        if (!entry.mHasBorderRouterTlv || !aSource.MatchesPrefix(entry.mPrefix))
+        {
+            continue;
+        }
+
+        if (ExternalRouteLookupInLookupTable(entry.mDomainId, aDestination, aRloc16) == kErrorNone)
+        {
+            ExitNow(error = kErrorNone);
+        }
+
+        if (LookupRouteIn(&table.mRoutes[entry.mDefaultRoutesStart], entry.mNumDefaultRoutes, aRloc16) == kErrorNone)
+        {
+            ExitNow(error = kErrorNone);
+        }
+    }
+
+exit:
+    return error;
+}
+
+Error Leader::ExternalRouteLookupInLookupTable(uint8_t             aDomainId,
+                                               const Ip6::Address &aDestination,
+                                               uint16_t           &aRloc16) const
+{
+    // Only the first entry in `mLongestFirst[]` order matching
+    // `aDestination` with Has Route entries in `aDomainId` is
+    // considered, i.e., the longest match and the first one in
+    // Network Data order among the matches of the same length.
+
+    const LookupTable &table = GetLookupTable();
+    Error              error = kErrorNoRoute;
+
+    for (uint8_t i = 0; i < table.mNumPrefixes; i++)
+    {
+        const PrefixEntry &entry = table.mPrefixes[table.mLongestFirst[i]];
+
+        if ((entry.mNumRoutes == 0) || (entry.mDomainId != aDomainId) || !aDestination.MatchesPrefix(entry.mPrefix))
+        {
+            continue;
+        }
+
+        error = LookupRouteIn(&table.mRoutes[entry.mRoutesStart], entry.mNumRoutes, aRloc16);
+        break;
+    }
+
+    return error;
+}
+
+Error Leader::LookupRouteIn(const RouteEntry *aRoutes, uint8_t aNumRoutes, uint16_t &aRloc16) const
+{
+    Error             error     = kErrorNoRoute;
+    const RouteEntry *bestRoute = nullptr;
+
+    for (const RouteEntry *route = aRoutes; route < aRoutes + aNumRoutes; route++)
+    {
+        if ((bestRoute == nullptr) || CompareRouteEntries(route->mPreference, route->mRloc16, bestRoute->mPreference,
+                                                          bestRoute->mRloc16) > 0)
+        {
+            bestRoute = route;
+        }
+    }
+
+    if (bestRoute != nullptr)
+    {
+        aRloc16 = bestRoute->mRloc16;
+        error   = kErrorNone;
+    }
+
+    return error;
+}
+
+#endif // OPENTHREAD_CONFIG_NETDATA_LOOKUP_TABLE_ENABLE
+
 Error Leader::SetNetworkData(uint8_t            aVersion,
                              uint8_t            aStableVersion,
                              Type               aType,
@@ -687,6 +1007,9 @@ Error Leader::SteeringDataCheckJoiner(const MeshCoP::JoinerDiscerner &aDiscerner
 void Leader::SignalNetDataChanged(void)
 {
     mMaxLength = Max(mMaxLength, GetLength());
+#if OPENTHREAD_CONFIG_NETDATA_LOOKUP_TABLE_ENABLE
+    mLookupTable.mIsStale = true;
+#endif
     Get<ot::Notifier>().Signal(kEventThreadNetdataChanged);
 }
 
@@ -50,6 +50,8 @@
 
 namespace ot {
 
+class UnitTester;
+
 namespace NetworkData {
 
 /**
@@ -68,6 +70,7 @@ class Leader : public MutableNetworkData, private NonCopyable
 {
     friend class Tmf::Agent;
     friend class Notifier;
+    friend class ot::UnitTester;
 
 public:
     /**
@@ -435,6 +438,12 @@ private:
     const PrefixTlv *FindNextMatchingPrefixTlv(const Ip6::Address &aAddress, const PrefixTlv *aPrevTlv) const;
     const PrefixTlv *FindPrefixTlvForContextId(uint8_t aContextId, const ContextTlv *&aContextTlv) const;
 
+    void  FindContextForAddressInTlvs(const Ip6::Address &aAddress, Lowpan::Context &aContext) const;
+    void  FindContextForIdInTlvs(uint8_t aContextId, Lowpan::Context &aContext) const;
+    bool  IsOnMeshInTlvs(const Ip6::Address &aAddress) const;
+    Error RouteLookupInTlvs(const Ip6::Address &aSource, const Ip6::Address &aDestination, uint16_t &aRloc16) const;
+    Error ExternalRouteLookupInTlvs(uint8_t aDomainId, const Ip6::Address &aDestination, uint16_t &aRloc16) const;
+
     int CompareRouteEntries(const BorderRouterEntry &aFirst, const BorderRouterEntry &aSecond) const;
     int CompareRouteEntries(const HasRouteEntry &aFirst, const HasRouteEntry &aSecond) const;
     int CompareRouteEntries(const ServerTlv &aFirst, const ServerTlv &aSecond) const;
@@ -448,6 +457,68 @@ private:
     Error ExternalRouteLookup(uint8_t aDomainId, const Ip6::Address &aDestination, uint16_t &aRloc16) const;
     Error DefaultRouteLookup(const PrefixTlv &aPrefix, uint16_t &aRloc16) const;
     Error LookupRouteIn(const PrefixTlv &aPrefixTlv, EntryChecker aEntryChecker, uint16_t &aRloc16) const;
+#if OPENTHREAD_CONFIG_NETDATA_LOOKUP_TABLE_ENABLE
+    // `LookupTable` holds the Prefix TLVs of the Network Data compiled
+    // for the route, on-mesh and 6LoWPAN context lookups. It is marked
+    // stale from `SignalNetDataChanged()` and rebuilt on next lookup.
+    // A valid Prefix TLV is at least `sizeof(PrefixTlv)` bytes and each
+    // route entry at least `sizeof(HasRouteEntry)` bytes, which bounds
+    // the number of prefixes and route entries in the Network Data.
+
+    struct RouteEntry
+    {
+        uint16_t mRloc16;
+        int8_t   mPreference;
+    };
+
+    struct PrefixEntry
+    {
+        Ip6::Prefix mPrefix;
+        uint8_t     mDomainId;
+        uint8_t     mContextId;
+        bool        mHasContext : 1;
+        bool        mCompressFlag : 1;
+        bool        mHasBorderRouterTlv : 1;
+        bool        mHasOnMeshEntry : 1;
+        uint8_t     mRoutesStart;        // Has Route entries in `mRoutes[]`.
+        uint8_t     mNumRoutes;          // Number of Has Route entries.
+        uint8_t     mDefaultRoutesStart; // Border Router entries with default route flag in `mRoutes[]`.
+        uint8_t     mNumDefaultRoutes;   // Number of default route Border Router entries.
+    };
+
+    struct LookupTable
+    {
+        static constexpr uint8_t kMaxPrefixes   = kMaxSize / sizeof(PrefixTlv);
+        static constexpr uint8_t kMaxRoutes     = kMaxSize / sizeof(HasRouteEntry);
+        static constexpr uint8_t kNumContextIds = 16; // 4-bit Context ID.
+        static constexpr uint8_t kNoPrefix      = NumericLimits<uint8_t>::kMax;
+
+        bool        mIsStale;
+        uint8_t     mNumPrefixes;
+        uint8_t     mNumRoutes;
+        uint8_t     mLongestFirst[kMaxPrefixes];      // Indexes into `mPrefixes[]`, longest prefix first.
+        uint8_t     mContextPrefixes[kNumContextIds]; // Index into `mPrefixes[]` for each Context ID.
+        PrefixEntry mPrefixes[kMaxPrefixes];          // In Network Data order.
+        RouteEntry  mRoutes[kMaxRoutes];
+    };
+
+    const LookupTable &GetLookupTable(void) const;
+    void               BuildLookupTable(void);
+
+    void  FindContextForAddressInLookupTable(const Ip6::Address &aAddress, Lowpan::Context &aContext) const;
+    void  FindContextForIdInLookupTable(uint8_t aContextId, Lowpan::Context &aContext) const;
+    bool  IsOnMeshInLookupTable(const Ip6::Address &aAddress) const;
+    Error RouteLookupInLookupTable(const Ip6::Address &aSource,
+                                   const Ip6::Address &aDestination,
+                                   uint16_t           &aRloc16) const;
+    Error ExternalRouteLookupInLookupTable(uint8_t             aDomainId,
+                                           const Ip6::Address &aDestination,
+                                           uint16_t           &aRloc16) const;
+    Error LookupRouteIn(const RouteEntry *aRoutes, uint8_t aNumRoutes, uint16_t &aRloc16) const;
+
+    static void InitContextFrom(const PrefixEntry &aEntry, Lowpan::Context &aContext);
+#endif
+
     Error SteeringDataCheck(const FilterIndexes &aFilterIndexes) const;
     Error ReadCommissioningDataUint16SubTlv(MeshCoP::Tlv::Type aType, uint16_t &aValue) const;
     void  SignalNetDataChanged(void);
@@ -634,6 +705,10 @@ private:
     uint8_t mTlvBuffer[kMaxSize];
     uint8_t mMaxLength;
 
+#if OPENTHREAD_CONFIG_NETDATA_LOOKUP_TABLE_ENABLE
+    LookupTable mLookupTable;
+#endif
+
 #if OPENTHREAD_FTD
 #if OPENTHREAD_CONFIG_BORDER_ROUTER_SIGNAL_NETWORK_DATA_FULL
     bool mIsClone;
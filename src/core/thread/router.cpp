@@ -81,6 +81,13 @@ void Router::SetFrom(const Parent &aParent)
     const Router *parentAsRouter = &aParent;
 
     *this = *parentAsRouter;
+
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MLE_ROUTE_CACHE_ENABLE
+    if (Get<RouterTable>().Contains(*this))
+    {
+        Get<RouterTable>().InvalidateRoutes();
+    }
+#endif
 }
 
 void Parent::Clear(void)
@@ -107,6 +114,13 @@ bool Router::SetNextHopAndCost(uint8_t aNextHop, uint8_t aCost)
         changed = true;
     }
 
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MLE_ROUTE_CACHE_ENABLE
+    if (changed && Get<RouterTable>().Contains(*this))
+    {
+        Get<RouterTable>().InvalidateRoute(GetRouterId());
+    }
+#endif
+
     return changed;
 }
 
@@ -43,6 +43,9 @@ RouterTable::RouterTable(Instance &aInstance)
     , mRouterIdSequenceLastUpdated(0)
     , mRouterIdSequence(Random::NonCrypto::Generate<uint8_t>())
     , mEvents(0)
+#if OPENTHREAD_CONFIG_MLE_ROUTE_CACHE_ENABLE
+    , mRouteCacheRloc16(Mle::kInvalidRloc16)
+#endif
 #if OPENTHREAD_CONFIG_REFERENCE_DEVICE_ENABLE
     , mMinRouterId(0)
     , mMaxRouterId(Mle::kMaxRouterId)
@@ -58,6 +61,9 @@ void RouterTable::Clear(void)
     ClearNeighbors();
     mRouterIdMap.Clear();
     mRouters.Clear();
+#if OPENTHREAD_CONFIG_MLE_ROUTE_CACHE_ENABLE
+    InvalidateRoutes();
+#endif
     SignalTableChanged(events);
 }
 
@@ -96,6 +102,10 @@ Router *RouterTable::AddRouter(uint8_t aRouterId)
 
     mRouterIdMap.SetIndex(aRouterId, mRouters.IndexOf(*router));
 
+#if OPENTHREAD_CONFIG_MLE_ROUTE_CACHE_ENABLE
+    InvalidateRoutes();
+#endif
+
     SignalTableChanged(IsSelfRouterId(aRouterId) ? kEventSelfRouterAdded : kEventRouterAdded);
 
 exit:
@@ -126,6 +136,10 @@ void RouterTable::RemoveRouter(Router &aRouter)
         mRouterIdMap.SetIndex(aRouter.GetRouterId(), mRouters.IndexOf((aRouter)));
     }
 
+#if OPENTHREAD_CONFIG_MLE_ROUTE_CACHE_ENABLE
+    InvalidateRoutes();
+#endif
+
     SignalTableChanged(isSelf ? kEventSelfRouterRemoved : kEventRouterRemoved);
 }
 
@@ -416,6 +430,78 @@ uint8_t RouterTable::GetPathCost(uint16_t aDestRloc16) const
 uint8_t RouterTable::GetPathCostToLeader(void) const { return GetPathCost(Get<Mle::Mle>().GetLeaderRloc16()); }
 
 void RouterTable::GetNextHopAndPathCost(uint16_t aDestRloc16, uint16_t &aNextHopRloc16, uint8_t &aPathCost) const
+{
+#if OPENTHREAD_CONFIG_MLE_ROUTE_CACHE_ENABLE
+    VerifyOrExit(!AsNonConst(this)->LookUpCachedRoute(aDestRloc16, aNextHopRloc16, aPathCost));
+#endif
+
+    ComputeNextHopAndPathCost(aDestRloc16, aNextHopRloc16, aPathCost);
+
+#if OPENTHREAD_CONFIG_MLE_ROUTE_CACHE_ENABLE
+exit:
+#endif
+    return;
+}
+
+#if OPENTHREAD_CONFIG_MLE_ROUTE_CACHE_ENABLE
+
+void RouterTable::InvalidateRoutes(void)
+{
+    mStaleRouteIds.Clear();
+    mStaleRouteIds.Complement();
+}
+
+bool RouterTable::LookUpCachedRoute(uint16_t aDestRloc16, uint16_t &aNextHopRloc16, uint8_t &aPathCost)
+{
+    // As a router or leader, the route towards any destination
+    // other than this device or one of its children follows the
+    // route towards the destination's router ID, which is read
+    // from `mCachedRoutes` (and recomputed first if stale).
+    // Returns `false` if the cache does not apply to the
+    // destination.
+
+    bool         found    = false;
+    uint8_t      routerId = Mle::RouterIdFromRloc16(aDestRloc16);
+    CachedRoute *cachedRoute;
+
+    VerifyOrExit(Get<Mle::Mle>().IsRouterOrLeader() && (routerId <= Mle::kMaxRouterId));
+    VerifyOrExit(!Get<Mle::Mle>().HasMatchingRouterIdWith(aDestRloc16));
+
+    if (mRouteCacheRloc16 != Get<Mle::Mle>().GetRloc16())
+    {
+        mRouteCacheRloc16 = Get<Mle::Mle>().GetRloc16();
+        InvalidateRoutes();
+    }
+
+    cachedRoute = &mCachedRoutes[routerId];
+
+    if (mStaleRouteIds.Has(routerId))
+    {
+        ComputeNextHopAndPathCost(Mle::Rloc16FromRouterId(routerId), cachedRoute->mNextHopRloc16,
+                                  cachedRoute->mPathCost);
+        mStaleRouteIds.Remove(routerId);
+    }
+
+    aNextHopRloc16 = cachedRoute->mNextHopRloc16;
+    aPathCost      = cachedRoute->mPathCost;
+
+    if (Mle::IsChildRloc16(aDestRloc16) && IsAllocated(routerId))
+    {
+        // Destination is a child of another router, we assume
+        // best link quality between destination and its parent.
+
+        aPathCost += kCostForLinkQuality3;
+    }
+
+    found = true;
+
+exit:
+    return found;
+}
+
+#endif // OPENTHREAD_CONFIG_MLE_ROUTE_CACHE_ENABLE
+
+void RouterTable::ComputeNextHopAndPathCost(uint16_t aDestRloc16, uint16_t &aNextHopRloc16, uint8_t &aPathCost) const
 {
     const Router *router;
     const Router *nextHop;
@@ -585,28 +671,37 @@ exit:
 
 void RouterTable::UpdateRoutes(const Mle::RouteTlv::Data &aRouteTlvData, uint8_t aNeighborId)
 {
+    if (ProcessRouteTlv(aRouteTlvData, aNeighborId))
+    {
+        Get<Mle::Mle>().ResetAdvertiseInterval();
+    }
+}
+
+bool RouterTable::ProcessRouteTlv(const Mle::RouteTlv::Data &aRouteTlvData, uint8_t aNeighborId)
+{
+    // Updates the routes from `aRouteTlvData` received from neighbor
+    // `aNeighborId`. Returns whether the path cost to any router
+    // changed from finite to infinite or vice versa.
+
+    bool                              reachabilityChanged = false;
     Router                           *neighbor;
-    Mle::RouterIdMask                 finitePathCostIds;
+    Mle::RouterIdMask                 recordedIds;
+    Mle::RouterIdMask                 reachableIds;
     uint8_t                           linkCostToNeighbor;
     const Mle::RouteTlv::Data::Entry *matchingEntry;
 
     neighbor = FindRouterById(aNeighborId);
     VerifyOrExit(neighbor != nullptr);
 
-    // Before updating the routes, we track which routers have finite
-    // path cost. After the update we check again to see if any path
-    // cost changed from finite to infinite or vice versa to decide
-    // whether to reset the  MLE Advertisement interval.
+    // Before a change that may affect the path cost to a router, we
+    // record whether the router is reachable (has finite path cost).
+    // After the update, we check again the recorded routers to see
+    // if any path cost changed from finite to infinite or vice
+    // versa. Path cost to other routers is not affected by the
+    // update, so they do not need to be checked.
 
-    finitePathCostIds.Clear();
-
-    for (uint8_t routerId = 0; routerId <= Mle::kMaxRouterId; routerId++)
-    {
-        if (GetPathCost(Mle::Rloc16FromRouterId(routerId)) < Mle::kMaxRouteCost)
-        {
-            finitePathCostIds.Add(routerId);
-        }
-    }
+    recordedIds.Clear();
+    reachableIds.Clear();
 
     // Find the entry corresponding to our Router ID in the received
     // `aRouteTlvData` to get the `LinkQualityIn` from the perspective
@@ -621,6 +716,18 @@ void RouterTable::UpdateRoutes(const Mle::RouteTlv::Data &aRouteTlvData, uint8_t
 
         if (neighbor->GetLinkQualityOut() != linkQuality)
         {
+            // The link cost to the neighbor changes, which affects
+            // the path cost to the neighbor itself and to all the
+            // routers for which the neighbor is the next hop.
+
+            for (const Router &router : mRouters)
+            {
+                if ((&router == neighbor) || (router.GetNextHop() == aNeighborId))
+                {
+                    RecordReachability(router.GetRouterId(), recordedIds, reachableIds);
+                }
+            }
+
             neighbor->SetLinkQualityOut(linkQuality);
             SignalTableChanged(kEventLinkQualityOutChanged);
         }
@@ -660,6 +767,8 @@ void RouterTable::UpdateRoutes(const Mle::RouteTlv::Data &aRouteTlvData, uint8_t
             continue;
         }
 
+        RecordReachability(router->GetRouterId(), recordedIds, reachableIds);
+
         nextHop = FindNextHopTowards(*router);
 
         cost = entry.GetRouteCost();
@@ -698,16 +807,35 @@ void RouterTable::UpdateRoutes(const Mle::RouteTlv::Data &aRouteTlvData, uint8_t
 
     for (uint8_t routerId = 0; routerId <= Mle::kMaxRouterId; routerId++)
     {
-        bool oldCostFinite = finitePathCostIds.IsAllocated(routerId);
-        bool newCostFinite = (GetPathCost(Mle::Rloc16FromRouterId(routerId)) < Mle::kMaxRouteCost);
+        if (!recordedIds.IsAllocated(routerId))
+        {
+            continue;
+        }
 
-        if (newCostFinite != oldCostFinite)
+        if (reachableIds.IsAllocated(routerId) != (GetPathCost(Mle::Rloc16FromRouterId(routerId)) < Mle::kMaxRouteCost))
         {
-            Get<Mle::Mle>().ResetAdvertiseInterval();
+            reachabilityChanged = true;
             break;
         }
     }
 
+exit:
+    return reachabilityChanged;
+}
+
+void RouterTable::RecordReachability(uint8_t            aRouterId,
+                                     Mle::RouterIdMask &aRecordedIds,
+                                     Mle::RouterIdMask &aReachableIds) const
+{
+    VerifyOrExit(!aRecordedIds.IsAllocated(aRouterId));
+
+    aRecordedIds.Add(aRouterId);
+
+    if (GetPathCost(Mle::Rloc16FromRouterId(aRouterId)) < Mle::kMaxRouteCost)
+    {
+        aReachableIds.Add(aRouterId);
+    }
+
 exit:
     return;
 }
@@ -34,6 +34,7 @@
 #if OPENTHREAD_FTD
 
 #include "common/array.hpp"
+#include "common/bit_set.hpp"
 #include "common/const_cast.hpp"
 #include "common/encoding.hpp"
 #include "common/iterator_utils.hpp"
@@ -49,9 +50,12 @@
 
 namespace ot {
 
+class UnitTester;
+
 class RouterTable : public InstanceLocator, private NonCopyable
 {
     friend class NeighborTable;
+    friend class UnitTester;
 
 public:
     /**
@@ -205,6 +209,25 @@ public:
      */
     void GetNextHopAndPathCost(uint16_t aDestRloc16, uint16_t &aNextHopRloc16, uint8_t &aPathCost) const;
 
+#if OPENTHREAD_CONFIG_MLE_ROUTE_CACHE_ENABLE
+    /**
+     * Marks the cached next hop and path cost towards a given router as stale.
+     *
+     * MUST be called when the next hop or the cost of a router entry in the table changes.
+     *
+     * @param[in]  aRouterId  The Router ID of the router entry.
+     */
+    void InvalidateRoute(uint8_t aRouterId) { mStaleRouteIds.Add(aRouterId); }
+
+    /**
+     * Marks the cached next hops and path costs towards all routers as stale.
+     *
+     * MUST be called when the state or the link quality of a neighboring router changes, or when a router entry is
+     * added to or removed from the table.
+     */
+    void InvalidateRoutes(void);
+#endif
+
     /**
      * Finds the router for a given Router ID.
      *
@@ -454,6 +477,12 @@ private:
     }
 
     bool IsSelfRouterId(uint8_t aRouterId) const;
+    void ComputeNextHopAndPathCost(uint16_t aDestRloc16, uint16_t &aNextHopRloc16, uint8_t &aPathCost) const;
+    bool ProcessRouteTlv(const Mle::RouteTlv::Data &aRouteTlvData, uint8_t aNeighborId);
+    void RecordReachability(uint8_t aRouterId, Mle::RouterIdMask &aRecordedIds, Mle::RouterIdMask &aReachableIds) const;
+#if OPENTHREAD_CONFIG_MLE_ROUTE_CACHE_ENABLE
+    bool LookUpCachedRoute(uint16_t aDestRloc16, uint16_t &aNextHopRloc16, uint8_t &aPathCost);
+#endif
     void SignalTableChanged(Events aEvents);
     void HandleTableChanged(void);
     void LogEvents(void) const;
@@ -489,6 +518,16 @@ private:
         uint8_t mIndexes[Mle::kMaxRouterId + 1];
     };
 
+#if OPENTHREAD_CONFIG_MLE_ROUTE_CACHE_ENABLE
+    struct CachedRoute
+    {
+        uint16_t mNextHopRloc16;
+        uint8_t  mPathCost;
+    };
+
+    typedef BitSet<Mle::kMaxRouterId + 1> RouterIdSet;
+#endif
+
     using ChangedTask = TaskletIn<RouterTable, &RouterTable::HandleTableChanged>;
 
     Array<Router, Mle::kMaxRouters> mRouters;
@@ -497,6 +536,14 @@ private:
     TimeMilli                       mRouterIdSequenceLastUpdated;
     uint8_t                         mRouterIdSequence;
     Events                          mEvents;
+#if OPENTHREAD_CONFIG_MLE_ROUTE_CACHE_ENABLE
+    // The cached route towards a router ID is valid when the ID is
+    // not in `mStaleRouteIds`. The entries are computed while this
+    // device is a router or leader using `mRouteCacheRloc16`.
+    CachedRoute mCachedRoutes[Mle::kMaxRouterId + 1];
+    RouterIdSet mStaleRouteIds;
+    uint16_t    mRouteCacheRloc16;
+#endif
 #if OPENTHREAD_CONFIG_REFERENCE_DEVICE_ENABLE
     uint8_t mMinRouterId;
     uint8_t mMaxRouterId;
@@ -37,6 +37,7 @@
 
 #include <string.h>
 
+#include "common/clearable.hpp"
 #include "common/code_utils.hpp"
 #include "common/debug.hpp"
 #include "common/num_utils.hpp"
@@ -60,13 +61,15 @@ Heap::Heap(void)
     first.SetNext(BlockOffset(guard));
 
     mMemory.mFreeSize = kFirstBlockSize;
+
+#if OPENTHREAD_CONFIG_HEAP_SLAB_ENABLE
+    ClearAllBytes(mSlabs);
+#endif
 }
 
 void *Heap::CAlloc(size_t aCount, size_t aSize)
 {
-    void    *ret  = nullptr;
-    Block   *prev = nullptr;
-    Block   *curr = nullptr;
+    void    *ret = nullptr;
     uint16_t size;
 
     // Verify that the requested allocation size will not cause an overflow.
@@ -84,6 +87,29 @@ void *Heap::CAlloc(size_t aCount, size_t aSize)
     VerifyOrExit(size > 0);
     VerifyOrExit(size <= NumericLimits<uint16_t>::kMax - kTotalSizeGuard);
 
+#if OPENTHREAD_CONFIG_HEAP_SLAB_ENABLE
+    if (size <= kMaxSlabChunkSize)
+    {
+        ret = SlabAlloc(size);
+
+        // Fall back to allocating a block if no slab chunk is available.
+        VerifyOrExit(ret == nullptr);
+    }
+#endif
+
+    ret = BlockAlloc(size);
+
+exit:
+    return ret;
+}
+
+void *Heap::BlockAlloc(uint16_t aSize)
+{
+    void    *ret  = nullptr;
+    Block   *prev = nullptr;
+    Block   *curr = nullptr;
+    uint16_t size = aSize;
+
     size += kAlignSize - 1 - kBlockRemainderSize;
     size &= ~(kAlignSize - 1);
     size += kBlockRemainderSize;
@@ -160,11 +186,24 @@ Block &Heap::BlockPrev(const Block &aBlock)
 
 void Heap::Free(void *aPointer)
 {
-    if (aPointer == nullptr)
+    VerifyOrExit(aPointer != nullptr);
+
+#if OPENTHREAD_CONFIG_HEAP_SLAB_ENABLE
+    if (IsSlabChunk(aPointer))
     {
-        return;
+        SlabFree(aPointer, BlockOf(aPointer).GetSize());
+        ExitNow();
     }
+#endif
+
+    BlockFree(aPointer);
+
+exit:
+    return;
+}
 
+void Heap::BlockFree(void *aPointer)
+{
     Block &block = BlockOf(aPointer);
     Block &right = BlockRight(block);
 
@@ -230,6 +269,161 @@ void Heap::Free(void *aPointer)
     }
 }
 
+void Heap::GetStats(Stats &aStats) const
+{
+    Heap        &self  = *AsNonConst(this);
+    const Block *block = &self.BlockNext(self.BlockSuper());
+
+    ClearAllBytes(aStats);
+
+    aStats.mCapacity = kFirstBlockSize;
+    aStats.mFreeSize = mMemory.mFreeSize;
+
+    // The free block list is sorted by size, so the last free
+    // block before the guard block is the largest one.
+
+    for (; block->IsFree(); block = &self.BlockNext(*block))
+    {
+        aStats.mNumFreeBlocks++;
+        aStats.mLargestFreeBlockSize = block->GetSize();
+    }
+
+#if OPENTHREAD_CONFIG_HEAP_SLAB_ENABLE
+    for (const Slab &slab : mSlabs)
+    {
+        if (slab.IsInUse())
+        {
+            aStats.mNumSlabs++;
+            aStats.mNumSlabChunks += kNumSlabChunks;
+            aStats.mNumFreeSlabChunks += slab.mNumFree;
+        }
+    }
+#endif
+}
+
+#if OPENTHREAD_CONFIG_HEAP_SLAB_ENABLE
+
+bool Heap::IsSlabChunk(const void *aPointer) const
+{
+    // The 2-byte value before a pointer returned by `CAlloc()` is
+    // either the size of a block or the tag of a slab chunk. Block
+    // sizes are always smaller than `kSlabChunkTag`.
+
+    uint16_t offset = static_cast<uint16_t>(reinterpret_cast<const uint8_t *>(aPointer) - mMemory.m8);
+
+    return mMemory.m16[(offset - sizeof(uint16_t)) / 2] >= kSlabChunkTag;
+}
+
+void *Heap::SlabAlloc(uint16_t aSize)
+{
+    void    *ret       = nullptr;
+    uint8_t  sizeClass = static_cast<uint8_t>((aSize - 1) / kSlabClassSizeStep);
+    Slab    *slab      = nullptr;
+    uint16_t offset;
+
+    // Use the slab with the fewest free chunks, so that objects are
+    // packed into as few slabs as possible and the slabs which are
+    // almost empty get a chance to be returned to the heap.
+
+    for (Slab &candidate : mSlabs)
+    {
+        if (!candidate.IsInUse() || (candidate.mClass != sizeClass) || (candidate.mNumFree == 0))
+        {
+            continue;
+        }
+
+        if ((slab == nullptr) || (candidate.mNumFree < slab->mNumFree))
+        {
+            slab = &candidate;
+        }
+    }
+
+    if (slab == nullptr)
+    {
+        slab = NewSlab(sizeClass);
+        VerifyOrExit(slab != nullptr);
+    }
+
+    offset          = slab->mFreeHead;
+    slab->mFreeHead = mMemory.m16[offset / 2];
+    slab->mNumFree--;
+
+    ret = &mMemory.m8[offset];
+    memset(ret, 0, slab->GetChunkSize());
+
+exit:
+    return ret;
+}
+
+Heap::Slab *Heap::NewSlab(uint8_t aClass)
+{
+    Slab    *slab = nullptr;
+    uint8_t *memory;
+    uint16_t offset;
+
+    for (Slab &candidate : mSlabs)
+    {
+        if (!candidate.IsInUse())
+        {
+            slab = &candidate;
+            break;
+        }
+    }
+
+    VerifyOrExit(slab != nullptr);
+
+    slab->mClass = aClass;
+
+    memory = static_cast<uint8_t *>(BlockAlloc(kNumSlabChunks * slab->GetChunkStride()));
+
+    if (memory == nullptr)
+    {
+        slab = nullptr;
+        ExitNow();
+    }
+
+    slab->mOffset   = static_cast<uint16_t>(memory - mMemory.m8);
+    slab->mFreeHead = 0;
+    slab->mNumFree  = kNumSlabChunks;
+
+    // Tag the chunks and link them in the free chunk list, with the
+    // first chunk at the head.
+
+    offset = slab->mOffset + kNumSlabChunks * slab->GetChunkStride() - slab->GetChunkSize();
+
+    for (uint8_t i = 0; i < kNumSlabChunks; i++)
+    {
+        mMemory.m16[(offset - sizeof(uint16_t)) / 2] = kSlabChunkTag | static_cast<uint16_t>(slab - mSlabs);
+        mMemory.m16[offset / 2]                      = slab->mFreeHead;
+
+        slab->mFreeHead = offset;
+        offset -= slab->GetChunkStride();
+    }
+
+exit:
+    return slab;
+}
+
+void Heap::SlabFree(void *aPointer, uint16_t aTag)
+{
+    Slab    &slab   = mSlabs[aTag & kSlabIndexMask];
+    uint16_t offset = static_cast<uint16_t>(reinterpret_cast<uint8_t *>(aPointer) - mMemory.m8);
+
+    OT_ASSERT(slab.IsInUse());
+
+    mMemory.m16[offset / 2] = slab.mFreeHead;
+    slab.mFreeHead          = offset;
+    slab.mNumFree++;
+
+    if (slab.mNumFree == kNumSlabChunks)
+    {
+        BlockFree(&mMemory.m8[slab.mOffset]);
+        slab.mOffset = 0;
+    }
+}
+
+#endif // OPENTHREAD_CONFIG_HEAP_SLAB_ENABLE
+
 } // namespace Utils
 } // namespace ot
 
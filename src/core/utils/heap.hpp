@@ -41,6 +41,8 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include <openthread/heap.h>
+
 #include "common/const_cast.hpp"
 #include "common/non_copyable.hpp"
 
@@ -161,10 +163,25 @@ private:
  *     +----------------+------------+---------+---------+-----+---------+--------+
  *     | kAlignSize - 2 | kAlignSize | 4 + s1  | 4 + s2  | ... | 4 + s4  |   2    |
  *     +--------------------------------------------------------------------------+
+ *
+ * When `OPENTHREAD_CONFIG_HEAP_SLAB_ENABLE` is enabled, small allocations are served from slabs. A slab is a block
+ * divided into `kNumSlabChunks` equal size chunks of one size class. Each chunk is preceded by a 2-byte tag holding
+ * `kSlabChunkTag` and the index of its slab, in place of the size of a block:
+ *
+ *     +----------------------------------------------------------------------+
+ *     | unused | tag | chunk 1 | unused | tag | chunk 2 | ... | tag | chunk n |
+ *     +--------+-----+---------+--------+-----+---------+-----+-----+---------+
+ *     | kAlignSize   |    c    |     kAlignSize   |  c  | ... |     |    c    |
+ *     +----------------------------------------------------------------------+
  */
 class Heap : private NonCopyable
 {
 public:
+    /**
+     * Represents the occupancy and fragmentation statistics of the heap.
+     */
+    typedef otHeapStats Stats;
+
     /**
      * Initializes a memory heap.
      */
@@ -207,9 +224,18 @@ public:
 
     /**
      * Returns free space of this heap.
+     *
+     * Free chunks of slabs (when `OPENTHREAD_CONFIG_HEAP_SLAB_ENABLE` is enabled) are not included.
      */
     size_t GetFreeSize(void) const { return mMemory.mFreeSize; }
 
+    /**
+     * Gets the occupancy and fragmentation statistics of this heap.
+     *
+     * @param[out] aStats   A reference to a `Stats` to output the statistics.
+     */
+    void GetStats(Stats &aStats) const;
+
 private:
 #if OPENTHREAD_CONFIG_TLS_ENABLE || OPENTHREAD_CONFIG_SECURE_TRANSPORT_ENABLE
     static constexpr uint16_t kMemorySize = OPENTHREAD_CONFIG_HEAP_INTERNAL_SIZE;
@@ -227,6 +253,40 @@ private:
 
     static_assert(kMemorySize % kAlignSize == 0, "The heap memory size is not aligned to kAlignSize!");
 
+#if OPENTHREAD_CONFIG_HEAP_SLAB_ENABLE
+    static constexpr uint8_t  kNumSlabClasses    = 4;      // Size classes 16, 32, 48 and 64 bytes.
+    static constexpr uint16_t kSlabClassSizeStep = 16;     // Chunk size step between size classes.
+    static constexpr uint16_t kMaxSlabChunkSize  = kNumSlabClasses * kSlabClassSizeStep;
+    static constexpr uint8_t  kNumSlabChunks     = 16;     // Number of chunks in a slab.
+    static constexpr uint8_t  kMaxSlabs          = 48;     // Maximum number of slabs.
+    static constexpr uint16_t kSlabChunkTag      = 0xff00; // Tag of a chunk (ORed with index of its slab).
+    static constexpr uint16_t kSlabIndexMask     = 0x00ff;
+
+    static_assert(kSlabClassSizeStep % kAlignSize == 0, "The slab chunks are not aligned to kAlignSize!");
+    static_assert(kMaxSlabs <= kSlabIndexMask, "kMaxSlabs does not fit in a chunk tag");
+    static_assert(kMemorySize < kSlabChunkTag, "A block size may be mistaken for a chunk tag");
+
+    struct Slab
+    {
+        bool     IsInUse(void) const { return mOffset != 0; }
+        uint16_t GetChunkSize(void) const { return (mClass + 1) * kSlabClassSizeStep; }
+        uint16_t GetChunkStride(void) const { return GetChunkSize() + kAlignSize; }
+
+        uint16_t mOffset;   // Offset of the slab memory (the user memory of its block), zero if slab is not in use.
+        uint16_t mFreeHead; // Offset of the first free chunk, zero if no free chunk.
+        uint8_t  mClass;    // Size class of the chunks.
+        uint8_t  mNumFree;  // Number of free chunks.
+    };
+
+    void *SlabAlloc(uint16_t aSize);
+    void  SlabFree(void *aPointer, uint16_t aTag);
+    Slab *NewSlab(uint8_t aClass);
+    bool  IsSlabChunk(const void *aPointer) const;
+#endif
+
+    void *BlockAlloc(uint16_t aSize);
+    void  BlockFree(void *aPointer);
+
     /**
      * Returns the block at offset @p aOffset.
      *
@@ -319,6 +379,10 @@ private:
         uint8_t  m8[kMemorySize];
         uint16_t m16[kMemorySize / sizeof(uint16_t)];
     } mMemory;
+
+#if OPENTHREAD_CONFIG_HEAP_SLAB_ENABLE
+    Slab mSlabs[kMaxSlabs];
+#endif
 };
 
 } // namespace Utils
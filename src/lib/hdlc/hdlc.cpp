@@ -49,6 +49,17 @@ namespace Hdlc {
  */
 static uint16_t UpdateFcs(uint16_t aFcs, uint8_t aByte);
 
+/**
+ * Updates an FCS with a sequence of bytes.
+ *
+ * @param[in]  aFcs     The FCS to update.
+ * @param[in]  aData    A pointer to the input bytes.
+ * @param[in]  aLength  The number of bytes in @p aData.
+ *
+ * @returns The updated FCS.
+ */
+static uint16_t UpdateFcs(uint16_t aFcs, const uint8_t *aData, uint16_t aLength);
+
 enum
 {
     kFlagXOn        = 0x11,
@@ -93,6 +104,16 @@ uint16_t UpdateFcs(uint16_t aFcs, uint8_t aByte)
     return (aFcs >> 8) ^ sFcsTable[(aFcs ^ aByte) & 0xff];
 }
 
+uint16_t UpdateFcs(uint16_t aFcs, const uint8_t *aData, uint16_t aLength)
+{
+    while (aLength--)
+    {
+        aFcs = UpdateFcs(aFcs, *aData++);
+    }
+
+    return aFcs;
+}
+
 static bool HdlcByteNeedsEscape(uint8_t aByte)
 {
     bool rval;
@@ -156,9 +177,31 @@ otError Encoder::Encode(const uint8_t *aData, uint16_t aLength)
     uint16_t                  oldFcs     = mFcs;
     Spinel::FrameWritePointer oldPointer = mWritePointer;
 
-    while (aLength--)
+    while (aLength > 0)
     {
-        SuccessOrExit(error = Encode(*aData++));
+        uint16_t runLength = 0;
+
+        // Write the run of bytes which do not need escaping in one
+        // shot, then encode the next byte (which needs escaping).
+
+        while ((runLength < aLength) && !HdlcByteNeedsEscape(aData[runLength]))
+        {
+            runLength++;
+        }
+
+        if (runLength > 0)
+        {
+            SuccessOrExit(error = mWritePointer.WriteBytes(aData, runLength));
+            mFcs = UpdateFcs(mFcs, aData, runLength);
+        }
+        else
+        {
+            SuccessOrExit(error = Encode(*aData));
+            runLength = 1;
+        }
+
+        aData += runLength;
+        aLength -= runLength;
     }
 
 exit:
@@ -223,79 +266,94 @@ void Decoder::Reset(void)
 
 void Decoder::Decode(const uint8_t *aData, uint16_t aLength)
 {
-    while (aLength--)
+    while (aLength > 0)
     {
-        uint8_t byte = *aData++;
+        uint16_t runLength = 0;
 
-        switch (mState)
+        if (mState == kStateSync)
         {
-        case kStateNoSync:
-            if (byte == kFlagSequence)
+            // Decode the run of bytes which are neither flag nor escape
+            // bytes in one shot, up to the remaining buffer space. Once
+            // the buffer is full, the next byte is decoded on its own
+            // (which handles running out of buffer space).
+
+            uint16_t maxRunLength = OT_MIN(aLength, mWritePointer->GetRemainingLength());
+
+            while ((runLength < maxRunLength) && (aData[runLength] != kFlagSequence) &&
+                   (aData[runLength] != kEscapeSequence))
             {
-                mState         = kStateSync;
-                mDecodedLength = 0;
-                mFcs           = kInitFcs;
+                runLength++;
             }
+        }
 
-            break;
+        if (runLength > 0)
+        {
+            IgnoreReturnValue(mWritePointer->WriteBytes(aData, runLength));
+            mFcs = UpdateFcs(mFcs, aData, runLength);
+            mDecodedLength += runLength;
+        }
+        else
+        {
+            DecodeByte(*aData);
+            runLength = 1;
+        }
 
-        case kStateSync:
-            switch (byte)
-            {
-            case kEscapeSequence:
-                mState = kStateEscaped;
-                break;
+        aData += runLength;
+        aLength -= runLength;
+    }
+}
 
-            case kFlagSequence:
+void Decoder::DecodeByte(uint8_t aByte)
+{
+    switch (mState)
+    {
+    case kStateNoSync:
+        if (aByte == kFlagSequence)
+        {
+            mState         = kStateSync;
+            mDecodedLength = 0;
+            mFcs           = kInitFcs;
+        }
 
-                if (mDecodedLength > 0)
-                {
-                    otError error = OT_ERROR_PARSE;
+        break;
 
-                    if ((mDecodedLength >= kFcsSize)
-#ifndef FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION
-                        && (mFcs == kGoodFcs)
-#endif
-                    )
-                    {
-                        // Remove the FCS from the frame.
-                        mWritePointer->UndoLastWrites(kFcsSize);
-                        error = OT_ERROR_NONE;
-                    }
-
-                    mFrameHandler(mContext, error);
-                }
+    case kStateSync:
+        switch (aByte)
+        {
+        case kEscapeSequence:
+            mState = kStateEscaped;
+            break;
 
-                mDecodedLength = 0;
-                mFcs           = kInitFcs;
-                break;
+        case kFlagSequence:
 
-            default:
-                if (mWritePointer->CanWrite(sizeof(uint8_t)))
-                {
-                    mFcs = UpdateFcs(mFcs, byte);
-                    IgnoreReturnValue(mWritePointer->WriteByte(byte));
-                    mDecodedLength++;
-                }
-                else
+            if (mDecodedLength > 0)
+            {
+                otError error = OT_ERROR_PARSE;
+
+                if ((mDecodedLength >= kFcsSize)
+#ifndef FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION
+                    && (mFcs == kGoodFcs)
+#endif
+                )
                 {
-                    mFrameHandler(mContext, OT_ERROR_NO_BUFS);
-                    mState = kStateNoSync;
+                    // Remove the FCS from the frame.
+                    mWritePointer->UndoLastWrites(kFcsSize);
+                    error = OT_ERROR_NONE;
                 }
 
-                break;
+                mFrameHandler(mContext, error);
             }
 
+            mDecodedLength = 0;
+            mFcs           = kInitFcs;
             break;
 
-        case kStateEscaped:
+        default:
             if (mWritePointer->CanWrite(sizeof(uint8_t)))
             {
-                byte ^= 0x20;
-                mFcs = UpdateFcs(mFcs, byte);
-                IgnoreReturnValue(mWritePointer->WriteByte(byte));
+                mFcs = UpdateFcs(mFcs, aByte);
+                IgnoreReturnValue(mWritePointer->WriteByte(aByte));
                 mDecodedLength++;
-                mState = kStateSync;
             }
             else
             {
@@ -305,6 +363,25 @@ void Decoder::Decode(const uint8_t *aData, uint16_t aLength)
 
             break;
         }
+
+        break;
+
+    case kStateEscaped:
+        if (mWritePointer->CanWrite(sizeof(uint8_t)))
+        {
+            aByte ^= 0x20;
+            mFcs = UpdateFcs(mFcs, aByte);
+            IgnoreReturnValue(mWritePointer->WriteByte(aByte));
+            mDecodedLength++;
+            mState = kStateSync;
+        }
+        else
+        {
+            mFrameHandler(mContext, OT_ERROR_NO_BUFS);
+            mState = kStateNoSync;
+        }
+
+        break;
     }
 }
 
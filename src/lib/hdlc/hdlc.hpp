@@ -171,6 +171,8 @@ private:
         kStateEscaped,
     };
 
+    void DecodeByte(uint8_t aByte);
+
     State                      mState;
     Spinel::FrameWritePointer *mWritePointer;
     FrameHandler               mFrameHandler;
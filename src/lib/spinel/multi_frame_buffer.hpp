@@ -71,6 +71,13 @@ public:
      */
     bool CanWrite(uint16_t aWriteLength) const { return (mRemainingLength >= aWriteLength); }
 
+    /**
+     * Returns the number of bytes that can still be written into the buffer.
+     *
+     * @returns The number of remaining bytes available to write.
+     */
+    uint16_t GetRemainingLength(void) const { return mRemainingLength; }
+
     /**
      * Writes a byte into the buffer and updates the write pointer (if space is available).
      *
@@ -85,6 +92,32 @@ public:
                                          : OT_ERROR_NO_BUFS;
     }
 
+    /**
+     * Writes a sequence of bytes into the buffer and updates the write pointer (if space is available).
+     *
+     * Either all bytes are written or none (if there is not enough buffer space for all of them).
+     *
+     * @param[in]  aBytes   A pointer to the bytes to be written to the buffer.
+     * @param[in]  aLength  The number of bytes to write.
+     *
+     * @retval OT_ERROR_NONE     Successfully wrote the bytes and updated the pointer.
+     * @retval OT_ERROR_NO_BUFS  Insufficient buffer space to write the bytes.
+     */
+    otError WriteBytes(const uint8_t *aBytes, uint16_t aLength)
+    {
+        otError error = OT_ERROR_NO_BUFS;
+
+        if (CanWrite(aLength))
+        {
+            memcpy(mWritePointer, aBytes, aLength);
+            mWritePointer += aLength;
+            mRemainingLength -= aLength;
+            error = OT_ERROR_NONE;
+        }
+
+        return error;
+    }
+
     /**
      * Undoes the last @p aUndoLength writes, removing them from frame.
      *
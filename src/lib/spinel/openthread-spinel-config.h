@@ -163,6 +163,19 @@
 #define OPENTHREAD_SPINEL_CONFIG_RCP_TX_WAIT_TIME_SECS 5
 #endif
 
+/**
+ * @def OPENTHREAD_SPINEL_CONFIG_BATCH_WINDOW_SIZE
+ *
+ * Defines the maximum number of batched spinel requests which can be outstanding (sent to the RCP and waiting for
+ * their responses) at the same time.
+ *
+ * The RCP must be able to queue this many responses (see `OPENTHREAD_CONFIG_NCP_SPINEL_RESPONSE_QUEUE_SIZE`). Setting
+ * it to 1 disables pipelining of batched requests.
+ */
+#ifndef OPENTHREAD_SPINEL_CONFIG_BATCH_WINDOW_SIZE
+#define OPENTHREAD_SPINEL_CONFIG_BATCH_WINDOW_SIZE 8
+#endif
+
 /**
  * @def OPENTHREAD_SPINEL_CONFIG_COPROCESSOR_RESET_FAILURE_CALLBACK_ENABLE
  *
@@ -75,6 +75,14 @@ RadioSpinel::RadioSpinel(void)
     , mPropertyFormat(nullptr)
     , mExpectedCommand(0)
     , mError(OT_ERROR_NONE)
+    , mBatchTids(0)
+    , mBatchPending(0)
+    , mBatchRequests(0)
+    , mBatchRoundTrips(0)
+    , mBatchError(OT_ERROR_NONE)
+    , mBatching(false)
+    , mBatchLastTid(0)
+    , mBatchPowerTids(0)
     , mTransmitFrame(nullptr)
     , mShortAddress(0)
     , mPanId(0xffff)
@@ -405,6 +413,13 @@ void RadioSpinel::HandleResponse(const uint8_t *aBuffer, uint16_t aLength)
         FreeTid(mWaitingTid);
         mWaitingTid = 0;
     }
+    else if ((mBatchTids & (1 << SPINEL_HEADER_GET_TID(header))) != 0)
+    {
+        HandleBatchResponse(SPINEL_HEADER_GET_TID(header), key, data, static_cast<uint16_t>(len));
+        mBatchTids &= ~(1 << SPINEL_HEADER_GET_TID(header));
+        mBatchPending--;
+        FreeTid(SPINEL_HEADER_GET_TID(header));
+    }
     else if (mTxRadioTid == SPINEL_HEADER_GET_TID(header))
     {
         if (mState == kStateTransmitting)
@@ -495,6 +510,46 @@ exit:
     LogIfFail("Error processing result", mError);
 }
 
+void RadioSpinel::HandleBatchResponse(spinel_tid_t      aTid,
+                                      spinel_prop_key_t aKey,
+                                      const uint8_t    *aBuffer,
+                                      uint16_t          aLength)
+{
+    otError error = OT_ERROR_NONE;
+
+    // The property value echoed back on success is not checked, only a
+    // `LAST_STATUS` response indicates a failure.
+
+    if (aKey == SPINEL_PROP_LAST_STATUS)
+    {
+        spinel_status_t status;
+        spinel_ssize_t  unpacked = spinel_datatype_unpack(aBuffer, aLength, "i", &status);
+
+        VerifyOrExit(unpacked > 0, error = OT_ERROR_PARSE);
+        error = SpinelStatusToOtError(status);
+    }
+
+exit:
+    if ((mBatchPowerTids & (1 << aTid)) != 0)
+    {
+        // The channel max power is only kept once the RCP accepted it.
+        if (error == OT_ERROR_NONE)
+        {
+            mMaxPowerTable.SetTransmitPower(mBatchMaxPowers[aTid].mChannel, mBatchMaxPowers[aTid].mPower);
+        }
+
+        mBatchPowerTids &= ~(1 << aTid);
+    }
+
+    if (mBatchError == OT_ERROR_NONE)
+    {
+        mBatchError = error;
+    }
+
+    UpdateParseErrorCount(error);
+    LogIfFail("Error processing batched result", error);
+}
+
 void RadioSpinel::HandleValueIs(spinel_prop_key_t aKey, const uint8_t *aBuffer, uint16_t aLength)
 {
     otError        error = OT_ERROR_NONE;
@@ -1415,6 +1470,83 @@ exit:
     return mError;
 }
 
+void RadioSpinel::BeginBatch(void)
+{
+    assert(!mBatching);
+
+    mBatching        = true;
+    mBatchRequests   = 0;
+    mBatchRoundTrips = 0;
+    mBatchError      = OT_ERROR_NONE;
+}
+
+otError RadioSpinel::EndBatch(void)
+{
+    otError error;
+
+    assert(mBatching);
+
+    error     = WaitBatchResponses(0);
+    mBatching = false;
+
+#if OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
+    if (mRcpFailure != kRcpFailureNone)
+    {
+        // Recovering from the failure restores all the properties
+        // kept by `RadioSpinel`, including the ones set in the batch.
+        RecoverFromRcpFailure();
+
+        if (mRcpFailure == kRcpFailureNone)
+        {
+            error = OT_ERROR_NONE;
+        }
+    }
+#endif
+
+    if (error == OT_ERROR_NONE)
+    {
+        error = mBatchError;
+    }
+
+    if (mBatchRequests > 0)
+    {
+        mMetrics.AddBatch(mBatchRequests, mBatchRoundTrips);
+    }
+
+    return error;
+}
+
+bool RadioSpinel::IsBatchable(spinel_prop_key_t aKey) const
+{
+    return mBatching && (mPropertyFormat == nullptr) && (aKey != SPINEL_PROP_STREAM_RAW);
+}
+
+otError RadioSpinel::WaitBatchResponses(uint8_t aMaxPending)
+{
+    otError  error = OT_ERROR_NONE;
+    uint64_t end;
+
+    VerifyOrExit(mBatchPending > aMaxPending);
+
+    mBatchRoundTrips++;
+    end = otPlatTimeGet() + kMaxWaitTime * kUsPerMs;
+
+    do
+    {
+        uint64_t now = otPlatTimeGet();
+
+        if ((end <= now) || (GetSpinelDriver().GetSpinelInterface()->WaitForFrame(end - now) != OT_ERROR_NONE))
+        {
+            LogWarn("Wait for batched responses timeout");
+            HandleRcpTimeout();
+            ExitNow(error = OT_ERROR_RESPONSE_TIMEOUT);
+        }
+    } while (mBatchPending > aMaxPending);
+
+exit:
+    return error;
+}
+
 spinel_tid_t RadioSpinel::GetNextTid(void)
 {
     spinel_tid_t tid = mCmdNextTid;
@@ -1442,14 +1574,28 @@ exit:
 otError RadioSpinel::RequestV(uint32_t command, spinel_prop_key_t aKey, const char *aFormat, va_list aArgs)
 {
     otError      error = OT_ERROR_NONE;
-    spinel_tid_t tid   = GetNextTid();
+    spinel_tid_t tid;
 
+    if (IsBatchable(aKey))
+    {
+        SuccessOrExit(error = mBatchError);
+        SuccessOrExit(error = WaitBatchResponses(kBatchWindowSize - 1));
+    }
+
+    tid = GetNextTid();
     VerifyOrExit(tid > 0, error = OT_ERROR_BUSY);
 
     error = GetSpinelDriver().SendCommand(command, aKey, tid, aFormat, aArgs);
     SuccessOrExit(error);
 
-    if (aKey == SPINEL_PROP_STREAM_RAW)
+    if (IsBatchable(aKey))
+    {
+        mBatchTids |= (1 << tid);
+        mBatchPending++;
+        mBatchRequests++;
+        mBatchLastTid = tid;
+    }
+    else if (aKey == SPINEL_PROP_STREAM_RAW)
     {
         // not allowed to send another frame before the last frame is done.
         assert(mTxRadioTid == 0);
@@ -1464,6 +1610,11 @@ otError RadioSpinel::RequestV(uint32_t command, spinel_prop_key_t aKey, const ch
     }
 
 exit:
+    if (IsBatchable(aKey) && (mBatchError == OT_ERROR_NONE))
+    {
+        mBatchError = error;
+    }
+
     return error;
 }
 
@@ -2020,6 +2171,11 @@ void RadioSpinel::RecoverFromRcpFailure(void)
     constexpr int16_t kMaxFailureCount = OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT;
     State             recoveringState  = mState;
     bool              skipReset        = false;
+    bool              batching         = mBatching;
+    uint16_t          batchRequests    = mBatchRequests;
+    uint16_t          batchRoundTrips  = mBatchRoundTrips;
+    otError           batchError       = mBatchError;
+    uint16_t          batchPowerTids   = 0;
 
     VerifyOrExit(mRcpRestorationEnabled);
 
@@ -2065,11 +2221,35 @@ void RadioSpinel::RecoverFromRcpFailure(void)
     mError        = OT_ERROR_NONE;
     mIsTimeSynced = false;
 
+    // Any batched requests are lost with the RCP failure, the
+    // properties they set are restored below.
+    batchPowerTids  = mBatchPowerTids;
+    mBatchTids      = 0;
+    mBatchPending   = 0;
+    mBatchError     = OT_ERROR_NONE;
+    mBatching       = false;
+    mBatchPowerTids = 0;
+
     SuccessOrDie(Set(SPINEL_PROP_PHY_ENABLED, SPINEL_DATATYPE_BOOL_S, true));
     mState = kStateSleep;
 
     RestoreProperties();
 
+    // The channel max powers of lost batched requests are not in
+    // `mMaxPowerTable` yet, as the RCP did not accept them.
+    for (spinel_tid_t tid = 0; tid < kNumTids; tid++)
+    {
+        if ((batchPowerTids & (1 << tid)) != 0)
+        {
+            otError error = SetChannelMaxTransmitPower(mBatchMaxPowers[tid].mChannel, mBatchMaxPowers[tid].mPower);
+
+            if (error != OT_ERROR_NONE && error != OT_ERROR_NOT_FOUND)
+            {
+                DieNow(OT_EXIT_FAILURE);
+            }
+        }
+    }
+
     switch (recoveringState)
     {
     case kStateDisabled:
@@ -2104,6 +2284,13 @@ void RadioSpinel::RecoverFromRcpFailure(void)
         SuccessOrDie(EnergyScan(mScanChannel, mScanDuration));
     }
 
+    // `RestoreProperties()` runs its own batch, resume the one that
+    // was open (or just ended) when the failure was detected.
+    mBatching        = batching;
+    mBatchRequests   = batchRequests;
+    mBatchRoundTrips = batchRoundTrips;
+    mBatchError      = batchError;
+
     --mRcpFailureCount;
 
     if (sSupportsLogCrashDump)
@@ -2188,6 +2375,11 @@ void RadioSpinel::RestoreProperties(void)
                          otLinkGetFrameCounter(mInstance) + kFrameCounterGuard));
     }
 
+    // The source match table may hold an entry per child, so send
+    // its updates as a batch rather than waiting for each response.
+
+    BeginBatch();
+
     SuccessOrDie(Set(SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES, nullptr));
 
     for (int i = 0; i < mSrcMatchShortEntryCount; ++i)
@@ -2209,6 +2401,8 @@ void RadioSpinel::RestoreProperties(void)
         SuccessOrDie(Set(SPINEL_PROP_MAC_SRC_MATCH_ENABLED, SPINEL_DATATYPE_BOOL_S, mSrcMatchEnabled));
     }
 
+    SuccessOrDie(EndBatch());
+
     if (mCcaEnergyDetectThresholdSet)
     {
         SuccessOrDie(Set(SPINEL_PROP_PHY_CCA_THRESHOLD, SPINEL_DATATYPE_INT8_S, mCcaEnergyDetectThreshold));
@@ -2294,10 +2488,26 @@ exit:
 
 otError RadioSpinel::SetChannelMaxTransmitPower(uint8_t aChannel, int8_t aMaxPower)
 {
-    otError error = OT_ERROR_NONE;
+    otError error   = OT_ERROR_NONE;
+    bool    batched = IsBatchable(SPINEL_PROP_PHY_CHAN_MAX_POWER);
+
     VerifyOrExit(aChannel >= Radio::kChannelMin && aChannel <= Radio::kChannelMax, error = OT_ERROR_INVALID_ARGS);
-    mMaxPowerTable.SetTransmitPower(aChannel, aMaxPower);
+
+    if (!batched)
+    {
+        mMaxPowerTable.SetTransmitPower(aChannel, aMaxPower);
+    }
+
     error = Set(SPINEL_PROP_PHY_CHAN_MAX_POWER, SPINEL_DATATYPE_UINT8_S SPINEL_DATATYPE_INT8_S, aChannel, aMaxPower);
+    SuccessOrExit(error);
+
+    if (batched)
+    {
+        // Keep the max power until the RCP accepts the batched request.
+        mBatchMaxPowers[mBatchLastTid].mChannel = aChannel;
+        mBatchMaxPowers[mBatchLastTid].mPower   = aMaxPower;
+        mBatchPowerTids |= (1 << mBatchLastTid);
+    }
 
 exit:
     return error;
@@ -2467,10 +2677,27 @@ exit:
     return;
 }
 
+void RadioSpinel::MetricsTracker::AddBatch(uint16_t aNumRequests, uint16_t aNumRoundTrips)
+{
+    // The batch counters are only persisted along with the other
+    // counters in `IncrementCount()`.
+    mMetrics.mSpinelBatchCount++;
+    mMetrics.mSpinelBatchRequestCount += aNumRequests;
+    mMetrics.mSpinelRoundTripsSaved += (aNumRequests > aNumRoundTrips) ? (aNumRequests - aNumRoundTrips) : 0;
+}
+
 void RadioSpinel::MetricsTracker::IncrementCount(MetricType aType)
 {
+    uint32_t batchCount        = mMetrics.mSpinelBatchCount;
+    uint32_t batchRequestCount = mMetrics.mSpinelBatchRequestCount;
+    uint32_t roundTripsSaved   = mMetrics.mSpinelRoundTripsSaved;
+
     RestoreMetrics();
 
+    mMetrics.mSpinelBatchCount        = batchCount;
+    mMetrics.mSpinelBatchRequestCount = batchRequestCount;
+    mMetrics.mSpinelRoundTripsSaved   = roundTripsSaved;
+
     switch (aType)
     {
     case kTypeTimeoutCount:
@@ -936,6 +936,29 @@ public:
      */
     otError Remove(spinel_prop_key_t aKey, const char *aFormat, ...);
 
+    /**
+     * Begins a batch of spinel property updates.
+     *
+     * Until `EndBatch()` is called, `Set()`, `Insert()` and `Remove()` send their request to the transceiver without
+     * waiting for its response, keeping up to `OPENTHREAD_SPINEL_CONFIG_BATCH_WINDOW_SIZE` requests outstanding. The
+     * transceiver processes the requests in order. Requests which unpack the response (e.g., `Get()`) still wait for
+     * it. Once a batched request is known to have failed, the following batched requests are not sent.
+     *
+     * Batches cannot be nested.
+     */
+    void BeginBatch(void);
+
+    /**
+     * Ends the batch of spinel property updates started by `BeginBatch()`.
+     *
+     * Waits for the responses of all outstanding batched requests.
+     *
+     * @retval  OT_ERROR_NONE               All batched requests succeeded.
+     * @retval  OT_ERROR_RESPONSE_TIMEOUT   Failed due to no response received from the transceiver.
+     * @retval  ...                         The error of the first batched request which failed.
+     */
+    otError EndBatch(void);
+
     /**
      * Sends a reset command to the RCP.
      *
@@ -1105,6 +1128,20 @@ private:
     static constexpr uint64_t kTxWaitUs =
         OPENTHREAD_SPINEL_CONFIG_RCP_TX_WAIT_TIME_SECS *
         kUsPerSec; ///< Maximum time of waiting for `TransmitDone` event, in microseconds.
+    static constexpr uint8_t kBatchWindowSize =
+        OPENTHREAD_SPINEL_CONFIG_BATCH_WINDOW_SIZE; ///< Max number of outstanding batched requests.
+
+    // Out of the 15 transaction ids, leave one for radio frame transmission and one for a non-batched request.
+    static_assert(kBatchWindowSize >= 1 && kBatchWindowSize <= 13,
+                  "OPENTHREAD_SPINEL_CONFIG_BATCH_WINDOW_SIZE is invalid");
+
+    static constexpr uint8_t kNumTids = SPINEL_HEADER_TID_MASK + 1; ///< Number of transaction id values.
+
+    struct BatchMaxPower
+    {
+        uint8_t mChannel;
+        int8_t  mPower;
+    };
 
     typedef otError (RadioSpinel::*ResponseHandler)(const uint8_t *aBuffer, uint16_t aLength);
 
@@ -1146,6 +1183,8 @@ private:
                                         const char       *aFormat,
                                         va_list           aArgs);
     otError WaitResponse(bool aHandleRcpTimeout = true);
+    bool    IsBatchable(spinel_prop_key_t aKey) const;
+    otError WaitBatchResponses(uint8_t aMaxPending);
     otError ParseRadioFrame(otRadioFrame &aFrame, const uint8_t *aBuffer, uint16_t aLength, spinel_ssize_t &aUnpacked);
 
     /**
@@ -1170,6 +1209,7 @@ private:
     void HandleResponse(const uint8_t *aBuffer, uint16_t aLength);
     void HandleTransmitDone(uint32_t aCommand, spinel_prop_key_t aKey, const uint8_t *aBuffer, uint16_t aLength);
     void HandleWaitingResponse(uint32_t aCommand, spinel_prop_key_t aKey, const uint8_t *aBuffer, uint16_t aLength);
+    void HandleBatchResponse(spinel_tid_t aTid, spinel_prop_key_t aKey, const uint8_t *aBuffer, uint16_t aLength);
 
     void RadioReceive(void);
 
@@ -1229,6 +1269,7 @@ private:
         void IncrementRcpUnexpectedResetCount(void) { IncrementCount(kTypeUnexpectResetCount); }
         void IncrementRcpRestorationCount(void) { IncrementCount(kTypeRestorationCount); }
         void IncrementSpinelParseErrorCount(void) { IncrementCount(kTypeSpinelParseErrorCount); }
+        void AddBatch(uint16_t aNumRequests, uint16_t aNumRoundTrips);
 
         const Metrics &GetMetrics(void) const { return mMetrics; }
 
@@ -1262,6 +1303,15 @@ private:
     va_list           mPropertyArgs;    ///< The arguments pack or unpack spinel property of current transaction.
     uint32_t          mExpectedCommand; ///< Expected response command of current transaction.
     otError           mError;           ///< The result of current transaction.
+    uint16_t          mBatchTids;       ///< The transaction ids of outstanding batched requests.
+    uint8_t           mBatchPending;    ///< The number of outstanding batched requests.
+    uint16_t          mBatchRequests;   ///< The number of requests sent in current batch.
+    uint16_t          mBatchRoundTrips; ///< The number of times current batch waited for responses.
+    otError           mBatchError;      ///< The first error of current batch.
+    bool              mBatching;        ///< Whether a batch is in progress.
+    spinel_tid_t      mBatchLastTid;    ///< The transaction id of the last batched request.
+    uint16_t          mBatchPowerTids;  ///< The transaction ids of batched channel max power requests.
+    BatchMaxPower     mBatchMaxPowers[kNumTids];
     uint8_t           mRxPsdu[OT_RADIO_FRAME_MAX_SIZE];
     uint8_t           mTxPsdu[OT_RADIO_FRAME_MAX_SIZE];
     uint8_t           mAckPsdu[OT_RADIO_FRAME_MAX_SIZE];
@@ -50,6 +50,9 @@ typedef struct otRadioSpinelMetrics
     uint32_t mRcpUnexpectedResetCount; ///< The number of RCP unexpected resets.
     uint32_t mRcpRestorationCount;     ///< The number of RCP restorations.
     uint32_t mSpinelParseErrorCount;   ///< The number of spinel frame parse errors.
+    uint32_t mSpinelBatchCount;        ///< The number of batched spinel transactions.
+    uint32_t mSpinelBatchRequestCount; ///< The number of spinel requests sent in batched transactions.
+    uint32_t mSpinelRoundTripsSaved;   ///< The number of spinel round trips saved by batching requests.
 } otRadioSpinelMetrics;
 
 /**
@@ -83,6 +83,8 @@ namespace Ncp {
 
 class NcpBase
 {
+    friend class DispatcherTester;
+
 public:
     static constexpr uint8_t kSpinelCmdHeaderSize = 2; ///< Size of spinel command header (in bytes).
     static constexpr uint8_t kSpinelPropIdSize    = 3; ///< Size of spinel property identifier (in bytes).
@@ -379,6 +381,83 @@ protected:
         NcpBase::PropertyHandler mHandler;
     };
 
+    static constexpr uint16_t          kNoHandlerIndex = 0xffff;
+    static constexpr spinel_prop_key_t kCounterIndexEnd =
+        static_cast<spinel_prop_key_t>(SPINEL_PROP_CNTR_MAC_RETRY_HISTOGRAM + 1);
+
+    // `HandlerIndex` maps every property key in `[kBegin, kEnd)` directly
+    // to the index of its entry in a sorted `HandlerEntry` table. It is
+    // generated at compile-time by `MakeHandlerIndex()` from the table.
+
+    template <spinel_prop_key_t kBegin, spinel_prop_key_t kEnd> struct HandlerIndex
+    {
+        bool Contains(spinel_prop_key_t aKey) const
+        {
+            return (static_cast<uint32_t>(aKey) - kBegin) < static_cast<uint32_t>(kEnd - kBegin);
+        }
+
+        PropertyHandler Find(const HandlerEntry *aHandlerEntries, spinel_prop_key_t aKey) const
+        {
+            uint16_t index = mIndexes[aKey - kBegin];
+
+            return (index != kNoHandlerIndex) ? aHandlerEntries[index].mHandler : nullptr;
+        }
+
+        uint16_t mIndexes[kEnd - kBegin];
+    };
+
+    template <size_t... kOffsets> struct OffsetList
+    {
+    };
+
+    template <size_t kCount, size_t... kOffsets>
+    struct MakeOffsetList : public MakeOffsetList<kCount - 1, kCount - 1, kOffsets...>
+    {
+    };
+
+    template <size_t... kOffsets> struct MakeOffsetList<0, kOffsets...>
+    {
+        typedef OffsetList<kOffsets...> Type;
+    };
+
+    static constexpr size_t FindLowerBound(const HandlerEntry *aHandlerEntries,
+                                           size_t              aStart,
+                                           size_t              aEnd,
+                                           uint32_t            aKey)
+    {
+        return (aStart >= aEnd) ? aStart
+               : (aHandlerEntries[(aStart + aEnd) / 2].mKey < aKey)
+                   ? FindLowerBound(aHandlerEntries, (aStart + aEnd) / 2 + 1, aEnd, aKey)
+                   : FindLowerBound(aHandlerEntries, aStart, (aStart + aEnd) / 2, aKey);
+    }
+
+    static constexpr uint16_t ToHandlerIndex(const HandlerEntry *aHandlerEntries,
+                                             size_t              aSize,
+                                             size_t              aLowerBound,
+                                             uint32_t            aKey)
+    {
+        return ((aLowerBound < aSize) && (aHandlerEntries[aLowerBound].mKey == aKey))
+                   ? static_cast<uint16_t>(aLowerBound)
+                   : kNoHandlerIndex;
+    }
+
+    template <spinel_prop_key_t kBegin, spinel_prop_key_t kEnd, size_t... kOffsets>
+    static constexpr HandlerIndex<kBegin, kEnd> MakeHandlerIndex(const HandlerEntry *aHandlerEntries,
+                                                                 size_t              aSize,
+                                                                 OffsetList<kOffsets...>)
+    {
+        return {{ToHandlerIndex(aHandlerEntries, aSize, FindLowerBound(aHandlerEntries, 0, aSize, kBegin + kOffsets),
+                                kBegin + kOffsets)...}};
+    }
+
+    template <spinel_prop_key_t kBegin, spinel_prop_key_t kEnd, size_t kSize>
+    static constexpr HandlerIndex<kBegin, kEnd> MakeHandlerIndex(const HandlerEntry (&aHandlerEntries)[kSize])
+    {
+        static_assert(kSize < kNoHandlerIndex, "Too many entries for a `HandlerIndex`");
+
+        return MakeHandlerIndex<kBegin, kEnd>(aHandlerEntries, kSize, typename MakeOffsetList<kEnd - kBegin>::Type());
+    }
+
     Spinel::Buffer::FrameTag GetLastOutboundFrameTag(void);
 
     otError HandleCommand(uint8_t aHeader);
@@ -387,6 +466,11 @@ protected:
     static constexpr bool AreHandlerEntriesSorted(const HandlerEntry *aHandlerEntries, size_t aSize);
 #endif
 
+    static const HandlerEntry kGetHandlerEntries[];
+    static const HandlerEntry kSetHandlerEntries[];
+    static const size_t       kNumGetHandlerEntries;
+    static const size_t       kNumSetHandlerEntries;
+
     static PropertyHandler FindPropertyHandler(const HandlerEntry *aHandlerEntries,
                                                size_t              aSize,
                                                spinel_prop_key_t   aKey);
@@ -2362,9 +2362,9 @@ template <> otError NcpBase::HandlePropertySet<SPINEL_PROP_STREAM_NET>(void)
     // May later include TX power, allow retransmits, etc...
 
     // STREAM_NET requires layer 2 security.
-    message = otIp6NewMessageFromBuffer(mInstance, framePtr, frameLen, nullptr);
+    message =
+        otIp6NewMessageFromBufferWithOrigin(mInstance, framePtr, frameLen, nullptr, OT_MESSAGE_ORIGIN_HOST_UNTRUSTED);
     VerifyOrExit(message != nullptr, error = OT_ERROR_NO_BUFS);
-    otMessageSetOrigin(message, OT_MESSAGE_ORIGIN_HOST_UNTRUSTED);
 
     error = otIp6Send(mInstance, message);
 
@@ -3412,9 +3412,9 @@ template <> otError NcpBase::HandlePropertySet<SPINEL_PROP_STREAM_NET_INSECURE>(
     // May later include TX power, allow retransmits, etc...
 
     // STREAM_NET_INSECURE packets are not secured at layer 2.
-    message = otIp6NewMessageFromBuffer(mInstance, framePtr, frameLen, &msgSettings);
+    message = otIp6NewMessageFromBufferWithOrigin(mInstance, framePtr, frameLen, &msgSettings,
+                                                  OT_MESSAGE_ORIGIN_HOST_UNTRUSTED);
     VerifyOrExit(message != nullptr, error = OT_ERROR_NO_BUFS);
-    otMessageSetOrigin(message, OT_MESSAGE_ORIGIN_HOST_UNTRUSTED);
 
     // Ensure the insecure message is forwarded using direct transmission.
     otMessageSetDirectTransmission(message, true);
@@ -115,8 +115,7 @@ int Daemon::OutputFormatV(const char *aFormat, va_list aArguments)
     if (rval < 0)
     {
         LogWarn("Failed to write CLI output: %s", strerror(errno));
-        close(mSessionSocket);
-        mSessionSocket = -1;
+        CloseSessionSocket();
     }
 
 exit:
@@ -149,10 +148,12 @@ void Daemon::InitializeSessionSocket(void)
 #endif
 #endif // __linux__
 
-    if (mSessionSocket != -1)
-    {
-        close(mSessionSocket);
-    }
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+    VerifyOrExit(Mainloop::Manager::Get().RegisterFd(newSessionSocket, kEventReadable, *this) == OT_ERROR_NONE,
+                 rval = -1);
+#endif
+
+    CloseSessionSocket();
     mSessionSocket = newSessionSocket;
 
 exit:
@@ -170,6 +171,20 @@ exit:
     }
 }
 
+void Daemon::CloseSessionSocket(void)
+{
+    VerifyOrExit(mSessionSocket != -1);
+
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+    Mainloop::Manager::Get().UnregisterFd(mSessionSocket);
+#endif
+    close(mSessionSocket);
+    mSessionSocket = -1;
+
+exit:
+    return;
+}
+
 #if OPENTHREAD_POSIX_CONFIG_ANDROID_ENABLE
 void Daemon::createListenSocketOrDie(void)
 {
@@ -288,20 +303,24 @@ exit:
     otSysCliInitUsingDaemon(gInstance);
 #endif
 
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+    SuccessOrDie(Mainloop::Manager::Get().RegisterFd(mListenSocket, kEventReadable, *this));
+#else
     Mainloop::Manager::Get().Add(*this);
+#endif
 
     return;
 }
 
 void Daemon::TearDown(void)
 {
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+    Mainloop::Manager::Get().UnregisterFd(mListenSocket);
+#else
     Mainloop::Manager::Get().Remove(*this);
+#endif
 
-    if (mSessionSocket != -1)
-    {
-        close(mSessionSocket);
-        mSessionSocket = -1;
-    }
+    CloseSessionSocket();
 
 #if !OPENTHREAD_POSIX_CONFIG_ANDROID_ENABLE
     // The `mListenSocket` is managed by `init` on Android
@@ -340,55 +359,86 @@ void Daemon::Update(Mainloop::Context &aContext)
 
 void Daemon::Process(const Mainloop::Context &aContext)
 {
-    ssize_t rval;
+    // Only used when the sockets are not registered with the
+    // mainloop manager (see `SetUp()`).
 
-    VerifyOrExit(mListenSocket != -1);
+    const int fds[] = {mListenSocket, mSessionSocket};
 
-    if (Mainloop::HasFdErrored(mListenSocket, aContext))
+    for (int fd : fds)
     {
-        DieNowWithMessage("daemon socket error", OT_EXIT_FAILURE);
-    }
-    else if (Mainloop::IsFdReadable(mListenSocket, aContext))
-    {
-        InitializeSessionSocket();
+        uint32_t events = 0;
+
+        if (fd == -1)
+        {
+            continue;
+        }
+
+        if (Mainloop::IsFdReadable(fd, aContext))
+        {
+            events |= kEventReadable;
+        }
+
+        if (Mainloop::HasFdErrored(fd, aContext))
+        {
+            events |= kEventError;
+        }
+
+        if (events != 0)
+        {
+            HandleFdEvents(fd, events, nullptr);
+        }
     }
+}
 
-    VerifyOrExit(mSessionSocket != -1);
+void Daemon::HandleFdEvents(int aFd, uint32_t aEvents, void *aContext)
+{
+    ssize_t rval;
 
-    if (Mainloop::HasFdErrored(mSessionSocket, aContext))
+    OT_UNUSED_VARIABLE(aContext);
+
+    if (aFd == mListenSocket)
     {
-        close(mSessionSocket);
-        mSessionSocket = -1;
+        if (aEvents & kEventError)
+        {
+            DieNowWithMessage("daemon socket error", OT_EXIT_FAILURE);
+        }
+        else if (aEvents & kEventReadable)
+        {
+            InitializeSessionSocket();
+        }
     }
-    else if (Mainloop::IsFdReadable(mSessionSocket, aContext))
+    else if (aFd == mSessionSocket)
     {
-        uint8_t buffer[OPENTHREAD_CONFIG_CLI_MAX_LINE_LENGTH];
+        if (aEvents & kEventError)
+        {
+            CloseSessionSocket();
+        }
+        else if (aEvents & kEventReadable)
+        {
+            uint8_t buffer[OPENTHREAD_CONFIG_CLI_MAX_LINE_LENGTH];
 
-        // leave 1 byte for the null terminator
-        rval = read(mSessionSocket, buffer, sizeof(buffer) - 1);
+            // leave 1 byte for the null terminator
+            rval = read(mSessionSocket, buffer, sizeof(buffer) - 1);
 
-        if (rval > 0)
-        {
-            buffer[rval] = '\0';
+            if (rval > 0)
+            {
+                buffer[rval] = '\0';
 #if OPENTHREAD_POSIX_CONFIG_DAEMON_CLI_ENABLE
-            otCliInputLine(reinterpret_cast<char *>(buffer));
+                otCliInputLine(reinterpret_cast<char *>(buffer));
 #else
-            OutputFormat("Error: CLI is disabled!\n");
+                OutputFormat("Error: CLI is disabled!\n");
 #endif
-        }
-        else
-        {
-            if (rval < 0)
+            }
+            else
             {
-                LogWarn("Daemon read: %s", strerror(errno));
+                if (rval < 0)
+                {
+                    LogWarn("Daemon read: %s", strerror(errno));
+                }
+                CloseSessionSocket();
             }
-            close(mSessionSocket);
-            mSessionSocket = -1;
         }
     }
-
-exit:
-    return;
 }
 
 Daemon &Daemon::Get(void)
@@ -42,7 +42,7 @@
 namespace ot {
 namespace Posix {
 
-class Daemon : public Mainloop::Source, public Logger<Daemon>, private NonCopyable
+class Daemon : public Mainloop::Source, public Mainloop::FdHandler, public Logger<Daemon>, private NonCopyable
 {
 public:
     static const char kLogModuleName[];
@@ -53,12 +53,14 @@ public:
     void TearDown(void);
     void Update(Mainloop::Context &aContext) override;
     void Process(const Mainloop::Context &aContext) override;
+    void HandleFdEvents(int aFd, uint32_t aEvents, void *aContext) override;
     int  OutputFormatV(const char *aFormat, va_list aArguments) OT_TOOL_PRINTF_STYLE_FORMAT_ARG_CHECK(2, 0);
 
 private:
     int  OutputFormat(const char *aFormat, ...) OT_TOOL_PRINTF_STYLE_FORMAT_ARG_CHECK(2, 3);
     void createListenSocketOrDie(void);
     void InitializeSessionSocket(void);
+    void CloseSessionSocket(void);
 
     int mListenSocket  = -1;
     int mDaemonLock    = -1;
@@ -214,6 +214,33 @@ const char *otSysGetThreadNetifName(void);
  */
 unsigned int otSysGetThreadNetifIndex(void);
 
+/**
+ * Represents the batching counters of the Thread network interface.
+ *
+ * The transmit counters track the packets read from the Thread network interface and sent through OpenThread. The
+ * receive counters track the packets received from OpenThread and written to the Thread network interface. A batch
+ * is the set of packets handled in one mainloop iteration.
+ */
+typedef struct otSysNetifBatchCounters
+{
+    uint32_t mTxBatches;       ///< The number of mainloop iterations which read at least one packet.
+    uint32_t mTxPackets;       ///< The number of packets read.
+    uint32_t mTxMaxBatchSize;  ///< The largest number of packets read in one mainloop iteration.
+    uint32_t mTxFullBatches;   ///< The number of mainloop iterations which reached the transmit batch size limit.
+    uint32_t mLastTxBatchSize; ///< The number of packets read in the last mainloop iteration which read packets.
+    uint32_t mRxBatches;       ///< The number of mainloop iterations which wrote at least one packet.
+    uint32_t mRxPackets;       ///< The number of packets written.
+    uint32_t mRxMaxBatchSize;  ///< The largest number of packets written in one mainloop iteration.
+    uint32_t mLastRxBatchSize; ///< The number of packets written in the last mainloop iteration which wrote packets.
+} otSysNetifBatchCounters;
+
+/**
+ * Returns the batching counters of the Thread network interface.
+ *
+ * @returns The batching counters of the Thread network interface.
+ */
+const otSysNetifBatchCounters *otSysGetThreadNetifBatchCounters(void);
+
 /**
  * Returns the infrastructure network interface name.
  *
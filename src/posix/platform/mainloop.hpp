@@ -34,6 +34,11 @@
 #ifndef OT_POSIX_PLATFORM_MAINLOOP_HPP_
 #define OT_POSIX_PLATFORM_MAINLOOP_HPP_
 
+#include "openthread-posix-config.h"
+
+#include <stddef.h>
+
+#include <openthread/error.h>
 #include <openthread/openthread-system.h>
 
 namespace ot {
@@ -164,6 +169,35 @@ private:
     Source *mNext = nullptr;
 };
 
+/**
+ * Is the base for handlers of file descriptors registered persistently with the `Manager`.
+ *
+ * Registered file descriptors are level-triggered, same as file descriptors added to the mainloop context by an event
+ * `Source`: `HandleFdEvents()` is invoked on every mainloop iteration in which the file descriptor is ready, so the
+ * handler does not need to consume all available data at once.
+ */
+class FdHandler
+{
+public:
+    static constexpr uint32_t kEventReadable = (1U << 0); ///< The file descriptor is readable.
+    static constexpr uint32_t kEventWritable = (1U << 1); ///< The file descriptor is writable.
+    static constexpr uint32_t kEventError    = (1U << 2); ///< The file descriptor has an error or hang-up.
+
+    /**
+     * Handles events on a registered file descriptor.
+     *
+     * @param[in]  aFd       The file descriptor.
+     * @param[in]  aEvents   The events (bitwise OR of `kEvent*` constants).
+     * @param[in]  aContext  The context given when registering the file descriptor.
+     */
+    virtual void HandleFdEvents(int aFd, uint32_t aEvents, void *aContext) = 0;
+
+    /**
+     * Marks destructor virtual method.
+     */
+    virtual ~FdHandler(void) = default;
+};
+
 /**
  * Manages mainloop.
  */
@@ -205,8 +239,71 @@ public:
      */
     static Manager &Get(void);
 
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+    /**
+     * Registers a file descriptor to be watched persistently (until unregistered).
+     *
+     * Unlike file descriptors added to the mainloop context by an event `Source`, a registered file descriptor does
+     * not need to be added again on every mainloop iteration. Only the single epoll file descriptor of the `Manager` is
+     * added to the mainloop context.
+     *
+     * The file descriptor MUST be unregistered before it is closed.
+     *
+     * @param[in]  aFd       The file descriptor.
+     * @param[in]  aEvents   The events to watch (bitwise OR of `FdHandler::kEvent*` constants).
+     * @param[in]  aHandler  The handler to invoke when any of the events occurs.
+     * @param[in]  aContext  An arbitrary context passed to @p aHandler along with the events.
+     *
+     * @retval OT_ERROR_NONE          Successfully registered the file descriptor.
+     * @retval OT_ERROR_ALREADY       The file descriptor is already registered.
+     * @retval OT_ERROR_NO_BUFS       Failed to allocate memory for the registration.
+     * @retval OT_ERROR_FAILED        Failed to register the file descriptor with epoll.
+     */
+    otError RegisterFd(int aFd, uint32_t aEvents, FdHandler &aHandler, void *aContext = nullptr);
+
+    /**
+     * Unregisters a previously registered file descriptor.
+     *
+     * @param[in]  aFd  The file descriptor.
+     */
+    void UnregisterFd(int aFd);
+
+    /**
+     * Returns the number of registered file descriptors.
+     *
+     * @returns The number of registered file descriptors.
+     */
+    size_t GetNumRegisteredFds(void) const { return mNumRegistrations; }
+
+    /**
+     * Closes the epoll file descriptor and frees all remaining registrations.
+     */
+    void Deinit(void);
+#endif
+
 private:
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+    static constexpr int kMaxEpollEvents = 32;
+
+    struct Registration
+    {
+        int        mFd;
+        FdHandler *mHandler;
+        void      *mContext;
+    };
+
+    Registration *FindRegistration(int aFd, size_t &aIndex);
+    void          ProcessFdEvents(void);
+#endif
+
     Source *mSources = nullptr;
+
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+    int           mEpollFd               = -1;
+    Registration *mRegistrations         = nullptr; // Sorted by `mFd`.
+    size_t        mNumRegistrations      = 0;
+    size_t        mRegistrationsCapacity = 0;
+#endif
 };
 
 } // namespace Mainloop
@@ -100,6 +100,7 @@
 #include <sys/socket.h>
 #include <sys/stat.h>
 #include <sys/types.h>
+#include <sys/uio.h>
 #include <unistd.h>
 
 #if defined(__APPLE__) || defined(__NetBSD__) || defined(__FreeBSD__)
@@ -174,10 +175,14 @@ extern int
 unsigned int gNetifIndex = 0;
 char         gNetifName[IFNAMSIZ];
 
+static otSysNetifBatchCounters sNetifBatchCounters;
+
 const char *otSysGetThreadNetifName(void) { return gNetifName; }
 
 unsigned int otSysGetThreadNetifIndex(void) { return gNetifIndex; }
 
+const otSysNetifBatchCounters *otSysGetThreadNetifBatchCounters(void) { return &sNetifBatchCounters; }
+
 #if OPENTHREAD_CONFIG_PLATFORM_NETIF_ENABLE
 
 #if OPENTHREAD_POSIX_CONFIG_FIREWALL_ENABLE
@@ -295,7 +300,12 @@ enum
 };
 #endif
 
-static constexpr size_t kMaxIp6Size = OPENTHREAD_CONFIG_IP6_MAX_DATAGRAM_LENGTH;
+static constexpr size_t   kMaxIp6Size  = OPENTHREAD_CONFIG_IP6_MAX_DATAGRAM_LENGTH;
+static constexpr uint16_t kTxBatchSize = OPENTHREAD_POSIX_CONFIG_NETIF_TX_BATCH_SIZE;
+
+static_assert(kTxBatchSize > 0, "OPENTHREAD_POSIX_CONFIG_NETIF_TX_BATCH_SIZE must be at least 1");
+
+static uint32_t sRxBatchSize = 0; ///< Number of packets written to the tunnel in the current mainloop iteration.
 #if defined(RTM_NEWLINK) && defined(RTM_DELLINK)
 static bool sIsSyncingState = false;
 #endif
@@ -1220,14 +1230,27 @@ static void processReceive(otMessage *aMessage, void *aContext)
 {
     OT_UNUSED_VARIABLE(aContext);
 
-    char     packet[kMaxIp6Size + 4];
-    otError  error     = OT_ERROR_NONE;
-    uint16_t length    = otMessageGetLength(aMessage);
-    size_t   offset    = 0;
-    uint16_t maxLength = sizeof(packet) - 4;
+    // The message is written to the tunnel directly from the message
+    // buffers (using `writev()`) without first copying it into a
+    // contiguous buffer. The copy is only used as a fallback when the
+    // message spans more than `kMaxSpans` buffers.
+
+    static constexpr uint16_t kMaxSpans = 32;
+
+    otMessageSpan spans[kMaxSpans];
+    struct iovec  iov[kMaxSpans + 1];
+    int           iovCount = 0;
+    uint16_t      numSpans = kMaxSpans;
+    char          packet[kMaxIp6Size];
+    otError       error  = OT_ERROR_NONE;
+    uint16_t      length = otMessageGetLength(aMessage);
 #if defined(__APPLE__) || defined(__NetBSD__) || defined(__FreeBSD__)
     // BSD tunnel drivers use (for legacy reasons) a 4-byte header to determine the address family of the packet
-    offset += 4;
+    static const uint8_t kTunHeader[] = {0, 0, (PF_INET6 << 8) & 0xFF, (PF_INET6 << 0) & 0xFF};
+
+    iov[iovCount].iov_base = const_cast<uint8_t *>(kTunHeader);
+    iov[iovCount].iov_len  = sizeof(kTunHeader);
+    iovCount++;
 #endif
 
     assert(gInstance == aContext);
@@ -1235,22 +1258,39 @@ static void processReceive(otMessage *aMessage, void *aContext)
 
     VerifyOrExit(sTunFd > 0);
 
-    VerifyOrExit(otMessageRead(aMessage, 0, &packet[offset], maxLength) == length, error = OT_ERROR_NO_BUFS);
+    if (otMessageGetSpans(aMessage, 0, length, spans, &numSpans) == OT_ERROR_NONE)
+    {
+        for (uint16_t i = 0; i < numSpans; i++)
+        {
+            iov[iovCount].iov_base = const_cast<uint8_t *>(spans[i].mBytes);
+            iov[iovCount].iov_len  = spans[i].mLength;
+            iovCount++;
+        }
+    }
+    else
+    {
+        VerifyOrExit(otMessageRead(aMessage, 0, packet, sizeof(packet)) == length, error = OT_ERROR_NO_BUFS);
+
+        iov[iovCount].iov_base = packet;
+        iov[iovCount].iov_len  = length;
+        iovCount++;
+    }
 
 #if OPENTHREAD_POSIX_LOG_TUN_PACKETS
     LogInfo("Packet from NCP (%u bytes)", static_cast<uint16_t>(length));
-    otDumpInfoPlat("", &packet[offset], length);
+
+    for (int i = 0; i < iovCount; i++)
+    {
+        otDumpInfoPlat("", iov[i].iov_base, static_cast<uint16_t>(iov[i].iov_len));
+    }
 #endif
 
 #if defined(__APPLE__) || defined(__NetBSD__) || defined(__FreeBSD__)
-    packet[0] = 0;
-    packet[1] = 0;
-    packet[2] = (PF_INET6 << 8) & 0xFF;
-    packet[3] = (PF_INET6 << 0) & 0xFF;
-    length += 4;
+    length += sizeof(kTunHeader);
 #endif
 
-    VerifyOrExit(write(sTunFd, packet, length) == length, perror("write"); error = OT_ERROR_FAILED);
+    VerifyOrExit(writev(sTunFd, iov, iovCount) == length, perror("writev"); error = OT_ERROR_FAILED);
+    sRxBatchSize++;
 
 exit:
     otMessageFree(aMessage);
@@ -1366,34 +1406,27 @@ exit:
 }
 #endif // __linux__
 
-static void processTransmit(otInstance *aInstance)
+static otError transmitPacket(otInstance *aInstance, char *aPacket, ssize_t aLength)
 {
     otMessage *message = nullptr;
-    ssize_t    rval;
-    char       packet[kMaxIp6Size];
-    otError    error  = OT_ERROR_NONE;
-    size_t     offset = 0;
+    otError    error   = OT_ERROR_NONE;
+    size_t     offset  = 0;
 #if OPENTHREAD_CONFIG_BORDER_ROUTING_ENABLE && OPENTHREAD_CONFIG_NAT64_TRANSLATOR_ENABLE
     bool isIp4 = false;
 #endif
 
-    assert(gInstance == aInstance);
-
-    rval = read(sTunFd, packet, sizeof(packet));
-    VerifyOrExit(rval > 0, error = OT_ERROR_FAILED);
-
 #if defined(__APPLE__) || defined(__NetBSD__) || defined(__FreeBSD__)
     // BSD tunnel drivers have (for legacy reasons), may have a 4-byte header on them
-    if ((rval >= 4) && (packet[0] == 0) && (packet[1] == 0))
+    if ((aLength >= 4) && (aPacket[0] == 0) && (aPacket[1] == 0))
     {
-        rval -= 4;
+        aLength -= 4;
         offset = 4;
     }
 #endif
 
 #if OPENTHREAD_CONFIG_BORDER_ROUTING_ENABLE && OPENTHREAD_CONFIG_BORDER_ROUTING_DHCP6_PD_ENABLE && \
     !OPENTHREAD_CONFIG_BORDER_ROUTING_DHCP6_PD_CLIENT_ENABLE
-    if (tryProcessIcmp6RaMessage(aInstance, reinterpret_cast<uint8_t *>(&packet[offset]), rval) == OT_ERROR_NONE)
+    if (tryProcessIcmp6RaMessage(aInstance, reinterpret_cast<uint8_t *>(&aPacket[offset]), aLength) == OT_ERROR_NONE)
     {
         ExitNow();
     }
@@ -1405,21 +1438,21 @@ static void processTransmit(otInstance *aInstance)
         settings.mLinkSecurityEnabled = (otThreadGetDeviceRole(aInstance) != OT_DEVICE_ROLE_DISABLED);
         settings.mPriority            = OT_MESSAGE_PRIORITY_LOW;
 #if OPENTHREAD_CONFIG_NAT64_TRANSLATOR_ENABLE
-        isIp4   = (getIpVersion(reinterpret_cast<uint8_t *>(&packet[offset])) == kIpVersion4);
-        message = isIp4 ? otIp4NewMessage(aInstance, &settings) : otIp6NewMessage(aInstance, &settings);
+        isIp4   = (getIpVersion(reinterpret_cast<uint8_t *>(&aPacket[offset])) == kIpVersion4);
+        message = isIp4 ? otIp4NewMessageWithOrigin(aInstance, &settings, OT_MESSAGE_ORIGIN_HOST_UNTRUSTED)
+                        : otIp6NewMessageWithOrigin(aInstance, &settings, OT_MESSAGE_ORIGIN_HOST_UNTRUSTED);
 #else
-        message = otIp6NewMessage(aInstance, &settings);
+        message = otIp6NewMessageWithOrigin(aInstance, &settings, OT_MESSAGE_ORIGIN_HOST_UNTRUSTED);
 #endif
         VerifyOrExit(message != nullptr, error = OT_ERROR_NO_BUFS);
-        otMessageSetOrigin(message, OT_MESSAGE_ORIGIN_HOST_UNTRUSTED);
     }
 
 #if OPENTHREAD_POSIX_LOG_TUN_PACKETS
-    LogInfo("Packet to NCP (%hu bytes)", static_cast<uint16_t>(rval));
-    otDumpInfoPlat("", &packet[offset], static_cast<size_t>(rval));
+    LogInfo("Packet to NCP (%hu bytes)", static_cast<uint16_t>(aLength));
+    otDumpInfoPlat("", &aPacket[offset], static_cast<size_t>(aLength));
 #endif
 
-    SuccessOrExit(error = otMessageAppend(message, &packet[offset], static_cast<uint16_t>(rval)));
+    SuccessOrExit(error = otMessageAppend(message, &aPacket[offset], static_cast<uint16_t>(aLength)));
 
 #if OPENTHREAD_CONFIG_NAT64_TRANSLATOR_ENABLE
     error = isIp4 ? otNat64Send(aInstance, message) : otIp6Send(aInstance, message);
@@ -1445,6 +1478,81 @@ exit:
             LogWarn("Failed to transmit, error:%s", otThreadErrorToString(error));
         }
     }
+
+    return error;
+}
+
+static void processTransmit(otInstance *aInstance)
+{
+    // Reads and sends up to `kTxBatchSize` packets from the tunnel,
+    // so that a burst of packets from the host is not limited to one
+    // packet per mainloop iteration. Stops early when the tunnel has
+    // no more packets or when OpenThread runs out of message buffers.
+
+    uint32_t batchSize = 0;
+
+    assert(gInstance == aInstance);
+
+    while (batchSize < kTxBatchSize)
+    {
+        char    packet[kMaxIp6Size];
+        ssize_t rval = read(sTunFd, packet, sizeof(packet));
+
+        if (rval <= 0)
+        {
+            if ((rval < 0) && (errno != EAGAIN) && (errno != EWOULDBLOCK) && (errno != EINTR))
+            {
+                LogWarn("Failed to read from tunnel: %s", strerror(errno));
+            }
+
+            break;
+        }
+
+        batchSize++;
+
+        if (transmitPacket(aInstance, packet, rval) == OT_ERROR_NO_BUFS)
+        {
+            break;
+        }
+    }
+
+    VerifyOrExit(batchSize > 0);
+
+    sNetifBatchCounters.mTxBatches++;
+    sNetifBatchCounters.mTxPackets += batchSize;
+    sNetifBatchCounters.mLastTxBatchSize = batchSize;
+
+    if (batchSize > sNetifBatchCounters.mTxMaxBatchSize)
+    {
+        sNetifBatchCounters.mTxMaxBatchSize = batchSize;
+    }
+
+    if (batchSize == kTxBatchSize)
+    {
+        sNetifBatchCounters.mTxFullBatches++;
+    }
+
+exit:
+    return;
+}
+
+static void updateRxBatchCounters(void)
+{
+    VerifyOrExit(sRxBatchSize > 0);
+
+    sNetifBatchCounters.mRxBatches++;
+    sNetifBatchCounters.mRxPackets += sRxBatchSize;
+    sNetifBatchCounters.mLastRxBatchSize = sRxBatchSize;
+
+    if (sRxBatchSize > sNetifBatchCounters.mRxMaxBatchSize)
+    {
+        sNetifBatchCounters.mRxMaxBatchSize = sRxBatchSize;
+    }
+
+    sRxBatchSize = 0;
+
+exit:
+    return;
 }
 
 static void logAddrEvent(bool isAdd, const otIp6Address &aAddress, otError error)
@@ -2496,6 +2604,10 @@ void platformNetifDeinit(void)
 
 void platformNetifUpdateFdSet(ot::Posix::Mainloop::Context *aContext)
 {
+    // The packets written to the tunnel since the last update belong
+    // to the mainloop iteration which just completed.
+    updateRxBatchCounters();
+
     VerifyOrExit(gNetifIndex > 0);
 
     assert(aContext != nullptr);
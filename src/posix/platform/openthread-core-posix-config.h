@@ -170,4 +170,8 @@
 #define OPENTHREAD_CONFIG_MAC_CSL_REQUEST_AHEAD_US 5000
 #endif
 
+#ifndef OPENTHREAD_CONFIG_CRC_LOOKUP_TABLE_ENABLE
+#define OPENTHREAD_CONFIG_CRC_LOOKUP_TABLE_ENABLE 1
+#endif
+
 #endif // OT_POSIX_PLATFORM_OPENTHREAD_CORE_POSIX_CONFIG_H_
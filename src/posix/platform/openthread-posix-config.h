@@ -140,6 +140,53 @@
 #define OPENTHREAD_POSIX_CONFIG_SECURE_SETTINGS_ENABLE 0
 #endif
 
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_SETTINGS_APPEND_LOG_ENABLE
+ *
+ * Define as 1 to write changes to the settings file as records appended to the end of the file (append-log), so that
+ * a single set, add or delete costs one write and one fsync instead of rewriting the whole file through a swap file.
+ *
+ * The file then starts with a header (which is not a settings record, so the whole key range stays available) and
+ * each change is a single record that adds a value, replaces all the values of a key or deletes values, so an
+ * interrupted write leaves either the old or the new settings behind. Replaced and deleted values are dropped when the
+ * file is compacted, which happens on init and whenever the stale bytes exceed both the live bytes and
+ * `OPENTHREAD_POSIX_CONFIG_SETTINGS_LOG_COMPACTION_THRESHOLD`. On deinit the file is rewritten in the plain format, and
+ * it is converted back to the append-log format on init. A build without this option cannot read a file left in the
+ * append-log format (e.g., after a crash) and discards the settings in it.
+ *
+ * When disabled, adding a setting (or setting a key without values) is still a single append to the file, while
+ * replacing or deleting settings rewrites the whole file through a swap file.
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_SETTINGS_APPEND_LOG_ENABLE
+#define OPENTHREAD_POSIX_CONFIG_SETTINGS_APPEND_LOG_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_SETTINGS_LOG_COMPACTION_THRESHOLD
+ *
+ * Specifies the minimum number of stale bytes in the settings file before it is compacted when
+ * `OPENTHREAD_POSIX_CONFIG_SETTINGS_APPEND_LOG_ENABLE` is enabled.
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_SETTINGS_LOG_COMPACTION_THRESHOLD
+#define OPENTHREAD_POSIX_CONFIG_SETTINGS_LOG_COMPACTION_THRESHOLD 4096
+#endif
+
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+ *
+ * Define as 1 to allow file descriptors to be registered persistently with the mainloop manager using epoll (Linux
+ * only).
+ *
+ * Registered file descriptors are watched through a single epoll file descriptor which is added to the mainloop
+ * context, so `select()` and the per-iteration fd set updates no longer scale with the number of registered file
+ * descriptors. Event sources using the existing `Update()`/`Process()` interface keep working unchanged.
+ *
+ * When enabled, the platform UDP sockets and the daemon sockets are registered with the mainloop manager.
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+#define OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE 0
+#endif
+
 /**
  * @def OPENTHREAD_POSIX_CONFIG_NETIF_LINK_LOCAL_ROUTE_METRIC
  *
@@ -164,6 +211,18 @@
 #define OPENTHREAD_POSIX_CONFIG_NETIF_PREFIX_ROUTE_METRIC 0
 #endif
 
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_NETIF_TX_BATCH_SIZE
+ *
+ * Specifies the maximum number of packets read from the Thread network interface (and sent through OpenThread) in one
+ * mainloop iteration.
+ *
+ * Define as 1 to read a single packet per mainloop iteration.
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_NETIF_TX_BATCH_SIZE
+#define OPENTHREAD_POSIX_CONFIG_NETIF_TX_BATCH_SIZE 8
+#endif
+
 /**
  * @def OPENTHREAD_POSIX_CONFIG_INSTALL_OMR_ROUTES_ENABLE
  *
@@ -215,33 +215,31 @@ void Radio::ProcessMaxPowerTable(const RadioUrl &aRadioUrl)
     maxPowerTableCopy = strdup(maxPowerTable);
     VerifyOrDie(maxPowerTableCopy != nullptr, OT_EXIT_FAILURE);
 
+    // Send the max power of all channels as one batch, errors are reported by `EndBatch()`.
+    mRadioSpinel.BeginBatch();
+
     for (str = strtok_r(maxPowerTableCopy, ",", &pSave); str != nullptr && channel <= ot::Radio::kChannelMax;
          str = strtok_r(nullptr, ",", &pSave))
     {
         power = static_cast<int8_t>(strtol(str, nullptr, 0));
-        error = mRadioSpinel.SetChannelMaxTransmitPower(channel, power);
-        VerifyOrDie((error == OT_ERROR_NONE) || (error == OT_ERROR_NOT_IMPLEMENTED), OT_EXIT_FAILURE);
-        if (error == OT_ERROR_NOT_IMPLEMENTED)
-        {
-            LogWarn("The RCP doesn't support setting the max transmit power");
-        }
-
+        IgnoreError(mRadioSpinel.SetChannelMaxTransmitPower(channel, power));
         ++channel;
     }
 
     // Use the last power if omitted.
     while (channel <= ot::Radio::kChannelMax)
     {
-        error = mRadioSpinel.SetChannelMaxTransmitPower(channel, power);
-        VerifyOrDie((error == OT_ERROR_NONE) || (error == OT_ERROR_NOT_IMPLEMENTED), OT_ERROR_FAILED);
-        if (error == OT_ERROR_NOT_IMPLEMENTED)
-        {
-            LogWarn("The RCP doesn't support setting the max transmit power");
-        }
-
+        IgnoreError(mRadioSpinel.SetChannelMaxTransmitPower(channel, power));
         ++channel;
     }
 
+    error = mRadioSpinel.EndBatch();
+    VerifyOrDie((error == OT_ERROR_NONE) || (error == OT_ERROR_NOT_IMPLEMENTED), OT_EXIT_FAILURE);
+    if (error == OT_ERROR_NOT_IMPLEMENTED)
+    {
+        LogWarn("The RCP doesn't support setting the max transmit power");
+    }
+
     VerifyOrDie(str == nullptr, OT_EXIT_INVALID_ARGUMENTS);
 
 exit:
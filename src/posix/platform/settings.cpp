@@ -415,6 +415,85 @@ int main()
         assert(otPlatSettingsGet(instance, 0, 0, nullptr, nullptr) == OT_ERROR_NOT_FOUND);
     }
     otPlatSettingsWipe(instance);
+
+    // verify records are preserved across re-initialization
+    assert(otPlatSettingsSet(instance, 0, data, sizeof(data)) == OT_ERROR_NONE);
+    assert(otPlatSettingsAdd(instance, 0, data, sizeof(data) / 2) == OT_ERROR_NONE);
+    assert(otPlatSettingsAdd(instance, 1, data, sizeof(data) / 3) == OT_ERROR_NONE);
+    assert(otPlatSettingsSet(instance, 1, data, sizeof(data) / 4) == OT_ERROR_NONE);
+    assert(otPlatSettingsDelete(instance, 0, 0) == OT_ERROR_NONE);
+    otPlatSettingsDeinit(instance);
+    otPlatSettingsInit(instance, nullptr, 0);
+    {
+        uint8_t  value[sizeof(data)];
+        uint16_t length = sizeof(value);
+
+        assert(otPlatSettingsGet(instance, 0, 0, value, &length) == OT_ERROR_NONE);
+        assert(length == sizeof(data) / 2);
+        assert(0 == memcmp(value, data, length));
+        assert(otPlatSettingsGet(instance, 0, 1, nullptr, nullptr) == OT_ERROR_NOT_FOUND);
+
+        length = sizeof(value);
+        assert(otPlatSettingsGet(instance, 1, 0, value, &length) == OT_ERROR_NONE);
+        assert(length == sizeof(data) / 4);
+        assert(0 == memcmp(value, data, length));
+        assert(otPlatSettingsGet(instance, 1, 1, nullptr, nullptr) == OT_ERROR_NOT_FOUND);
+    }
+    otPlatSettingsWipe(instance);
+
+    // verify records of interleaved keys keep their order and set replaces all of them
+    for (uint8_t i = 0; i < 10; i++)
+    {
+        assert(otPlatSettingsAdd(instance, 10 - i % 3, data, i + 1) == OT_ERROR_NONE);
+    }
+    {
+        uint16_t length;
+
+        for (uint8_t i = 0; i < 10; i++)
+        {
+            length = sizeof(data);
+            assert(otPlatSettingsGet(instance, 10 - i % 3, i / 3, nullptr, &length) == OT_ERROR_NONE);
+            assert(length == i + 1);
+        }
+
+        assert(otPlatSettingsSet(instance, 9, data, sizeof(data)) == OT_ERROR_NONE);
+        assert(otPlatSettingsGet(instance, 9, 1, nullptr, nullptr) == OT_ERROR_NOT_FOUND);
+        otPlatSettingsDeinit(instance);
+        otPlatSettingsInit(instance, nullptr, 0);
+
+        length = sizeof(data);
+        assert(otPlatSettingsGet(instance, 9, 0, nullptr, &length) == OT_ERROR_NONE);
+        assert(length == sizeof(data));
+        assert(otPlatSettingsGet(instance, 9, 1, nullptr, nullptr) == OT_ERROR_NOT_FOUND);
+        length = sizeof(data);
+        assert(otPlatSettingsGet(instance, 10, 3, nullptr, &length) == OT_ERROR_NONE);
+        assert(length == 10);
+        length = sizeof(data);
+        assert(otPlatSettingsGet(instance, 8, 2, nullptr, &length) == OT_ERROR_NONE);
+        assert(length == 9);
+    }
+    otPlatSettingsWipe(instance);
+
+    // verify the whole key range is available, including the largest keys
+    assert(otPlatSettingsSet(instance, 0xffff, data, sizeof(data)) == OT_ERROR_NONE);
+    assert(otPlatSettingsAdd(instance, 0xfffe, data, sizeof(data) / 2) == OT_ERROR_NONE);
+    assert(otPlatSettingsSet(instance, 0xffff, data, sizeof(data) / 3) == OT_ERROR_NONE);
+    assert(otPlatSettingsDelete(instance, 0xfffe, 0) == OT_ERROR_NONE);
+    assert(otPlatSettingsAdd(instance, 0xfffe, data, sizeof(data) / 4) == OT_ERROR_NONE);
+    otPlatSettingsDeinit(instance);
+    otPlatSettingsInit(instance, nullptr, 0);
+    {
+        uint16_t length = sizeof(data);
+
+        assert(otPlatSettingsGet(instance, 0xffff, 0, nullptr, &length) == OT_ERROR_NONE);
+        assert(length == sizeof(data) / 3);
+        assert(otPlatSettingsGet(instance, 0xffff, 1, nullptr, nullptr) == OT_ERROR_NOT_FOUND);
+        length = sizeof(data);
+        assert(otPlatSettingsGet(instance, 0xfffe, 0, nullptr, &length) == OT_ERROR_NONE);
+        assert(length == sizeof(data) / 4);
+        assert(otPlatSettingsGet(instance, 0xfffe, 1, nullptr, nullptr) == OT_ERROR_NOT_FOUND);
+    }
+    otPlatSettingsWipe(instance);
     otPlatSettingsDeinit(instance);
 
     return 0;
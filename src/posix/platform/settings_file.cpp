@@ -38,6 +38,7 @@
 #include <inttypes.h>
 #include <stddef.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <sys/stat.h>
 #include <unistd.h>
@@ -85,7 +86,7 @@ otError SettingsFile::Init(const char *aSettingsFileBaseName)
 {
     otError     error           = OT_ERROR_NONE;
     const char *directory       = GetSettingsPath();
-    off_t       lastValidOffset = 0;
+    size_t      lastValidOffset = 0;
 
     OT_ASSERT(strlen(directory) < kMaxFileBasePathNameSize);
     OT_ASSERT((aSettingsFileBaseName != nullptr) && strlen(aSettingsFileBaseName) < kMaxFileBaseNameSize);
@@ -109,41 +110,32 @@ otError SettingsFile::Init(const char *aSettingsFileBaseName)
 
     VerifyOrDie(mSettingsFd != -1, OT_EXIT_ERROR_ERRNO);
 
-    for (off_t size = lseek(mSettingsFd, 0, SEEK_END), offset = lseek(mSettingsFd, 0, SEEK_SET); offset < size;)
-    {
-        lastValidOffset = offset;
-
-        uint16_t key;
-        uint16_t length;
-        ssize_t  rval;
+    LoadImage();
+    error = ParseImage(lastValidOffset);
 
-        rval = read(mSettingsFd, &key, sizeof(key));
-        VerifyOrExit(rval == sizeof(key), error = OT_ERROR_PARSE);
-
-        rval = read(mSettingsFd, &length, sizeof(length));
-        VerifyOrExit(rval == sizeof(length), error = OT_ERROR_PARSE);
-
-        offset += sizeof(key) + sizeof(length) + length;
-        VerifyOrExit(offset == lseek(mSettingsFd, length, SEEK_CUR), error = OT_ERROR_PARSE);
-    }
-
-exit:
     if (error == OT_ERROR_PARSE)
     {
-        off_t fileSize = lseek(mSettingsFd, 0, SEEK_END);
-
         if (lastValidOffset > 0)
         {
-            otLogCritPlat("Settings file corrupt at offset %jd of %jd bytes, truncating to preserve %jd bytes of "
+            otLogCritPlat("Settings file corrupt at offset %zu of %zu bytes, truncating to preserve %zu bytes of "
                           "valid entries",
-                          (intmax_t)lastValidOffset, (intmax_t)fileSize, (intmax_t)lastValidOffset);
+                          lastValidOffset, mImageLength, lastValidOffset);
         }
         else
         {
-            otLogCritPlat("Settings file corrupt from start (%jd bytes), truncating entire file", (intmax_t)fileSize);
+            otLogCritPlat("Settings file corrupt from start (%zu bytes), truncating entire file", mImageLength);
         }
 
-        VerifyOrDie(ftruncate(mSettingsFd, lastValidOffset) == 0, OT_EXIT_ERROR_ERRNO);
+        VerifyOrDie(ftruncate(mSettingsFd, static_cast<off_t>(lastValidOffset)) == 0, OT_EXIT_ERROR_ERRNO);
+        mImageLength = lastValidOffset;
+    }
+
+    // Rewrite the file when it has stale records or when it is not in
+    // the format of the enabled mode (e.g., written by a build with a
+    // different `OPENTHREAD_POSIX_CONFIG_SETTINGS_APPEND_LOG_ENABLE`).
+    if ((mIsLog != OPENTHREAD_POSIX_CONFIG_SETTINGS_APPEND_LOG_ENABLE) || (GetStaleLength() > 0))
+    {
+        Compact(OPENTHREAD_POSIX_CONFIG_SETTINGS_APPEND_LOG_ENABLE);
     }
 
     return error;
@@ -152,206 +144,493 @@ exit:
 void SettingsFile::Deinit(void)
 {
     VerifyOrExit(mSettingsFd != -1);
+
+#if OPENTHREAD_POSIX_CONFIG_SETTINGS_APPEND_LOG_ENABLE
+    // Leave a plain file behind, so that builds which are not aware
+    // of the append-log format read the same settings.
+    Compact(false);
+#endif
+
     VerifyOrDie(close(mSettingsFd) == 0, OT_EXIT_ERROR_ERRNO);
     mSettingsFd = -1;
 
+    ClearCache();
+    free(mImage);
+    free(mRecords);
+    mImage           = nullptr;
+    mImageCapacity   = 0;
+    mRecords         = nullptr;
+    mRecordsCapacity = 0;
+
 exit:
     return;
 }
 
 otError SettingsFile::Get(uint16_t aKey, int aIndex, uint8_t *aValue, uint16_t *aValueLength)
 {
-    otError error = OT_ERROR_NOT_FOUND;
-    off_t   size;
-    off_t   offset;
+    otError       error = OT_ERROR_NONE;
+    const Record *record;
+
+    OT_ASSERT(mSettingsFd >= 0);
+
+    record = FindRecord(aKey, aIndex);
+    VerifyOrExit(record != nullptr, error = OT_ERROR_NOT_FOUND);
+
+    if (aValueLength)
+    {
+        if (aValue)
+        {
+            uint16_t readLength = (record->mLength <= *aValueLength ? record->mLength : *aValueLength);
+
+            memcpy(aValue, &mImage[record->mOffset], readLength);
+        }
+
+        *aValueLength = record->mLength;
+    }
+
+exit:
+    return error;
+}
+
+void SettingsFile::Set(uint16_t aKey, const uint8_t *aValue, uint16_t aValueLength)
+{
+    size_t appendOffset = mImageLength;
+    bool   replaced;
+
+    OT_ASSERT(mSettingsFd >= 0);
+
+    replaced = RemoveRecords(aKey, kRemoveAll);
+    AppendRecord(kRecordTypeSet, aKey, aValue, aValueLength);
+
+#if OPENTHREAD_POSIX_CONFIG_SETTINGS_APPEND_LOG_ENABLE
+    OT_UNUSED_VARIABLE(replaced);
+    AppendToFile(appendOffset);
+    CompactIfStale();
+#else
+    // Replacing values rewrites the file through the swap file, so
+    // that an interrupted `Set()` leaves either the old or the new
+    // value behind (but never both).
+    if (replaced)
+    {
+        Compact(false);
+    }
+    else
+    {
+        AppendToFile(appendOffset);
+    }
+#endif
+}
+
+void SettingsFile::Add(uint16_t aKey, const uint8_t *aValue, uint16_t aValueLength)
+{
+    size_t appendOffset = mImageLength;
 
     OT_ASSERT(mSettingsFd >= 0);
 
-    size   = lseek(mSettingsFd, 0, SEEK_END);
-    offset = lseek(mSettingsFd, 0, SEEK_SET);
-    VerifyOrExit(offset == 0 && size >= 0, error = OT_ERROR_PARSE);
+    AppendRecord(kRecordTypeAdd, aKey, aValue, aValueLength);
+    AppendToFile(appendOffset);
+}
 
-    while (offset < size)
+otError SettingsFile::Delete(uint16_t aKey, int aIndex)
+{
+    otError error = OT_ERROR_NONE;
+
+    OT_ASSERT(mSettingsFd >= 0);
+
+    VerifyOrExit(RemoveRecords(aKey, aIndex), error = OT_ERROR_NOT_FOUND);
+
+#if OPENTHREAD_POSIX_CONFIG_SETTINGS_APPEND_LOG_ENABLE
     {
+        size_t  appendOffset = mImageLength;
+        int16_t index        = static_cast<int16_t>(aIndex);
+
+        AppendRecordHeader(kRecordTypeDelete, aKey, sizeof(index));
+        AppendToImage(&index, sizeof(index));
+        AppendToFile(appendOffset);
+        CompactIfStale();
+    }
+#else
+    Compact(false);
+#endif
+
+exit:
+    return error;
+}
+
+void SettingsFile::Wipe(void)
+{
+    VerifyOrDie(0 == ftruncate(mSettingsFd, 0), OT_EXIT_ERROR_ERRNO);
+    ClearCache();
+
+#if OPENTHREAD_POSIX_CONFIG_SETTINGS_APPEND_LOG_ENABLE
+    mIsLog = true;
+    AppendLogHeader();
+    AppendToFile(0);
+#endif
+}
+
+void SettingsFile::LoadImage(void)
+{
+    off_t  size = lseek(mSettingsFd, 0, SEEK_END);
+    size_t length;
+
+    VerifyOrDie(size >= 0, OT_EXIT_ERROR_ERRNO);
+
+    ClearCache();
+    ReserveImage(static_cast<size_t>(size));
+
+    for (length = 0; length < static_cast<size_t>(size);)
+    {
+        ssize_t rval =
+            pread(mSettingsFd, &mImage[length], static_cast<size_t>(size) - length, static_cast<off_t>(length));
+
+        VerifyOrDie(rval > 0, OT_EXIT_ERROR_ERRNO);
+        length += static_cast<size_t>(rval);
+    }
+
+    mImageLength = length;
+}
+
+otError SettingsFile::ParseImage(size_t &aValidLength)
+{
+    otError  error  = OT_ERROR_NONE;
+    size_t   offset = 0;
+    uint16_t header[kLogHeaderSize / sizeof(uint16_t)];
+
+    aValidLength = 0;
+    mIsLog       = false;
+
+    if (mImageLength >= sizeof(header))
+    {
+        memcpy(header, mImage, sizeof(header));
+
+        if ((header[0] == kLogMagic) && (header[1] == kLogMarker))
+        {
+            VerifyOrExit(header[2] == kLogVersion, error = OT_ERROR_PARSE);
+            mIsLog = true;
+            offset = kLogHeaderSize;
+        }
+    }
+
+    while (offset < mImageLength)
+    {
+        uint8_t  type = kRecordTypeAdd;
         uint16_t key;
         uint16_t length;
-        ssize_t  rval;
 
-        rval = read(mSettingsFd, &key, sizeof(key));
-        VerifyOrExit(rval == sizeof(key), error = OT_ERROR_PARSE);
+        aValidLength = offset;
 
-        rval = read(mSettingsFd, &length, sizeof(length));
-        VerifyOrExit(rval == sizeof(length), error = OT_ERROR_PARSE);
+        VerifyOrExit(mImageLength - offset >= (mIsLog ? kLogRecordHeaderSize : kRecordHeaderSize),
+                     error = OT_ERROR_PARSE);
 
-        if (key == aKey)
+        if (mIsLog)
         {
-            if (aIndex == 0)
-            {
-                error = OT_ERROR_NONE;
-
-                if (aValueLength)
-                {
-                    if (aValue)
-                    {
-                        uint16_t readLength = (length <= *aValueLength ? length : *aValueLength);
-
-                        VerifyOrExit(read(mSettingsFd, aValue, readLength) == readLength, error = OT_ERROR_PARSE);
-                    }
-
-                    *aValueLength = length;
-                }
-
-                break;
-            }
-            else
-            {
-                --aIndex;
-            }
+            type = mImage[offset];
+            offset += sizeof(type);
         }
 
-        offset += sizeof(key) + sizeof(length) + length;
-        VerifyOrExit(offset == lseek(mSettingsFd, length, SEEK_CUR), error = OT_ERROR_PARSE);
+        memcpy(&key, &mImage[offset], sizeof(key));
+        memcpy(&length, &mImage[offset + sizeof(key)], sizeof(length));
+        offset += kRecordHeaderSize;
+
+        VerifyOrExit(mImageLength - offset >= length, error = OT_ERROR_PARSE);
+        SuccessOrExit(error = ParseRecord(static_cast<RecordType>(type), key, length, offset));
+        offset += length;
     }
 
+    aValidLength = offset;
+
 exit:
     return error;
 }
 
-void SettingsFile::Set(uint16_t aKey, const uint8_t *aValue, uint16_t aValueLength)
+otError SettingsFile::ParseRecord(RecordType aType, uint16_t aKey, uint16_t aLength, size_t aOffset)
 {
-    int swapFd = -1;
+    otError error = OT_ERROR_NONE;
+    int16_t index;
 
-    OT_ASSERT(mSettingsFd >= 0);
-
-    switch (Delete(aKey, -1, &swapFd))
+    switch (aType)
     {
-    case OT_ERROR_NONE:
-    case OT_ERROR_NOT_FOUND:
+    case kRecordTypeSet:
+        IgnoreReturnValue(RemoveRecords(aKey, kRemoveAll));
+        OT_FALL_THROUGH;
+
+    case kRecordTypeAdd:
+        AddRecord(aKey, aLength, aOffset);
+        break;
+
+    case kRecordTypeDelete:
+        VerifyOrExit(aLength == sizeof(index), error = OT_ERROR_PARSE);
+        memcpy(&index, &mImage[aOffset], sizeof(index));
+        IgnoreReturnValue(RemoveRecords(aKey, index));
         break;
 
     default:
-        OT_ASSERT(false);
+        error = OT_ERROR_PARSE;
         break;
     }
 
-    VerifyOrDie(write(swapFd, &aKey, sizeof(aKey)) == sizeof(aKey) &&
-                    write(swapFd, &aValueLength, sizeof(aValueLength)) == sizeof(aValueLength) &&
-                    write(swapFd, aValue, aValueLength) == aValueLength,
-                OT_EXIT_FAILURE);
-
-    SwapPersist(swapFd);
+exit:
+    return error;
 }
 
-void SettingsFile::Add(uint16_t aKey, const uint8_t *aValue, uint16_t aValueLength)
+void SettingsFile::ReserveImage(size_t aLength)
 {
-    off_t size;
-    int   swapFd;
+    VerifyOrExit(aLength > mImageCapacity);
 
-    OT_ASSERT(mSettingsFd >= 0);
+    mImageCapacity = (aLength > 2 * mImageCapacity) ? aLength : 2 * mImageCapacity;
+    mImage         = static_cast<uint8_t *>(realloc(mImage, mImageCapacity));
+    VerifyOrDie(mImage != nullptr, OT_EXIT_FAILURE);
 
-    size   = lseek(mSettingsFd, 0, SEEK_END);
-    swapFd = SwapOpen();
+exit:
+    return;
+}
+
+void SettingsFile::AppendToImage(const void *aData, size_t aLength)
+{
+    ReserveImage(mImageLength + aLength);
+    memcpy(&mImage[mImageLength], aData, aLength);
+    mImageLength += aLength;
+}
 
-    if (size > 0)
+void SettingsFile::AppendRecordHeader(RecordType aType, uint16_t aKey, uint16_t aLength)
+{
+    // The type is only part of the records in the append-log format.
+
+    if (mIsLog)
     {
-        VerifyOrDie(0 == lseek(mSettingsFd, 0, SEEK_SET), OT_EXIT_ERROR_ERRNO);
-        SwapWrite(swapFd, static_cast<uint16_t>(size));
+        AppendToImage(&aType, sizeof(aType));
     }
 
-    VerifyOrDie(write(swapFd, &aKey, sizeof(aKey)) == sizeof(aKey) &&
-                    write(swapFd, &aValueLength, sizeof(aValueLength)) == sizeof(aValueLength) &&
-                    write(swapFd, aValue, aValueLength) == aValueLength,
-                OT_EXIT_FAILURE);
+    AppendToImage(&aKey, sizeof(aKey));
+    AppendToImage(&aLength, sizeof(aLength));
+}
 
-    SwapPersist(swapFd);
+void SettingsFile::AppendRecord(RecordType aType, uint16_t aKey, const uint8_t *aValue, uint16_t aValueLength)
+{
+    AppendRecordHeader(aType, aKey, aValueLength);
+    AddRecord(aKey, aValueLength, mImageLength);
+    AppendToImage(aValue, aValueLength);
 }
 
-otError SettingsFile::Delete(uint16_t aKey, int aIndex) { return Delete(aKey, aIndex, nullptr); }
+size_t SettingsFile::FindFirstRecord(uint16_t aKey) const
+{
+    // Returns the index in `mRecords` of the first record with a key
+    // not less than `aKey` (binary search over the sorted records).
+
+    size_t low  = 0;
+    size_t high = mNumRecords;
+
+    while (low < high)
+    {
+        size_t mid = low + (high - low) / 2;
+
+        if (mRecords[mid].mKey < aKey)
+        {
+            low = mid + 1;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+
+    return low;
+}
 
-otError SettingsFile::Delete(uint16_t aKey, int aIndex, int *aSwapFd)
+const SettingsFile::Record *SettingsFile::FindRecord(uint16_t aKey, int aIndex) const
 {
-    otError error = OT_ERROR_NOT_FOUND;
-    off_t   size;
-    off_t   offset;
-    int     swapFd;
+    const Record *match = nullptr;
+    size_t        i;
 
-    OT_ASSERT(mSettingsFd >= 0);
+    VerifyOrExit(aIndex >= 0);
 
-    size   = lseek(mSettingsFd, 0, SEEK_END);
-    offset = lseek(mSettingsFd, 0, SEEK_SET);
-    swapFd = SwapOpen();
+    i = FindFirstRecord(aKey) + static_cast<size_t>(aIndex);
+    VerifyOrExit((i < mNumRecords) && (mRecords[i].mKey == aKey));
+    match = &mRecords[i];
 
-    OT_ASSERT(swapFd != -1);
-    OT_ASSERT(offset == 0);
-    VerifyOrExit(offset == 0 && size >= 0, error = OT_ERROR_FAILED);
+exit:
+    return match;
+}
+
+void SettingsFile::AddRecord(uint16_t aKey, uint16_t aLength, size_t aOffset)
+{
+    // Inserts the record after all the existing ones with `aKey` to
+    // keep `mRecords` sorted by key and in file order within a key.
 
-    while (offset < size)
+    size_t i = FindFirstRecord(aKey);
+
+    while ((i < mNumRecords) && (mRecords[i].mKey == aKey))
     {
-        uint16_t key;
-        uint16_t length;
-        ssize_t  rval;
+        i++;
+    }
+
+    if (mNumRecords == mRecordsCapacity)
+    {
+        mRecordsCapacity = (mRecordsCapacity == 0) ? 16 : 2 * mRecordsCapacity;
+        mRecords         = static_cast<Record *>(realloc(mRecords, mRecordsCapacity * sizeof(Record)));
+        VerifyOrDie(mRecords != nullptr, OT_EXIT_FAILURE);
+    }
 
-        rval = read(mSettingsFd, &key, sizeof(key));
-        VerifyOrExit(rval == sizeof(key), error = OT_ERROR_FAILED);
+    memmove(&mRecords[i + 1], &mRecords[i], (mNumRecords - i) * sizeof(Record));
+    mRecords[i].mKey    = aKey;
+    mRecords[i].mLength = aLength;
+    mRecords[i].mOffset = aOffset;
+    mNumRecords++;
 
-        rval = read(mSettingsFd, &length, sizeof(length));
-        VerifyOrExit(rval == sizeof(length), error = OT_ERROR_FAILED);
+    mLiveLength += aLength;
+}
+
+bool SettingsFile::RemoveRecords(uint16_t aKey, int aIndex)
+{
+    // Removes the record at `aIndex` among the ones with `aKey`, or
+    // all of them if `aIndex` is `kRemoveAll`. Returns whether any
+    // record was removed.
 
-        offset += sizeof(key) + sizeof(length) + length;
+    size_t start = FindFirstRecord(aKey);
+    size_t end   = start;
 
-        if (aKey == key)
+    while ((end < mNumRecords) && (mRecords[end].mKey == aKey))
+    {
+        end++;
+    }
+
+    if (aIndex != kRemoveAll)
+    {
+        if ((aIndex >= 0) && (static_cast<size_t>(aIndex) < end - start))
         {
-            if (aIndex == 0)
-            {
-                VerifyOrExit(offset == lseek(mSettingsFd, length, SEEK_CUR), error = OT_ERROR_FAILED);
-                SwapWrite(swapFd, static_cast<uint16_t>(size - offset));
-                error = OT_ERROR_NONE;
-                break;
-            }
-            else if (aIndex == -1)
-            {
-                VerifyOrExit(offset == lseek(mSettingsFd, length, SEEK_CUR), error = OT_ERROR_FAILED);
-                error = OT_ERROR_NONE;
-                continue;
-            }
-            else
-            {
-                --aIndex;
-            }
+            start += static_cast<size_t>(aIndex);
+            end = start + 1;
         }
+        else
+        {
+            end = start;
+        }
+    }
+
+    for (size_t i = start; i < end; i++)
+    {
+        mLiveLength -= mRecords[i].mLength;
+    }
+
+    memmove(&mRecords[start], &mRecords[end], (mNumRecords - end) * sizeof(Record));
+    mNumRecords -= end - start;
 
-        rval = write(swapFd, &key, sizeof(key));
-        VerifyOrExit(rval == sizeof(key), error = OT_ERROR_FAILED);
+    return end > start;
+}
+
+size_t SettingsFile::GetUsedLength(void) const
+{
+    // Returns the length of a compacted image of the live records.
 
-        rval = write(swapFd, &length, sizeof(length));
-        VerifyOrExit(rval == sizeof(length), error = OT_ERROR_FAILED);
+    size_t usedLength = mLiveLength;
 
-        SwapWrite(swapFd, length);
+    if (mIsLog)
+    {
+        usedLength += kLogHeaderSize + mNumRecords * kLogRecordHeaderSize;
+    }
+    else
+    {
+        usedLength += mNumRecords * kRecordHeaderSize;
     }
 
-exit:
-    if (aSwapFd != nullptr)
+    return usedLength;
+}
+
+size_t SettingsFile::GetStaleLength(void) const
+{
+    size_t usedLength = GetUsedLength();
+
+    return (mImageLength > usedLength) ? mImageLength - usedLength : 0;
+}
+
+void SettingsFile::ClearCache(void)
+{
+    mImageLength = 0;
+    mLiveLength  = 0;
+    mNumRecords  = 0;
+    mIsLog       = false;
+}
+
+void SettingsFile::AppendLogHeader(void)
+{
+    uint16_t header[] = {kLogMagic, kLogMarker, kLogVersion};
+
+    AppendToImage(header, sizeof(header));
+}
+
+void SettingsFile::Compact(bool aIsLog)
+{
+    // Writes the live records into a new image in the given format
+    // and persists it as the new settings file through the swap file.
+
+    uint8_t *oldImage = mImage;
+    int      swapFd;
+
+    mImage         = nullptr;
+    mImageLength   = 0;
+    mImageCapacity = 0;
+    mIsLog         = aIsLog;
+    ReserveImage(GetUsedLength());
+
+    if (mIsLog)
     {
-        *aSwapFd = swapFd;
+        AppendLogHeader();
     }
-    else if (error == OT_ERROR_NONE)
+
+    for (size_t i = 0; i < mNumRecords; i++)
     {
-        SwapPersist(swapFd);
+        Record &record = mRecords[i];
+
+        AppendRecordHeader(kRecordTypeAdd, record.mKey, record.mLength);
+        AppendToImage(&oldImage[record.mOffset], record.mLength);
+        record.mOffset = mImageLength - record.mLength;
     }
-    else if (error == OT_ERROR_NOT_FOUND)
+
+    free(oldImage);
+
+    swapFd = SwapOpen();
+
+    for (size_t written = 0; written < mImageLength;)
     {
-        SwapDiscard(swapFd);
+        ssize_t rval = write(swapFd, &mImage[written], mImageLength - written);
+
+        VerifyOrDie(rval > 0, OT_EXIT_ERROR_ERRNO);
+        written += static_cast<size_t>(rval);
     }
-    else if (error == OT_ERROR_FAILED)
+
+    SwapPersist(swapFd);
+}
+
+void SettingsFile::AppendToFile(size_t aOffset)
+{
+    // Persists the bytes appended to the cached image starting at
+    // `aOffset` with a single write and fsync.
+
+    while (aOffset < mImageLength)
     {
-        SwapDiscard(swapFd);
-        DieNow(error);
+        ssize_t rval = pwrite(mSettingsFd, &mImage[aOffset], mImageLength - aOffset, static_cast<off_t>(aOffset));
+
+        VerifyOrDie(rval > 0, OT_EXIT_ERROR_ERRNO);
+        aOffset += static_cast<size_t>(rval);
     }
 
-    return error;
+    VerifyOrDie(0 == fsync(mSettingsFd), OT_EXIT_ERROR_ERRNO);
 }
 
-void SettingsFile::Wipe(void) { VerifyOrDie(0 == ftruncate(mSettingsFd, 0), OT_EXIT_ERROR_ERRNO); }
+#if OPENTHREAD_POSIX_CONFIG_SETTINGS_APPEND_LOG_ENABLE
+
+void SettingsFile::CompactIfStale(void)
+{
+    size_t staleLength = GetStaleLength();
+
+    if ((staleLength > GetUsedLength()) && (staleLength >= OPENTHREAD_POSIX_CONFIG_SETTINGS_LOG_COMPACTION_THRESHOLD))
+    {
+        Compact(true);
+    }
+}
+
+#endif // OPENTHREAD_POSIX_CONFIG_SETTINGS_APPEND_LOG_ENABLE
 
 void SettingsFile::GetSettingsFilePath(char aFileName[kMaxFilePathSize], bool aSwap)
 {
@@ -374,25 +653,6 @@ int SettingsFile::SwapOpen(void)
     return fd;
 }
 
-void SettingsFile::SwapWrite(int aFd, uint16_t aLength)
-{
-    const size_t kBlockSize = 512;
-    uint8_t      buffer[kBlockSize];
-
-    while (aLength > 0)
-    {
-        uint16_t count = aLength >= sizeof(buffer) ? sizeof(buffer) : aLength;
-        ssize_t  rval  = read(mSettingsFd, buffer, count);
-
-        VerifyOrDie(rval > 0, OT_EXIT_FAILURE);
-        count = static_cast<uint16_t>(rval);
-        rval  = write(aFd, buffer, count);
-        OT_ASSERT(rval == count);
-        VerifyOrDie(rval == count, OT_EXIT_FAILURE);
-        aLength -= count;
-    }
-}
-
 void SettingsFile::SwapPersist(int aFd)
 {
     char swapFile[kMaxFilePathSize];
@@ -422,14 +682,5 @@ void SettingsFile::SwapPersist(int aFd)
     mSettingsFd = aFd;
 }
 
-void SettingsFile::SwapDiscard(int aFd)
-{
-    char swapFileName[kMaxFilePathSize];
-
-    VerifyOrDie(0 == close(aFd), OT_EXIT_ERROR_ERRNO);
-    GetSettingsFilePath(swapFileName, true);
-    VerifyOrDie(0 == unlink(swapFileName), OT_EXIT_ERROR_ERRNO);
-}
-
 } // namespace Posix
 } // namespace ot
@@ -72,6 +72,14 @@ public:
 
     SettingsFile(void)
         : mSettingsFd(-1)
+        , mImage(nullptr)
+        , mImageLength(0)
+        , mImageCapacity(0)
+        , mLiveLength(0)
+        , mIsLog(false)
+        , mRecords(nullptr)
+        , mNumRecords(0)
+        , mRecordsCapacity(0)
     {
     }
 
@@ -145,17 +153,83 @@ private:
     static constexpr size_t kMaxFileBasePathNameSize = kMaxFileFullPathNameSize - kSlashLength - kMaxFileBaseNameSize;
     static constexpr size_t kMaxFilePathSize         = PATH_MAX;
 
-    otError Delete(uint16_t aKey, int aIndex, int *aSwapFd);
-    void    GetSettingsFilePath(char aFileName[kMaxFilePathSize], bool aSwap);
-    int     SwapOpen(void);
-    void    SwapWrite(int aFd, uint16_t aLength);
-    void    SwapPersist(int aFd);
-    void    SwapDiscard(int aFd);
+    // The whole settings file is cached in `mImage` and `mRecords`
+    // indexes the live records sorted by key (in file order among
+    // records with the same key), so that reads are served from
+    // memory without any file access.
+    //
+    // A plain file is a sequence of `{key, length, value}` records.
+    // An append-log file starts with a `kLogHeaderSize` header (which
+    // is not a record, so no settings key is reserved) followed by
+    // `{type, key, length, value}` records, where the type tells how
+    // the record changes the settings: add a value, replace all the
+    // values of the key, or delete the value(s) at an index (given as
+    // the `int16_t` value of the record). A change is thus always a
+    // single record, so an interrupted write leaves either the old or
+    // the new settings behind once the partial record is truncated.
+    //
+    // A parser not aware of the append-log format reads the header as
+    // a record with length `kLogMarker`, and thus rejects a log file
+    // (shorter than 64 KiB) as corrupt rather than misreading it.
+
+    enum RecordType : uint8_t
+    {
+        kRecordTypeAdd    = 1, // Adds a value for the key.
+        kRecordTypeSet    = 2, // Replaces all values of the key.
+        kRecordTypeDelete = 3, // Deletes the value(s) of the key at the `int16_t` index in the record value.
+    };
+
+    static constexpr uint16_t kLogMagic            = 0x544f; // "OT" in little-endian.
+    static constexpr uint16_t kLogMarker           = 0xffff; // Read as the first record length by plain parsers.
+    static constexpr uint16_t kLogVersion          = 1;
+    static constexpr size_t   kLogHeaderSize       = 3 * sizeof(uint16_t);                // Magic, marker and version.
+    static constexpr size_t   kRecordHeaderSize    = sizeof(uint16_t) + sizeof(uint16_t); // Key and length.
+    static constexpr size_t   kLogRecordHeaderSize = sizeof(uint8_t) + kRecordHeaderSize; // Type, key and length.
+    static constexpr int      kRemoveAll           = -1;                                  // Removes all of a key.
+
+    struct Record
+    {
+        uint16_t mKey;
+        uint16_t mLength;
+        size_t   mOffset; // Offset of the value in `mImage`.
+    };
+
+    void          LoadImage(void);
+    otError       ParseImage(size_t &aValidLength);
+    otError       ParseRecord(RecordType aType, uint16_t aKey, uint16_t aLength, size_t aOffset);
+    void          ReserveImage(size_t aLength);
+    void          AppendToImage(const void *aData, size_t aLength);
+    void          AppendRecordHeader(RecordType aType, uint16_t aKey, uint16_t aLength);
+    void          AppendRecord(RecordType aType, uint16_t aKey, const uint8_t *aValue, uint16_t aValueLength);
+    size_t        FindFirstRecord(uint16_t aKey) const;
+    const Record *FindRecord(uint16_t aKey, int aIndex) const;
+    void          AddRecord(uint16_t aKey, uint16_t aLength, size_t aOffset);
+    bool          RemoveRecords(uint16_t aKey, int aIndex);
+    size_t        GetUsedLength(void) const;
+    size_t        GetStaleLength(void) const;
+    void          ClearCache(void);
+    void          AppendLogHeader(void);
+    void          Compact(bool aIsLog);
+    void          AppendToFile(size_t aOffset);
+#if OPENTHREAD_POSIX_CONFIG_SETTINGS_APPEND_LOG_ENABLE
+    void CompactIfStale(void);
+#endif
+    void GetSettingsFilePath(char aFileName[kMaxFilePathSize], bool aSwap);
+    int  SwapOpen(void);
+    void SwapPersist(int aFd);
 
     static char sSettingsPath[kMaxFileBasePathNameSize];
     static char sSettingsFileName[kMaxFileBaseNameSize];
     char        mSettingsFileFullPathName[kMaxFileFullPathNameSize];
     int         mSettingsFd;
+    uint8_t    *mImage;
+    size_t      mImageLength;
+    size_t      mImageCapacity;
+    size_t      mLiveLength; // Total length of the values of the live records.
+    bool        mIsLog;      // Whether `mImage` is in the append-log format.
+    Record     *mRecords;
+    size_t      mNumRecords;
+    size_t      mRecordsCapacity;
 };
 
 } // namespace Posix
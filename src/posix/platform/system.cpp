@@ -381,6 +381,9 @@ void otSysDeinit(void)
     {
         platformDeinitNcpMode();
     }
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+    ot::Posix::Mainloop::Manager::Get().Deinit();
+#endif
 }
 
 #if OPENTHREAD_POSIX_VIRTUAL_TIME
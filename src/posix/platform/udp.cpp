@@ -239,6 +239,15 @@ otError otPlatUdpSocket(otUdpSocket *aUdpSocket)
     fd = ot::Posix::SocketWithCloseExec(AF_INET6, SOCK_DGRAM, IPPROTO_UDP, ot::Posix::kSocketNonBlock);
     VerifyOrExit(fd >= 0, error = OT_ERROR_FAILED);
 
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+    if (ot::Posix::Mainloop::Manager::Get().RegisterFd(fd, ot::Posix::Mainloop::FdHandler::kEventReadable,
+                                                       ot::Posix::Udp::Get(), aUdpSocket) != OT_ERROR_NONE)
+    {
+        close(fd);
+        ExitNow(error = OT_ERROR_FAILED);
+    }
+#endif
+
     aUdpSocket->mHandle = FdToHandle(fd);
 
 exit:
@@ -255,6 +264,9 @@ otError otPlatUdpClose(otUdpSocket *aUdpSocket)
     VerifyOrExit(aUdpSocket->mHandle != nullptr);
 
     fd = FdFromHandle(aUdpSocket->mHandle);
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+    ot::Posix::Mainloop::Manager::Get().UnregisterFd(fd);
+#endif
     VerifyOrExit(0 == close(fd), error = OT_ERROR_FAILED);
 
     aUdpSocket->mHandle = nullptr;
@@ -571,6 +583,13 @@ const char Udp::kLogModuleName[] = "Udp";
 
 void Udp::Update(Mainloop::Context &aContext)
 {
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+    // Platform UDP sockets are registered with the mainloop manager
+    // when they are created. Start a new iteration of processing one
+    // socket at a time.
+    OT_UNUSED_VARIABLE(aContext);
+    mReceived = false;
+#else
     VerifyOrExit(gNetifIndex != 0);
 
     for (otUdpSocket *socket = otUdpGetSockets(gInstance); socket != nullptr; socket = socket->mNext)
@@ -588,6 +607,7 @@ void Udp::Update(Mainloop::Context &aContext)
 
 exit:
     return;
+#endif
 }
 
 void Udp::Init(const char *aIfName)
@@ -627,48 +647,71 @@ Udp &Udp::Get(void)
 
 void Udp::Process(const Mainloop::Context &aContext)
 {
-    otMessageSettings msgSettings = {false, OT_MESSAGE_PRIORITY_NORMAL};
-
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+    OT_UNUSED_VARIABLE(aContext);
+#else
     for (otUdpSocket *socket = otUdpGetSockets(gInstance); socket != nullptr; socket = socket->mNext)
     {
         int fd = FdFromHandle(socket->mHandle);
 
-        if (fd > 0 && Mainloop::IsFdReadable(fd, aContext))
+        if (fd > 0 && Mainloop::IsFdReadable(fd, aContext) && Receive(*socket) == OT_ERROR_NONE)
         {
-            otMessageInfo messageInfo;
-            otMessage    *message = nullptr;
-            uint8_t       payload[kMaxUdpSize];
-            uint16_t      length = sizeof(payload);
+            // only process one socket a time
+            break;
+        }
+    }
+#endif
+}
 
-            memset(&messageInfo, 0, sizeof(messageInfo));
-            messageInfo.mSockPort = socket->mSockName.mPort;
+void Udp::HandleFdEvents(int aFd, uint32_t aEvents, void *aContext)
+{
+    otUdpSocket *socket = static_cast<otUdpSocket *>(aContext);
 
-            if (OT_ERROR_NONE != receivePacket(fd, payload, length, messageInfo))
-            {
-                continue;
-            }
+    OT_UNUSED_VARIABLE(aFd);
 
-            message = otUdpNewMessage(gInstance, &msgSettings);
+    VerifyOrExit(gNetifIndex != 0);
+    VerifyOrExit(aEvents & kEventReadable);
 
-            if (message == nullptr)
-            {
-                continue;
-            }
+    // Only process one socket a time, same as `Process()`. The other
+    // ready sockets stay readable and are processed in later
+    // iterations.
+    VerifyOrExit(!mReceived);
+    assert(socket->mHandle == FdToHandle(aFd));
 
-            if (otMessageAppend(message, payload, length) != OT_ERROR_NONE)
-            {
-                otMessageFree(message);
-                continue;
-            }
+    mReceived = (Receive(*socket) == OT_ERROR_NONE);
 
-            socket->mHandler(socket->mContext, message, &messageInfo);
-            otMessageFree(message);
-            // only process one socket a time
-            break;
-        }
+exit:
+    return;
+}
+
+otError Udp::Receive(otUdpSocket &aSocket)
+{
+    otError           error       = OT_ERROR_NONE;
+    otMessageSettings msgSettings = {false, OT_MESSAGE_PRIORITY_NORMAL};
+    otMessageInfo     messageInfo;
+    otMessage        *message = nullptr;
+    uint8_t           payload[kMaxUdpSize];
+    uint16_t          length = sizeof(payload);
+
+    memset(&messageInfo, 0, sizeof(messageInfo));
+    messageInfo.mSockPort = aSocket.mSockName.mPort;
+
+    SuccessOrExit(error = receivePacket(FdFromHandle(aSocket.mHandle), payload, length, messageInfo));
+
+    message = otUdpNewMessage(gInstance, &msgSettings);
+    VerifyOrExit(message != nullptr, error = OT_ERROR_NO_BUFS);
+
+    SuccessOrExit(error = otMessageAppend(message, payload, length));
+
+    aSocket.mHandler(aSocket.mContext, message, &messageInfo);
+
+exit:
+    if (message != nullptr)
+    {
+        otMessageFree(message);
     }
 
-    return;
+    return error;
 }
 
 } // namespace Posix
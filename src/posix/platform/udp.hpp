@@ -28,6 +28,8 @@
 #ifndef OT_POSIX_PLATFORM_UDP_HPP_
 #define OT_POSIX_PLATFORM_UDP_HPP_
 
+#include <openthread/udp.h>
+
 #include "core/common/non_copyable.hpp"
 
 #include "logger.hpp"
@@ -36,7 +38,7 @@
 namespace ot {
 namespace Posix {
 
-class Udp : public Mainloop::Source, public Logger<Udp>, private NonCopyable
+class Udp : public Mainloop::Source, public Mainloop::FdHandler, public Logger<Udp>, private NonCopyable
 {
 public:
     static const char kLogModuleName[];
@@ -49,6 +51,12 @@ public:
     void Deinit(void);
     void Update(Mainloop::Context &aContext) override;
     void Process(const Mainloop::Context &aContext) override;
+    void HandleFdEvents(int aFd, uint32_t aEvents, void *aContext) override;
+
+private:
+    static otError Receive(otUdpSocket &aSocket);
+
+    bool mReceived = false; // Whether a registered socket was processed in the current mainloop iteration.
 };
 
 } // namespace Posix
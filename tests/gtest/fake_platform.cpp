@@ -438,6 +438,11 @@ void otPlatRadioClearSrcMatchExtEntries(otInstance *) { FakePlatform::CurrentPla
 
 otError otPlatRadioEnergyScan(otInstance *, uint8_t, uint16_t) { return OT_ERROR_NOT_IMPLEMENTED; }
 
+otError otPlatRadioSetChannelMaxTransmitPower(otInstance *, uint8_t aChannel, int8_t aMaxPower)
+{
+    return FakePlatform::CurrentPlatform().SetChannelMaxTransmitPower(aChannel, aMaxPower);
+}
+
 otError otPlatRadioSetTransmitPower(otInstance *, int8_t) { return OT_ERROR_NOT_IMPLEMENTED; }
 
 int8_t otPlatRadioGetReceiveSensitivity(otInstance *) { return -100; }
@@ -127,6 +127,8 @@ public:
     virtual void   SrcMatchClearExtEntries(void) { mSrcMatchExtAddrs.clear(); }
     virtual size_t SrcMatchCountExtEntries(void) const { return mSrcMatchExtAddrs.size(); }
 
+    virtual otError SetChannelMaxTransmitPower(uint8_t, int8_t) { return OT_ERROR_NOT_IMPLEMENTED; }
+
 protected:
     void ProcessSchedules(uint64_t &aTimeout);
 
@@ -520,3 +520,72 @@ TEST(RadioSpinelSrcMatch, shouldNotDuplicateSrcMatchEntriesOnRestoreProperties)
     ASSERT_EQ(platform.SrcMatchHasExtEntry(kTestExtAddrReversed), 1);
 }
 #endif // OPENTHREAD_SPINEL_CONFIG_RCP_RESTORATION_MAX_COUNT > 0
+
+TEST(RadioSpinelBatch, shouldApplyAllBatchedRequests)
+{
+    constexpr uint16_t      kNumEntries = 10;
+    FakeCoprocessorPlatform platform;
+
+    ASSERT_EQ(platform.mRadioSpinel.Enable(FakePlatform::CurrentInstance()), kErrorNone);
+
+    platform.mRadioSpinel.BeginBatch();
+
+    for (uint16_t i = 0; i < kNumEntries; i++)
+    {
+        ASSERT_EQ(platform.mRadioSpinel.AddSrcMatchShortEntry(0x1000 + i), kErrorNone);
+    }
+
+    ASSERT_EQ(platform.mRadioSpinel.EnableSrcMatch(true), kErrorNone);
+    ASSERT_EQ(platform.mRadioSpinel.EndBatch(), kErrorNone);
+
+    ASSERT_TRUE(platform.SrcMatchIsEnabled());
+    ASSERT_EQ(platform.SrcMatchCountShortEntries(), kNumEntries);
+
+    for (uint16_t i = 0; i < kNumEntries; i++)
+    {
+        ASSERT_EQ(platform.SrcMatchHasShortEntry(0x1000 + i), 1);
+    }
+
+    {
+        const otRadioSpinelMetrics &metrics = platform.mRadioSpinel.GetRadioSpinelMetrics();
+
+        EXPECT_EQ(metrics.mSpinelBatchCount, 1u);
+        EXPECT_EQ(metrics.mSpinelBatchRequestCount, kNumEntries + 1u);
+        EXPECT_GT(metrics.mSpinelRoundTripsSaved, 0u);
+    }
+}
+
+class FakeMaxPowerCoprocessorPlatform : public FakeCoprocessorPlatform
+{
+public:
+    otError SetChannelMaxTransmitPower(uint8_t, int8_t) override { return kErrorNone; }
+};
+
+TEST(RadioSpinelBatch, shouldKeepChannelMaxPowerAcceptedInBatch)
+{
+    constexpr uint8_t               kTestChannel = 11;
+    FakeMaxPowerCoprocessorPlatform platform;
+
+    ASSERT_EQ(platform.mRadioSpinel.Enable(FakePlatform::CurrentInstance()), kErrorNone);
+    ASSERT_NE(platform.mRadioSpinel.GetRadioChannelMask(false) & (1UL << kTestChannel), 0u);
+
+    platform.mRadioSpinel.BeginBatch();
+    ASSERT_EQ(platform.mRadioSpinel.SetChannelMaxTransmitPower(kTestChannel, OT_RADIO_POWER_INVALID), kErrorNone);
+    ASSERT_EQ(platform.mRadioSpinel.EndBatch(), kErrorNone);
+
+    ASSERT_EQ(platform.mRadioSpinel.GetRadioChannelMask(false) & (1UL << kTestChannel), 0u);
+}
+
+TEST(RadioSpinelBatch, shouldNotKeepChannelMaxPowerRejectedInBatch)
+{
+    constexpr uint8_t       kTestChannel = 11;
+    FakeCoprocessorPlatform platform;
+
+    ASSERT_EQ(platform.mRadioSpinel.Enable(FakePlatform::CurrentInstance()), kErrorNone);
+
+    platform.mRadioSpinel.BeginBatch();
+    ASSERT_EQ(platform.mRadioSpinel.SetChannelMaxTransmitPower(kTestChannel, OT_RADIO_POWER_INVALID), kErrorNone);
+    ASSERT_EQ(platform.mRadioSpinel.EndBatch(), kErrorNotImplemented);
+
+    ASSERT_NE(platform.mRadioSpinel.GetRadioChannelMask(false) & (1UL << kTestChannel), 0u);
+}
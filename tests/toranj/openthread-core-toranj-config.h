@@ -111,6 +111,8 @@
 
 #define OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE 0
 
+#define OPENTHREAD_CONFIG_MESSAGE_NUM_SHARED_BUFFER_CHAINS 16
+
 #define OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_ENTRIES 16
 
 #define OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_TIMEOUT 6
@@ -131,6 +133,10 @@
 
 #define OPENTHREAD_CONFIG_MLE_IP_ADDRS_PER_CHILD 10
 
+#define OPENTHREAD_CONFIG_MLE_ROUTE_CACHE_ENABLE 1
+
+#define OPENTHREAD_CONFIG_NETDATA_LOOKUP_TABLE_ENABLE 1
+
 #define OPENTHREAD_CONFIG_IP6_MAX_EXT_UCAST_ADDRS 8
 
 #define OPENTHREAD_CONFIG_IP6_MAX_EXT_MCAST_ADDRS 4
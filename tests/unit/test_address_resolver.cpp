@@ -0,0 +1,275 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "test_platform.h"
+
+#include <openthread/config.h>
+
+#include "test_util.h"
+#include "test_util.hpp"
+#include "common/code_utils.hpp"
+#include "common/random.hpp"
+#include "instance/instance.hpp"
+#include "thread/address_resolver.hpp"
+
+namespace ot {
+
+#if OPENTHREAD_FTD
+
+static Instance *sInstance;
+
+class UnitTester
+{
+public:
+    static void TestAddressResolverCacheLookup(void);
+
+private:
+    typedef AddressResolver::CacheEntry     CacheEntry;
+    typedef AddressResolver::CacheEntryList CacheEntryList;
+
+    // More EIDs than cache entries, so that adding entries also
+    // exercises eviction.
+    static constexpr uint16_t kNumEids       = 3 * AddressResolver::kCacheEntries;
+    static constexpr uint16_t kNumRloc16s    = 4;
+    static constexpr uint16_t kNumOperations = 4000;
+
+    static AddressResolver &GetResolver(void) { return sInstance->Get<AddressResolver>(); }
+    static void             PrepareEid(uint16_t aIndex, Ip6::Address &aEid);
+    static uint16_t         PickRloc16(void);
+    static CacheEntryList  &PickList(void);
+    static void             AddEntry(const Ip6::Address &aEid);
+    static void             MoveEntry(const Ip6::Address &aEid);
+    static void             VerifyCache(void);
+};
+
+void UnitTester::PrepareEid(uint16_t aIndex, Ip6::Address &aEid)
+{
+    // The EIDs only differ in their last two bytes so that many of
+    // them collide in the cache index.
+
+    SuccessOrQuit(aEid.FromString("fd00:1234::"));
+    aEid.mFields.m8[14] = static_cast<uint8_t>(aIndex >> 8);
+    aEid.mFields.m8[15] = static_cast<uint8_t>(aIndex & 0xff);
+}
+
+uint16_t UnitTester::PickRloc16(void)
+{
+    return static_cast<uint16_t>(0x400 * (1 + Random::NonCrypto::GenerateUpToExcluding<uint16_t>(kNumRloc16s)));
+}
+
+AddressResolver::CacheEntryList &UnitTester::PickList(void)
+{
+    AddressResolver &resolver = GetResolver();
+    CacheEntryList  *lists[]  = {&resolver.mCachedList, &resolver.mSnoopedList, &resolver.mQueryList,
+                                 &resolver.mQueryRetryList};
+
+    return *lists[Random::NonCrypto::GenerateUpToExcluding<uint8_t>(GetArrayLength(lists))];
+}
+
+void UnitTester::AddEntry(const Ip6::Address &aEid)
+{
+    // Adds a new entry the same way `Resolve()` and
+    // `UpdateSnoopedCacheEntry()` do.
+
+    AddressResolver &resolver = GetResolver();
+    CacheEntryList  *list;
+    CacheEntry      *prev;
+    CacheEntry      *entry;
+
+    VerifyOrExit(resolver.FindCacheEntry(aEid, list, prev) == nullptr);
+
+    entry = resolver.NewCacheEntry(/* aSnoopedEntry */ Random::NonCrypto::Generate<uint8_t>() & 1);
+    VerifyOrExit(entry != nullptr);
+
+    entry->SetTarget(aEid);
+    entry->SetRloc16(PickRloc16());
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE
+    resolver.IndexCacheEntry(*entry);
+#endif
+
+    list = &PickList();
+
+    if (list != &resolver.mCachedList)
+    {
+        entry->SetCanEvict(Random::NonCrypto::Generate<uint8_t>() & 1);
+    }
+
+    list->Push(*entry);
+
+exit:
+    return;
+}
+
+void UnitTester::MoveEntry(const Ip6::Address &aEid)
+{
+    // Moves an entry to the head of a list, the same way `Resolve()`
+    // moves a used entry to the head of the cached list.
+
+    CacheEntryList *list;
+    CacheEntry     *prev;
+    CacheEntry     *entry;
+
+    entry = GetResolver().FindCacheEntry(aEid, list, prev);
+    VerifyOrExit(entry != nullptr);
+
+    list->PopAfter(prev);
+
+    list = &PickList();
+
+    if (list != &GetResolver().mCachedList)
+    {
+        entry->SetCanEvict(true);
+    }
+
+    list->Push(*entry);
+
+exit:
+    return;
+}
+
+void UnitTester::VerifyCache(void)
+{
+    // Verifies that `FindCacheEntry()` finds the same entry, list and
+    // previous entry as a scan of all the lists, for every EID.
+
+    AddressResolver &resolver   = GetResolver();
+    CacheEntryList  *lists[]    = {&resolver.mCachedList, &resolver.mSnoopedList, &resolver.mQueryList,
+                                   &resolver.mQueryRetryList};
+    uint16_t         numEntries = 0;
+
+    for (uint16_t i = 0; i < kNumEids; i++)
+    {
+        Ip6::Address    eid;
+        CacheEntryList *list;
+        CacheEntry     *prev;
+        CacheEntry     *entry;
+        CacheEntryList *expectedList  = nullptr;
+        CacheEntry     *expectedPrev  = nullptr;
+        CacheEntry     *expectedEntry = nullptr;
+
+        PrepareEid(i, eid);
+
+        for (CacheEntryList *candidateList : lists)
+        {
+            expectedEntry = candidateList->FindMatchingWithPrev(expectedPrev, eid);
+
+            if (expectedEntry != nullptr)
+            {
+                expectedList = candidateList;
+                numEntries++;
+                break;
+            }
+        }
+
+        entry = resolver.FindCacheEntry(eid, list, prev);
+
+        VerifyOrQuit(entry == expectedEntry);
+
+        if (entry != nullptr)
+        {
+            VerifyOrQuit(list == expectedList);
+            VerifyOrQuit(prev == expectedPrev);
+        }
+    }
+
+#if OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_HASH_INDEX_ENABLE
+    VerifyOrQuit(resolver.mCacheIndex.GetNumEntries() == numEntries);
+#else
+    OT_UNUSED_VARIABLE(numEntries);
+#endif
+}
+
+void UnitTester::TestAddressResolverCacheLookup(void)
+{
+    Ip6::Address eid;
+
+    printf("TestAddressResolverCacheLookup()");
+
+    sInstance = testInitInstance();
+    VerifyOrQuit(sInstance != nullptr);
+
+    VerifyCache();
+
+    for (uint16_t i = 0; i < AddressResolver::kCacheEntries; i++)
+    {
+        PrepareEid(i, eid);
+        AddEntry(eid);
+    }
+
+    VerifyCache();
+
+    for (uint16_t iter = 0; iter < kNumOperations; iter++)
+    {
+        PrepareEid(Random::NonCrypto::GenerateUpToExcluding<uint16_t>(kNumEids), eid);
+
+        switch (Random::NonCrypto::GenerateUpToExcluding<uint8_t>(8))
+        {
+        case 0:
+        case 1:
+        case 2:
+            AddEntry(eid);
+            break;
+        case 3:
+        case 4:
+        case 5:
+            MoveEntry(eid);
+            break;
+        case 6:
+            GetResolver().RemoveEntryForAddress(eid);
+            break;
+        case 7:
+            GetResolver().RemoveEntriesForRloc16(PickRloc16());
+            break;
+        }
+
+        VerifyCache();
+    }
+
+    GetResolver().Clear();
+    VerifyCache();
+
+    printf(" -- PASS\n");
+
+    testFreeInstance(sInstance);
+}
+
+#endif // OPENTHREAD_FTD
+
+} // namespace ot
+
+int main(void)
+{
+#if OPENTHREAD_FTD
+    ot::UnitTester::TestAddressResolverCacheLookup();
+    printf("All tests passed\n");
+#else
+    printf("Address resolver is not available in this build\n");
+#endif
+
+    return 0;
+}
@@ -30,6 +30,7 @@
 
 #include "common/debug.hpp"
 #include "crypto/aes_ccm.hpp"
+#include "instance/instance.hpp"
 
 #include "test_platform.h"
 #include "test_util.hpp"
@@ -174,6 +175,78 @@ void TestMacCommandFrame(void)
     testFreeInstance(instance);
 }
 
+/**
+ * Verifies AES CCM of MAC frames (`TxFrame` and `RxFrame`) using test vectors from IEEE 802.15.4-2006 Annex C Section
+ * C.2.3.
+ */
+void TestMacFrameAesCcm(void)
+{
+    static constexpr uint8_t kFcsSize     = 2;
+    static constexpr uint8_t kTagLength   = 8;
+    static constexpr uint8_t kFrameLength = 40;
+
+    static const uint8_t kKey[] = {
+        0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf,
+    };
+
+    static const uint8_t kExtAddress[] = {0xac, 0xde, 0x48, 0x00, 0x00, 0x00, 0x00, 0x01};
+
+    // The frames include the FCS, which is not covered by AES CCM.
+
+    static const uint8_t kFrame[kFrameLength] = {
+        0x2B, 0xDC, 0x84, 0x21, 0x43, 0x02, 0x00, 0x00, 0x00, 0x00, 0x48, 0xDE, 0xAC, 0xFF,
+        0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x48, 0xDE, 0xAC, 0x06, 0x05, 0x00, 0x00, 0x00,
+        0x01, 0xCE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    };
+
+    static const uint8_t kSecuredFrame[kFrameLength] = {
+        0x2B, 0xDC, 0x84, 0x21, 0x43, 0x02, 0x00, 0x00, 0x00, 0x00, 0x48, 0xDE, 0xAC, 0xFF,
+        0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x48, 0xDE, 0xAC, 0x06, 0x05, 0x00, 0x00, 0x00,
+        0x01, 0xD8, 0x4F, 0xDE, 0x52, 0x90, 0x61, 0xF9, 0xC6, 0xF1, 0x00, 0x00,
+    };
+
+    Instance        *instance = testInitInstance();
+    Mac::Key         key;
+    Mac::KeyMaterial keyMaterial;
+    Mac::ExtAddress  extAddress;
+    Mac::TxFrame     txFrame;
+    Mac::RxFrame     rxFrame;
+    uint8_t          psdu[kFrameLength];
+
+    VerifyOrQuit(instance != nullptr);
+
+    memcpy(key.m8, kKey, sizeof(kKey));
+    keyMaterial.SetFrom(key);
+    extAddress.Set(kExtAddress);
+
+    ClearAllBytes(txFrame);
+    memcpy(psdu, kFrame, sizeof(psdu));
+    txFrame.mPsdu   = psdu;
+    txFrame.mLength = sizeof(psdu);
+    txFrame.SetAesKey(keyMaterial);
+
+    txFrame.ProcessTransmitAesCcm(extAddress);
+    VerifyOrQuit(txFrame.IsSecurityProcessed());
+    VerifyOrQuit(memcmp(psdu, kSecuredFrame, sizeof(psdu)) == 0);
+
+    ClearAllBytes(rxFrame);
+    rxFrame.mPsdu   = psdu;
+    rxFrame.mLength = sizeof(psdu);
+
+    SuccessOrQuit(rxFrame.ProcessReceiveAesCcm(extAddress, keyMaterial));
+    VerifyOrQuit(memcmp(psdu, kFrame, sizeof(psdu) - kTagLength - kFcsSize) == 0);
+
+    // A frame whose payload was modified fails the tag check.
+
+    memcpy(psdu, kSecuredFrame, sizeof(psdu));
+    psdu[sizeof(psdu) - kTagLength - kFcsSize - 1] ^= 0x01;
+    rxFrame.InvalidateHeaderLayout();
+
+    VerifyOrQuit(rxFrame.ProcessReceiveAesCcm(extAddress, keyMaterial) == kErrorSecurity);
+
+    testFreeInstance(instance);
+}
+
 /**
  * Verifies in-place encryption/decryption.
  */
@@ -254,13 +327,516 @@ void TestInPlaceAesCcmProcessing(void)
     testFreeInstance(instance);
 }
 
+/**
+ * Verifies AES CCM using an `AesEcb` with its key already set.
+ */
+void TestAesCcmWithKeyedEcb(void)
+{
+    static constexpr uint32_t kHeaderLength  = 29;
+    static constexpr uint32_t kPayloadLength = 1;
+    static constexpr uint8_t  kTagLength     = 8;
+
+    static const uint8_t kKey[] = {
+        0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf,
+    };
+
+    static const uint8_t kNonce[] = {
+        0xAC, 0xDE, 0x48, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x06,
+    };
+
+    static const uint8_t kDecrypted[] = {
+        0x2B, 0xDC, 0x84, 0x21, 0x43, 0x02, 0x00, 0x00, 0x00, 0x00, 0x48, 0xDE, 0xAC,
+        0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x48, 0xDE, 0xAC, 0x06, 0x05, 0x00,
+        0x00, 0x00, 0x01, 0xCE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    };
+
+    static const uint8_t kEncrypted[] = {
+        0x2B, 0xDC, 0x84, 0x21, 0x43, 0x02, 0x00, 0x00, 0x00, 0x00, 0x48, 0xDE, 0xAC,
+        0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x48, 0xDE, 0xAC, 0x06, 0x05, 0x00,
+        0x00, 0x00, 0x01, 0xD8, 0x4F, 0xDE, 0x52, 0x90, 0x61, 0xF9, 0xC6, 0xF1,
+    };
+
+    Instance      *instance = testInitInstance();
+    Crypto::Key    cryptoKey;
+    Crypto::AesEcb ecb;
+    uint8_t        frame[sizeof(kDecrypted)];
+
+    VerifyOrQuit(instance != nullptr);
+
+    cryptoKey.Set(kKey, sizeof(kKey));
+    ecb.SetKey(cryptoKey);
+
+    // Use the same keyed `AesEcb` for multiple `AesCcm` computations.
+
+    for (uint8_t iter = 0; iter < 3; iter++)
+    {
+        Crypto::AesCcm aesCcm;
+
+        memcpy(frame, kDecrypted, sizeof(frame));
+
+        aesCcm.SetKey(ecb);
+        aesCcm.Init(kHeaderLength, kPayloadLength, kTagLength, kNonce, sizeof(kNonce));
+        aesCcm.Header(frame, kHeaderLength);
+        aesCcm.Payload(frame + kHeaderLength, frame + kHeaderLength, kPayloadLength, Crypto::AesCcm::kEncrypt);
+        aesCcm.Finalize(frame + kHeaderLength + kPayloadLength);
+        VerifyOrQuit(memcmp(frame, kEncrypted, sizeof(kEncrypted)) == 0);
+    }
+
+    testFreeInstance(instance);
+}
+
+static void ComputeMleTag(Crypto::AesCcm &aAesCcm, uint8_t *aTag)
+{
+    static constexpr uint8_t kTagLength = 4;
+
+    static const uint8_t kNonce[] = {
+        0xac, 0xde, 0x48, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x06,
+    };
+
+    uint8_t payload[40];
+
+    for (uint8_t i = 0; i < sizeof(payload); i++)
+    {
+        payload[i] = i;
+    }
+
+    aAesCcm.Init(0, sizeof(payload), kTagLength, kNonce, sizeof(kNonce));
+    aAesCcm.Payload(payload, nullptr, sizeof(payload), Crypto::AesCcm::kEncrypt);
+    aAesCcm.Finalize(aTag);
+}
+
+/**
+ * Verifies the key schedules prepared by `KeyManager`.
+ */
+void TestKeyManagerKeySchedule(void)
+{
+    static const uint8_t kNetworkKey[] = {
+        0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff,
+    };
+
+    Instance   *instance = testInitInstance();
+    KeyManager *keyManager;
+    NetworkKey  networkKey;
+    uint32_t    keySequence;
+    uint8_t     tag[4];
+    uint8_t     expectedTag[4];
+
+    VerifyOrQuit(instance != nullptr);
+
+    keyManager = &instance->Get<KeyManager>();
+
+    memcpy(networkKey.m8, kNetworkKey, sizeof(networkKey.m8));
+    keyManager->SetNetworkKey(networkKey);
+    keyManager->SetCurrentKeySequence(10, KeyManager::kForceUpdate);
+    keySequence = keyManager->GetCurrentKeySequence();
+
+    // Check the current, previous and next MLE keys.
+
+    for (uint32_t sequence = keySequence - 1; sequence <= keySequence + 1; sequence++)
+    {
+        Crypto::AesCcm aesCcm;
+        Crypto::AesCcm expectedAesCcm;
+
+        expectedAesCcm.SetKey((sequence == keySequence) ? keyManager->GetCurrentMleKey()
+                                                        : keyManager->GetTemporaryMleKey(sequence));
+        ComputeMleTag(expectedAesCcm, expectedTag);
+
+        for (uint8_t iter = 0; iter < 2; iter++)
+        {
+            aesCcm.SetKey(keyManager->GetMleKeySchedule(sequence));
+            ComputeMleTag(aesCcm, tag);
+            VerifyOrQuit(memcmp(tag, expectedTag, sizeof(tag)) == 0);
+        }
+    }
+
+#if !OPENTHREAD_CONFIG_PLATFORM_KEY_REFERENCES_ENABLE
+    VerifyOrQuit(&keyManager->GetMleKeySchedule(keySequence + 1) == &keyManager->GetMleKeySchedule(keySequence + 1));
+    VerifyOrQuit(&keyManager->GetMleKeySchedule(keySequence) != &keyManager->GetMleKeySchedule(keySequence + 1));
+#endif
+
+    // Rotate the key and check that the cached key schedules are
+    // not used for the new key material.
+
+    keyManager->SetCurrentKeySequence(keySequence + 1, KeyManager::kForceUpdate);
+
+    {
+        Crypto::AesCcm aesCcm;
+        Crypto::AesCcm expectedAesCcm;
+
+        expectedAesCcm.SetKey(keyManager->GetCurrentMleKey());
+        ComputeMleTag(expectedAesCcm, expectedTag);
+
+        aesCcm.SetKey(keyManager->GetMleKeySchedule(keySequence + 1));
+        ComputeMleTag(aesCcm, tag);
+        VerifyOrQuit(memcmp(tag, expectedTag, sizeof(tag)) == 0);
+    }
+
+    // Change the network key and check the same key sequence.
+
+    networkKey.m8[0] ^= 0xff;
+    keyManager->SetNetworkKey(networkKey);
+    keyManager->SetCurrentKeySequence(keySequence + 1, KeyManager::kForceUpdate);
+
+    {
+        Crypto::AesCcm aesCcm;
+        Crypto::AesCcm expectedAesCcm;
+
+        expectedAesCcm.SetKey(keyManager->GetCurrentMleKey());
+        ComputeMleTag(expectedAesCcm, expectedTag);
+
+        aesCcm.SetKey(keyManager->GetMleKeySchedule(keySequence + 1));
+        ComputeMleTag(aesCcm, tag);
+        VerifyOrQuit(memcmp(tag, expectedTag, sizeof(tag)) == 0);
+    }
+
+    testFreeInstance(instance);
+}
+
+/**
+ * Measures AES CCM processing of 127-byte frames when setting the key for every frame compared to using a prepared
+ * key schedule.
+ */
+void BenchmarkAesCcmKeySchedule(void)
+{
+    static constexpr uint32_t kNumFrames     = 20000;
+    static constexpr uint8_t  kFrameLength   = 127;
+    static constexpr uint8_t  kHeaderLength  = 23;
+    static constexpr uint8_t  kTagLength     = 4;
+    static constexpr uint8_t  kPayloadLength = kFrameLength - kHeaderLength - kTagLength - sizeof(uint16_t);
+
+    static const uint8_t kKey[] = {
+        0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xab, 0xac, 0xad, 0xae, 0xaf,
+    };
+
+    static const uint8_t kNonce[] = {
+        0xac, 0xde, 0x48, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x06,
+    };
+
+    Instance      *instance = testInitInstance();
+    Crypto::Key    cryptoKey;
+    Crypto::AesEcb ecb;
+    uint8_t        frame[kFrameLength];
+    uint8_t        encryptedFrame[kFrameLength];
+    uint8_t        tag[kTagLength];
+    uint8_t        scheduleTag[kTagLength];
+    uint64_t       startTime;
+    uint64_t       setKeyDuration;
+    uint64_t       scheduleDuration;
+
+    VerifyOrQuit(instance != nullptr);
+
+    printf("BenchmarkAesCcmKeySchedule()\n");
+
+    for (uint8_t i = 0; i < kFrameLength; i++)
+    {
+        frame[i] = i;
+    }
+
+    cryptoKey.Set(kKey, sizeof(kKey));
+
+    startTime = GetMonotonicTimeNs();
+
+    for (uint32_t count = 0; count < kNumFrames; count++)
+    {
+        Crypto::AesCcm aesCcm;
+
+        aesCcm.SetKey(kKey, sizeof(kKey));
+        aesCcm.Init(kHeaderLength, kPayloadLength, kTagLength, kNonce, sizeof(kNonce));
+        aesCcm.Header(frame, kHeaderLength);
+        aesCcm.Payload(&frame[kHeaderLength], &frame[kHeaderLength], kPayloadLength, Crypto::AesCcm::kEncrypt);
+        aesCcm.Finalize(tag);
+    }
+
+    setKeyDuration = GetMonotonicTimeNs() - startTime;
+
+    memcpy(encryptedFrame, frame, sizeof(frame));
+
+    for (uint8_t i = 0; i < kFrameLength; i++)
+    {
+        frame[i] = i;
+    }
+
+    ecb.SetKey(cryptoKey);
+
+    startTime = GetMonotonicTimeNs();
+
+    for (uint32_t count = 0; count < kNumFrames; count++)
+    {
+        Crypto::AesCcm aesCcm;
+
+        aesCcm.SetKey(ecb);
+        aesCcm.Init(kHeaderLength, kPayloadLength, kTagLength, kNonce, sizeof(kNonce));
+        aesCcm.Header(frame, kHeaderLength);
+        aesCcm.Payload(&frame[kHeaderLength], &frame[kHeaderLength], kPayloadLength, Crypto::AesCcm::kEncrypt);
+        aesCcm.Finalize(scheduleTag);
+    }
+
+    scheduleDuration = GetMonotonicTimeNs() - startTime;
+
+    VerifyOrQuit(memcmp(tag, scheduleTag, sizeof(tag)) == 0);
+    VerifyOrQuit(memcmp(frame, encryptedFrame, sizeof(frame)) == 0);
+
+    printf("  set key per frame:  %7lu frames/sec\n",
+           ToUlong(static_cast<uint32_t>(kNumFrames * 1000000000ull / (setKeyDuration + 1))));
+    printf("  keyed AES context:  %7lu frames/sec\n",
+           ToUlong(static_cast<uint32_t>(kNumFrames * 1000000000ull / (scheduleDuration + 1))));
+
+    testFreeInstance(instance);
+}
+
+static void PrepareBatchOperation(Crypto::AesCcm::Operation &aOperation,
+                                  uint8_t                   *aFrame,
+                                  uint16_t                   aHeaderLength,
+                                  uint16_t                   aPayloadLength,
+                                  uint8_t                    aTagLength,
+                                  const uint8_t             *aNonce,
+                                  uint8_t                   *aTag,
+                                  Crypto::AesCcm::Mode       aMode)
+{
+    aOperation.mNonce         = aNonce;
+    aOperation.mHeader        = aFrame;
+    aOperation.mPlainText     = aFrame + aHeaderLength;
+    aOperation.mCipherText    = aFrame + aHeaderLength;
+    aOperation.mTag           = aTag;
+    aOperation.mHeaderLength  = aHeaderLength;
+    aOperation.mPayloadLength = aPayloadLength;
+    aOperation.mTagLength     = aTagLength;
+    aOperation.mMode          = aMode;
+}
+
+/**
+ * Verifies `AesCcm::ProcessBatch()` against processing each operation on its own.
+ */
+void TestAesCcmBatch(void)
+{
+    struct TestOperation
+    {
+        uint16_t mHeaderLength;
+        uint16_t mPayloadLength;
+        uint8_t  mTagLength;
+    };
+
+    static constexpr uint16_t kMaxFrameLength = 300;
+
+    static const TestOperation kTestOperations[] = {
+        {29, 1, 8},   {23, 98, 4}, {0, 40, 4}, {14, 0, 16}, {15, 16, 4},
+        {40, 255, 8}, {3, 17, 16}, {0, 0, 4},  {60, 33, 8},
+    };
+
+    static constexpr uint16_t kNumOperations = GetArrayLength(kTestOperations);
+
+    static const uint8_t kKey[] = {
+        0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf,
+    };
+
+    Instance                 *instance = testInitInstance();
+    Crypto::Key               cryptoKey;
+    Crypto::AesEcb            ecb;
+    Crypto::AesCcm::Operation operations[kNumOperations];
+    uint8_t                   frames[kNumOperations][kMaxFrameLength];
+    uint8_t                   expectedFrames[kNumOperations][kMaxFrameLength];
+    uint8_t                   nonces[kNumOperations][Crypto::AesCcm::kNonceSize];
+    uint8_t                   tags[kNumOperations][Crypto::AesCcm::kMaxTagLength];
+    uint8_t                   expectedTags[kNumOperations][Crypto::AesCcm::kMaxTagLength];
+
+    VerifyOrQuit(instance != nullptr);
+
+    printf("TestAesCcmBatch()\n");
+
+    cryptoKey.Set(kKey, sizeof(kKey));
+    ecb.SetKey(cryptoKey);
+
+    for (uint16_t i = 0; i < kNumOperations; i++)
+    {
+        const TestOperation &testOp = kTestOperations[i];
+        Crypto::AesCcm       aesCcm;
+
+        VerifyOrQuit(testOp.mHeaderLength + testOp.mPayloadLength <= kMaxFrameLength);
+
+        for (uint16_t index = 0; index < kMaxFrameLength; index++)
+        {
+            frames[i][index] = static_cast<uint8_t>(index * 7 + i);
+        }
+
+        for (uint8_t index = 0; index < Crypto::AesCcm::kNonceSize; index++)
+        {
+            nonces[i][index] = static_cast<uint8_t>(index + i * 13);
+        }
+
+        memcpy(expectedFrames[i], frames[i], kMaxFrameLength);
+
+        aesCcm.SetKey(cryptoKey);
+        aesCcm.Init(testOp.mHeaderLength, testOp.mPayloadLength, testOp.mTagLength, nonces[i],
+                    Crypto::AesCcm::kNonceSize);
+        aesCcm.Header(expectedFrames[i], testOp.mHeaderLength);
+        aesCcm.Payload(&expectedFrames[i][testOp.mHeaderLength], &expectedFrames[i][testOp.mHeaderLength],
+                       testOp.mPayloadLength, Crypto::AesCcm::kEncrypt);
+        aesCcm.Finalize(expectedTags[i]);
+
+        PrepareBatchOperation(operations[i], frames[i], testOp.mHeaderLength, testOp.mPayloadLength,
+                              testOp.mTagLength, nonces[i], tags[i], Crypto::AesCcm::kEncrypt);
+    }
+
+    // Encrypt the frames in place.
+
+    Crypto::AesCcm::ProcessBatch(ecb, operations, kNumOperations);
+
+    for (uint16_t i = 0; i < kNumOperations; i++)
+    {
+        VerifyOrQuit(memcmp(frames[i], expectedFrames[i], kMaxFrameLength) == 0);
+        VerifyOrQuit(memcmp(tags[i], expectedTags[i], kTestOperations[i].mTagLength) == 0);
+    }
+
+    // Decrypt the frames in place and check the payload and tags.
+
+    for (uint16_t i = 0; i < kNumOperations; i++)
+    {
+        operations[i].mMode = Crypto::AesCcm::kDecrypt;
+        memset(tags[i], 0, sizeof(tags[i]));
+    }
+
+    Crypto::AesCcm::ProcessBatch(ecb, operations, kNumOperations);
+
+    for (uint16_t i = 0; i < kNumOperations; i++)
+    {
+        for (uint16_t index = 0; index < kMaxFrameLength; index++)
+        {
+            VerifyOrQuit(frames[i][index] == static_cast<uint8_t>(index * 7 + i));
+        }
+
+        VerifyOrQuit(memcmp(tags[i], expectedTags[i], kTestOperations[i].mTagLength) == 0);
+    }
+
+    // Decrypt without outputting the plaintext, only verifying the tags.
+
+    for (uint16_t i = 0; i < kNumOperations; i++)
+    {
+        Crypto::AesCcm::Operation &operation = operations[i];
+
+        operation.mCipherText = &expectedFrames[i][kTestOperations[i].mHeaderLength];
+        operation.mHeader     = expectedFrames[i];
+        operation.mPlainText  = nullptr;
+        memset(tags[i], 0, sizeof(tags[i]));
+    }
+
+    Crypto::AesCcm::ProcessBatch(ecb, operations, kNumOperations);
+
+    for (uint16_t i = 0; i < kNumOperations; i++)
+    {
+        VerifyOrQuit(memcmp(tags[i], expectedTags[i], kTestOperations[i].mTagLength) == 0);
+    }
+
+    testFreeInstance(instance);
+}
+
+/**
+ * Measures AES CCM processing of 127-byte frames one by one compared to processing them in batches.
+ */
+void BenchmarkAesCcmBatch(void)
+{
+    static constexpr uint16_t kNumFrames     = 32;
+    static constexpr uint32_t kNumRounds     = 500;
+    static constexpr uint8_t  kFrameLength   = 127;
+    static constexpr uint8_t  kHeaderLength  = 23;
+    static constexpr uint8_t  kTagLength     = 4;
+    static constexpr uint8_t  kPayloadLength = kFrameLength - kHeaderLength - kTagLength - sizeof(uint16_t);
+
+    static const uint8_t kKey[] = {
+        0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xab, 0xac, 0xad, 0xae, 0xaf,
+    };
+
+    Instance                 *instance = testInitInstance();
+    Crypto::Key               cryptoKey;
+    Crypto::AesEcb            ecb;
+    Crypto::AesCcm::Operation operations[kNumFrames];
+    uint8_t                   frames[kNumFrames][kFrameLength];
+    uint8_t                   batchFrames[kNumFrames][kFrameLength];
+    uint8_t                   nonces[kNumFrames][Crypto::AesCcm::kNonceSize];
+    uint8_t                   tags[kNumFrames][kTagLength];
+    uint8_t                   batchTags[kNumFrames][kTagLength];
+    uint64_t                  startTime;
+    uint64_t                  frameDuration;
+    uint64_t                  batchDuration;
+
+    VerifyOrQuit(instance != nullptr);
+
+    printf("BenchmarkAesCcmBatch()\n");
+
+    cryptoKey.Set(kKey, sizeof(kKey));
+    ecb.SetKey(cryptoKey);
+
+    for (uint16_t i = 0; i < kNumFrames; i++)
+    {
+        for (uint8_t index = 0; index < kFrameLength; index++)
+        {
+            frames[i][index] = static_cast<uint8_t>(index + i);
+        }
+
+        for (uint8_t index = 0; index < Crypto::AesCcm::kNonceSize; index++)
+        {
+            nonces[i][index] = static_cast<uint8_t>(index * i);
+        }
+
+        memcpy(batchFrames[i], frames[i], kFrameLength);
+
+        PrepareBatchOperation(operations[i], batchFrames[i], kHeaderLength, kPayloadLength, kTagLength, nonces[i],
+                              batchTags[i], Crypto::AesCcm::kEncrypt);
+    }
+
+    startTime = GetMonotonicTimeNs();
+
+    for (uint32_t round = 0; round < kNumRounds; round++)
+    {
+        for (uint16_t i = 0; i < kNumFrames; i++)
+        {
+            Crypto::AesCcm aesCcm;
+
+            aesCcm.SetKey(ecb);
+            aesCcm.Init(kHeaderLength, kPayloadLength, kTagLength, nonces[i], Crypto::AesCcm::kNonceSize);
+            aesCcm.Header(frames[i], kHeaderLength);
+            aesCcm.Payload(&frames[i][kHeaderLength], &frames[i][kHeaderLength], kPayloadLength,
+                           Crypto::AesCcm::kEncrypt);
+            aesCcm.Finalize(tags[i]);
+        }
+    }
+
+    frameDuration = GetMonotonicTimeNs() - startTime;
+    startTime     = GetMonotonicTimeNs();
+
+    for (uint32_t round = 0; round < kNumRounds; round++)
+    {
+        Crypto::AesCcm::ProcessBatch(ecb, operations, kNumFrames);
+    }
+
+    batchDuration = GetMonotonicTimeNs() - startTime;
+
+    for (uint16_t i = 0; i < kNumFrames; i++)
+    {
+        VerifyOrQuit(memcmp(frames[i], batchFrames[i], kFrameLength) == 0);
+        VerifyOrQuit(memcmp(tags[i], batchTags[i], kTagLength) == 0);
+    }
+
+    printf("  frame by frame: %7lu frames/sec\n",
+           ToUlong(static_cast<uint32_t>(kNumRounds * kNumFrames * 1000000000ull / (frameDuration + 1))));
+    printf("  batch of %u:     %7lu frames/sec\n", kNumFrames,
+           ToUlong(static_cast<uint32_t>(kNumRounds * kNumFrames * 1000000000ull / (batchDuration + 1))));
+
+    testFreeInstance(instance);
+}
+
 } // namespace ot
 
 int main(void)
 {
     ot::TestMacBeaconFrame();
     ot::TestMacCommandFrame();
+    ot::TestMacFrameAesCcm();
     ot::TestInPlaceAesCcmProcessing();
+    ot::TestAesCcmWithKeyedEcb();
+    ot::TestKeyManagerKeySchedule();
+    ot::BenchmarkAesCcmKeySchedule();
+    ot::TestAesCcmBatch();
+    ot::BenchmarkAesCcmBatch();
     printf("All tests passed\n");
     return 0;
 }
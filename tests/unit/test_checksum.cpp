@@ -467,6 +467,125 @@ public:
         VerifyOrQuit(checksum.GetValue() == kTestVectorChecksum);
         VerifyOrQuit(checksum.GetValue() == CalculateChecksum(kTestVector, sizeof(kTestVector)), );
     }
+
+    static void TestAddData(void)
+    {
+        // Cross-checks `AddData()` against adding the data one byte at
+        // a time, with the data split across multiple calls at random
+        // (possibly odd) positions and with different buffer alignments.
+
+        static constexpr uint16_t kMaxLength     = 1400;
+        static constexpr uint16_t kNumIterations = 5000;
+
+        Instance *instance;
+        uint8_t   buffer[kMaxLength + sizeof(uint32_t)];
+
+        printf("TestAddData\n");
+
+        instance = static_cast<Instance *>(testInitInstance());
+        VerifyOrQuit(instance != nullptr);
+
+        for (uint16_t iter = 0; iter < kNumIterations; iter++)
+        {
+            uint16_t       length = Random::NonCrypto::GenerateUpToExcluding<uint16_t>(kMaxLength + 1);
+            const uint8_t *data   = &buffer[iter % sizeof(uint32_t)];
+            Checksum       checksum;
+            Checksum       expected;
+            uint16_t       offset = 0;
+
+            switch (iter % 3)
+            {
+            case 0:
+                Random::NonCrypto::FillBuffer(buffer, sizeof(buffer));
+                break;
+            case 1:
+                memset(buffer, 0xff, sizeof(buffer));
+                break;
+            default:
+                memset(buffer, 0, sizeof(buffer));
+                break;
+            }
+
+            while (offset < length)
+            {
+                uint16_t chunkLength = Random::NonCrypto::GenerateUpToExcluding<uint16_t>(length - offset + 1);
+
+                checksum.AddData(&data[offset], chunkLength);
+
+                for (uint16_t i = 0; i < chunkLength; i++)
+                {
+                    expected.AddUint8(data[offset + i]);
+                }
+
+                VerifyOrQuit(checksum.GetValue() == expected.GetValue());
+                VerifyOrQuit(checksum.mAtOddIndex == expected.mAtOddIndex);
+
+                offset += chunkLength;
+            }
+
+            {
+                Checksum fullChecksum;
+
+                fullChecksum.AddData(data, length);
+                VerifyOrQuit(fullChecksum.GetValue() == CalculateChecksum(data, length));
+            }
+        }
+
+        testFreeInstance(instance);
+    }
+
+    static void BenchmarkAddData(void)
+    {
+        static const uint16_t     kLengths[] = {64, 128, 256, 512, 1024, 1280};
+        static constexpr uint32_t kNumRounds = 20000;
+
+        Instance *instance;
+        uint8_t   buffer[1280];
+
+        printf("BenchmarkAddData\n");
+
+        instance = static_cast<Instance *>(testInitInstance());
+        VerifyOrQuit(instance != nullptr);
+
+        Random::NonCrypto::FillBuffer(buffer, sizeof(buffer));
+
+        for (uint16_t length : kLengths)
+        {
+            Checksum byteChecksum;
+            Checksum wordChecksum;
+            uint64_t startTime;
+            uint64_t byteDuration;
+            uint64_t wordDuration;
+
+            startTime = GetMonotonicTimeNs();
+
+            for (uint32_t round = 0; round < kNumRounds; round++)
+            {
+                for (uint16_t i = 0; i < length; i++)
+                {
+                    byteChecksum.AddUint8(buffer[i]);
+                }
+            }
+
+            byteDuration = GetMonotonicTimeNs() - startTime;
+            startTime    = GetMonotonicTimeNs();
+
+            for (uint32_t round = 0; round < kNumRounds; round++)
+            {
+                wordChecksum.AddData(buffer, length);
+            }
+
+            wordDuration = GetMonotonicTimeNs() - startTime;
+
+            VerifyOrQuit(byteChecksum.GetValue() == wordChecksum.GetValue());
+
+            printf("  %4u bytes: byte-wise %6lu ns, word-wise %6lu ns\n", length,
+                   ToUlong(static_cast<uint32_t>(byteDuration / kNumRounds)),
+                   ToUlong(static_cast<uint32_t>(wordDuration / kNumRounds)));
+        }
+
+        testFreeInstance(instance);
+    }
 };
 
 #if OPENTHREAD_CONFIG_VERHOEFF_CHECKSUM_ENABLE
@@ -530,6 +649,8 @@ void TestVerhoeffChecksum(void)
 int main(void)
 {
     ot::ChecksumTester::TestExampleVector();
+    ot::ChecksumTester::TestAddData();
+    ot::ChecksumTester::BenchmarkAddData();
     ot::TestUdpMessageChecksum();
     ot::TestIcmp6MessageChecksum();
     ot::TestTcp4MessageChecksum();
@@ -31,8 +31,10 @@
 #include <openthread/config.h>
 
 #include "test_util.h"
+#include "test_util.hpp"
 #include "common/array.hpp"
 #include "common/code_utils.hpp"
+#include "common/num_utils.hpp"
 #include "instance/instance.hpp"
 #include "thread/child_table.hpp"
 
@@ -394,11 +396,218 @@ void TestChildTable(void)
     testFreeInstance(sInstance);
 }
 
+// Fills in the addresses of the child entry at `aIndex` used by `TestChildTableAddressLookup()`.
+static void PrepareChildAddresses(uint16_t         aIndex,
+                                  uint16_t        &aRloc16,
+                                  Mac::ExtAddress &aExtAddress,
+                                  Ip6::Address    &aMeshLocalAddress,
+                                  Ip6::Address    &aGlobalAddress)
+{
+    aRloc16 = 0x0400 | (aIndex + 1);
+
+    aExtAddress.Clear();
+    aExtAddress.m8[0] = 0x12;
+    aExtAddress.m8[6] = static_cast<uint8_t>(aIndex >> 8);
+    aExtAddress.m8[7] = static_cast<uint8_t>(aIndex & 0xff);
+
+    aMeshLocalAddress.SetPrefix(sInstance->Get<Mle::Mle>().GetMeshLocalPrefix());
+    aMeshLocalAddress.GetIid().Clear();
+    aMeshLocalAddress.GetIid().mFields.m8[0]  = 0x5a;
+    aMeshLocalAddress.GetIid().mFields.m16[3] = BigEndian::HostSwap16(aIndex);
+
+    SuccessOrQuit(aGlobalAddress.FromString("2001:db8::"));
+    aGlobalAddress.mFields.m16[7] = BigEndian::HostSwap16(aIndex + 1);
+}
+
+void TestChildTableAddressLookup(void)
+{
+    static constexpr uint32_t kNumRounds = 200;
+
+    ChildTable     *table;
+    NeighborTable  *neighborTable;
+    Child          *child;
+    uint16_t        rloc16;
+    Mac::ExtAddress extAddress;
+    Ip6::Address    mlAddress;
+    Ip6::Address    globalAddress;
+    Ip6::Address    otherAddress;
+    uint32_t        numFound;
+    uint64_t        startTime;
+    uint64_t        indexedDuration;
+    uint64_t        scanDuration;
+
+    printf("TestChildTableAddressLookup()");
+
+    sInstance = testInitInstance();
+    VerifyOrQuit(sInstance != nullptr);
+
+    table         = &sInstance->Get<ChildTable>();
+    neighborTable = &sInstance->Get<NeighborTable>();
+
+    // Fill the table. Children with an odd index are sleepy.
+
+    for (uint16_t i = 0; i < kMaxChildren; i++)
+    {
+        uint8_t mode = (i & 1) ? 0 : Mle::DeviceMode::kModeRxOnWhenIdle;
+
+        PrepareChildAddresses(i, rloc16, extAddress, mlAddress, globalAddress);
+
+        child = table->GetNewChild();
+        VerifyOrQuit(child != nullptr);
+
+        child->SetDeviceMode(Mle::DeviceMode(mode));
+        child->SetRloc16(rloc16);
+        child->SetExtAddress(extAddress);
+        SuccessOrQuit(child->AddIp6Address(mlAddress));
+        SuccessOrQuit(child->AddIp6Address(globalAddress));
+        child->SetState(Child::kStateValid);
+    }
+
+    for (uint16_t i = 0; i < kMaxChildren; i++)
+    {
+        PrepareChildAddresses(i, rloc16, extAddress, mlAddress, globalAddress);
+        child = table->GetChildAtIndex(i);
+
+        VerifyOrQuit(table->FindChild(rloc16, Child::kInStateValid) == child);
+        VerifyOrQuit(table->FindChild(extAddress, Child::kInStateValidOrRestoring) == child);
+        VerifyOrQuit(table->FindChild(mlAddress, Child::kInStateValid) == child);
+        VerifyOrQuit(table->FindChild(globalAddress, Child::kInStateAnyExceptInvalid) == child);
+        VerifyOrQuit(table->FindChild(globalAddress, Child::kInStateAny) == child);
+        VerifyOrQuit(table->FindChild(globalAddress, Child::kInStateChildIdRequest) == nullptr);
+        VerifyOrQuit(neighborTable->FindNeighbor(globalAddress) == child);
+        VerifyOrQuit(table->HasSleepyChildWithAddress(mlAddress) == ((i & 1) != 0));
+        VerifyOrQuit(table->HasSleepyChildWithAddress(globalAddress) == ((i & 1) != 0));
+    }
+
+    // Change the addresses and the state of a child and verify that
+    // lookups follow.
+
+    child = table->GetChildAtIndex(0);
+    PrepareChildAddresses(0, rloc16, extAddress, mlAddress, globalAddress);
+
+    SuccessOrQuit(child->RemoveIp6Address(globalAddress));
+    VerifyOrQuit(table->FindChild(globalAddress, Child::kInStateValid) == nullptr);
+    VerifyOrQuit(table->FindChild(mlAddress, Child::kInStateValid) == child);
+
+    SuccessOrQuit(otherAddress.FromString("fd00:1234::1"));
+    SuccessOrQuit(child->AddIp6Address(otherAddress));
+    VerifyOrQuit(table->FindChild(otherAddress, Child::kInStateValid) == child);
+
+    child->SetRloc16(0x0600);
+    VerifyOrQuit(table->FindChild(rloc16, Child::kInStateValid) == nullptr);
+    VerifyOrQuit(table->FindChild(0x0600, Child::kInStateValid) == child);
+
+    extAddress.m8[0] = 0x34;
+    child->SetExtAddress(extAddress);
+    VerifyOrQuit(table->FindChild(extAddress, Child::kInStateValid) == child);
+
+    child->SetState(Child::kStateInvalid);
+    VerifyOrQuit(table->FindChild(0x0600, Child::kInStateAnyExceptInvalid) == nullptr);
+    VerifyOrQuit(table->FindChild(extAddress, Child::kInStateAnyExceptInvalid) == nullptr);
+    VerifyOrQuit(table->FindChild(otherAddress, Child::kInStateAnyExceptInvalid) == nullptr);
+    VerifyOrQuit(table->FindChild(otherAddress, Child::kInStateAny) == child);
+
+    child->SetState(Child::kStateRestored);
+    VerifyOrQuit(table->FindChild(otherAddress, Child::kInStateValidOrRestoring) == child);
+
+    child->ClearIp6Addresses();
+    VerifyOrQuit(table->FindChild(otherAddress, Child::kInStateValidOrRestoring) == nullptr);
+    VerifyOrQuit(table->FindChild(mlAddress, Child::kInStateValidOrRestoring) == nullptr);
+
+    // When more than one child has an address, the one with the
+    // smallest index is returned.
+
+    SuccessOrQuit(table->GetChildAtIndex(5)->AddIp6Address(otherAddress));
+    SuccessOrQuit(table->GetChildAtIndex(3)->AddIp6Address(otherAddress));
+    VerifyOrQuit(table->FindChild(otherAddress, Child::kInStateValid) == table->GetChildAtIndex(3));
+    VerifyOrQuit(table->HasSleepyChildWithAddress(otherAddress));
+    SuccessOrQuit(table->GetChildAtIndex(3)->RemoveIp6Address(otherAddress));
+    VerifyOrQuit(table->FindChild(otherAddress, Child::kInStateValid) == table->GetChildAtIndex(5));
+
+    child->Clear();
+    VerifyOrQuit(table->FindChild(extAddress, Child::kInStateAny) == nullptr);
+
+    printf(" -- PASS\n");
+
+    // Benchmark looking up every child (by RLOC16, extended address
+    // and IPv6 address) against a scan of the table.
+
+    numFound  = 0;
+    startTime = GetMonotonicTimeNs();
+
+    for (uint32_t round = 0; round < kNumRounds; round++)
+    {
+        for (uint16_t i = 1; i < kMaxChildren; i++)
+        {
+            PrepareChildAddresses(i, rloc16, extAddress, mlAddress, globalAddress);
+
+            numFound += (table->FindChild(rloc16, Child::kInStateValid) != nullptr);
+            numFound += (table->FindChild(extAddress, Child::kInStateValid) != nullptr);
+            numFound += (neighborTable->FindNeighbor(globalAddress) != nullptr);
+        }
+    }
+
+    indexedDuration = GetMonotonicTimeNs() - startTime;
+    VerifyOrQuit(numFound == kNumRounds * 3 * (kMaxChildren - 1u));
+
+    numFound  = 0;
+    startTime = GetMonotonicTimeNs();
+
+    for (uint32_t round = 0; round < kNumRounds; round++)
+    {
+        for (uint16_t i = 1; i < kMaxChildren; i++)
+        {
+            PrepareChildAddresses(i, rloc16, extAddress, mlAddress, globalAddress);
+
+            for (Child &entry : table->Iterate(Child::kInStateValid))
+            {
+                if (entry.GetRloc16() == rloc16)
+                {
+                    numFound++;
+                    break;
+                }
+            }
+
+            for (Child &entry : table->Iterate(Child::kInStateValid))
+            {
+                if (entry.GetExtAddress() == extAddress)
+                {
+                    numFound++;
+                    break;
+                }
+            }
+
+            for (Child &entry : table->Iterate(Child::kInStateValid))
+            {
+                if (entry.HasIp6Address(globalAddress))
+                {
+                    numFound++;
+                    break;
+                }
+            }
+        }
+    }
+
+    scanDuration = GetMonotonicTimeNs() - startTime;
+    VerifyOrQuit(numFound == kNumRounds * 3 * (kMaxChildren - 1u));
+
+    printf("BenchmarkChildTableLookup()\n");
+    printf("  children:            %u\n", kMaxChildren);
+    printf("  index:               %s\n", OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE ? "enabled" : "disabled");
+    printf("  lookup (ns):         %lu\n",
+           ToUlong(static_cast<uint32_t>(indexedDuration / (kNumRounds * 3 * (kMaxChildren - 1u)))));
+    printf("  table scan (ns):     %lu\n",
+           ToUlong(static_cast<uint32_t>(scanDuration / (kNumRounds * 3 * (kMaxChildren - 1u)))));
+
+    testFreeInstance(sInstance);
+}
+
 } // namespace ot
 
 int main(void)
 {
     ot::TestChildTable();
+    ot::TestChildTableAddressLookup();
     printf("\nAll tests passed.\n");
     return 0;
 }
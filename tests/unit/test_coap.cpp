@@ -0,0 +1,627 @@
+/*
+ *  Copyright (c) 2025, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdio.h>
+
+#include "test_platform.h"
+#include "test_util.hpp"
+#include "instance/instance.hpp"
+
+namespace ot {
+
+class UnitTester
+{
+public:
+    static void TestResourceTable(void)
+    {
+        static constexpr uint16_t kNumResources = 40;
+
+        Coap::CoapBase::ResourceTable<Coap::Resource> table;
+        char                                          uriPaths[kNumResources][8];
+        Coap::Resource                               *resources[kNumResources];
+
+        printf("TestResourceTable()\n");
+
+        for (uint16_t i = 0; i < kNumResources; i++)
+        {
+            snprintf(uriPaths[i], sizeof(uriPaths[i]), "r/%u", i);
+            resources[i] = new Coap::Resource(uriPaths[i], nullptr, nullptr);
+            table.Add(*resources[i]);
+        }
+
+        for (uint16_t i = 0; i < kNumResources; i++)
+        {
+            VerifyOrQuit(FindResource(table, uriPaths[i]) == resources[i]);
+        }
+
+        VerifyOrQuit(FindResource(table, "r/none") == nullptr);
+
+        for (uint16_t i = 0; i < kNumResources; i += 2)
+        {
+            table.Remove(*resources[i]);
+            VerifyOrQuit(resources[i]->GetNext() == nullptr);
+        }
+
+        for (uint16_t i = 0; i < kNumResources; i++)
+        {
+            VerifyOrQuit(FindResource(table, uriPaths[i]) == ((i % 2 == 0) ? nullptr : resources[i]));
+        }
+
+        // Remove a resource whose URI path changed after it was added.
+
+        uriPaths[1][0] = 'x';
+        table.Remove(*resources[1]);
+        uriPaths[1][0] = 'r';
+        VerifyOrQuit(FindResource(table, uriPaths[1]) == nullptr);
+
+        for (Coap::Resource *resource : resources)
+        {
+            delete resource;
+        }
+    }
+
+    static void TestMessageIndex(void)
+    {
+        static constexpr uint16_t kCapacity    = 4;
+        static constexpr uint16_t kNumMessages = kCapacity + 1;
+
+        using Index = Coap::CoapBase::MessageIndex<kCapacity>;
+
+        Instance      *instance;
+        Index          index;
+        Coap::Message *messages[kNumMessages];
+        uint16_t       entry;
+
+        printf("TestMessageIndex()\n");
+
+        instance = static_cast<Instance *>(testInitInstance());
+        VerifyOrQuit(instance != nullptr);
+
+        for (Coap::Message *&message : messages)
+        {
+            message = AsCoapMessagePtr(instance->Get<MessagePool>().Allocate(Message::kTypeOther));
+            VerifyOrQuit(message != nullptr);
+        }
+
+        VerifyOrQuit(index.GetNumEntries() == 0);
+        VerifyOrQuit(index.FindFirstWithId(10) == Index::kNoEntry);
+        VerifyOrQuit(index.FindFirstWithToken(1) == Index::kNoEntry);
+
+        // Message IDs 10 and 14 share the same bucket.
+
+        SuccessOrQuit(index.Add(*messages[0], 10, 1));
+        SuccessOrQuit(index.Add(*messages[1], 14, 2));
+        SuccessOrQuit(index.Add(*messages[2], 10, 1));
+        SuccessOrQuit(index.Add(*messages[3], 7, 5));
+        VerifyOrQuit(index.GetNumEntries() == kCapacity);
+        VerifyOrQuit(!index.HasUnindexedWithId(8));
+        VerifyOrQuit(!index.HasUnindexedWithToken(8));
+
+        // Message ID 8 shares the bucket of 12 but not of 10, and
+        // token hash 8 shares the bucket of 4 but not of 5.
+
+        VerifyOrQuit(index.Add(*messages[4], 8, 8) == kErrorNoBufs);
+        VerifyOrQuit(index.GetNumEntries() == kCapacity);
+        VerifyOrQuit(index.HasUnindexedWithId(8));
+        VerifyOrQuit(index.HasUnindexedWithId(12));
+        VerifyOrQuit(!index.HasUnindexedWithId(10));
+        VerifyOrQuit(index.HasUnindexedWithToken(8));
+        VerifyOrQuit(index.HasUnindexedWithToken(4));
+        VerifyOrQuit(!index.HasUnindexedWithToken(5));
+        VerifyOrQuit(index.FindFirstWithId(8) == Index::kNoEntry);
+
+        entry = index.FindFirstWithId(10);
+        VerifyOrQuit(&index.GetMessage(entry) == messages[0]);
+        entry = index.FindNextWithId(entry);
+        VerifyOrQuit(&index.GetMessage(entry) == messages[2]);
+        VerifyOrQuit(index.FindNextWithId(entry) == Index::kNoEntry);
+
+        entry = index.FindFirstWithId(14);
+        VerifyOrQuit(&index.GetMessage(entry) == messages[1]);
+        VerifyOrQuit(index.FindNextWithId(entry) == Index::kNoEntry);
+
+        VerifyOrQuit(index.FindFirstWithId(6) == Index::kNoEntry);
+        VerifyOrQuit(index.FindFirstWithId(8) == Index::kNoEntry);
+
+        entry = index.FindFirstWithToken(1);
+        VerifyOrQuit(&index.GetMessage(entry) == messages[0]);
+        entry = index.FindNextWithToken(entry);
+        VerifyOrQuit(&index.GetMessage(entry) == messages[2]);
+        VerifyOrQuit(index.FindNextWithToken(entry) == Index::kNoEntry);
+
+        entry = index.FindFirstWithToken(5);
+        VerifyOrQuit(&index.GetMessage(entry) == messages[3]);
+        VerifyOrQuit(index.FindNextWithToken(entry) == Index::kNoEntry);
+
+        VerifyOrQuit(!index.Remove(*messages[4], 8, 8));
+        VerifyOrQuit(!index.HasUnindexedWithId(8));
+        VerifyOrQuit(!index.HasUnindexedWithToken(8));
+        VerifyOrQuit(index.GetNumEntries() == kCapacity);
+
+        VerifyOrQuit(index.Remove(*messages[0], 10, 1));
+        VerifyOrQuit(index.GetNumEntries() == kCapacity - 1);
+
+        entry = index.FindFirstWithId(10);
+        VerifyOrQuit(&index.GetMessage(entry) == messages[2]);
+        VerifyOrQuit(index.FindNextWithId(entry) == Index::kNoEntry);
+
+        entry = index.FindFirstWithToken(1);
+        VerifyOrQuit(&index.GetMessage(entry) == messages[2]);
+        VerifyOrQuit(index.FindNextWithToken(entry) == Index::kNoEntry);
+
+        SuccessOrQuit(index.Add(*messages[4], 10, 5));
+
+        entry = index.FindFirstWithId(10);
+        VerifyOrQuit(&index.GetMessage(entry) == messages[2]);
+        entry = index.FindNextWithId(entry);
+        VerifyOrQuit(&index.GetMessage(entry) == messages[4]);
+
+        entry = index.FindFirstWithToken(5);
+        VerifyOrQuit(&index.GetMessage(entry) == messages[3]);
+        entry = index.FindNextWithToken(entry);
+        VerifyOrQuit(&index.GetMessage(entry) == messages[4]);
+
+        index.Clear();
+        VerifyOrQuit(index.GetNumEntries() == 0);
+        VerifyOrQuit(index.FindFirstWithId(10) == Index::kNoEntry);
+        VerifyOrQuit(index.FindFirstWithToken(5) == Index::kNoEntry);
+
+        for (Coap::Message *message : messages)
+        {
+            message->Free();
+        }
+
+        testFreeInstance(instance);
+    }
+
+    static void TestPendingRequestLookup(void)
+    {
+        // Sends more requests than fit in the pending request index
+        // and checks that `FindRelatedRequest()` finds each of them by
+        // message ID (as for a received Ack) and by token (as for a
+        // separate response), both for indexed requests and for the
+        // ones which could not be indexed.
+
+        static constexpr uint16_t kNumUnindexed = 8;
+        static constexpr uint16_t kNumRequests  = Coap::CoapBase::kRequestIndexSize + kNumUnindexed;
+
+        static_assert(kNumUnindexed <= Coap::CoapBase::kRequestIndexSize, "kNumUnindexed is too large");
+
+        Instance                      *instance;
+        Ip6::MessageInfo               messageInfo;
+        uint16_t                       messageIds[kNumRequests];
+        Coap::Token                    tokens[kNumRequests];
+        uint16_t                       requestId;
+        uint16_t                       numResponses = 0;
+        Coap::CoapBase::LookupCounters counters;
+
+        printf("TestPendingRequestLookup()\n");
+
+        instance = static_cast<Instance *>(testInitInstance());
+        VerifyOrQuit(instance != nullptr);
+
+        {
+            TestCoap coap(*instance);
+
+            InitPeerMessageInfo(messageInfo);
+
+            for (uint16_t i = 0; i < kNumRequests; i++)
+            {
+                SendRequest(coap, messageInfo, i, messageIds[i], tokens[i], &numResponses);
+            }
+
+            VerifyOrQuit(coap.mPendingRequests.mRequestIndex.GetNumEntries() == Coap::CoapBase::kRequestIndexSize);
+
+            // Only the lookups in the buckets of the unindexed requests
+            // search through all the pending requests.
+
+            coap.ResetLookupCounters();
+
+            for (uint16_t i = 0; i < kNumRequests; i++)
+            {
+                SuccessOrQuit(FindRequestById(coap, messageInfo, messageIds[i], requestId));
+                VerifyOrQuit(requestId == messageIds[i]);
+            }
+
+            counters = coap.GetLookupCounters();
+            VerifyOrQuit(counters.mRequestLookups == kNumRequests);
+            VerifyOrQuit(counters.mRequestFullScans >= kNumUnindexed);
+            VerifyOrQuit(counters.mRequestFullScans < kNumRequests);
+
+            coap.ResetLookupCounters();
+
+            for (uint16_t i = 0; i < kNumRequests; i++)
+            {
+                SuccessOrQuit(FindRequestByToken(coap, messageInfo, tokens[i], requestId));
+                VerifyOrQuit(requestId == messageIds[i]);
+            }
+
+            counters = coap.GetLookupCounters();
+            VerifyOrQuit(counters.mRequestLookups == kNumRequests);
+            VerifyOrQuit(counters.mRequestFullScans >= kNumUnindexed);
+            VerifyOrQuit(counters.mRequestFullScans < kNumRequests);
+
+            // Requests which are not pending are not found.
+
+            VerifyOrQuit(FindRequestById(coap, messageInfo, messageIds[0] - 1, requestId) == kErrorNotFound);
+
+            // Receive the (piggybacked) responses to the requests which
+            // could not be indexed. Afterwards, no lookup searches
+            // through all the pending requests.
+
+            for (uint16_t i = Coap::CoapBase::kRequestIndexSize; i < kNumRequests; i++)
+            {
+                ReceiveResponse(coap, messageInfo, messageIds[i], tokens[i]);
+            }
+
+            VerifyOrQuit(numResponses == kNumUnindexed);
+
+            coap.ResetLookupCounters();
+
+            for (uint16_t i = 0; i < kNumRequests; i++)
+            {
+                if (i < Coap::CoapBase::kRequestIndexSize)
+                {
+                    SuccessOrQuit(FindRequestById(coap, messageInfo, messageIds[i], requestId));
+                    VerifyOrQuit(requestId == messageIds[i]);
+                    SuccessOrQuit(FindRequestByToken(coap, messageInfo, tokens[i], requestId));
+                    VerifyOrQuit(requestId == messageIds[i]);
+                }
+                else
+                {
+                    VerifyOrQuit(FindRequestById(coap, messageInfo, messageIds[i], requestId) == kErrorNotFound);
+                    VerifyOrQuit(FindRequestByToken(coap, messageInfo, tokens[i], requestId) == kErrorNotFound);
+                }
+            }
+
+            counters = coap.GetLookupCounters();
+            VerifyOrQuit(counters.mRequestLookups == 2 * kNumRequests);
+            VerifyOrQuit(counters.mRequestFullScans == 0);
+
+            // A new request is indexed again.
+
+            SendRequest(coap, messageInfo, kNumRequests, messageIds[0], tokens[0], &numResponses);
+            VerifyOrQuit(coap.mPendingRequests.mRequestIndex.GetNumEntries() ==
+                         Coap::CoapBase::kRequestIndexSize - kNumUnindexed + 1);
+
+            coap.ClearAllRequestsAndResponses();
+            VerifyOrQuit(coap.mPendingRequests.mRequestIndex.GetNumEntries() == 0);
+        }
+
+        testFreeInstance(instance);
+    }
+
+    static void BenchmarkRequestLookup(void)
+    {
+        // Looks up each pending request of a `CoapBase` by message ID
+        // (as for a received Ack) and by token (as for a separate
+        // response) using `FindRelatedRequest()`, and by checking
+        // every pending request in turn (as done without the index).
+        // The number of requests is limited by the message pool of
+        // the unit test build.
+
+        static constexpr uint16_t kNumRequests = Coap::CoapBase::kRequestIndexSize;
+        static constexpr uint32_t kNumRounds   = 2000;
+
+        Instance        *instance;
+        Ip6::MessageInfo messageInfo;
+        uint16_t         messageIds[kNumRequests];
+        Coap::Token      tokens[kNumRequests];
+        Coap::Message   *rxMessage;
+        uint64_t         startTime;
+        uint64_t         scanDuration;
+        uint64_t         indexDuration;
+
+        printf("BenchmarkRequestLookup()\n");
+
+        instance = static_cast<Instance *>(testInitInstance());
+        VerifyOrQuit(instance != nullptr);
+
+        {
+            TestCoap coap(*instance);
+
+            InitPeerMessageInfo(messageInfo);
+
+            for (uint16_t i = 0; i < kNumRequests; i++)
+            {
+                SendRequest(coap, messageInfo, i, messageIds[i], tokens[i], nullptr);
+            }
+
+            // The received messages (an Ack or a separate response for
+            // each request) reuse the same message.
+
+            rxMessage = coap.NewMessage();
+            VerifyOrQuit(rxMessage != nullptr);
+
+            scanDuration = 0;
+
+            for (uint32_t round = 0; round < kNumRounds; round++)
+            {
+                for (uint16_t i = 0; i < 2 * kNumRequests; i++)
+                {
+                    Coap::CoapBase::Request request;
+                    Coap::Msg               rxMsg(*rxMessage, messageInfo);
+                    bool                    found = false;
+
+                    InitRxMessage(rxMsg, i, messageIds, tokens);
+
+                    startTime = GetMonotonicTimeNs();
+
+                    for (Coap::Message &message : coap.mPendingRequests.mRequestMessages)
+                    {
+                        request.InitFrom(message);
+
+                        if (coap.mPendingRequests.IsRelatedRequest(rxMsg, request))
+                        {
+                            found = true;
+                            break;
+                        }
+                    }
+
+                    scanDuration += GetMonotonicTimeNs() - startTime;
+                    VerifyOrQuit(found);
+                }
+            }
+
+            indexDuration = 0;
+
+            for (uint32_t round = 0; round < kNumRounds; round++)
+            {
+                for (uint16_t i = 0; i < 2 * kNumRequests; i++)
+                {
+                    Coap::CoapBase::Request request;
+                    Coap::Msg               rxMsg(*rxMessage, messageInfo);
+
+                    InitRxMessage(rxMsg, i, messageIds, tokens);
+
+                    startTime = GetMonotonicTimeNs();
+                    SuccessOrQuit(coap.mPendingRequests.FindRelatedRequest(rxMsg, request));
+                    indexDuration += GetMonotonicTimeNs() - startTime;
+                }
+            }
+
+            VerifyOrQuit(coap.GetLookupCounters().mRequestFullScans == 0);
+
+            scanDuration /= static_cast<uint64_t>(kNumRounds) * kNumRequests * 2;
+            indexDuration /= static_cast<uint64_t>(kNumRounds) * kNumRequests * 2;
+
+            printf("  per lookup with %u requests: compare all %6lu ns, index %6lu ns\n", kNumRequests,
+                   ToUlong(static_cast<uint32_t>(scanDuration)), ToUlong(static_cast<uint32_t>(indexDuration)));
+
+            rxMessage->Free();
+            coap.ClearAllRequestsAndResponses();
+        }
+
+        testFreeInstance(instance);
+    }
+
+private:
+    class TestCoap : public Coap::CoapBase
+    {
+        // A CoAP agent whose transmitted messages are dropped.
+
+    public:
+        explicit TestCoap(Instance &aInstance)
+            : CoapBase(aInstance, Transmit)
+        {
+        }
+
+    private:
+        static Error Transmit(CoapBase &, ot::Message &aMessage, const Ip6::MessageInfo &)
+        {
+            aMessage.Free();
+            return kErrorNone;
+        }
+    };
+
+    static void InitPeerMessageInfo(Ip6::MessageInfo &aMessageInfo)
+    {
+        static constexpr uint16_t kPeerPort = 5683;
+
+        Ip6::Address peerAddress;
+
+        SuccessOrQuit(peerAddress.FromString("fd00::1234"));
+
+        aMessageInfo.Clear();
+        aMessageInfo.SetPeerAddr(peerAddress);
+        aMessageInfo.SetPeerPort(kPeerPort);
+    }
+
+    static void HandleResponse(void *aContext, Coap::Msg *aMsg, Error aResult)
+    {
+        if (aResult == kErrorNone)
+        {
+            VerifyOrQuit(aMsg != nullptr);
+            (*static_cast<uint16_t *>(aContext))++;
+        }
+    }
+
+    static void SendRequest(TestCoap               &aCoap,
+                            const Ip6::MessageInfo &aMessageInfo,
+                            uint16_t                aIndex,
+                            uint16_t               &aMessageId,
+                            Coap::Token            &aToken,
+                            uint16_t               *aNumResponses)
+    {
+        // Sends a confirmable request with a token derived from
+        // `aIndex`, and returns its message ID and token.
+
+        uint8_t        tokenBytes[Coap::Token::kMaxLength] = {0x5a, 0xa5, 0x3c, 0xc3, 0, 0, 0, 0};
+        Coap::Message *message;
+
+        BigEndian::WriteUint16(aIndex, &tokenBytes[sizeof(tokenBytes) - sizeof(uint16_t)]);
+        SuccessOrQuit(aToken.SetToken(tokenBytes, sizeof(tokenBytes)));
+
+        message = aCoap.NewMessage();
+        VerifyOrQuit(message != nullptr);
+
+        SuccessOrQuit(message->Init(Coap::kTypeConfirmable, Coap::kCodePost));
+        SuccessOrQuit(message->WriteToken(aToken));
+        SuccessOrQuit(message->AppendUriPathOptions("t"));
+
+        if (aNumResponses != nullptr)
+        {
+            SuccessOrQuit(aCoap.SendMessage(*message, aMessageInfo, HandleResponse, aNumResponses));
+        }
+        else
+        {
+            SuccessOrQuit(aCoap.SendMessage(*message, aMessageInfo, nullptr, nullptr));
+        }
+
+        // The new request is the last one in the pending queue.
+
+        for (const Coap::Message &pending : aCoap.mPendingRequests.mRequestMessages)
+        {
+            aMessageId = pending.ReadMessageId();
+        }
+    }
+
+    static void InitRxMessage(Coap::Msg         &aRxMsg,
+                              uint16_t           aIndex,
+                              const uint16_t    *aMessageIds,
+                              const Coap::Token *aTokens)
+    {
+        // Prepares an empty Ack for request `aIndex`, or for a larger
+        // `aIndex` a separate response for request `aIndex` minus the
+        // number of requests.
+
+        static constexpr uint16_t kNumRequests = Coap::CoapBase::kRequestIndexSize;
+
+        if (aIndex < kNumRequests)
+        {
+            SuccessOrQuit(aRxMsg.mMessage.Init(Coap::kTypeAck, Coap::kCodeEmpty, aMessageIds[aIndex]));
+        }
+        else
+        {
+            SuccessOrQuit(aRxMsg.mMessage.Init(Coap::kTypeNonConfirmable, Coap::kCodeContent, 0));
+            SuccessOrQuit(aRxMsg.mMessage.WriteToken(aTokens[aIndex - kNumRequests]));
+        }
+
+        SuccessOrQuit(aRxMsg.ParseHeaderAndOptions(Coap::Msg::kRejectIfNoPayloadWithPayloadMarker));
+    }
+
+    static Error FindRequest(TestCoap &aCoap, Coap::Msg &aRxMsg, uint16_t &aRequestId)
+    {
+        Coap::CoapBase::Request request;
+        Error                   error;
+
+        SuccessOrQuit(aRxMsg.ParseHeaderAndOptions(Coap::Msg::kRejectIfNoPayloadWithPayloadMarker));
+
+        error = aCoap.mPendingRequests.FindRelatedRequest(aRxMsg, request);
+
+        if (error == kErrorNone)
+        {
+            aRequestId = request.GetMessage().ReadMessageId();
+        }
+
+        aRxMsg.mMessage.Free();
+
+        return error;
+    }
+
+    static Error FindRequestById(TestCoap               &aCoap,
+                                 const Ip6::MessageInfo &aMessageInfo,
+                                 uint16_t                aMessageId,
+                                 uint16_t               &aRequestId)
+    {
+        // Finds the request related to an empty Ack with `aMessageId`.
+
+        Coap::Message *message = aCoap.NewMessage();
+        Coap::Msg      rxMsg(*message, aMessageInfo);
+
+        VerifyOrQuit(message != nullptr);
+        SuccessOrQuit(message->Init(Coap::kTypeAck, Coap::kCodeEmpty, aMessageId));
+
+        return FindRequest(aCoap, rxMsg, aRequestId);
+    }
+
+    static Error FindRequestByToken(TestCoap               &aCoap,
+                                    const Ip6::MessageInfo &aMessageInfo,
+                                    const Coap::Token      &aToken,
+                                    uint16_t               &aRequestId)
+    {
+        // Finds the request related to a separate response with `aToken`.
+
+        Coap::Message *message = aCoap.NewMessage();
+        Coap::Msg      rxMsg(*message, aMessageInfo);
+
+        VerifyOrQuit(message != nullptr);
+        SuccessOrQuit(message->Init(Coap::kTypeNonConfirmable, Coap::kCodeContent, 0));
+        SuccessOrQuit(message->WriteToken(aToken));
+
+        return FindRequest(aCoap, rxMsg, aRequestId);
+    }
+
+    static void ReceiveResponse(TestCoap               &aCoap,
+                                const Ip6::MessageInfo &aMessageInfo,
+                                uint16_t                aMessageId,
+                                const Coap::Token      &aToken)
+    {
+        // Receives a piggybacked response to the request with
+        // `aMessageId` and `aToken`.
+
+        Coap::Message *message = aCoap.NewMessage();
+
+        VerifyOrQuit(message != nullptr);
+        SuccessOrQuit(message->Init(Coap::kTypeAck, Coap::kCodeContent, aMessageId));
+        SuccessOrQuit(message->WriteToken(aToken));
+
+        aCoap.Receive(*message, aMessageInfo);
+        message->Free();
+    }
+
+    static const Coap::Resource *FindResource(const Coap::CoapBase::ResourceTable<Coap::Resource> &aTable,
+                                              const char                                          *aUriPath)
+    {
+        const Coap::Resource *match = nullptr;
+
+        for (const Coap::Resource &resource : aTable.GetListFor(aUriPath))
+        {
+            if (StringMatch(resource.GetUriPath(), aUriPath))
+            {
+                match = &resource;
+                break;
+            }
+        }
+
+        return match;
+    }
+};
+
+} // namespace ot
+
+int main(void)
+{
+    ot::UnitTester::TestResourceTable();
+    ot::UnitTester::TestMessageIndex();
+    ot::UnitTester::TestPendingRequestLookup();
+    ot::UnitTester::BenchmarkRequestLookup();
+
+    printf("All tests passed\n");
+    return 0;
+}
@@ -26,6 +26,8 @@
  *  POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <stdlib.h>
+
 #include "common/crc.hpp"
 
 #include "test_platform.h"
@@ -105,12 +107,127 @@ void TestCrc32(void)
     }
 }
 
+template <typename UintType> UintType CalculateBitwiseCrc(UintType aPolynomial, const uint8_t *aData, uint16_t aLength)
+{
+    // Reference implementation feeding one bit at a time.
+
+    static constexpr uint8_t kNumBits = sizeof(UintType) * kBitsPerByte;
+
+    UintType crc = 0;
+
+    for (uint16_t i = 0; i < aLength; i++)
+    {
+        crc ^= static_cast<UintType>(static_cast<UintType>(aData[i]) << (kNumBits - kBitsPerByte));
+
+        for (uint8_t bit = 0; bit < kBitsPerByte; bit++)
+        {
+            bool msbIsSet = (crc >> (kNumBits - 1));
+
+            crc = static_cast<UintType>(crc << 1);
+
+            if (msbIsSet)
+            {
+                crc ^= aPolynomial;
+            }
+        }
+    }
+
+    return crc;
+}
+
+void FillRandom(uint8_t *aBuffer, uint16_t aLength)
+{
+    for (uint16_t i = 0; i < aLength; i++)
+    {
+        aBuffer[i] = static_cast<uint8_t>(rand());
+    }
+}
+
+template <typename UintType> void TestCrcSplitFeeds(UintType aPolynomial)
+{
+    // Feeds random data split at random positions using both
+    // `FeedByte()` and `FeedBytes()` and cross-checks the result
+    // against the bit-wise reference.
+
+    static constexpr uint16_t kMaxLength     = 1500;
+    static constexpr uint16_t kNumIterations = 2000;
+
+    uint8_t buffer[kMaxLength];
+
+    printf("TestCrcSplitFeeds(0x%lx)\n", ToUlong(aPolynomial));
+
+    for (uint16_t iter = 0; iter < kNumIterations; iter++)
+    {
+        CrcCalculator<UintType> crc(aPolynomial);
+        uint16_t                length = static_cast<uint16_t>(rand() % (kMaxLength + 1));
+        uint16_t                offset = 0;
+
+        FillRandom(buffer, length);
+
+        while (offset < length)
+        {
+            uint16_t feedLength = static_cast<uint16_t>(rand() % (length - offset + 1));
+
+            if ((feedLength > 0) && ((iter % 4) == 0))
+            {
+                feedLength = 1;
+                crc.FeedByte(buffer[offset]);
+            }
+            else
+            {
+                crc.FeedBytes(&buffer[offset], feedLength);
+            }
+
+            offset += feedLength;
+            VerifyOrQuit(crc.GetCrc() == CalculateBitwiseCrc<UintType>(aPolynomial, buffer, offset));
+        }
+    }
+}
+
+template <typename UintType> void BenchmarkCrc(UintType aPolynomial)
+{
+    static constexpr uint16_t kLength    = 1280;
+    static constexpr uint32_t kNumRounds = 2000;
+
+    uint8_t  buffer[kLength];
+    UintType expectedCrc;
+    uint64_t startTime;
+    uint64_t duration;
+
+    FillRandom(buffer, sizeof(buffer));
+    expectedCrc = CalculateBitwiseCrc<UintType>(aPolynomial, buffer, kLength);
+
+    startTime = GetMonotonicTimeNs();
+
+    for (uint32_t round = 0; round < kNumRounds; round++)
+    {
+        CrcCalculator<UintType> crc(aPolynomial);
+
+        VerifyOrQuit(crc.FeedBytes(buffer, kLength) == expectedCrc);
+    }
+
+    duration = GetMonotonicTimeNs() - startTime;
+
+    // Throughput in MB/s is the number of bytes per microsecond.
+    printf("BenchmarkCrc(0x%lx): %u bytes, %lu ns, %lu MB/s\n", ToUlong(aPolynomial), kLength,
+           ToUlong(static_cast<uint32_t>(duration / kNumRounds)),
+           ToUlong(static_cast<uint32_t>((static_cast<uint64_t>(kLength) * kNumRounds * 1000) / (duration + 1))));
+}
+
 } // namespace ot
 
 int main(void)
 {
     ot::TestCrc16();
     ot::TestCrc32();
+
+    ot::TestCrcSplitFeeds<uint16_t>(ot::kCrc16CcittPolynomial);
+    ot::TestCrcSplitFeeds<uint16_t>(ot::kCrc16AnsiPolynomial);
+    ot::TestCrcSplitFeeds<uint32_t>(ot::kCrc32AnsiPolynomial);
+    ot::TestCrcSplitFeeds<uint16_t>(0x8bb7); // CRC16-T10-DIF (no lookup table)
+
+    ot::BenchmarkCrc<uint16_t>(ot::kCrc16CcittPolynomial);
+    ot::BenchmarkCrc<uint32_t>(ot::kCrc32AnsiPolynomial);
     printf("All tests passed\n");
     return 0;
 }
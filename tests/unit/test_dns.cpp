@@ -1169,6 +1169,414 @@ void TestDnsCompressedName(void)
     testFreeInstance(instance);
 }
 
+void TestDnsNameCompressDictionary(void)
+{
+    static constexpr uint8_t kHeaderOffset = 10;
+
+    const char kName1[]         = "host.example.com.";
+    const char kName1Upper[]    = "HOST.Example.COM";
+    const char kName2[]         = "other.example.com";
+    const char kInstanceLabel[] = "Human.Readable";
+    const char kDomain[]        = "example.com.";
+    const char kName4[]         = "new.name.org.";
+    const char kBadName[]       = "bad..name";
+
+    static const char kExpectedReadName2[] = "other.example.com.";
+
+    Instance                      *instance;
+    Message                       *message;
+    Dns::Name::CompressDictionary *dictionary;
+    Dns::Name::Buffer              name;
+    uint16_t                       offset;
+    uint16_t                       length;
+    uint16_t                       name1Offset;
+    uint16_t                       nameOffset;
+    uint8_t                        numEntries;
+
+    printf("================================================================\n");
+    printf("TestDnsNameCompressDictionary()\n");
+
+    instance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(instance != nullptr, "Null OpenThread instance");
+
+    dictionary = new Dns::Name::CompressDictionary();
+    VerifyOrQuit((message = instance->Get<MessagePool>().Allocate(Message::kTypeIp6)) != nullptr);
+
+    for (uint8_t index = 0; index < kHeaderOffset + sizeof(Dns::Header); index++)
+    {
+        SuccessOrQuit(message->Append(index));
+    }
+
+    message->SetOffset(kHeaderOffset);
+
+    // Append name1 "host.example.com." which is appended in full.
+
+    length = message->GetLength();
+    SuccessOrQuit(Dns::Name::AppendName(nullptr, kName1, *message, *dictionary, name1Offset));
+    VerifyOrQuit(name1Offset == length - kHeaderOffset);
+    VerifyOrQuit(message->GetLength() - length == sizeof(kName1));
+    VerifyOrQuit(dictionary->GetNumEntries() == 3);
+
+    offset = name1Offset + kHeaderOffset;
+    SuccessOrQuit(Dns::Name::CompareName(*message, offset, kName1));
+    VerifyOrQuit(dictionary->Find(*message, nullptr, "host", kDomain) == name1Offset);
+    VerifyOrQuit(dictionary->Find(*message, nullptr, nullptr, "com") == name1Offset + sizeof("host.example"));
+
+    // Append name1 again (using different case), it should be a single
+    // pointer label to name1.
+
+    length = message->GetLength();
+    SuccessOrQuit(Dns::Name::AppendName(nullptr, kName1Upper, *message, *dictionary, nameOffset));
+    VerifyOrQuit(nameOffset == name1Offset);
+    VerifyOrQuit(message->GetLength() - length == sizeof(uint16_t));
+    VerifyOrQuit(dictionary->GetNumEntries() == 3);
+
+    offset = length;
+    SuccessOrQuit(Dns::Name::CompareName(*message, offset, kName1));
+    VerifyOrQuit(offset == message->GetLength());
+
+    // Append name2 "other.example.com" which shares "example.com" with
+    // name1.
+
+    length = message->GetLength();
+    SuccessOrQuit(Dns::Name::AppendName(kName2, *message, *dictionary));
+    VerifyOrQuit(message->GetLength() - length == sizeof("other") + sizeof(uint16_t));
+    VerifyOrQuit(dictionary->GetNumEntries() == 4);
+
+    offset = length;
+    SuccessOrQuit(Dns::Name::ReadName(*message, offset, name));
+    VerifyOrQuit(strcmp(name, kExpectedReadName2) == 0);
+    VerifyOrQuit(offset == message->GetLength());
+
+    // Append name3 with a first label containing a dot character.
+
+    length = message->GetLength();
+    SuccessOrQuit(Dns::Name::AppendName(kInstanceLabel, kDomain, *message, *dictionary, nameOffset));
+    VerifyOrQuit(nameOffset == length - kHeaderOffset);
+    VerifyOrQuit(message->GetLength() - length == sizeof(kInstanceLabel) + sizeof(uint16_t));
+    VerifyOrQuit(Dns::Name(*message, length).Matches(kInstanceLabel, nullptr, kDomain));
+    VerifyOrQuit(dictionary->Find(*message, kInstanceLabel, nullptr, kDomain) == nameOffset);
+
+    length = message->GetLength();
+    SuccessOrQuit(Dns::Name::AppendName(kInstanceLabel, kDomain, *message, *dictionary, offset));
+    VerifyOrQuit(offset == nameOffset);
+    VerifyOrQuit(message->GetLength() - length == sizeof(uint16_t));
+
+    // Check that entries added after a saved state are removed by
+    // `RestoreNumEntries()`.
+
+    numEntries = dictionary->GetNumEntries();
+    SuccessOrQuit(Dns::Name::AppendName(kName4, *message, *dictionary));
+    VerifyOrQuit(dictionary->GetNumEntries() == numEntries + 3);
+    VerifyOrQuit(dictionary->Find(*message, nullptr, kName4, nullptr) != Dns::Name::CompressDictionary::kUnknownOffset);
+
+    dictionary->RestoreNumEntries(numEntries);
+    VerifyOrQuit(dictionary->GetNumEntries() == numEntries);
+    VerifyOrQuit(dictionary->Find(*message, nullptr, kName4, nullptr) == Dns::Name::CompressDictionary::kUnknownOffset);
+    VerifyOrQuit(dictionary->Find(*message, nullptr, kName1, nullptr) == name1Offset);
+
+    // Root name and invalid names.
+
+    length = message->GetLength();
+    SuccessOrQuit(Dns::Name::AppendName(".", *message, *dictionary));
+    VerifyOrQuit(message->GetLength() - length == 1);
+
+    length = message->GetLength();
+    VerifyOrQuit(Dns::Name::AppendName(kBadName, *message, *dictionary) == kErrorInvalidArgs);
+    VerifyOrQuit(message->GetLength() == length);
+    VerifyOrQuit(dictionary->GetNumEntries() == numEntries);
+
+    // Append name from a message using `AppendTo()`.
+
+    length = message->GetLength();
+    SuccessOrQuit(Dns::Name(*message, name1Offset + kHeaderOffset).AppendTo(*message, *dictionary));
+    VerifyOrQuit(message->GetLength() - length == sizeof(uint16_t));
+
+    dictionary->Clear();
+    VerifyOrQuit(dictionary->GetNumEntries() == 0);
+    VerifyOrQuit(dictionary->Find(*message, nullptr, kName1, nullptr) == Dns::Name::CompressDictionary::kUnknownOffset);
+
+    printf("PASS\n\n");
+
+    message->Free();
+    delete dictionary;
+    testFreeInstance(instance);
+}
+
+void TestDnsNameCompressDictionaryOverflow(void)
+{
+    // Appends more names than fit in the dictionary itself, then
+    // appends each of them again. Every repeated name must be a
+    // single pointer label, including the ones added to the entries
+    // allocated from the heap.
+
+    static constexpr uint16_t kNumNames = OPENTHREAD_CONFIG_DNS_NAME_COMPRESS_DICTIONARY_SIZE + 8;
+
+    Instance                      *instance;
+    Message                       *message;
+    Dns::Name::CompressDictionary *dictionary;
+    Dns::Name::Buffer              names[kNumNames];
+    uint16_t                       nameOffsets[kNumNames];
+    uint16_t                       offset;
+    uint16_t                       length;
+    uint16_t                       numEntries;
+
+    printf("================================================================\n");
+    printf("TestDnsNameCompressDictionaryOverflow()\n");
+
+    instance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(instance != nullptr, "Null OpenThread instance");
+
+    dictionary = new Dns::Name::CompressDictionary();
+    VerifyOrQuit((message = instance->Get<MessagePool>().Allocate(Message::kTypeIp6)) != nullptr);
+
+    SuccessOrQuit(message->Append(Dns::Header()));
+
+    // Each name adds one entry (for its first label) after the first
+    // name, which also adds "example.org" and "org".
+
+    for (uint16_t i = 0; i < kNumNames; i++)
+    {
+        snprintf(names[i], sizeof(names[i]), "name-%02u.example.org.", i);
+
+        length = message->GetLength();
+        SuccessOrQuit(Dns::Name::AppendName(nullptr, names[i], *message, *dictionary, nameOffsets[i]));
+        VerifyOrQuit(nameOffsets[i] == length);
+
+        if (i > 0)
+        {
+            VerifyOrQuit(message->GetLength() - length == sizeof("name-00") + sizeof(uint16_t));
+        }
+    }
+
+    VerifyOrQuit(dictionary->GetNumEntries() == kNumNames + 2);
+
+    for (uint16_t i = 0; i < kNumNames; i++)
+    {
+        VerifyOrQuit(dictionary->Find(*message, nullptr, names[i], nullptr) == nameOffsets[i]);
+    }
+
+    length = message->GetLength();
+
+    for (uint16_t i = 0; i < kNumNames; i++)
+    {
+        SuccessOrQuit(Dns::Name::AppendName(names[i], *message, *dictionary));
+    }
+
+    VerifyOrQuit(message->GetLength() - length == kNumNames * sizeof(uint16_t));
+
+    offset = length;
+
+    for (uint16_t i = 0; i < kNumNames; i++)
+    {
+        SuccessOrQuit(Dns::Name::CompareName(*message, offset, names[i]));
+    }
+
+    VerifyOrQuit(offset == message->GetLength());
+
+    // A name which is not in the message is not found.
+
+    VerifyOrQuit(dictionary->Find(*message, nullptr, "name-99.example.org", nullptr) ==
+                 Dns::Name::CompressDictionary::kUnknownOffset);
+
+    // An encoded name in record data (e.g., in a TXT record) is not
+    // a name appended through the dictionary and must not be used
+    // for compression.
+
+    {
+        static const uint8_t kTxtData[] = {7, 'n', 'a', 'm', 'e', '-', '9', '9', 7, 'e', 'x',
+                                           'a', 'm', 'p', 'l', 'e', 3,   'o', 'r', 'g', 0};
+
+        SuccessOrQuit(message->AppendBytes(kTxtData, sizeof(kTxtData)));
+
+        length = message->GetLength();
+        SuccessOrQuit(Dns::Name::AppendName("name-99.example.org", *message, *dictionary));
+        VerifyOrQuit(message->GetLength() - length == sizeof("name-99") + sizeof(uint16_t));
+    }
+
+    // Removing entries allocated from the heap keeps the earlier ones.
+
+    numEntries = dictionary->GetNumEntries();
+    dictionary->RestoreNumEntries(numEntries - 2);
+    VerifyOrQuit(dictionary->Find(*message, nullptr, "name-99.example.org", nullptr) ==
+                 Dns::Name::CompressDictionary::kUnknownOffset);
+    VerifyOrQuit(dictionary->Find(*message, nullptr, names[kNumNames - 1], nullptr) ==
+                 Dns::Name::CompressDictionary::kUnknownOffset);
+    VerifyOrQuit(dictionary->Find(*message, nullptr, names[kNumNames - 2], nullptr) == nameOffsets[kNumNames - 2]);
+    VerifyOrQuit(dictionary->Find(*message, nullptr, names[0], nullptr) == nameOffsets[0]);
+
+    dictionary->RestoreNumEntries(OPENTHREAD_CONFIG_DNS_NAME_COMPRESS_DICTIONARY_SIZE);
+    VerifyOrQuit(dictionary->GetNumEntries() == OPENTHREAD_CONFIG_DNS_NAME_COMPRESS_DICTIONARY_SIZE);
+    VerifyOrQuit(dictionary->Find(*message, nullptr, names[0], nullptr) == nameOffsets[0]);
+
+    printf("PASS\n\n");
+
+    message->Free();
+    delete dictionary;
+    testFreeInstance(instance);
+}
+
+static void AppendNameByComparing(const char *aName, Message &aMessage, uint16_t *aOffsets, uint16_t &aNumOffsets)
+{
+    // Compresses `aName` by comparing each of its suffixes (longest
+    // first) against every name suffix appended earlier in the
+    // message, i.e., without a compression dictionary.
+
+    const char *suffix      = aName;
+    uint16_t    matchOffset = 0;
+
+    while ((*suffix != '\0') && (matchOffset == 0))
+    {
+        for (uint16_t i = aNumOffsets; i > 0; i--)
+        {
+            uint16_t offset = aOffsets[i - 1] + aMessage.GetOffset();
+
+            if (Dns::Name::CompareName(aMessage, offset, suffix) == kErrorNone)
+            {
+                matchOffset = aOffsets[i - 1];
+                break;
+            }
+        }
+
+        if (matchOffset == 0)
+        {
+            suffix = strchr(suffix, '.') + 1;
+        }
+    }
+
+    for (const char *label = aName; label != suffix;)
+    {
+        const char            *dot = strchr(label, '.');
+        Dns::Name::LabelBuffer labelBuffer;
+
+        memcpy(labelBuffer, label, static_cast<size_t>(dot - label));
+        labelBuffer[dot - label] = '\0';
+
+        aOffsets[aNumOffsets++] = aMessage.GetLength() - aMessage.GetOffset();
+        SuccessOrQuit(Dns::Name::AppendLabel(labelBuffer, aMessage));
+
+        label = dot + 1;
+    }
+
+    if (matchOffset != 0)
+    {
+        SuccessOrQuit(Dns::Name::AppendPointerLabel(matchOffset, aMessage));
+    }
+    else
+    {
+        SuccessOrQuit(Dns::Name::AppendTerminator(aMessage));
+    }
+}
+
+void BenchmarkDnsNameCompression(void)
+{
+    // Builds a response with 50 SRV records (instance names under
+    // the same service type, and a few shared host names), once by
+    // comparing each name against all earlier names in the message
+    // and once using a compression dictionary. Both must generate the
+    // same message.
+
+    static constexpr uint16_t kNumRecords = 50;
+    static constexpr uint16_t kNumHosts   = 5;
+    static constexpr uint32_t kNumRounds  = 100;
+    static constexpr uint16_t kMaxOffsets = kNumRecords * 8;
+
+    Instance                      *instance;
+    Message                       *message;
+    Message                       *message2;
+    Dns::Name::CompressDictionary *dictionary;
+    Dns::Name::Buffer              instanceNames[kNumRecords];
+    Dns::Name::Buffer              hostNames[kNumHosts];
+    uint16_t                       offsets[kMaxOffsets];
+    uint16_t                       numOffsets;
+    Dns::SrvRecord                 srvRecord;
+    Dns::Header                    header;
+    uint64_t                       startTime;
+    uint64_t                       compareDuration;
+    uint64_t                       dictionaryDuration;
+
+    printf("================================================================\n");
+    printf("BenchmarkDnsNameCompression()\n");
+
+    instance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(instance != nullptr, "Null OpenThread instance");
+
+    dictionary = new Dns::Name::CompressDictionary();
+
+    for (uint16_t i = 0; i < kNumRecords; i++)
+    {
+        snprintf(instanceNames[i], sizeof(instanceNames[i]), "instance-%02u._srv._udp.default.service.arpa.", i);
+    }
+
+    for (uint16_t i = 0; i < kNumHosts; i++)
+    {
+        snprintf(hostNames[i], sizeof(hostNames[i]), "host-%u.default.service.arpa.", i);
+    }
+
+    header.Clear();
+    srvRecord.Init();
+
+    message  = nullptr;
+    message2 = nullptr;
+
+    startTime = GetMonotonicTimeNs();
+
+    for (uint32_t round = 0; round < kNumRounds; round++)
+    {
+        if (message != nullptr)
+        {
+            message->Free();
+        }
+
+        VerifyOrQuit((message = instance->Get<MessagePool>().Allocate(Message::kTypeOther)) != nullptr);
+        SuccessOrQuit(message->Append(header));
+        numOffsets = 0;
+
+        for (uint16_t i = 0; i < kNumRecords; i++)
+        {
+            AppendNameByComparing(instanceNames[i], *message, offsets, numOffsets);
+            SuccessOrQuit(message->Append(srvRecord));
+            AppendNameByComparing(hostNames[i % kNumHosts], *message, offsets, numOffsets);
+        }
+    }
+
+    compareDuration = GetMonotonicTimeNs() - startTime;
+    startTime       = GetMonotonicTimeNs();
+
+    for (uint32_t round = 0; round < kNumRounds; round++)
+    {
+        if (message2 != nullptr)
+        {
+            message2->Free();
+        }
+
+        VerifyOrQuit((message2 = instance->Get<MessagePool>().Allocate(Message::kTypeOther)) != nullptr);
+        SuccessOrQuit(message2->Append(header));
+        dictionary->Clear();
+
+        for (uint16_t i = 0; i < kNumRecords; i++)
+        {
+            SuccessOrQuit(Dns::Name::AppendName(instanceNames[i], *message2, *dictionary));
+            SuccessOrQuit(message2->Append(srvRecord));
+            SuccessOrQuit(Dns::Name::AppendName(hostNames[i % kNumHosts], *message2, *dictionary));
+        }
+    }
+
+    dictionaryDuration = GetMonotonicTimeNs() - startTime;
+
+    VerifyOrQuit(message->GetLength() == message2->GetLength());
+    VerifyOrQuit(message->CompareBytes(0, *message2, 0, message->GetLength()));
+
+    printf("  %u records, %u bytes: compare with earlier names %6lu ns, dictionary %6lu ns\n", kNumRecords,
+           message->GetLength(), ToUlong(static_cast<uint32_t>(compareDuration / kNumRounds)),
+           ToUlong(static_cast<uint32_t>(dictionaryDuration / kNumRounds)));
+
+    message->Free();
+    message2->Free();
+    delete dictionary;
+    testFreeInstance(instance);
+}
+
 void TestHeaderAndResourceRecords(void)
 {
     static constexpr uint8_t  kHeaderOffset    = 0;
@@ -1877,6 +2285,9 @@ int main(void)
 {
     ot::TestDnsName();
     ot::TestDnsCompressedName();
+    ot::TestDnsNameCompressDictionary();
+    ot::TestDnsNameCompressDictionaryOverflow();
+    ot::BenchmarkDnsNameCompression();
     ot::TestHeaderAndResourceRecords();
     ot::TestDnsTxtEntry();
 
@@ -0,0 +1,128 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <openthread/config.h>
+
+#include "test_platform.h"
+#include "test_util.hpp"
+
+#include "common/hash_index.hpp"
+
+namespace ot {
+
+// The hash of a key is the key divided by `kKeysPerHash`, so that
+// several keys share each hash value. With only a few slots, many
+// hash values also share the same home slot.
+static constexpr uint16_t kKeysPerHash = 3;
+
+static uint32_t HashOf(uint16_t aKey) { return aKey / kKeysPerHash; }
+
+template <uint16_t kSize> static bool Contains(const HashIndex<uint16_t, kSize> &aIndex, uint16_t aKey)
+{
+    uint32_t hash     = HashOf(aKey);
+    bool     contains = false;
+
+    for (uint16_t slot = aIndex.FindFirst(hash); slot != aIndex.kNotFound; slot = aIndex.FindNext(hash, slot))
+    {
+        if (aIndex.GetValueAt(slot) == aKey)
+        {
+            VerifyOrQuit(!contains);
+            contains = true;
+        }
+    }
+
+    return contains;
+}
+
+template <uint16_t kSize> void TestHashIndex(void)
+{
+    static constexpr uint16_t kNumKeys       = 4 * kSize;
+    static constexpr uint16_t kNumOperations = 20000;
+
+    HashIndex<uint16_t, kSize> index;
+    bool                       added[kNumKeys];
+    uint16_t                   numAdded = 0;
+
+    printf("TestHashIndex<%u>\n", kSize);
+
+    memset(added, 0, sizeof(added));
+
+    VerifyOrQuit(index.GetNumEntries() == 0);
+    VerifyOrQuit(index.FindFirst(0) == index.kNotFound);
+    VerifyOrQuit(index.Remove(HashOf(0), 0) == kErrorNotFound);
+
+    for (uint16_t iter = 0; iter < kNumOperations; iter++)
+    {
+        uint16_t key = static_cast<uint16_t>(rand() % kNumKeys);
+
+        if (added[key])
+        {
+            SuccessOrQuit(index.Remove(HashOf(key), key));
+            added[key] = false;
+            numAdded--;
+        }
+        else if (numAdded < index.kMaxEntries)
+        {
+            SuccessOrQuit(index.Add(HashOf(key), key));
+            added[key] = true;
+            numAdded++;
+        }
+        else
+        {
+            VerifyOrQuit(index.Add(HashOf(key), key) == kErrorNoBufs);
+        }
+
+        VerifyOrQuit(index.GetNumEntries() == numAdded);
+
+        for (uint16_t i = 0; i < kNumKeys; i++)
+        {
+            VerifyOrQuit(Contains(index, i) == added[i]);
+        }
+    }
+
+    index.Clear();
+    VerifyOrQuit(index.GetNumEntries() == 0);
+
+    for (uint16_t i = 0; i < kNumKeys; i++)
+    {
+        VerifyOrQuit(!Contains(index, i));
+    }
+}
+
+} // namespace ot
+
+int main(void)
+{
+    ot::TestHashIndex<2>();
+    ot::TestHashIndex<7>();
+    ot::TestHashIndex<16>();
+    ot::TestHashIndex<64>();
+
+    printf("All tests passed\n");
+    return 0;
+}
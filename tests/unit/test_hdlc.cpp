@@ -33,7 +33,7 @@
 #include "lib/hdlc/hdlc.hpp"
 #include "lib/spinel/multi_frame_buffer.hpp"
 
-#include "test_util.h"
+#include "test_util.hpp"
 
 namespace ot {
 namespace Ncp {
@@ -105,6 +105,7 @@ void TestHdlcFrameBuffer(void)
     VerifyOrQuit(memcmp(frameBuffer.GetFrame(), sMottoText, frameBuffer.GetLength()) == 0);
 
     frameBuffer.Clear();
+    VerifyOrQuit(frameBuffer.GetRemainingLength() == kBufferSize);
     VerifyOrQuit(frameBuffer.CanWrite(kBufferSize));
     VerifyOrQuit(frameBuffer.CanWrite(kBufferSize + 1) == false, "CanWrite(kBufferSize + 1) did not fail as expected");
 
@@ -115,8 +116,28 @@ void TestHdlcFrameBuffer(void)
     }
 
     VerifyOrQuit(frameBuffer.CanWrite(1) == false, "did not fail with full buffer");
+    VerifyOrQuit(frameBuffer.GetRemainingLength() == 0);
     VerifyOrQuit(frameBuffer.WriteByte(0) == OT_ERROR_NO_BUFS, "did not fail with full buffer");
 
+    frameBuffer.Clear();
+    SuccessOrQuit(frameBuffer.WriteBytes(sOpenThreadText, sizeof(sOpenThreadText) - 1));
+    SuccessOrQuit(frameBuffer.WriteBytes(sHelloText, sizeof(sHelloText) - 1));
+    VerifyOrQuit(frameBuffer.GetLength() == sizeof(sOpenThreadText) + sizeof(sHelloText) - 2);
+    VerifyOrQuit(memcmp(frameBuffer.GetFrame(), sOpenThreadText, sizeof(sOpenThreadText) - 1) == 0);
+    VerifyOrQuit(memcmp(frameBuffer.GetFrame() + sizeof(sOpenThreadText) - 1, sHelloText, sizeof(sHelloText) - 1) == 0);
+
+    while (frameBuffer.CanWrite(sizeof(sHexText)))
+    {
+        SuccessOrQuit(frameBuffer.WriteBytes(sHexText, sizeof(sHexText)));
+    }
+
+    {
+        uint16_t length = frameBuffer.GetLength();
+
+        VerifyOrQuit(frameBuffer.WriteBytes(sHexText, sizeof(sHexText)) == OT_ERROR_NO_BUFS);
+        VerifyOrQuit(frameBuffer.GetLength() == length, "WriteBytes() changed the buffer on failure");
+    }
+
     printf(" -- PASS\n");
 }
 
@@ -627,7 +648,24 @@ void TestFuzzEncoderDecoder(void)
         VerifyOrQuit(encoderBuffer.GetLength() > length, "Encoded frame is too short");
 
         decoderContext.mWasCalled = false;
-        decoder.Decode(encoderBuffer.GetFrame(), encoderBuffer.GetLength());
+
+        if (iter % 2)
+        {
+            decoder.Decode(encoderBuffer.GetFrame(), encoderBuffer.GetLength());
+        }
+        else
+        {
+            // Feed the encoded frame to decoder in randomly sized chunks.
+
+            for (uint16_t offset = 0; offset < encoderBuffer.GetLength();)
+            {
+                uint16_t chunkLength = static_cast<uint16_t>(GetRandom(encoderBuffer.GetLength() - offset) + 1);
+
+                decoder.Decode(encoderBuffer.GetFrame() + offset, chunkLength);
+                offset += chunkLength;
+            }
+        }
+
         VerifyOrQuit(decoderContext.mWasCalled);
         VerifyOrQuit(decoderContext.mError == OT_ERROR_NONE, "Decoder::Decode() returned incorrect error code");
 
@@ -637,9 +675,82 @@ void TestFuzzEncoderDecoder(void)
                      "Decoded frame content does not match original frame");
     }
 
+    // Verify that `Decoder` reports `OT_ERROR_NO_BUFS` when the decoded
+    // frame does not fit in the buffer.
+
+    {
+        Spinel::FrameBuffer<kMaxFrameLength / 2> smallBuffer;
+
+        decoder.Init(smallBuffer, ProcessDecodedFrame, &decoderContext);
+
+        for (uint16_t i = 0; i < kMaxFrameLength; i++)
+        {
+            frame[i] = static_cast<uint8_t>(i);
+        }
+
+        encoderBuffer.Clear();
+        SuccessOrQuit(encoder.BeginFrame());
+        SuccessOrQuit(encoder.Encode(frame, kMaxFrameLength));
+        SuccessOrQuit(encoder.EndFrame());
+
+        decoderContext.mWasCalled = false;
+        decoder.Decode(encoderBuffer.GetFrame(), encoderBuffer.GetLength());
+        VerifyOrQuit(decoderContext.mWasCalled);
+        VerifyOrQuit(decoderContext.mError == OT_ERROR_NO_BUFS);
+    }
+
     printf(" -- PASS\n");
 }
 
+void BenchmarkEncoderDecoder(void)
+{
+    static constexpr uint16_t kFrameLength = 1280;
+    static constexpr uint32_t kNumFrames   = 20000;
+
+    uint8_t                          frame[kFrameLength];
+    Spinel::FrameBuffer<kBufferSize> encoderBuffer;
+    Spinel::FrameBuffer<kBufferSize> decoderBuffer;
+    DecoderContext                   decoderContext;
+    Hdlc::Encoder                    encoder(encoderBuffer);
+    Hdlc::Decoder                    decoder;
+    uint64_t                         startTime;
+    uint64_t                         encodeDuration = 0;
+    uint64_t                         decodeDuration = 0;
+
+    printf("Benchmarking Hdlc::Encoder and Hdlc::Decoder with %u-byte frames\n", kFrameLength);
+
+    for (uint16_t i = 0; i < kFrameLength; i++)
+    {
+        frame[i] = static_cast<uint8_t>(GetRandom(256));
+    }
+
+    decoder.Init(decoderBuffer, ProcessDecodedFrame, &decoderContext);
+
+    for (uint32_t iter = 0; iter < kNumFrames; iter++)
+    {
+        encoderBuffer.Clear();
+        decoderBuffer.Clear();
+
+        startTime = GetMonotonicTimeNs();
+        SuccessOrQuit(encoder.BeginFrame());
+        SuccessOrQuit(encoder.Encode(frame, kFrameLength));
+        SuccessOrQuit(encoder.EndFrame());
+        encodeDuration += GetMonotonicTimeNs() - startTime;
+
+        decoderContext.mWasCalled = false;
+        startTime                 = GetMonotonicTimeNs();
+        decoder.Decode(encoderBuffer.GetFrame(), encoderBuffer.GetLength());
+        decodeDuration += GetMonotonicTimeNs() - startTime;
+
+        VerifyOrQuit(decoderContext.mWasCalled);
+        VerifyOrQuit(decoderContext.mError == OT_ERROR_NONE);
+        VerifyOrQuit(decoderBuffer.GetLength() == kFrameLength);
+    }
+
+    printf("  Encode: %lu frames/sec\n", static_cast<unsigned long>(kNumFrames * 1000000000ull / (encodeDuration + 1)));
+    printf("  Decode: %lu frames/sec\n", static_cast<unsigned long>(kNumFrames * 1000000000ull / (decodeDuration + 1)));
+}
+
 } // namespace Ncp
 } // namespace ot
 
@@ -649,6 +760,7 @@ int main(void)
     ot::Ncp::TestSpinelMultiFrameBuffer();
     ot::Ncp::TestEncoderDecoder();
     ot::Ncp::TestFuzzEncoderDecoder();
+    ot::Ncp::BenchmarkEncoderDecoder();
     printf("\nAll tests passed.\n");
     return 0;
 }
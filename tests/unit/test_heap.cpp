@@ -33,10 +33,12 @@
 #include <stdlib.h>
 
 #include "common/debug.hpp"
+#include "common/num_utils.hpp"
 #include "crypto/aes_ccm.hpp"
 
 #include "test_platform.h"
 #include "test_util.h"
+#include "test_util.hpp"
 
 namespace ot {
 
@@ -167,10 +169,172 @@ void TestAllocateMultiple(void)
     }
 }
 
+/**
+ * Verifies the heap statistics and the slab allocation of small variables.
+ */
+void TestHeapStats(void)
+{
+    static constexpr uint16_t kNumAllocs = 40;
+
+    ot::Utils::Heap        heap;
+    ot::Utils::Heap::Stats stats;
+    uint8_t               *pointers[kNumAllocs];
+    uint16_t               sizes[kNumAllocs];
+
+    heap.GetStats(stats);
+    VerifyOrQuit(stats.mCapacity == heap.GetCapacity());
+    VerifyOrQuit(stats.mFreeSize == heap.GetFreeSize());
+    VerifyOrQuit(stats.mNumFreeBlocks == 1);
+    VerifyOrQuit(stats.mLargestFreeBlockSize == heap.GetCapacity());
+    VerifyOrQuit(stats.mNumSlabs == 0);
+
+    for (uint16_t i = 0; i < kNumAllocs; i++)
+    {
+        sizes[i]    = 1 + (i * 7) % 80;
+        pointers[i] = static_cast<uint8_t *>(heap.CAlloc(1, sizes[i]));
+        VerifyOrQuit(pointers[i] != nullptr);
+
+        for (uint16_t j = 0; j < sizes[i]; j++)
+        {
+            VerifyOrQuit(pointers[i][j] == 0, "memory not initialized to zero!");
+        }
+
+        memset(pointers[i], static_cast<int>(i), sizes[i]);
+    }
+
+    for (uint16_t i = 0; i < kNumAllocs; i++)
+    {
+        for (uint16_t j = 0; j < sizes[i]; j++)
+        {
+            VerifyOrQuit(pointers[i][j] == static_cast<uint8_t>(i), "allocated memory overlaps!");
+        }
+    }
+
+    heap.GetStats(stats);
+    VerifyOrQuit(stats.mFreeSize == heap.GetFreeSize());
+    VerifyOrQuit(stats.mFreeSize < heap.GetCapacity());
+    VerifyOrQuit(stats.mLargestFreeBlockSize <= stats.mFreeSize);
+    VerifyOrQuit(stats.mNumFreeSlabChunks <= stats.mNumSlabChunks);
+
+#if OPENTHREAD_CONFIG_HEAP_SLAB_ENABLE
+    VerifyOrQuit(stats.mNumSlabs > 0);
+    VerifyOrQuit(stats.mNumSlabChunks - stats.mNumFreeSlabChunks > 0);
+#else
+    VerifyOrQuit(stats.mNumSlabs == 0);
+#endif
+
+    // Free every other variable, then the rest.
+
+    for (uint16_t i = 0; i < kNumAllocs; i += 2)
+    {
+        heap.Free(pointers[i]);
+    }
+
+    for (uint16_t i = 1; i < kNumAllocs; i += 2)
+    {
+        for (uint16_t j = 0; j < sizes[i]; j++)
+        {
+            VerifyOrQuit(pointers[i][j] == static_cast<uint8_t>(i), "freeing corrupted allocated memory!");
+        }
+
+        heap.Free(pointers[i]);
+    }
+
+    VerifyOrQuit(heap.IsClean());
+
+    heap.GetStats(stats);
+    VerifyOrQuit(stats.mFreeSize == heap.GetCapacity());
+    VerifyOrQuit(stats.mNumFreeBlocks == 1);
+    VerifyOrQuit(stats.mLargestFreeBlockSize == heap.GetCapacity());
+    VerifyOrQuit(stats.mNumSlabs == 0);
+    VerifyOrQuit(stats.mNumSlabChunks == 0);
+}
+
+/**
+ * Stresses the heap with a workload of many small and some larger variables which are allocated and freed randomly,
+ * and reports the allocation speed and the resulting heap fragmentation.
+ */
+void BenchmarkHeapStress(void)
+{
+    static constexpr uint16_t kNumSlots  = 200;
+    static constexpr uint32_t kNumRounds = 200000;
+
+    ot::Utils::Heap        heap;
+    ot::Utils::Heap::Stats stats;
+    void                  *slots[kNumSlots];
+    uint32_t               numAllocs = 0;
+    uint32_t               numFails  = 0;
+    uint64_t               startTime;
+    uint64_t               duration;
+
+    printf("BenchmarkHeapStress()\n");
+
+    srand(0);
+    memset(slots, 0, sizeof(slots));
+
+    startTime = GetMonotonicTimeNs();
+
+    for (uint32_t round = 0; round < kNumRounds; round++)
+    {
+        uint16_t index = static_cast<uint16_t>(static_cast<unsigned>(rand()) % kNumSlots);
+        size_t   size;
+
+        if (slots[index] != nullptr)
+        {
+            heap.Free(slots[index]);
+            slots[index] = nullptr;
+            continue;
+        }
+
+        // Mostly small variables (e.g., strings and SRP entries), with
+        // one in eight larger ones.
+
+        if (static_cast<unsigned>(rand()) % 8 == 0)
+        {
+            size = 65 + static_cast<size_t>(rand()) % 256;
+        }
+        else
+        {
+            size = 1 + static_cast<size_t>(rand()) % 64;
+        }
+
+        slots[index] = heap.CAlloc(1, size);
+        numAllocs++;
+
+        if (slots[index] == nullptr)
+        {
+            numFails++;
+        }
+    }
+
+    duration = GetMonotonicTimeNs() - startTime;
+
+    heap.GetStats(stats);
+
+    printf("  slab layer:          %s\n", OPENTHREAD_CONFIG_HEAP_SLAB_ENABLE ? "enabled" : "disabled");
+    printf("  allocations:         %lu (%lu failed)\n", ToUlong(numAllocs), ToUlong(numFails));
+    printf("  ops/sec:             %lu\n",
+           ToUlong(static_cast<uint32_t>(kNumRounds * 1000000000ull / (duration + 1))));
+    printf("  free size:           %u of %u\n", stats.mFreeSize, stats.mCapacity);
+    printf("  free blocks:         %u (largest %u)\n", stats.mNumFreeBlocks, stats.mLargestFreeBlockSize);
+    printf("  slab chunks:         %u in %u slabs (%u free)\n", stats.mNumSlabChunks, stats.mNumSlabs,
+           stats.mNumFreeSlabChunks);
+
+    for (void *&slot : slots)
+    {
+        heap.Free(slot);
+        slot = nullptr;
+    }
+
+    VerifyOrQuit(heap.IsClean() && heap.GetFreeSize() == heap.GetCapacity());
+}
+
 void RunTimerTests(void)
 {
     TestAllocateSingle();
     TestAllocateMultiple();
+    TestHeapStats();
+    BenchmarkHeapStress();
 }
 
 #endif // !OPENTHREAD_CONFIG_HEAP_EXTERNAL_ENABLE
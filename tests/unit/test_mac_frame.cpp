@@ -782,6 +782,157 @@ void TestMacFrameAckGeneration(void)
 #endif // (OPENTHREAD_CONFIG_THREAD_VERSION >= OT_THREAD_VERSION_1_2)
 }
 
+uint32_t ReadFrameHeader(const Mac::RxFrame &aFrame)
+{
+    // Reads the fields commonly used while processing a received
+    // frame and returns a digest of them.
+
+    uint32_t       digest = 0;
+    Mac::Address   address;
+    Mac::PanId     panId;
+    uint8_t        securityLevel;
+    uint8_t        keyIdMode;
+    uint32_t       frameCounter;
+    const uint8_t *payload;
+
+    SuccessOrQuit(aFrame.GetSrcAddr(address));
+    digest += address.GetExtended().m8[0];
+    SuccessOrQuit(aFrame.GetDstAddr(address));
+    digest += address.GetShort();
+    SuccessOrQuit(aFrame.GetDstPanId(panId));
+    digest += panId;
+    SuccessOrQuit(aFrame.GetSecurityLevel(securityLevel));
+    digest += securityLevel;
+    SuccessOrQuit(aFrame.GetKeyIdMode(keyIdMode));
+    digest += keyIdMode;
+    SuccessOrQuit(aFrame.GetFrameCounter(frameCounter));
+    digest += frameCounter;
+
+    payload = aFrame.GetPayload();
+    VerifyOrQuit(payload != nullptr);
+    digest += payload[0];
+    digest += aFrame.GetPayloadLength();
+    digest += aFrame.GetFooterLength();
+
+#if OPENTHREAD_CONFIG_MAC_HEADER_IE_SUPPORT
+    VerifyOrQuit(aFrame.GetHeaderIe(Mac::CslIe::kHeaderIeId) != nullptr);
+    digest += aFrame.GetHeaderIe(Mac::CslIe::kHeaderIeId)[sizeof(Mac::HeaderIe)];
+#endif
+
+    return digest;
+}
+
+void TestMacFrameHeaderLayout(void)
+{
+    static constexpr uint32_t kNumRounds = 100000;
+
+    // Secured 2015 data frame: short destination, extended source,
+    // CSL and Termination Header IEs, 8-byte payload, MIC-32 and FCS.
+    uint8_t psdu[] = {0x69, 0xea, 0x8e, 0xce, 0xfa, 0x02, 0x24, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x6e,
+                      0x16, 0x0d, 0x02, 0x00, 0x00, 0x00, 0x01, 0x04, 0x0d, 0x21, 0x0c, 0x35, 0x0c, 0x80,
+                      0x3f, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0xf9, 0x4e, 0x58, 0x70, 0x40, 0x8c};
+
+    uint8_t        otherPsdu[sizeof(psdu)];
+    Mac::RxFrame   frame;
+    Mac::RxFrame   otherFrame;
+    Mac::Address   address;
+    uint32_t       digest;
+    uint32_t       cachedDigest = 0;
+    uint32_t       parsedDigest = 0;
+    uint64_t       startTime;
+    uint64_t       parsedDuration;
+    uint64_t       cachedDuration;
+    const uint8_t *payload;
+
+    printf("TestMacFrameHeaderLayout\n");
+
+    frame.mPsdu      = psdu;
+    frame.mLength    = sizeof(psdu);
+    frame.mRadioType = 0;
+
+    // The layouts are cached by the PSDU buffer, which may have been
+    // used by an earlier frame at the same stack address.
+    frame.InvalidateHeaderLayout();
+    VerifyOrQuit(!frame.HasHeaderLayout());
+    SuccessOrQuit(frame.ValidatePsdu());
+
+    payload = frame.GetPayload();
+    digest  = ReadFrameHeader(frame);
+
+    frame.ParseHeaderLayout();
+    VerifyOrQuit(frame.HasHeaderLayout());
+
+    VerifyOrQuit(frame.GetPayload() == payload);
+    VerifyOrQuit(ReadFrameHeader(frame) == digest);
+
+    SuccessOrQuit(frame.GetSrcAddr(address));
+    VerifyOrQuit(address.IsExtended());
+    SuccessOrQuit(frame.GetDstAddr(address));
+    VerifyOrQuit(address.IsShort() && (address.GetShort() == 0x2402));
+    VerifyOrQuit(frame.GetPayloadLength() == 8);
+    VerifyOrQuit(payload[0] == 0x11);
+
+    // Changing the PSDU buffer or the Header IE Present flag
+    // invalidates the cached layout.
+
+    frame.mPsdu = nullptr;
+    VerifyOrQuit(!frame.HasHeaderLayout());
+    frame.mPsdu = psdu;
+    VerifyOrQuit(frame.HasHeaderLayout());
+
+    frame.SetIePresent(true);
+    VerifyOrQuit(!frame.HasHeaderLayout());
+    VerifyOrQuit(ReadFrameHeader(frame) == digest);
+
+    // The layouts of frames using different PSDU buffers are cached
+    // independently.
+
+    memcpy(otherPsdu, psdu, sizeof(psdu));
+    otherFrame.mPsdu      = otherPsdu;
+    otherFrame.mLength    = sizeof(otherPsdu);
+    otherFrame.mRadioType = 0;
+    otherFrame.InvalidateHeaderLayout();
+
+    frame.ParseHeaderLayout();
+    otherFrame.ParseHeaderLayout();
+    VerifyOrQuit(frame.HasHeaderLayout());
+    VerifyOrQuit(otherFrame.HasHeaderLayout());
+    VerifyOrQuit(ReadFrameHeader(otherFrame) == digest);
+
+    otherFrame.InvalidateHeaderLayout();
+    VerifyOrQuit(!otherFrame.HasHeaderLayout());
+    VerifyOrQuit(frame.HasHeaderLayout());
+
+    // Compare the per-frame cost of reading the header fields when
+    // the header is parsed on every access versus using the cached
+    // layout.
+
+    frame.InvalidateHeaderLayout();
+    startTime = GetMonotonicTimeNs();
+
+    for (uint32_t round = 0; round < kNumRounds; round++)
+    {
+        parsedDigest += ReadFrameHeader(frame);
+    }
+
+    parsedDuration = GetMonotonicTimeNs() - startTime;
+    startTime      = GetMonotonicTimeNs();
+
+    for (uint32_t round = 0; round < kNumRounds; round++)
+    {
+        frame.ParseHeaderLayout();
+        cachedDigest += ReadFrameHeader(frame);
+    }
+
+    cachedDuration = GetMonotonicTimeNs() - startTime;
+
+    VerifyOrQuit(parsedDigest == cachedDigest);
+
+    printf("  per frame: parsed on access %5lu ns, parsed once %5lu ns\n",
+           ToUlong(static_cast<uint32_t>(parsedDuration / kNumRounds)),
+           ToUlong(static_cast<uint32_t>(cachedDuration / kNumRounds)));
+}
+
 #if OPENTHREAD_CONFIG_WAKEUP_COORDINATOR_ENABLE
 constexpr uint16_t kMpFcfLongFrame           = 1 << 3;
 constexpr uint16_t kMpFcfDstAddrShift        = 4;
@@ -1073,6 +1224,7 @@ int main(void)
     ot::TestMacChannelMask();
     ot::TestMacFrameApi();
     ot::TestMacFrameAckGeneration();
+    ot::TestMacFrameHeaderLayout();
 #if OPENTHREAD_CONFIG_WAKEUP_COORDINATOR_ENABLE
     ot::TestMacWakeupFrameGeneration();
     ot::TestMacWakeupFrameDetectionNegative();
@@ -537,6 +537,841 @@ void TestAppender(void)
     testFreeInstance(instance);
 }
 
+void TestMessageSpans(void)
+{
+    static constexpr uint16_t kPacketSize = 1280;
+    static constexpr uint16_t kMaxSpans   = (kPacketSize / Buffer::kSize) + 2;
+    static constexpr uint16_t kNumRounds  = 10000;
+
+    static const uint16_t kStartOffsets[] = {0, 1, 200, kPacketSize - 1};
+
+    Instance     *instance;
+    Message      *message;
+    uint8_t       packet[kPacketSize];
+    uint8_t       readBuffer[kPacketSize];
+    otMessageSpan spans[kMaxSpans];
+    uint16_t      numSpans;
+    uint16_t      offset;
+    OffsetRange   fullRange;
+    uint64_t      startTime;
+    uint64_t      copyDuration;
+    uint64_t      spanDuration;
+    uint32_t      sum;
+
+    printf("TestMessageSpans\n");
+
+    instance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(instance != nullptr);
+
+    message = instance->Get<MessagePool>().Allocate(Message::kTypeIp6);
+    VerifyOrQuit(message != nullptr);
+
+    Random::NonCrypto::FillBuffer(packet, sizeof(packet));
+    SuccessOrQuit(message->AppendBytes(packet, sizeof(packet)));
+
+    fullRange.InitFromMessageFullLength(*message);
+
+    // Verify that the spans cover the requested range and point into
+    // the message buffers.
+
+    for (uint16_t startOffset : kStartOffsets)
+    {
+        OffsetRange offsetRange;
+
+        offsetRange.InitFromRange(startOffset, kPacketSize);
+
+        numSpans = kMaxSpans;
+        SuccessOrQuit(message->GetSpans(offsetRange, spans, numSpans));
+        VerifyOrQuit(numSpans > 0);
+
+        offset = startOffset;
+
+        for (uint16_t i = 0; i < numSpans; i++)
+        {
+            VerifyOrQuit(spans[i].mLength > 0);
+            VerifyOrQuit(spans[i].mLength <= Buffer::kSize);
+            VerifyOrQuit(memcmp(spans[i].mBytes, &packet[offset], spans[i].mLength) == 0);
+            offset += spans[i].mLength;
+        }
+
+        VerifyOrQuit(offset == kPacketSize);
+
+        if (numSpans > 1)
+        {
+            numSpans--;
+            VerifyOrQuit(message->GetSpans(offsetRange, spans, numSpans) == kErrorNoBufs);
+        }
+
+        // Verify `SpanIterator` provides the same spans.
+
+        numSpans = kMaxSpans;
+        SuccessOrQuit(message->GetSpans(offsetRange, spans, numSpans));
+
+        {
+            uint16_t index = 0;
+
+            for (Message::SpanIterator iterator(*message, offsetRange); !iterator.IsDone(); iterator.Advance())
+            {
+                VerifyOrQuit(index < numSpans);
+                VerifyOrQuit(iterator.GetBytes() == spans[index].mBytes);
+                VerifyOrQuit(iterator.GetLength() == spans[index].mLength);
+                index++;
+            }
+
+            VerifyOrQuit(index == numSpans);
+        }
+    }
+
+    {
+        OffsetRange offsetRange;
+
+        offsetRange.Init(kPacketSize - 10, 11);
+        numSpans = kMaxSpans;
+        VerifyOrQuit(message->GetSpans(offsetRange, spans, numSpans) == kErrorParse);
+    }
+
+    // Modify the message in place using `MutableSpanIterator`.
+
+    for (Message::MutableSpanIterator iterator(*message, fullRange); !iterator.IsDone(); iterator.Advance())
+    {
+        for (uint16_t i = 0; i < iterator.GetLength(); i++)
+        {
+            iterator.GetBytes()[i] ^= 0xff;
+        }
+    }
+
+    for (uint16_t i = 0; i < kPacketSize; i++)
+    {
+        packet[i] ^= 0xff;
+    }
+
+    VerifyOrQuit(message->CompareBytes(0, packet, kPacketSize));
+
+    // Compare consuming a 1280-byte packet by first copying it into a
+    // contiguous buffer versus directly from the message spans.
+
+    sum       = 0;
+    startTime = GetMonotonicTimeNs();
+
+    for (uint16_t round = 0; round < kNumRounds; round++)
+    {
+        VerifyOrQuit(message->ReadBytes(0, readBuffer, kPacketSize) == kPacketSize);
+        sum += readBuffer[round % kPacketSize];
+    }
+
+    copyDuration = GetMonotonicTimeNs() - startTime;
+    startTime    = GetMonotonicTimeNs();
+
+    for (uint16_t round = 0; round < kNumRounds; round++)
+    {
+        numSpans = kMaxSpans;
+        SuccessOrQuit(message->GetSpans(fullRange, spans, numSpans));
+        sum += spans[round % numSpans].mBytes[0];
+    }
+
+    spanDuration = GetMonotonicTimeNs() - startTime;
+
+    printf("  %u-byte packet in %u buffers (sum %lu)\n", kPacketSize, numSpans, ToUlong(sum));
+    printf("  copy: %4u bytes copied, %5lu ns/packet\n", kPacketSize,
+           ToUlong(static_cast<uint32_t>(copyDuration / kNumRounds)));
+    printf("  span: %4u bytes copied, %5lu ns/packet\n", 0, ToUlong(static_cast<uint32_t>(spanDuration / kNumRounds)));
+
+    message->Free();
+    testFreeInstance(instance);
+}
+
+static constexpr uint16_t kFloodPayloadSize = 200;
+static constexpr uint16_t kMleMessageSize   = Buffer::kSize * 2;
+
+static uint16_t FloodWithUdpMessages(Instance       &aInstance,
+                                     MessageQueue   &aQueue,
+                                     Message::Origin aOrigin,
+                                     uint16_t        aPayloadSize = kFloodPayloadSize)
+{
+    // Allocates normal priority messages from `aOrigin` with
+    // `aPayloadSize` bytes and holds them in `aQueue` until no more
+    // message can be allocated.
+
+    uint8_t  payload[kFloodPayloadSize];
+    uint16_t numMessages = 0;
+
+    memset(payload, 0x5a, sizeof(payload));
+
+    while (true)
+    {
+        Message *message = aInstance.Get<MessagePool>().Allocate(
+            Message::kTypeIp6, 0, Message::Settings(kWithLinkSecurity, Message::kPriorityNormal, aOrigin));
+
+        if (message == nullptr)
+        {
+            break;
+        }
+
+        VerifyOrQuit(message->GetOrigin() == aOrigin);
+
+        if (message->AppendBytes(payload, aPayloadSize) != kErrorNone)
+        {
+            message->Free();
+            break;
+        }
+
+        aQueue.Enqueue(*message);
+        numMessages++;
+    }
+
+    return numMessages;
+}
+
+static bool CanAllocateMessage(Instance &aInstance, Message::Priority aPriority, uint16_t aLength)
+{
+    Message::Settings settings(kNoLinkSecurity, aPriority);
+    Message          *message;
+    bool              allocated = false;
+
+    message = aInstance.Get<MessagePool>().Allocate(Message::kTypeIp6, 0, settings);
+    VerifyOrExit(message != nullptr);
+
+    message->SetSubType(Message::kSubTypeMle);
+    SuccessOrExit(message->SetLength(aLength));
+    allocated = true;
+
+exit:
+    FreeMessage(message);
+    return allocated;
+}
+
+void TestMessagePoolQuotas(void)
+{
+    static constexpr uint16_t kReservedNetBuffers  = 6;
+    static constexpr uint16_t kReservedHighBuffers = 4;
+    static constexpr uint16_t kMaxUntrustedBuffers = 10;
+    static constexpr uint16_t kNumStressRounds     = 1000;
+
+    Instance           *instance;
+    MessagePool        *pool;
+    MessageQueue        floodQueue;
+    MessagePool::Quotas quotas;
+    MessagePool::Usage  usage;
+    Message            *message;
+    uint16_t            numMessages;
+    uint16_t            numBuffers;
+    uint32_t            numNetFailures;
+
+    printf("TestMessagePoolQuotas\n");
+
+    instance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(instance != nullptr);
+
+    pool = &instance->Get<MessagePool>();
+
+    quotas.Clear();
+    SuccessOrQuit(pool->SetQuotas(quotas));
+
+    quotas.mReservedNetPriorityBuffers = pool->GetTotalBufferCount();
+    VerifyOrQuit(pool->SetQuotas(quotas) == kErrorInvalidArgs);
+
+    // Without a reservation, a UDP flood uses all buffers and MLE
+    // messages can no longer be allocated.
+
+    numMessages = FloodWithUdpMessages(*instance, floodQueue, Message::kOriginHostUntrusted);
+    VerifyOrQuit(numMessages > 0);
+    VerifyOrQuit(!CanAllocateMessage(*instance, Message::kPriorityNet, kMleMessageSize));
+
+    pool->GetUsage(usage);
+    VerifyOrQuit(usage.mNormalPriority.mNumBuffers + pool->GetFreeBufferCount() <= pool->GetTotalBufferCount());
+    VerifyOrQuit(usage.mHostUntrusted.mNumBuffers == usage.mNormalPriority.mNumBuffers);
+    VerifyOrQuit(usage.mNetPriority.mNumBuffers == 0);
+    VerifyOrQuit(usage.mNetPriority.mNumFailedAllocations > 0);
+    VerifyOrQuit(usage.mNormalPriority.mNumFailedAllocations > 0);
+
+    floodQueue.DequeueAndFreeAll();
+
+    // With buffers reserved for network control messages, the flood
+    // leaves them free and MLE keeps working while the flood goes on.
+
+    quotas.Clear();
+    quotas.mReservedNetPriorityBuffers = kReservedNetBuffers;
+    SuccessOrQuit(pool->SetQuotas(quotas));
+
+    pool->GetUsage(usage);
+    numNetFailures = usage.mNetPriority.mNumFailedAllocations;
+
+    VerifyOrQuit(FloodWithUdpMessages(*instance, floodQueue, Message::kOriginHostUntrusted) > 0);
+    VerifyOrQuit(pool->GetFreeBufferCount() >= kReservedNetBuffers);
+
+    for (uint16_t round = 0; round < kNumStressRounds; round++)
+    {
+        // Free a random flood message and flood again.
+
+        message = floodQueue.GetHead();
+
+        for (uint16_t skip = Random::NonCrypto::GenerateUpToExcluding<uint16_t>(numMessages); skip > 0; skip--)
+        {
+            if (message->GetNext() == nullptr)
+            {
+                break;
+            }
+
+            message = message->GetNext();
+        }
+
+        floodQueue.DequeueAndFree(*message);
+        IgnoreReturnValue(FloodWithUdpMessages(*instance, floodQueue, Message::kOriginHostUntrusted));
+
+        VerifyOrQuit(pool->GetFreeBufferCount() >= kReservedNetBuffers);
+        VerifyOrQuit(CanAllocateMessage(*instance, Message::kPriorityNet, kMleMessageSize));
+    }
+
+    pool->GetUsage(usage);
+    VerifyOrQuit(usage.mNetPriority.mNumBuffers == 0);
+    VerifyOrQuit(usage.mNetPriority.mNumFailedAllocations == numNetFailures);
+    VerifyOrQuit(usage.mNetPriority.mMaxUsedBuffers > 0);
+
+    floodQueue.DequeueAndFreeAll();
+
+    // The reservations are hierarchical: high priority messages may
+    // use the high priority reservation, but not the one for network
+    // control messages.
+
+    quotas.Clear();
+    quotas.mReservedHighPriorityBuffers = kReservedHighBuffers;
+    quotas.mReservedNetPriorityBuffers  = kReservedNetBuffers;
+    SuccessOrQuit(pool->SetQuotas(quotas));
+
+    VerifyOrQuit(FloodWithUdpMessages(*instance, floodQueue, Message::kOriginHostUntrusted) > 0);
+    VerifyOrQuit(pool->GetFreeBufferCount() >= kReservedHighBuffers + kReservedNetBuffers);
+
+    message = pool->Allocate(Message::kTypeIp6, 0, Message::Settings(kWithLinkSecurity, Message::kPriorityHigh));
+    VerifyOrQuit(message != nullptr);
+    VerifyOrQuit(message->SetLength(pool->GetFreeBufferCount() * Buffer::kSize) == kErrorNoBufs);
+    VerifyOrQuit(pool->GetFreeBufferCount() >= kReservedNetBuffers);
+    VerifyOrQuit(CanAllocateMessage(*instance, Message::kPriorityNet, kMleMessageSize));
+    message->Free();
+
+    floodQueue.DequeueAndFreeAll();
+
+    // A quota limits the buffers used by messages from untrusted host
+    // sources, while other messages can still be allocated.
+
+    quotas.Clear();
+    quotas.mMaxHostUntrustedBuffers = kMaxUntrustedBuffers;
+    SuccessOrQuit(pool->SetQuotas(quotas));
+
+    VerifyOrQuit(FloodWithUdpMessages(*instance, floodQueue, Message::kOriginHostUntrusted) > 0);
+
+    pool->GetUsage(usage);
+    VerifyOrQuit(usage.mHostUntrusted.mNumBuffers <= kMaxUntrustedBuffers);
+    VerifyOrQuit(usage.mHostUntrusted.mNumFailedAllocations > 0);
+    VerifyOrQuit(CanAllocateMessage(*instance, Message::kPriorityNormal, kMleMessageSize));
+
+    floodQueue.DequeueAndFreeAll();
+
+    // The quota also limits messages which only use their first
+    // buffer, as the origin is given when a message is allocated.
+
+    VerifyOrQuit(FloodWithUdpMessages(*instance, floodQueue, Message::kOriginHostUntrusted, 0) ==
+                 kMaxUntrustedBuffers);
+
+    pool->GetUsage(usage);
+    VerifyOrQuit(usage.mHostUntrusted.mNumBuffers == kMaxUntrustedBuffers);
+    VerifyOrQuit(CanAllocateMessage(*instance, Message::kPriorityNormal, kMleMessageSize));
+
+    message = pool->Allocate(Message::kTypeIp6, 0,
+                             Message::Settings(kNoLinkSecurity, Message::kPriorityHigh, Message::kOriginHostUntrusted));
+    VerifyOrQuit(message == nullptr);
+
+    message = pool->Allocate(Message::kTypeIp6, 0, Message::Settings::From(nullptr, Message::kOriginHostUntrusted));
+    VerifyOrQuit(message == nullptr);
+
+    floodQueue.DequeueAndFreeAll();
+
+    message = pool->Allocate(Message::kTypeIp6, 0, Message::Settings::From(nullptr, Message::kOriginHostUntrusted));
+    VerifyOrQuit(message != nullptr);
+    VerifyOrQuit(message->IsOriginHostUntrusted());
+    VerifyOrQuit(message->IsLinkSecurityEnabled());
+    VerifyOrQuit(message->GetPriority() == Message::kPriorityNormal);
+    message->Free();
+
+    // Changing the origin of a message moves its buffers.
+
+    message = pool->Allocate(Message::kTypeIp6);
+    VerifyOrQuit(message != nullptr);
+    SuccessOrQuit(message->SetLength(kFloodPayloadSize));
+
+    pool->GetUsage(usage);
+    numBuffers = usage.mHostTrusted.mNumBuffers;
+    VerifyOrQuit(numBuffers == message->GetBufferCount());
+
+    message->SetOrigin(Message::kOriginThreadNetif);
+    pool->GetUsage(usage);
+    VerifyOrQuit(usage.mHostTrusted.mNumBuffers == 0);
+    VerifyOrQuit(usage.mThreadNetif.mNumBuffers == numBuffers);
+
+    SuccessOrQuit(message->SetPriority(Message::kPriorityLow));
+    pool->GetUsage(usage);
+    VerifyOrQuit(usage.mLowPriority.mNumBuffers == numBuffers);
+
+    message->Free();
+    floodQueue.DequeueAndFreeAll();
+
+    pool->GetUsage(usage);
+    VerifyOrQuit(usage.mLowPriority.mNumBuffers == 0);
+    VerifyOrQuit(usage.mNormalPriority.mNumBuffers == 0);
+    VerifyOrQuit(usage.mHighPriority.mNumBuffers == 0);
+    VerifyOrQuit(usage.mNetPriority.mNumBuffers == 0);
+    VerifyOrQuit(usage.mThreadNetif.mNumBuffers == 0);
+    VerifyOrQuit(usage.mHostTrusted.mNumBuffers == 0);
+    VerifyOrQuit(usage.mHostUntrusted.mNumBuffers == 0);
+
+    pool->ResetMaxUsedBufferCount();
+    pool->GetUsage(usage);
+    VerifyOrQuit(usage.mNormalPriority.mMaxUsedBuffers == 0);
+
+    testFreeInstance(instance);
+}
+
+#if OPENTHREAD_CONFIG_MESSAGE_NUM_SHARED_BUFFER_CHAINS > 0
+
+static constexpr uint16_t kSharedPacketSize = 1280;
+
+static Message *AllocateMulticastDatagram(Instance &aInstance, const uint8_t *aPacket, uint16_t aLength)
+{
+    Message::Settings settings(kWithLinkSecurity, Message::kPriorityNormal, Message::kOriginThreadNetif);
+    Message          *message = aInstance.Get<MessagePool>().Allocate(Message::kTypeIp6, 0, settings);
+
+    VerifyOrQuit(message != nullptr);
+    SuccessOrQuit(message->AppendBytes(aPacket, aLength));
+
+    return message;
+}
+
+static void VerifyAllBuffersFree(MessagePool &aPool)
+{
+    MessagePool::Usage usage;
+
+    VerifyOrQuit(aPool.GetFreeBufferCount() == aPool.GetTotalBufferCount());
+    VerifyOrQuit(aPool.GetSharingCounters().mCurSharedBuffers == 0);
+
+    aPool.GetUsage(usage);
+    VerifyOrQuit(usage.mNormalPriority.mNumBuffers == 0);
+    VerifyOrQuit(usage.mThreadNetif.mNumBuffers == 0);
+    VerifyOrQuit(usage.mHostTrusted.mNumBuffers == 0);
+}
+
+void TestMessageSharedBuffers(void)
+{
+    static constexpr uint16_t kNumConsumers = 4;
+
+    Instance                    *instance;
+    MessagePool                 *pool;
+    Message                     *original;
+    Message                     *clones[kNumConsumers];
+    MessagePool::Quotas          quotas;
+    MessagePool::Usage           usage;
+    MessagePool::SharingCounters counters;
+    uint8_t                      packet[kSharedPacketSize];
+    uint8_t                      header[4];
+    uint16_t                     numTailBuffers;
+    uint16_t                     numFreeBuffers;
+    uint8_t                      byte;
+
+    printf("TestMessageSharedBuffers\n");
+
+    instance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(instance != nullptr);
+
+    pool = &instance->Get<MessagePool>();
+
+    quotas.Clear();
+    SuccessOrQuit(pool->SetQuotas(quotas));
+
+    Random::NonCrypto::FillBuffer(packet, sizeof(packet));
+    memset(header, 0xee, sizeof(header));
+
+    // A multicast datagram received over Thread is passed to several
+    // consumers. Each clone uses a single new buffer.
+
+    original       = AllocateMulticastDatagram(*instance, packet, kSharedPacketSize);
+    numTailBuffers = original->GetBufferCount() - 1;
+    numFreeBuffers = pool->GetFreeBufferCount();
+    VerifyOrQuit(numTailBuffers > 0);
+
+    for (Message *&clone : clones)
+    {
+        clone = original->Clone<kShareBuffers>();
+        VerifyOrQuit(clone != nullptr);
+        VerifyOrQuit(clone->GetLength() == kSharedPacketSize);
+        VerifyOrQuit(clone->CompareBytes(0, packet, kSharedPacketSize));
+        VerifyOrQuit(clone->GetBufferCount() == numTailBuffers + 1);
+        VerifyOrQuit(clone->IsOriginThreadNetif());
+    }
+
+    VerifyOrQuit(pool->GetFreeBufferCount() == numFreeBuffers - kNumConsumers);
+
+    counters = pool->GetSharingCounters();
+    VerifyOrQuit(counters.mNumSharedClones == kNumConsumers);
+    VerifyOrQuit(counters.mNumSharedBuffers == kNumConsumers * numTailBuffers);
+    VerifyOrQuit(counters.mCurSharedBuffers == numTailBuffers);
+    VerifyOrQuit(counters.mNumCopiedBuffers == 0);
+
+    pool->GetUsage(usage);
+    VerifyOrQuit(usage.mThreadNetif.mNumBuffers == numTailBuffers + 1 + kNumConsumers);
+
+    // Writing a header in the first buffer does not copy the shared
+    // buffers.
+
+    clones[0]->WriteBytes(0, header, sizeof(header));
+    VerifyOrQuit(clones[0]->CompareBytes(0, header, sizeof(header)));
+    VerifyOrQuit(original->CompareBytes(0, packet, kSharedPacketSize));
+    VerifyOrQuit(pool->GetSharingCounters().mNumCopiedBuffers == 0);
+
+    // Writing the payload copies the shared buffers for the writer
+    // only.
+
+    byte = packet[kSharedPacketSize - 1] ^ 0xff;
+    clones[1]->Write(kSharedPacketSize - 1, byte);
+    VerifyOrQuit(pool->GetSharingCounters().mNumCopiedBuffers == numTailBuffers);
+    VerifyOrQuit(pool->GetFreeBufferCount() == numFreeBuffers - kNumConsumers - numTailBuffers);
+    VerifyOrQuit(clones[1]->CompareBytes(0, packet, kSharedPacketSize - 1));
+    VerifyOrQuit(clones[1]->CompareBytes(kSharedPacketSize - 1, &byte, sizeof(byte)));
+    VerifyOrQuit(original->CompareBytes(0, packet, kSharedPacketSize));
+    VerifyOrQuit(clones[2]->CompareBytes(0, packet, kSharedPacketSize));
+
+    // In-place modification through `MutableSpanIterator` (as used
+    // for decryption) also copies the shared buffers.
+
+    for (Message::MutableSpanIterator iterator(*clones[3], 0, kSharedPacketSize); !iterator.IsDone();
+         iterator.Advance())
+    {
+        for (uint16_t i = 0; i < iterator.GetLength(); i++)
+        {
+            iterator.GetBytes()[i] ^= 0xff;
+        }
+    }
+
+    VerifyOrQuit(pool->GetSharingCounters().mNumCopiedBuffers == 2 * numTailBuffers);
+    VerifyOrQuit(original->CompareBytes(0, packet, kSharedPacketSize));
+
+    for (uint16_t i = 0; i < kSharedPacketSize; i++)
+    {
+        byte = packet[i] ^ 0xff;
+        VerifyOrQuit(clones[3]->CompareBytes(i, &byte, sizeof(byte)));
+    }
+
+    // Removing the footer down to the first buffer releases the
+    // shared buffers without copying them.
+
+    clones[2]->RemoveFooter(kSharedPacketSize - 1);
+    VerifyOrQuit(clones[2]->GetBufferCount() == 1);
+    VerifyOrQuit(clones[2]->CompareBytes(0, packet, 1));
+    SuccessOrQuit(clones[2]->SetLength(kSharedPacketSize));
+    VerifyOrQuit(pool->GetSharingCounters().mNumCopiedBuffers == 2 * numTailBuffers);
+
+    // The shared buffers outlive the original message. The last
+    // message sharing them takes them over on a write.
+
+    original->Free();
+    VerifyOrQuit(clones[0]->CompareBytes(sizeof(header), packet + sizeof(header), kSharedPacketSize - sizeof(header)));
+    VerifyOrQuit(pool->GetSharingCounters().mCurSharedBuffers == numTailBuffers);
+
+    clones[0]->Write(kSharedPacketSize - 1, byte);
+    VerifyOrQuit(pool->GetSharingCounters().mNumCopiedBuffers == 2 * numTailBuffers);
+    VerifyOrQuit(pool->GetSharingCounters().mCurSharedBuffers == 0);
+
+    SuccessOrQuit(clones[0]->SetPriority(Message::kPriorityLow));
+    pool->GetUsage(usage);
+    VerifyOrQuit(usage.mLowPriority.mNumBuffers == numTailBuffers + 1);
+
+    for (Message *clone : clones)
+    {
+        clone->Free();
+    }
+
+    VerifyAllBuffersFree(*pool);
+
+    testFreeInstance(instance);
+}
+
+void TestMessageSharedBuffersFlood(void)
+{
+    // Floods the pool with clones of a multicast datagram and then
+    // modifies every clone. The buffers kept free for copying the
+    // shared buffers ensure all writes succeed.
+
+    static constexpr uint16_t kNumRounds = 2000;
+
+    Instance    *instance;
+    MessagePool *pool;
+    Message     *original;
+    MessageQueue queue;
+    uint8_t      packet[kSharedPacketSize];
+    uint16_t     numClones = 0;
+    uint16_t     numCopies = 0;
+    uint64_t     startTime;
+    uint64_t     copyDuration;
+    uint64_t     shareDuration;
+
+    printf("TestMessageSharedBuffersFlood\n");
+
+    instance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(instance != nullptr);
+
+    pool = &instance->Get<MessagePool>();
+
+    Random::NonCrypto::FillBuffer(packet, sizeof(packet));
+    original = AllocateMulticastDatagram(*instance, packet, kSharedPacketSize);
+
+    while (true)
+    {
+        Message *clone = original->Clone<kShareBuffers>();
+
+        if (clone == nullptr)
+        {
+            break;
+        }
+
+        queue.Enqueue(*clone);
+        numClones++;
+    }
+
+    VerifyOrQuit(numClones > 0);
+    VerifyOrQuit(pool->GetSharingCounters().mCurSharedBuffers == original->GetBufferCount() - 1);
+
+    original->Free();
+
+    for (Message &clone : queue)
+    {
+        uint8_t byte = static_cast<uint8_t>(numCopies);
+
+        clone.Write(kSharedPacketSize - 1, byte);
+        VerifyOrQuit(clone.CompareBytes(0, packet, kSharedPacketSize - 1));
+        VerifyOrQuit(clone.CompareBytes(kSharedPacketSize - 1, &byte, sizeof(byte)));
+        numCopies++;
+    }
+
+    printf("  %u clones sharing buffers, %lu buffers copied on write\n", numClones,
+           ToUlong(pool->GetSharingCounters().mNumCopiedBuffers));
+
+    queue.DequeueAndFreeAll();
+    VerifyAllBuffersFree(*pool);
+
+    // Compare the cost of passing a datagram to several consumers
+    // by copying versus sharing its buffers.
+
+    original = AllocateMulticastDatagram(*instance, packet, kSharedPacketSize);
+
+    startTime = GetMonotonicTimeNs();
+
+    for (uint16_t round = 0; round < kNumRounds; round++)
+    {
+        Message *clone = original->Clone<kSameReservedHeader>();
+
+        VerifyOrQuit(clone != nullptr);
+        clone->Free();
+    }
+
+    copyDuration = GetMonotonicTimeNs() - startTime;
+    startTime    = GetMonotonicTimeNs();
+
+    for (uint16_t round = 0; round < kNumRounds; round++)
+    {
+        Message *clone = original->Clone<kShareBuffers>();
+
+        VerifyOrQuit(clone != nullptr);
+        clone->Free();
+    }
+
+    shareDuration = GetMonotonicTimeNs() - startTime;
+
+    printf("  copy:  %u buffers per clone, %5lu ns/clone\n", original->GetBufferCount(),
+           ToUlong(static_cast<uint32_t>(copyDuration / kNumRounds)));
+    printf("  share: %u buffers per clone, %5lu ns/clone\n", 1,
+           ToUlong(static_cast<uint32_t>(shareDuration / kNumRounds)));
+
+    original->Free();
+    VerifyAllBuffersFree(*pool);
+
+    testFreeInstance(instance);
+}
+
+void TestMessageSharedBuffersRandom(void)
+{
+    // Applies random operations to messages sharing buffers and
+    // verifies their content against private copies.
+
+    static constexpr uint16_t kNumMessages = 8;
+    static constexpr uint16_t kMaxLength   = kSharedPacketSize + 100;
+    static constexpr uint16_t kNumRounds   = 20000;
+
+    enum Operation : uint8_t
+    {
+        kAllocate,
+        kClone,
+        kWrite,
+        kResize,
+        kPrepend,
+        kRemoveHeader,
+        kFree,
+        kNumOperations,
+    };
+
+    Instance    *instance;
+    MessagePool *pool;
+    Message     *messages[kNumMessages];
+    uint8_t      contents[kNumMessages][kMaxLength];
+    uint8_t      bytes[kMaxLength];
+
+    printf("TestMessageSharedBuffersRandom\n");
+
+    instance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(instance != nullptr);
+
+    pool = &instance->Get<MessagePool>();
+
+    ClearAllBytes(messages);
+
+    for (uint16_t round = 0; round < kNumRounds; round++)
+    {
+        uint8_t   index   = Random::NonCrypto::GenerateUpToExcluding<uint8_t>(kNumMessages);
+        Message *&message = messages[index];
+        uint8_t  *content = contents[index];
+
+        switch (Random::NonCrypto::GenerateUpToExcluding<uint8_t>(kNumOperations))
+        {
+        case kAllocate:
+        case kClone:
+            if (message != nullptr)
+            {
+                break;
+            }
+
+            for (uint8_t source = 0; source < kNumMessages; source++)
+            {
+                if ((messages[source] != nullptr) && Random::NonCrypto::GenerateUpToExcluding<uint8_t>(2))
+                {
+                    message = messages[source]->Clone<kShareBuffers>();
+
+                    if (message != nullptr)
+                    {
+                        memcpy(content, contents[source], message->GetLength());
+                    }
+
+                    break;
+                }
+            }
+
+            if (message == nullptr)
+            {
+                uint16_t length = Random::NonCrypto::GenerateUpToExcluding<uint16_t>(kSharedPacketSize) + 1;
+
+                message = pool->Allocate(Message::kTypeIp6);
+                Random::NonCrypto::FillBuffer(content, length);
+
+                if ((message != nullptr) && (message->AppendBytes(content, length) != kErrorNone))
+                {
+                    message->Free();
+                    message = nullptr;
+                }
+            }
+
+            break;
+
+        case kWrite:
+            if ((message != nullptr) && (message->GetLength() > 0))
+            {
+                uint16_t offset = Random::NonCrypto::GenerateUpToExcluding<uint16_t>(message->GetLength());
+                uint16_t length = Random::NonCrypto::GenerateUpToExcluding<uint16_t>(message->GetLength() - offset) + 1;
+
+                Random::NonCrypto::FillBuffer(content + offset, length);
+                message->WriteBytes(offset, content + offset, length);
+            }
+
+            break;
+
+        case kResize:
+            if (message != nullptr)
+            {
+                uint16_t oldLength = message->GetLength();
+                uint16_t newLength = Random::NonCrypto::GenerateUpToExcluding<uint16_t>(kMaxLength);
+
+                if (message->SetLength(newLength) == kErrorNone)
+                {
+                    if (newLength > oldLength)
+                    {
+                        Random::NonCrypto::FillBuffer(content + oldLength, newLength - oldLength);
+                        message->WriteBytes(oldLength, content + oldLength, newLength - oldLength);
+                    }
+                }
+            }
+
+            break;
+
+        case kPrepend:
+            if (message != nullptr)
+            {
+                uint16_t length = Random::NonCrypto::GenerateUpToExcluding<uint16_t>(Buffer::kSize) + 1;
+
+                if (message->GetLength() + length > kMaxLength)
+                {
+                    break;
+                }
+
+                Random::NonCrypto::FillBuffer(bytes, length);
+
+                if (message->PrependBytes(bytes, length) == kErrorNone)
+                {
+                    memmove(content + length, content, message->GetLength() - length);
+                    memcpy(content, bytes, length);
+                }
+            }
+
+            break;
+
+        case kRemoveHeader:
+            if ((message != nullptr) && (message->GetLength() > 0))
+            {
+                uint16_t length = Random::NonCrypto::GenerateUpToExcluding<uint16_t>(message->GetLength()) + 1;
+
+                message->RemoveHeader(length);
+                memmove(content, content + length, message->GetLength());
+            }
+
+            break;
+
+        case kFree:
+            FreeMessage(message);
+            message = nullptr;
+            break;
+
+        default:
+            break;
+        }
+
+        for (uint16_t i = 0; i < kNumMessages; i++)
+        {
+            if (messages[i] != nullptr)
+            {
+                VerifyOrQuit(messages[i]->CompareBytes(0, contents[i], messages[i]->GetLength()));
+            }
+        }
+    }
+
+    printf("  %lu clones sharing buffers, %lu buffers shared, %lu buffers copied on write\n",
+           ToUlong(pool->GetSharingCounters().mNumSharedClones), ToUlong(pool->GetSharingCounters().mNumSharedBuffers),
+           ToUlong(pool->GetSharingCounters().mNumCopiedBuffers));
+
+    for (Message *message : messages)
+    {
+        FreeMessage(message);
+    }
+
+    VerifyAllBuffersFree(*pool);
+
+    testFreeInstance(instance);
+}
+
+#endif // OPENTHREAD_CONFIG_MESSAGE_NUM_SHARED_BUFFER_CHAINS > 0
+
 } // namespace ot
 
 int main(void)
@@ -550,6 +1385,13 @@ int main(void)
 
     ot::UnitTester::TestCloning();
     ot::TestAppender();
+    ot::TestMessageSpans();
+    ot::TestMessagePoolQuotas();
+#if OPENTHREAD_CONFIG_MESSAGE_NUM_SHARED_BUFFER_CHAINS > 0
+    ot::TestMessageSharedBuffers();
+    ot::TestMessageSharedBuffersFlood();
+    ot::TestMessageSharedBuffersRandom();
+#endif
 
     printf("All tests passed\n");
     return 0;
@@ -42,6 +42,38 @@ namespace Nat64 {
 
 static ot::Instance *sInstance;
 
+static uint32_t sNow = 0;
+static uint32_t sAlarmTime;
+static bool     sAlarmOn = false;
+
+extern "C" {
+
+void otPlatAlarmMilliStop(otInstance *) { sAlarmOn = false; }
+
+void otPlatAlarmMilliStartAt(otInstance *, uint32_t aT0, uint32_t aDt)
+{
+    sAlarmOn   = true;
+    sAlarmTime = aT0 + aDt;
+}
+
+uint32_t otPlatAlarmMilliGetNow(void) { return sNow; }
+
+} // extern "C"
+
+void AdvanceTime(uint32_t aDuration)
+{
+    uint32_t time = sNow + aDuration;
+
+    while (sAlarmOn && TimeMilli(sAlarmTime) <= TimeMilli(time))
+    {
+        sNow     = sAlarmTime;
+        sAlarmOn = false;
+        otPlatAlarmMilliFired(sInstance);
+    }
+
+    sNow = time;
+}
+
 void DumpIp6Message(const char *aTextMessage, const Message &aMessage)
 {
     Ip6::Headers ip6Headers;
@@ -435,6 +467,462 @@ void TestNat64Counters(void)
     Log("End of TestNat64Counters");
 }
 
+Message *NewUdp6Message(const Ip6::Address &aSource, const Ip6::Address &aDestination, uint16_t aSrcPort)
+{
+    static const uint8_t kPayload[] = {0x61, 0x62, 0x63, 0x64};
+
+    Message       *message = sInstance->Get<Ip6::Ip6>().NewMessage();
+    Ip6::Header    ip6Header;
+    Ip6::UdpHeader udpHeader;
+
+    VerifyOrQuit(message != nullptr);
+
+    ip6Header.Clear();
+    ip6Header.InitVersionTrafficClassFlow();
+    ip6Header.SetPayloadLength(sizeof(udpHeader) + sizeof(kPayload));
+    ip6Header.SetNextHeader(Ip6::kProtoUdp);
+    ip6Header.SetHopLimit(64);
+    ip6Header.SetSource(aSource);
+    ip6Header.SetDestination(aDestination);
+
+    udpHeader.Clear();
+    udpHeader.SetSourcePort(aSrcPort);
+    udpHeader.SetDestinationPort(4660);
+    udpHeader.SetLength(sizeof(udpHeader) + sizeof(kPayload));
+
+    SuccessOrQuit(message->Append(ip6Header));
+    SuccessOrQuit(message->Append(udpHeader));
+    SuccessOrQuit(message->Append(kPayload));
+
+    return message;
+}
+
+Message *NewUdp4Message(const Ip4::Address &aSource, const Ip4::Address &aDestination, uint16_t aDstPort)
+{
+    static const uint8_t kPayload[] = {0x61, 0x62, 0x63, 0x64};
+
+    Message       *message = sInstance->Get<Ip6::Ip6>().NewMessage();
+    Ip4::Header    ip4Header;
+    Ip6::UdpHeader udpHeader;
+
+    VerifyOrQuit(message != nullptr);
+
+    ip4Header.Clear();
+    ip4Header.InitVersionIhl();
+    ip4Header.SetTotalLength(sizeof(ip4Header) + sizeof(udpHeader) + sizeof(kPayload));
+    ip4Header.SetProtocol(Ip4::kProtoUdp);
+    ip4Header.SetTtl(64);
+    ip4Header.SetSource(aSource);
+    ip4Header.SetDestination(aDestination);
+
+    udpHeader.Clear();
+    udpHeader.SetSourcePort(4660);
+    udpHeader.SetDestinationPort(aDstPort);
+    udpHeader.SetLength(sizeof(udpHeader) + sizeof(kPayload));
+
+    SuccessOrQuit(message->Append(ip4Header));
+    SuccessOrQuit(message->Append(udpHeader));
+    SuccessOrQuit(message->Append(kPayload));
+
+    return message;
+}
+
+static constexpr uint16_t kClientPort = 10000;
+
+void StartTranslatorForMappingTest(void)
+{
+    Ip6::Prefix prefix;
+    Ip4::Cidr   cidr;
+
+    SuccessOrQuit(prefix.FromString("fd01::/96"));
+    SuccessOrQuit(cidr.FromString("10.100.0.0/20"));
+
+    SuccessOrQuit(sInstance->Get<Translator>().SetIp4Cidr(cidr));
+    sInstance->Get<Translator>().SetNat64Prefix(prefix);
+    sInstance->Get<Translator>().SetEnabled(true);
+}
+
+Ip6::Address GetClientAddress(uint16_t aClient)
+{
+    Ip6::Address address;
+
+    SuccessOrQuit(address.FromString("fd02::"));
+    BigEndian::WriteUint16(aClient + 1, &address.mFields.m8[14]);
+
+    return address;
+}
+
+Ip6::Address GetIp6ServerAddress(void)
+{
+    Ip6::Address address;
+
+    SuccessOrQuit(address.FromString("fd01::ac10:f3c5"));
+
+    return address;
+}
+
+Ip4::Address GetIp4ServerAddress(void)
+{
+    Ip4::Address address;
+
+    SuccessOrQuit(address.FromString("172.16.243.197"));
+
+    return address;
+}
+
+Error TranslateFromClient(uint16_t aClient)
+{
+    Message *message = NewUdp6Message(GetClientAddress(aClient), GetIp6ServerAddress(), kClientPort + aClient);
+    Error    error   = sInstance->Get<Translator>().TranslateIp6ToIp4(*message);
+
+    message->Free();
+
+    return error;
+}
+
+bool FindClientMapping(uint16_t aClient, Translator::AddressMapping &aMapping)
+{
+    Translator::AddressMappingIterator iter;
+    bool                               found = false;
+
+    iter.Init(*sInstance);
+
+    while (iter.GetNext(aMapping) == kErrorNone)
+    {
+        if (AsCoreType(&aMapping.mIp6) == GetClientAddress(aClient))
+        {
+            found = true;
+            break;
+        }
+    }
+
+    return found;
+}
+
+bool HasClientMapping(uint16_t aClient)
+{
+    Translator::AddressMapping mapping;
+
+    return FindClientMapping(aClient, mapping);
+}
+
+uint16_t CountMappings(void)
+{
+    Translator::AddressMappingIterator iter;
+    Translator::AddressMapping         mapping;
+    uint16_t                           count = 0;
+
+    iter.Init(*sInstance);
+
+    while (iter.GetNext(mapping) == kErrorNone)
+    {
+        count++;
+    }
+
+    return count;
+}
+
+void VerifyClientIsReachable(uint16_t aClient)
+{
+    // Translates a packet addressed to the client's translated IPv4
+    // address (and port) and checks that it is delivered to the
+    // client, i.e., the IPv4 index still maps to the client.
+
+    Translator::AddressMapping mapping;
+    Message                   *message;
+    Ip6::Headers               ip6Headers;
+    uint16_t                   dstPort = kClientPort + aClient;
+
+    VerifyOrQuit(FindClientMapping(aClient, mapping));
+
+#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+    dstPort = mapping.mTranslatedPortOrId;
+#endif
+
+    message = NewUdp4Message(GetIp4ServerAddress(), AsCoreType(&mapping.mIp4), dstPort);
+    SuccessOrQuit(sInstance->Get<Translator>().TranslateIp4ToIp6(*message));
+
+    SuccessOrQuit(ip6Headers.ParseFrom(*message));
+    VerifyOrQuit(ip6Headers.GetDestinationAddress() == GetClientAddress(aClient));
+    VerifyOrQuit(ip6Headers.GetDestinationPort() == kClientPort + aClient);
+
+    message->Free();
+}
+
+void TestNat64MappingEviction(void)
+{
+    // Fills the mapping pool and checks that new mappings evict the
+    // least recently used mapping once mappings become eligible for
+    // eviction, and that evicted mappings are removed from both
+    // lookup indexes.
+
+    static constexpr uint16_t kPoolSize        = OPENTHREAD_CONFIG_NAT64_MAX_MAPPINGS;
+    static constexpr uint32_t kCreateInterval  = 10;
+    static constexpr uint32_t kMinEvictTimeout = 2 * Time::kOneMinuteInMsec;
+
+    Translator::AddressMappingIterator iter;
+    Translator::AddressMapping         mapping;
+
+    Log("--------------------------------------------------------------------------------------------");
+    Log("TestNat64MappingEviction");
+
+    sInstance = testInitInstance();
+    VerifyOrQuit(sInstance != nullptr);
+
+    StartTranslatorForMappingTest();
+
+    for (uint16_t client = 0; client < kPoolSize; client++)
+    {
+        SuccessOrQuit(TranslateFromClient(client));
+        AdvanceTime(kCreateInterval);
+    }
+
+    VerifyOrQuit(CountMappings() == kPoolSize);
+
+    // All mappings were used recently, so none can be evicted and a
+    // new client is dropped.
+
+    VerifyOrQuit(TranslateFromClient(kPoolSize) == kErrorDrop);
+    VerifyOrQuit(CountMappings() == kPoolSize);
+    VerifyOrQuit(!HasClientMapping(kPoolSize));
+
+    // Once all mappings are eligible for eviction, client 0 is the
+    // least recently used. Use client 1 again so that it becomes the
+    // most recently used one.
+
+    AdvanceTime(kMinEvictTimeout);
+    SuccessOrQuit(TranslateFromClient(1));
+
+    SuccessOrQuit(TranslateFromClient(kPoolSize));
+    VerifyOrQuit(CountMappings() == kPoolSize);
+    VerifyOrQuit(!HasClientMapping(0));
+    VerifyOrQuit(HasClientMapping(1));
+    VerifyOrQuit(HasClientMapping(kPoolSize));
+
+    // The next new client evicts client 2, skipping client 1.
+
+    SuccessOrQuit(TranslateFromClient(kPoolSize + 1));
+    VerifyOrQuit(CountMappings() == kPoolSize);
+    VerifyOrQuit(!HasClientMapping(2));
+    VerifyOrQuit(HasClientMapping(1));
+    VerifyOrQuit(HasClientMapping(3));
+
+    // An evicted client gets a new mapping (evicting client 3) and
+    // does not find a stale entry in the index.
+
+    SuccessOrQuit(TranslateFromClient(0));
+    VerifyOrQuit(CountMappings() == kPoolSize);
+    VerifyOrQuit(HasClientMapping(0));
+    VerifyOrQuit(!HasClientMapping(3));
+
+    // Mappings are iterated from the most recently used one.
+
+    iter.Init(*sInstance);
+    SuccessOrQuit(iter.GetNext(mapping));
+    VerifyOrQuit(AsCoreType(&mapping.mIp6) == GetClientAddress(0));
+    SuccessOrQuit(iter.GetNext(mapping));
+    VerifyOrQuit(AsCoreType(&mapping.mIp6) == GetClientAddress(kPoolSize + 1));
+
+    VerifyClientIsReachable(0);
+    VerifyClientIsReachable(1);
+    VerifyClientIsReachable(4);
+    VerifyClientIsReachable(kPoolSize);
+    VerifyClientIsReachable(kPoolSize + 1);
+
+    testFreeInstance(sInstance);
+
+    Log("End of TestNat64MappingEviction");
+}
+
+void TestNat64MappingExpiry(void)
+{
+    // Checks that idle mappings expire, that mappings which were
+    // used again do not, and that expired mappings are removed from
+    // both lookup indexes.
+
+    static constexpr uint16_t kNumClients  = 8;
+    static constexpr uint32_t kIdleTimeout = OPENTHREAD_CONFIG_NAT64_IDLE_TIMEOUT_SECONDS * Time::kOneSecondInMsec;
+
+    Log("--------------------------------------------------------------------------------------------");
+    Log("TestNat64MappingExpiry");
+
+    sInstance = testInitInstance();
+    VerifyOrQuit(sInstance != nullptr);
+
+    StartTranslatorForMappingTest();
+
+    // The translator checks for expired mappings every `kIdleTimeout`
+    // starting from its initialization. Create the mappings shortly
+    // after, and use the even clients again right after the first
+    // check, so only the odd ones have expired by the second check.
+
+    AdvanceTime(Time::kOneSecondInMsec);
+
+    for (uint16_t client = 0; client < kNumClients; client++)
+    {
+        SuccessOrQuit(TranslateFromClient(client));
+    }
+
+    VerifyOrQuit(CountMappings() == kNumClients);
+
+    AdvanceTime(kIdleTimeout - Time::kOneSecondInMsec / 2);
+    VerifyOrQuit(CountMappings() == kNumClients);
+
+    for (uint16_t client = 0; client < kNumClients; client += 2)
+    {
+        SuccessOrQuit(TranslateFromClient(client));
+    }
+
+    AdvanceTime(kIdleTimeout);
+    VerifyOrQuit(CountMappings() == kNumClients / 2);
+
+    for (uint16_t client = 0; client < kNumClients; client++)
+    {
+        VerifyOrQuit(HasClientMapping(client) == (client % 2 == 0));
+    }
+
+    for (uint16_t client = 0; client < kNumClients; client += 2)
+    {
+        VerifyClientIsReachable(client);
+    }
+
+    // An expired client gets a new mapping.
+
+    SuccessOrQuit(TranslateFromClient(1));
+    VerifyOrQuit(CountMappings() == kNumClients / 2 + 1);
+    VerifyClientIsReachable(1);
+
+    testFreeInstance(sInstance);
+
+    Log("End of TestNat64MappingExpiry");
+}
+
+void TestNat64MappingBenchmark(void)
+{
+    // Drives UDP traffic in both directions across a large number of
+    // mappings and reports the average time per translated packet.
+
+    static constexpr uint16_t kNumMappings = OT_MIN(1000, OPENTHREAD_CONFIG_NAT64_MAX_MAPPINGS);
+    static constexpr uint16_t kNumRounds   = 10;
+
+    Ip6::Prefix                        prefix;
+    Ip4::Cidr                          cidr;
+    Ip6::Address                       ip6Server;
+    Ip4::Address                       ip4Server;
+    Ip4::Address                      *ip4Addresses;
+    uint16_t                          *translatedPorts;
+    Translator::AddressMappingIterator iter;
+    Translator::AddressMapping         mapping;
+    uint16_t                           numMappings;
+    uint64_t                           startTime;
+    uint64_t                           createDuration;
+    uint64_t                           duration6To4;
+    uint64_t                           duration4To6;
+
+    Log("--------------------------------------------------------------------------------------------");
+    Log("TestNat64MappingBenchmark - %u mappings", kNumMappings);
+
+    sInstance = testInitInstance();
+    VerifyOrQuit(sInstance != nullptr);
+
+    ip4Addresses    = new Ip4::Address[kNumMappings];
+    translatedPorts = new uint16_t[kNumMappings];
+
+    SuccessOrQuit(prefix.FromString("fd01::/96"));
+    SuccessOrQuit(cidr.FromString("10.100.0.0/20"));
+    SuccessOrQuit(ip6Server.FromString("fd01::ac10:f3c5"));
+    SuccessOrQuit(ip4Server.FromString("172.16.243.197"));
+
+    SuccessOrQuit(sInstance->Get<Translator>().SetIp4Cidr(cidr));
+    sInstance->Get<Translator>().SetNat64Prefix(prefix);
+    sInstance->Get<Translator>().SetEnabled(true);
+
+    createDuration = 0;
+    duration6To4   = 0;
+    duration4To6   = 0;
+
+    for (uint16_t round = 0; round <= kNumRounds; round++)
+    {
+        for (uint16_t i = 0; i < kNumMappings; i++)
+        {
+            Message     *message;
+            Ip6::Address ip6Client;
+            Ip4::Headers ip4Headers;
+
+            SuccessOrQuit(ip6Client.FromString("fd02::"));
+            BigEndian::WriteUint16(i + 1, &ip6Client.mFields.m8[14]);
+
+            message = NewUdp6Message(ip6Client, ip6Server, 10000 + i);
+
+            startTime = GetMonotonicTimeNs();
+            SuccessOrQuit(sInstance->Get<Translator>().TranslateIp6ToIp4(*message));
+            (round == 0 ? createDuration : duration6To4) += GetMonotonicTimeNs() - startTime;
+
+            SuccessOrQuit(ip4Headers.ParseFrom(*message));
+            VerifyOrQuit(ip4Headers.GetDestinationAddress() == ip4Server);
+
+            if (round == 0)
+            {
+                ip4Addresses[i]    = ip4Headers.GetSourceAddress();
+                translatedPorts[i] = ip4Headers.GetSourcePort();
+            }
+            else
+            {
+                VerifyOrQuit(ip4Headers.GetSourceAddress() == ip4Addresses[i]);
+                VerifyOrQuit(ip4Headers.GetSourcePort() == translatedPorts[i]);
+            }
+
+            message->Free();
+        }
+
+        if (round == 0)
+        {
+            continue;
+        }
+
+        for (uint16_t i = 0; i < kNumMappings; i++)
+        {
+            Message     *message;
+            Ip6::Headers ip6Headers;
+
+            message = NewUdp4Message(ip4Server, ip4Addresses[i], translatedPorts[i]);
+
+            startTime = GetMonotonicTimeNs();
+            SuccessOrQuit(sInstance->Get<Translator>().TranslateIp4ToIp6(*message));
+            duration4To6 += GetMonotonicTimeNs() - startTime;
+
+            SuccessOrQuit(ip6Headers.ParseFrom(*message));
+            VerifyOrQuit(BigEndian::ReadUint16(&ip6Headers.GetDestinationAddress().mFields.m8[14]) == i + 1);
+            VerifyOrQuit(ip6Headers.GetDestinationPort() == 10000 + i);
+
+            message->Free();
+        }
+    }
+
+    numMappings = 0;
+    iter.Init(*sInstance);
+
+    while (iter.GetNext(mapping) == kErrorNone)
+    {
+        numMappings++;
+    }
+
+    VerifyOrQuit(numMappings == kNumMappings);
+
+    Log("Create mapping : %8lu ns/packet", ToUlong(static_cast<uint32_t>(createDuration / kNumMappings)));
+    Log("IPv6 -> IPv4   : %8lu ns/packet",
+        ToUlong(static_cast<uint32_t>(duration6To4 / (static_cast<uint32_t>(kNumMappings) * kNumRounds))));
+    Log("IPv4 -> IPv6   : %8lu ns/packet",
+        ToUlong(static_cast<uint32_t>(duration4To6 / (static_cast<uint32_t>(kNumMappings) * kNumRounds))));
+
+    delete[] ip4Addresses;
+    delete[] translatedPorts;
+
+    testFreeInstance(sInstance);
+
+    Log("End of TestNat64MappingBenchmark");
+}
+
 } // namespace Nat64
 } // namespace ot
 
@@ -445,6 +933,9 @@ int main(void)
 #if OPENTHREAD_CONFIG_NAT64_TRANSLATOR_ENABLE
     ot::Nat64::TestNat64Translation();
     ot::Nat64::TestNat64Counters();
+    ot::Nat64::TestNat64MappingEviction();
+    ot::Nat64::TestNat64MappingExpiry();
+    ot::Nat64::TestNat64MappingBenchmark();
     printf("All tests passed\n");
 #else
     printf("NAT64 is not enabled\n");
@@ -0,0 +1,278 @@
+/*
+ *  Copyright (c) 2025, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdio.h>
+
+#include "test_platform.h"
+#include "test_util.hpp"
+#include "common/code_utils.hpp"
+#include "ncp/ncp_base.hpp"
+
+namespace ot {
+namespace Ncp {
+
+class DispatcherTester
+{
+public:
+    typedef NcpBase::HandlerEntry    HandlerEntry;
+    typedef NcpBase::PropertyHandler PropertyHandler;
+
+    static constexpr spinel_prop_key_t kCoreBegin    = SPINEL_PROP_LAST_STATUS;
+    static constexpr spinel_prop_key_t kCoreEnd      = SPINEL_PROP_INTERFACE__BEGIN;
+    static constexpr spinel_prop_key_t kCounterBegin = SPINEL_PROP_CNTR__BEGIN;
+    static constexpr spinel_prop_key_t kCounterEnd   = NcpBase::kCounterIndexEnd;
+    static constexpr uint32_t          kMaxKey       = SPINEL_PROP_DEBUG__END;
+
+    static void TestHandlerIndex(void)
+    {
+        // Verify that looking up every key through the direct index
+        // matches the binary search over the same sorted table.
+
+        printf("TestHandlerIndex\n");
+
+        for (size_t i = 1; i < OT_ARRAY_LENGTH(kHandlerEntries); i++)
+        {
+            VerifyOrQuit(kHandlerEntries[i - 1].mKey < kHandlerEntries[i].mKey);
+        }
+
+        for (uint32_t key = 0; key < kMaxKey; key++)
+        {
+            spinel_prop_key_t propKey = static_cast<spinel_prop_key_t>(key);
+
+            VerifyOrQuit(FindIndexed(propKey) == FindSearched(propKey));
+        }
+
+        for (const HandlerEntry &entry : kHandlerEntries)
+        {
+            VerifyOrQuit(FindIndexed(entry.mKey) == entry.mHandler);
+        }
+
+        VerifyOrQuit(FindIndexed(SPINEL_PROP_CAPS) == nullptr);
+        VerifyOrQuit(FindIndexed(SPINEL_PROP_CNTR_TX_PKT_ACK_REQ) == nullptr);
+        VerifyOrQuit(FindIndexed(SPINEL_PROP_VENDOR__BEGIN) == nullptr);
+    }
+
+    static void TestGetAndSetHandlerTables(void)
+    {
+        // Verify that the getter and setter lookups (direct index with
+        // binary search fallback) match a linear search over the actual
+        // `NcpBase` tables for every key.
+
+        printf("TestGetAndSetHandlerTables\n");
+
+        VerifyOrQuit(NcpBase::kNumGetHandlerEntries > 0);
+        VerifyOrQuit(NcpBase::kNumSetHandlerEntries > 0);
+
+        for (uint32_t key = 0; key < kMaxKey; key++)
+        {
+            spinel_prop_key_t propKey = static_cast<spinel_prop_key_t>(key);
+
+            VerifyOrQuit(NcpBase::FindGetPropertyHandler(propKey) ==
+                         FindLinear(NcpBase::kGetHandlerEntries, NcpBase::kNumGetHandlerEntries, propKey));
+            VerifyOrQuit(NcpBase::FindSetPropertyHandler(propKey) ==
+                         FindLinear(NcpBase::kSetHandlerEntries, NcpBase::kNumSetHandlerEntries, propKey));
+        }
+
+        for (size_t i = 0; i < NcpBase::kNumGetHandlerEntries; i++)
+        {
+            const HandlerEntry &entry = NcpBase::kGetHandlerEntries[i];
+
+            VerifyOrQuit(NcpBase::FindGetPropertyHandler(entry.mKey) == entry.mHandler);
+        }
+
+        for (size_t i = 0; i < NcpBase::kNumSetHandlerEntries; i++)
+        {
+            const HandlerEntry &entry = NcpBase::kSetHandlerEntries[i];
+
+            VerifyOrQuit(NcpBase::FindSetPropertyHandler(entry.mKey) == entry.mHandler);
+        }
+    }
+
+    static void TestPropertyHandlerLookup(void)
+    {
+        printf("TestPropertyHandlerLookup\n");
+
+        VerifyOrQuit(NcpBase::FindGetPropertyHandler(SPINEL_PROP_LAST_STATUS) != nullptr);
+        VerifyOrQuit(NcpBase::FindGetPropertyHandler(SPINEL_PROP_CAPS) != nullptr);
+        VerifyOrQuit(NcpBase::FindGetPropertyHandler(SPINEL_PROP_NET_ROLE) != nullptr);
+        VerifyOrQuit(NcpBase::FindGetPropertyHandler(SPINEL_PROP_CNTR_TX_PKT_TOTAL) != nullptr);
+        VerifyOrQuit(NcpBase::FindGetPropertyHandler(SPINEL_PROP_CNTR_ALL_MAC_COUNTERS) != nullptr);
+        VerifyOrQuit(NcpBase::FindGetPropertyHandler(SPINEL_PROP_THREAD_CHILD_TIMEOUT) != nullptr);
+        VerifyOrQuit(NcpBase::FindGetPropertyHandler(SPINEL_PROP_NET_ROLE) !=
+                     NcpBase::FindGetPropertyHandler(SPINEL_PROP_CAPS));
+        VerifyOrQuit(NcpBase::FindGetPropertyHandler(static_cast<spinel_prop_key_t>(0xff)) == nullptr);
+        VerifyOrQuit(NcpBase::FindGetPropertyHandler(static_cast<spinel_prop_key_t>(0x6ff)) == nullptr);
+        VerifyOrQuit(NcpBase::FindGetPropertyHandler(static_cast<spinel_prop_key_t>(0x3fff)) == nullptr);
+
+        VerifyOrQuit(NcpBase::FindSetPropertyHandler(SPINEL_PROP_NET_ROLE) != nullptr);
+        VerifyOrQuit(NcpBase::FindSetPropertyHandler(SPINEL_PROP_STREAM_NET) != nullptr);
+        VerifyOrQuit(NcpBase::FindSetPropertyHandler(SPINEL_PROP_THREAD_CHILD_TIMEOUT) != nullptr);
+        VerifyOrQuit(NcpBase::FindSetPropertyHandler(SPINEL_PROP_CAPS) == nullptr);
+    }
+
+    static void BenchmarkDispatch(void)
+    {
+        static constexpr uint32_t kNumRounds = 100000;
+
+        uint64_t startTime;
+        uint64_t searchDuration;
+        uint64_t indexDuration;
+        uint32_t searchCount = 0;
+        uint32_t indexCount  = 0;
+
+        printf("BenchmarkDispatch\n");
+
+        startTime = GetMonotonicTimeNs();
+
+        for (uint32_t round = 0; round < kNumRounds; round++)
+        {
+            for (const HandlerEntry &entry : kHandlerEntries)
+            {
+                searchCount += (FindSearched(entry.mKey) != nullptr) ? 1 : 0;
+            }
+        }
+
+        searchDuration = GetMonotonicTimeNs() - startTime;
+        startTime      = GetMonotonicTimeNs();
+
+        for (uint32_t round = 0; round < kNumRounds; round++)
+        {
+            for (const HandlerEntry &entry : kHandlerEntries)
+            {
+                indexCount += (FindIndexed(entry.mKey) != nullptr) ? 1 : 0;
+            }
+        }
+
+        indexDuration = GetMonotonicTimeNs() - startTime;
+
+        VerifyOrQuit(searchCount == indexCount);
+
+        searchDuration /= static_cast<uint64_t>(kNumRounds) * OT_ARRAY_LENGTH(kHandlerEntries) / 1000;
+        indexDuration /= static_cast<uint64_t>(kNumRounds) * OT_ARRAY_LENGTH(kHandlerEntries) / 1000;
+
+        printf("  per lookup: binary search %6lu ps, direct index (with fallback) %6lu ps\n",
+               ToUlong(static_cast<uint32_t>(searchDuration)), ToUlong(static_cast<uint32_t>(indexDuration)));
+    }
+
+private:
+    static PropertyHandler FindLinear(const HandlerEntry *aHandlerEntries, size_t aSize, spinel_prop_key_t aKey)
+    {
+        PropertyHandler handler = nullptr;
+
+        for (size_t i = 0; i < aSize; i++)
+        {
+            if (aHandlerEntries[i].mKey == aKey)
+            {
+                handler = aHandlerEntries[i].mHandler;
+                break;
+            }
+        }
+
+        return handler;
+    }
+
+    static PropertyHandler FindSearched(spinel_prop_key_t aKey)
+    {
+        return NcpBase::FindPropertyHandler(kHandlerEntries, OT_ARRAY_LENGTH(kHandlerEntries), aKey);
+    }
+
+    static PropertyHandler FindIndexed(spinel_prop_key_t aKey)
+    {
+        PropertyHandler handler;
+
+        if (kCoreIndex.Contains(aKey))
+        {
+            handler = kCoreIndex.Find(kHandlerEntries, aKey);
+        }
+        else if (kCounterIndex.Contains(aKey))
+        {
+            handler = kCounterIndex.Find(kHandlerEntries, aKey);
+        }
+        else
+        {
+            handler = FindSearched(aKey);
+        }
+
+        return handler;
+    }
+
+    static constexpr HandlerEntry kHandlerEntries[] = {
+        {SPINEL_PROP_LAST_STATUS, &NcpBase::SendQueuedResponses},
+        {SPINEL_PROP_PROTOCOL_VERSION, &NcpBase::SendQueuedDatagramMessages},
+        {SPINEL_PROP_HWADDR, &NcpBase::SendQueuedResponses},
+        {SPINEL_PROP_PHY_CHAN, &NcpBase::SendQueuedDatagramMessages},
+        {SPINEL_PROP_PHY_RSSI, &NcpBase::SendQueuedResponses},
+        {SPINEL_PROP_MAC_SCAN_STATE, &NcpBase::SendQueuedDatagramMessages},
+        {SPINEL_PROP_MAC_15_4_LADDR, &NcpBase::SendQueuedResponses},
+        {SPINEL_PROP_MAC_15_4_PANID, &NcpBase::SendQueuedDatagramMessages},
+        {SPINEL_PROP_NET_ROLE, &NcpBase::SendQueuedResponses},
+        {SPINEL_PROP_NET_NETWORK_NAME, &NcpBase::SendQueuedDatagramMessages},
+        {SPINEL_PROP_THREAD_PARENT, &NcpBase::SendQueuedResponses},
+        {SPINEL_PROP_THREAD_LEADER_RID, &NcpBase::SendQueuedDatagramMessages},
+        {SPINEL_PROP_IPV6_ML_ADDR, &NcpBase::SendQueuedResponses},
+        {SPINEL_PROP_IPV6_ADDRESS_TABLE, &NcpBase::SendQueuedDatagramMessages},
+        {SPINEL_PROP_STREAM_RAW, &NcpBase::SendQueuedResponses},
+        {SPINEL_PROP_STREAM_NET, &NcpBase::SendQueuedDatagramMessages},
+        {SPINEL_PROP_MESHCOP_JOINER_STATE, &NcpBase::SendQueuedResponses},
+        {SPINEL_PROP_SERVER_SERVICES, &NcpBase::SendQueuedDatagramMessages},
+        {SPINEL_PROP_CNTR_TX_PKT_TOTAL, &NcpBase::SendQueuedResponses},
+        {SPINEL_PROP_CNTR_RX_PKT_TOTAL, &NcpBase::SendQueuedDatagramMessages},
+        {SPINEL_PROP_CNTR_ALL_MAC_COUNTERS, &NcpBase::SendQueuedResponses},
+        {SPINEL_PROP_CNTR_MLE_COUNTERS, &NcpBase::SendQueuedDatagramMessages},
+        {SPINEL_PROP_CNTR_MAC_RETRY_HISTOGRAM, &NcpBase::SendQueuedResponses},
+        {SPINEL_PROP_THREAD_CHILD_TIMEOUT, &NcpBase::SendQueuedDatagramMessages},
+        {SPINEL_PROP_THREAD_NEIGHBOR_TABLE, &NcpBase::SendQueuedResponses},
+        {SPINEL_PROP_NEST_STREAM_MFG, &NcpBase::SendQueuedDatagramMessages},
+        {SPINEL_PROP_DEBUG_TEST_ASSERT, &NcpBase::SendQueuedResponses},
+    };
+
+    static constexpr NcpBase::HandlerIndex<kCoreBegin, kCoreEnd> kCoreIndex =
+        NcpBase::MakeHandlerIndex<kCoreBegin, kCoreEnd>(kHandlerEntries);
+
+    static constexpr NcpBase::HandlerIndex<kCounterBegin, kCounterEnd> kCounterIndex =
+        NcpBase::MakeHandlerIndex<kCounterBegin, kCounterEnd>(kHandlerEntries);
+};
+
+constexpr DispatcherTester::HandlerEntry DispatcherTester::kHandlerEntries[];
+constexpr NcpBase::HandlerIndex<DispatcherTester::kCoreBegin, DispatcherTester::kCoreEnd> DispatcherTester::kCoreIndex;
+constexpr NcpBase::HandlerIndex<DispatcherTester::kCounterBegin, DispatcherTester::kCounterEnd>
+    DispatcherTester::kCounterIndex;
+
+} // namespace Ncp
+} // namespace ot
+
+int main(void)
+{
+    ot::Ncp::DispatcherTester::TestHandlerIndex();
+    ot::Ncp::DispatcherTester::TestGetAndSetHandlerTables();
+    ot::Ncp::DispatcherTester::TestPropertyHandlerLookup();
+    ot::Ncp::DispatcherTester::BenchmarkDispatch();
+
+    printf("All tests passed\n");
+    return 0;
+}
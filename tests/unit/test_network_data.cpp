@@ -1066,6 +1066,464 @@ void TestNetworkDataDsnSrpAnycastSeqNumSelection(void)
 }
 
 } // namespace NetworkData
+
+class UnitTester
+{
+public:
+    static void TestNetworkDataLeaderLookups(void);
+    static void BenchmarkNetworkDataLeaderLookups(void);
+
+private:
+    class TlvsBuilder
+    {
+    public:
+        // Builds Network Data TLVs. Every `Add{SubTlv}()` appends a
+        // sub-TLV to the last added Prefix TLV. All methods return
+        // `false` (and leave the TLVs unchanged) if there is no room.
+
+        TlvsBuilder(void)
+            : mLength(0)
+            , mPrefixTlvOffset(0)
+        {
+        }
+
+        const uint8_t *GetBytes(void) const { return mBytes; }
+        uint8_t        GetLength(void) const { return mLength; }
+
+        bool AddPrefix(uint8_t aDomainId, const Ip6::Prefix &aPrefix)
+        {
+            uint8_t prefixSize = aPrefix.GetBytesSize();
+
+            VerifyOrExit(CanAppend(4 + prefixSize));
+
+            mPrefixTlvOffset = mLength;
+            Append(NetworkData::NetworkDataTlv::kTypePrefix << 1);
+            Append(2 + prefixSize);
+            Append(aDomainId);
+            Append(aPrefix.GetLength());
+
+            for (uint8_t i = 0; i < prefixSize; i++)
+            {
+                Append(aPrefix.GetBytes()[i]);
+            }
+
+            return true;
+
+        exit:
+            return false;
+        }
+
+        bool AddHasRoute(const uint16_t *aRloc16s, const uint8_t *aFlags, uint8_t aNumEntries)
+        {
+            VerifyOrExit(StartSubTlv(NetworkData::NetworkDataTlv::kTypeHasRoute, 3 * aNumEntries));
+
+            for (uint8_t i = 0; i < aNumEntries; i++)
+            {
+                Append(aRloc16s[i] >> 8);
+                Append(aRloc16s[i] & 0xff);
+                Append(aFlags[i]);
+            }
+
+            return true;
+
+        exit:
+            return false;
+        }
+
+        bool AddBorderRouter(const uint16_t *aRloc16s, const uint16_t *aFlags, uint8_t aNumEntries)
+        {
+            VerifyOrExit(StartSubTlv(NetworkData::NetworkDataTlv::kTypeBorderRouter, 4 * aNumEntries));
+
+            for (uint8_t i = 0; i < aNumEntries; i++)
+            {
+                Append(aRloc16s[i] >> 8);
+                Append(aRloc16s[i] & 0xff);
+                Append(aFlags[i] >> 8);
+                Append(aFlags[i] & 0xff);
+            }
+
+            return true;
+
+        exit:
+            return false;
+        }
+
+        bool AddContext(uint8_t aContextId, bool aCompress, uint8_t aContextLength)
+        {
+            VerifyOrExit(StartSubTlv(NetworkData::NetworkDataTlv::kTypeContext, 2));
+
+            Append((aCompress ? kContextCompressFlag : 0) | aContextId);
+            Append(aContextLength);
+
+            return true;
+
+        exit:
+            return false;
+        }
+
+    private:
+        static constexpr uint8_t kContextCompressFlag = 1 << 4;
+
+        bool CanAppend(uint16_t aLength) const { return mLength + aLength <= sizeof(mBytes); }
+
+        void Append(uint16_t aByte) { mBytes[mLength++] = static_cast<uint8_t>(aByte); }
+
+        bool StartSubTlv(NetworkData::NetworkDataTlv::Type aType, uint8_t aLength)
+        {
+            VerifyOrExit(CanAppend(2 + aLength));
+
+            mBytes[mPrefixTlvOffset + 1] += 2 + aLength;
+            Append(aType << 1);
+            Append(aLength);
+
+            return true;
+
+        exit:
+            return false;
+        }
+
+        uint8_t mBytes[NetworkData::NetworkData::kMaxSize];
+        uint8_t mLength;
+        uint8_t mPrefixTlvOffset;
+    };
+
+    static void SetLeaderData(const TlvsBuilder &aBuilder);
+    static void GenerateAddress(Ip6::Address &aAddress);
+    static void GeneratePrefix(Ip6::Prefix &aPrefix);
+    static void GenerateLeaderData(void);
+    static void VerifyLookups(const Ip6::Address &aSource, const Ip6::Address &aDestination);
+};
+
+static Instance *sInstance;
+
+void UnitTester::SetLeaderData(const TlvsBuilder &aBuilder)
+{
+    NetworkData::Leader &leader = sInstance->Get<NetworkData::Leader>();
+
+    memcpy(leader.GetBytes(), aBuilder.GetBytes(), aBuilder.GetLength());
+    leader.SetLength(aBuilder.GetLength());
+    leader.SignalNetDataChanged();
+}
+
+void UnitTester::GenerateAddress(Ip6::Address &aAddress)
+{
+    // Generates an address from one of few base prefixes with a few
+    // random bytes changed, so that the generated addresses and
+    // prefixes share prefixes of various lengths.
+
+    static const char *const kBaseAddresses[] = {"fd00::", "fd00:1::1", "2001:db8::", "2001:db8:1:2::1"};
+    static const uint8_t     kByteValues[]    = {0x00, 0x01, 0x80, 0xff};
+
+    uint8_t numChanges = Random::NonCrypto::GenerateUpToExcluding<uint8_t>(4);
+    uint8_t baseIndex  = Random::NonCrypto::GenerateUpToExcluding<uint8_t>(GetArrayLength(kBaseAddresses) + 1);
+
+    if (baseIndex == GetArrayLength(kBaseAddresses))
+    {
+        aAddress.Clear();
+        aAddress.SetPrefix(sInstance->Get<Mle::Mle>().GetMeshLocalPrefix());
+    }
+    else
+    {
+        SuccessOrQuit(aAddress.FromString(kBaseAddresses[baseIndex]));
+    }
+
+    for (uint8_t i = 0; i < numChanges; i++)
+    {
+        uint8_t index = Random::NonCrypto::GenerateUpToExcluding<uint8_t>(sizeof(Ip6::Address));
+
+        aAddress.mFields.m8[index] =
+            kByteValues[Random::NonCrypto::GenerateUpToExcluding<uint8_t>(GetArrayLength(kByteValues))];
+    }
+}
+
+void UnitTester::GeneratePrefix(Ip6::Prefix &aPrefix)
+{
+    static const uint8_t kPrefixLengths[] = {0, 3, 8, 16, 32, 48, 56, 64, 64, 64, 72, 96, 128};
+
+    Ip6::Address address;
+
+    GenerateAddress(address);
+    aPrefix.InitFrom(address.GetBytes(),
+                     kPrefixLengths[Random::NonCrypto::GenerateUpToExcluding<uint8_t>(GetArrayLength(kPrefixLengths))]);
+}
+
+void UnitTester::GenerateLeaderData(void)
+{
+    // Generates random Prefix TLVs with random Has Route, Border
+    // Router and Context sub-TLVs. RLOC16s and preferences are picked
+    // from small sets so that route entries often compare equal.
+
+    static const uint16_t kRloc16s[] = {0x0400, 0x0401, 0x0800, 0x1000, 0x1001, 0x2c00};
+
+    TlvsBuilder builder;
+    uint8_t     numPrefixes = Random::NonCrypto::GenerateInClosedRange<uint8_t>(0, 14);
+
+    for (uint8_t i = 0; i < numPrefixes; i++)
+    {
+        Ip6::Prefix prefix;
+        uint8_t     numSubTlvs = Random::NonCrypto::GenerateUpToExcluding<uint8_t>(4);
+
+        GeneratePrefix(prefix);
+
+        if (!builder.AddPrefix(Random::NonCrypto::GenerateUpToExcluding<uint8_t>(3), prefix))
+        {
+            break;
+        }
+
+        for (uint8_t j = 0; j < numSubTlvs; j++)
+        {
+            uint16_t rloc16s[3];
+            uint16_t flags[3];
+            uint8_t  routeFlags[3];
+            uint8_t  numEntries = Random::NonCrypto::GenerateUpToExcluding<uint8_t>(GetArrayLength(rloc16s) + 1);
+
+            for (uint8_t k = 0; k < numEntries; k++)
+            {
+                rloc16s[k] = kRloc16s[Random::NonCrypto::GenerateUpToExcluding<uint8_t>(GetArrayLength(kRloc16s))];
+
+                // Random preference and on-mesh and default route flags.
+                flags[k]      = Random::NonCrypto::GenerateUpToExcluding<uint16_t>(4) << 14;
+                flags[k]     |= Random::NonCrypto::GenerateUpToExcluding<uint16_t>(4) << 8;
+                routeFlags[k] = static_cast<uint8_t>(Random::NonCrypto::GenerateUpToExcluding<uint8_t>(4) << 6);
+            }
+
+            switch (Random::NonCrypto::GenerateUpToExcluding<uint8_t>(3))
+            {
+            case 0:
+                IgnoreReturnValue(builder.AddHasRoute(rloc16s, routeFlags, numEntries));
+                break;
+
+            case 1:
+                IgnoreReturnValue(builder.AddBorderRouter(rloc16s, flags, numEntries));
+                break;
+
+            default:
+                // Context ID zero is invalid in a Context TLV.
+                IgnoreReturnValue(builder.AddContext(Random::NonCrypto::GenerateUpToExcluding<uint8_t>(16),
+                                                     Random::NonCrypto::GenerateUpToExcluding<uint8_t>(2) == 0,
+                                                     prefix.GetLength()));
+                break;
+            }
+        }
+    }
+
+    SetLeaderData(builder);
+}
+
+void UnitTester::VerifyLookups(const Ip6::Address &aSource, const Ip6::Address &aDestination)
+{
+    // Verifies that the lookups (which may use the lookup table) find
+    // the same entries as the lookups parsing the Network Data TLVs.
+
+    NetworkData::Leader &leader = sInstance->Get<NetworkData::Leader>();
+    Lowpan::Context      context;
+    Lowpan::Context      expectedContext;
+    uint16_t             rloc16;
+    uint16_t             expectedRloc16;
+    Error                error;
+
+    leader.FindContextForAddress(aDestination, context);
+    leader.FindContextForAddressInTlvs(aDestination, expectedContext);
+    VerifyOrQuit(context.IsValid() == expectedContext.IsValid());
+
+    if (context.IsValid())
+    {
+        VerifyOrQuit(context.GetPrefix() == expectedContext.GetPrefix());
+        VerifyOrQuit(context.GetContextId() == expectedContext.GetContextId());
+        VerifyOrQuit(context.GetCompressFlag() == expectedContext.GetCompressFlag());
+    }
+
+    VerifyOrQuit(leader.IsOnMesh(aDestination) == leader.IsOnMeshInTlvs(aDestination));
+
+    error = leader.RouteLookup(aSource, aDestination, rloc16);
+    VerifyOrQuit(error == leader.RouteLookupInTlvs(aSource, aDestination, expectedRloc16));
+    VerifyOrQuit((error != kErrorNone) || (rloc16 == expectedRloc16));
+
+    for (uint8_t domainId = 0; domainId < 3; domainId++)
+    {
+        error = leader.ExternalRouteLookup(domainId, aDestination, rloc16);
+        VerifyOrQuit(error == leader.ExternalRouteLookupInTlvs(domainId, aDestination, expectedRloc16));
+        VerifyOrQuit((error != kErrorNone) || (rloc16 == expectedRloc16));
+    }
+}
+
+void UnitTester::TestNetworkDataLeaderLookups(void)
+{
+    static constexpr uint16_t kNumNetworkData = 2000;
+    static constexpr uint8_t  kNumAddresses   = 20;
+
+    NetworkData::Leader *leader;
+
+    printf("\n\n-------------------------------------------------");
+    printf("\nTestNetworkDataLeaderLookups()\n");
+
+    sInstance = testInitInstance();
+    VerifyOrQuit(sInstance != nullptr);
+
+    leader = &sInstance->Get<NetworkData::Leader>();
+
+    for (uint16_t i = 0; i < kNumNetworkData; i++)
+    {
+        GenerateLeaderData();
+
+        for (uint8_t contextId = 0; contextId <= 16; contextId++)
+        {
+            Lowpan::Context context;
+            Lowpan::Context expectedContext;
+
+            leader->FindContextForId(contextId, context);
+            leader->FindContextForIdInTlvs(contextId, expectedContext);
+            VerifyOrQuit(context.IsValid() == expectedContext.IsValid());
+
+            if (context.IsValid())
+            {
+                VerifyOrQuit(context.GetPrefix() == expectedContext.GetPrefix());
+                VerifyOrQuit(context.GetCompressFlag() == expectedContext.GetCompressFlag());
+            }
+        }
+
+        for (uint8_t j = 0; j < kNumAddresses; j++)
+        {
+            Ip6::Address source;
+            Ip6::Address destination;
+
+            GenerateAddress(source);
+            GenerateAddress(destination);
+            VerifyLookups(source, destination);
+        }
+    }
+
+    printf("\nTestNetworkDataLeaderLookups() passed\n");
+
+    testFreeInstance(sInstance);
+}
+
+void UnitTester::BenchmarkNetworkDataLeaderLookups(void)
+{
+    // Benchmarks the lookups on a Network Data with 40 Prefix TLVs.
+    // To fit in the Network Data, most of them are short prefixes
+    // without sub-TLVs (which are still parsed by every lookup).
+
+    static constexpr uint16_t kNumRounds = 10000;
+
+    static const char *const kAddresses[] = {"2001:db8::1", "fdde:ad00:beef:1::1", "fd11:2233::1", "3000::1"};
+
+    static const uint16_t kBrRloc16s[]    = {0x0400};
+    static const uint16_t kBrFlags[]      = {0x0300}; // On-mesh and default route flags.
+    static const uint16_t kRouteRloc16s[] = {0x0800, 0x1000};
+    static const uint8_t  kRouteFlags[]   = {0x00, 0x40};
+
+    NetworkData::Leader *leader;
+    TlvsBuilder          builder;
+    Ip6::Prefix          prefix;
+    Ip6::Address         addresses[GetArrayLength(kAddresses)];
+    uint8_t              numPrefixes = 0;
+    uint32_t             numFound    = 0;
+    uint64_t             startTime;
+    uint64_t             durations[2];
+
+    printf("\n\n-------------------------------------------------");
+    printf("\nBenchmarkNetworkDataLeaderLookups()\n");
+
+    sInstance = testInitInstance();
+    VerifyOrQuit(sInstance != nullptr);
+
+    leader = &sInstance->Get<NetworkData::Leader>();
+
+    for (uint8_t i = 0; i < 34; i++)
+    {
+        uint8_t prefixByte = 0x40 + i;
+
+        prefix.InitFrom(&prefixByte, 8);
+        VerifyOrQuit(builder.AddPrefix(0, prefix));
+        numPrefixes++;
+    }
+
+    SuccessOrQuit(prefix.FromString("fd00::/8"));
+    VerifyOrQuit(builder.AddPrefix(0, prefix));
+    VerifyOrQuit(builder.AddBorderRouter(kBrRloc16s, kBrFlags, 1));
+    VerifyOrQuit(builder.AddContext(1, true, 8));
+    numPrefixes++;
+
+    SuccessOrQuit(prefix.FromString("fdde::/16"));
+    VerifyOrQuit(builder.AddPrefix(0, prefix));
+    VerifyOrQuit(builder.AddHasRoute(kRouteRloc16s, kRouteFlags, 2));
+    numPrefixes++;
+
+    SuccessOrQuit(prefix.FromString("2000::/3"));
+    VerifyOrQuit(builder.AddPrefix(0, prefix));
+    VerifyOrQuit(builder.AddHasRoute(kRouteRloc16s, kRouteFlags, 1));
+    numPrefixes++;
+
+    SuccessOrQuit(prefix.FromString("::/0"));
+    VerifyOrQuit(builder.AddPrefix(0, prefix));
+    VerifyOrQuit(builder.AddHasRoute(&kRouteRloc16s[1], &kRouteFlags[1], 1));
+    numPrefixes++;
+
+    SuccessOrQuit(prefix.FromString("fdde:ad00::/32"));
+    VerifyOrQuit(builder.AddPrefix(0, prefix));
+    VerifyOrQuit(builder.AddContext(2, true, 32));
+    numPrefixes++;
+
+    SuccessOrQuit(prefix.FromString("fdde:ad00:beef::/48"));
+    VerifyOrQuit(builder.AddPrefix(0, prefix));
+    VerifyOrQuit(builder.AddBorderRouter(kBrRloc16s, kBrFlags, 1));
+    numPrefixes++;
+
+    SetLeaderData(builder);
+
+    for (uint8_t i = 0; i < GetArrayLength(kAddresses); i++)
+    {
+        SuccessOrQuit(addresses[i].FromString(kAddresses[i]));
+    }
+
+    // Measure the same lookups (as done for every forwarded and
+    // compressed message) first using the `Leader` methods and then
+    // by parsing the Network Data TLVs.
+
+    for (uint8_t run = 0; run < 2; run++)
+    {
+        startTime = GetMonotonicTimeNs();
+
+        for (uint16_t round = 0; round < kNumRounds; round++)
+        {
+            for (const Ip6::Address &address : addresses)
+            {
+                Lowpan::Context context;
+                uint16_t        rloc16;
+
+                if (run == 0)
+                {
+                    leader->FindContextForAddress(address, context);
+                    numFound += context.IsValid() ? 1 : 0;
+                    numFound += leader->IsOnMesh(address) ? 1 : 0;
+                    numFound += (leader->RouteLookup(address, addresses[0], rloc16) == kErrorNone) ? 1 : 0;
+                }
+                else
+                {
+                    leader->FindContextForAddressInTlvs(address, context);
+                    numFound -= context.IsValid() ? 1 : 0;
+                    numFound -= leader->IsOnMeshInTlvs(address) ? 1 : 0;
+                    numFound -= (leader->RouteLookupInTlvs(address, addresses[0], rloc16) == kErrorNone) ? 1 : 0;
+                }
+            }
+        }
+
+        durations[run] = GetMonotonicTimeNs() - startTime;
+    }
+
+    VerifyOrQuit(numFound == 0);
+
+    printf("  prefixes:            %u (%u bytes)\n", numPrefixes, builder.GetLength());
+    printf("  lookup table:        %s\n", OPENTHREAD_CONFIG_NETDATA_LOOKUP_TABLE_ENABLE ? "enabled" : "disabled");
+    printf("  lookups (ns):        %lu\n",
+           ToUlong(static_cast<uint32_t>(durations[0] / (kNumRounds * GetArrayLength(addresses)))));
+    printf("  parsing TLVs (ns):   %lu\n",
+           ToUlong(static_cast<uint32_t>(durations[1] / (kNumRounds * GetArrayLength(addresses)))));
+
+    testFreeInstance(sInstance);
+}
+
 } // namespace ot
 
 int main(void)
@@ -1076,6 +1534,8 @@ int main(void)
 #endif
     ot::NetworkData::TestNetworkDataDsnSrpServices();
     ot::NetworkData::TestNetworkDataDsnSrpAnycastSeqNumSelection();
+    ot::UnitTester::TestNetworkDataLeaderLookups();
+    ot::UnitTester::BenchmarkNetworkDataLeaderLookups();
 
     printf("\nAll tests passed\n");
     return 0;
@@ -0,0 +1,462 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "test_platform.h"
+
+#include <openthread/config.h>
+
+#include "test_util.h"
+#include "test_util.hpp"
+#include "common/code_utils.hpp"
+#include "common/num_utils.hpp"
+#include "common/random.hpp"
+#include "instance/instance.hpp"
+#include "thread/router_table.hpp"
+
+namespace ot {
+
+static Instance *sInstance;
+
+class UnitTester
+{
+public:
+    static void TestRouterTableRoutes(void);
+    static void BenchmarkRouterTableRoutes(void);
+
+private:
+    static constexpr uint8_t kSelfRouterId = 10;
+    static constexpr uint8_t kNumRouters   = 32;
+
+    static void    BecomeRouter(void);
+    static void    UpdateRouterIdMask(uint8_t aNumRouters);
+    static Router *PickRouter(void);
+    static void    PrepareRouteTlvData(Mle::RouteTlv::Data &aRouteTlvData);
+    static bool    IsReachable(uint8_t aRouterId);
+    static void    DetermineReachableIds(Mle::RouterIdMask &aReachableIds);
+    static void    VerifyRoutes(void);
+};
+
+void UnitTester::BecomeRouter(void)
+{
+    Mle::Mle &mle = sInstance->Get<Mle::Mle>();
+
+    mle.SetRouterId(kSelfRouterId);
+    mle.SetRloc16(Mle::Rloc16FromRouterId(kSelfRouterId));
+    mle.SetRole(Mle::kRoleRouter);
+}
+
+void UnitTester::UpdateRouterIdMask(uint8_t aNumRouters)
+{
+    // Updates the router table to allocate this device's Router ID
+    // and `aNumRouters - 1` other randomly selected Router IDs.
+
+    RouterTable      &routerTable = sInstance->Get<RouterTable>();
+    Mle::RouterIdMask routerIdMask;
+    uint8_t           numAllocated = 1;
+
+    routerIdMask.Clear();
+    routerIdMask.SetSequence(routerTable.GetRouterIdSequence() + 1);
+    routerIdMask.Add(kSelfRouterId);
+
+    while (numAllocated < aNumRouters)
+    {
+        uint8_t routerId = Random::NonCrypto::GenerateUpToExcluding<uint8_t>(Mle::kMaxRouterId + 1);
+
+        if (!routerIdMask.IsAllocated(routerId))
+        {
+            routerIdMask.Add(routerId);
+            numAllocated++;
+        }
+    }
+
+    routerTable.UpdateRouterIdMask(routerIdMask);
+    VerifyOrQuit(routerTable.GetActiveRouterCount() == aNumRouters);
+}
+
+Router *UnitTester::PickRouter(void)
+{
+    // Picks a random router entry other than this device.
+
+    RouterTable &routerTable = sInstance->Get<RouterTable>();
+    Router      *router;
+
+    do
+    {
+        uint8_t index = Random::NonCrypto::GenerateUpToExcluding<uint8_t>(routerTable.GetActiveRouterCount());
+
+        router = &routerTable.mRouters[index];
+    } while (router->GetRouterId() == kSelfRouterId);
+
+    return router;
+}
+
+void UnitTester::PrepareRouteTlvData(Mle::RouteTlv::Data &aRouteTlvData)
+{
+    // Prepares Route TLV data with random route costs and link
+    // qualities for all allocated routers.
+
+    Message          *message;
+    Mle::RouterIdMask routerIdMask;
+    OffsetRange       offsetRange;
+#if OPENTHREAD_CONFIG_MLE_LONG_ROUTES_ENABLE
+    bool isEven = true;
+#endif
+
+    message = sInstance->Get<MessagePool>().Allocate(Message::kTypeOther);
+    VerifyOrQuit(message != nullptr);
+
+    sInstance->Get<RouterTable>().GetRouterIdMask(routerIdMask);
+    SuccessOrQuit(message->Append(routerIdMask));
+
+    for (uint8_t routerId = 0; routerId <= Mle::kMaxRouterId; routerId++)
+    {
+        LinkQuality lqIn;
+        LinkQuality lqOut;
+        uint8_t     routeCost;
+
+        if (!routerIdMask.IsAllocated(routerId))
+        {
+            continue;
+        }
+
+        lqIn      = static_cast<LinkQuality>(Random::NonCrypto::GenerateUpToExcluding<uint8_t>(kLinkQuality3 + 1));
+        lqOut     = static_cast<LinkQuality>(Random::NonCrypto::GenerateUpToExcluding<uint8_t>(kLinkQuality3 + 1));
+        routeCost = Random::NonCrypto::GenerateUpToExcluding<uint8_t>(Mle::kMaxRouteCost);
+
+#if !OPENTHREAD_CONFIG_MLE_LONG_ROUTES_ENABLE
+        SuccessOrQuit(Mle::RouteTlv::AppendRouteDataEntry(*message, lqIn, lqOut, routeCost));
+#else
+        SuccessOrQuit(Mle::RouteTlv::AppendRouteDataEntry(*message, lqIn, lqOut, routeCost, isEven));
+        isEven = !isEven;
+#endif
+    }
+
+    offsetRange.InitFromMessageFullLength(*message);
+    SuccessOrQuit(aRouteTlvData.ParseFrom(*message, offsetRange));
+
+    message->Free();
+}
+
+bool UnitTester::IsReachable(uint8_t aRouterId)
+{
+    uint16_t nextHopRloc16;
+    uint8_t  pathCost;
+
+    sInstance->Get<RouterTable>().ComputeNextHopAndPathCost(Mle::Rloc16FromRouterId(aRouterId), nextHopRloc16,
+                                                            pathCost);
+
+    return pathCost < Mle::kMaxRouteCost;
+}
+
+void UnitTester::DetermineReachableIds(Mle::RouterIdMask &aReachableIds)
+{
+    aReachableIds.Clear();
+
+    for (uint8_t routerId = 0; routerId <= Mle::kMaxRouterId; routerId++)
+    {
+        if (IsReachable(routerId))
+        {
+            aReachableIds.Add(routerId);
+        }
+    }
+}
+
+void UnitTester::VerifyRoutes(void)
+{
+    // Verifies that the next hop and path cost towards every router
+    // ID (and towards a child of every router) match the ones from a
+    // full computation.
+
+    RouterTable &routerTable = sInstance->Get<RouterTable>();
+
+    for (uint8_t routerId = 0; routerId <= Mle::kMaxRouterId; routerId++)
+    {
+        uint16_t       routerRloc16  = Mle::Rloc16FromRouterId(routerId);
+        const uint16_t destRloc16s[] = {routerRloc16, static_cast<uint16_t>(routerRloc16 + 1)};
+
+        for (uint16_t destRloc16 : destRloc16s)
+        {
+            uint16_t nextHopRloc16;
+            uint8_t  pathCost;
+            uint16_t expectedNextHopRloc16;
+            uint8_t  expectedPathCost;
+
+            routerTable.GetNextHopAndPathCost(destRloc16, nextHopRloc16, pathCost);
+            routerTable.ComputeNextHopAndPathCost(destRloc16, expectedNextHopRloc16, expectedPathCost);
+
+            VerifyOrQuit(nextHopRloc16 == expectedNextHopRloc16);
+            VerifyOrQuit(pathCost == expectedPathCost);
+        }
+    }
+}
+
+void UnitTester::TestRouterTableRoutes(void)
+{
+    static constexpr uint16_t kNumOperations = 20000;
+
+    enum Operation : uint8_t
+    {
+        kOpProcessRouteTlv,
+        kOpAddRss,
+        kOpSetLinkQualityOut,
+        kOpSetState,
+        kOpRemoveRouterLink,
+        kOpSetNextHopAndCost,
+        kOpUpdateRouterIdMask,
+        kNumOperationTypes,
+    };
+
+    RouterTable *routerTable;
+    uint16_t     numReachabilityChanges = 0;
+
+    printf("TestRouterTableRoutes()");
+
+    sInstance = testInitInstance();
+    VerifyOrQuit(sInstance != nullptr);
+
+    routerTable = &sInstance->Get<RouterTable>();
+
+    BecomeRouter();
+    UpdateRouterIdMask(kNumRouters);
+    VerifyRoutes();
+
+    // Apply random changes to the router table and after each change
+    // verify the (possibly cached) routes against a full computation.
+    // Routes are not looked up between some of the changes, so that
+    // stale cache entries accumulate.
+
+    for (uint16_t i = 0; i < kNumOperations; i++)
+    {
+        Router *router = PickRouter();
+
+        switch (Random::NonCrypto::GenerateUpToExcluding<uint8_t>(kNumOperationTypes))
+        {
+        case kOpProcessRouteTlv:
+        {
+            Mle::RouteTlv::Data routeTlvData;
+            Mle::RouterIdMask   reachableIds;
+            Mle::RouterIdMask   newReachableIds;
+            bool                reachabilityChanged;
+
+            // `ProcessRouteTlv()` only checks the routers whose path
+            // cost may be affected by the update. Verify that it
+            // reports a reachability change exactly when checking all
+            // the routers does.
+
+            PrepareRouteTlvData(routeTlvData);
+            DetermineReachableIds(reachableIds);
+
+            reachabilityChanged = routerTable->ProcessRouteTlv(routeTlvData, router->GetRouterId());
+
+            DetermineReachableIds(newReachableIds);
+            VerifyOrQuit(reachabilityChanged ==
+                         (memcmp(&reachableIds, &newReachableIds, sizeof(Mle::RouterIdMask)) != 0));
+
+            if (reachabilityChanged)
+            {
+                numReachabilityChanges++;
+            }
+
+            break;
+        }
+
+        case kOpAddRss:
+        {
+            int8_t rss = static_cast<int8_t>(Random::NonCrypto::GenerateInClosedRange<uint8_t>(0, 80) - 120);
+
+            router->GetLinkInfo().AddRss(rss);
+            break;
+        }
+
+        case kOpSetLinkQualityOut:
+            router->SetLinkQualityOut(
+                static_cast<LinkQuality>(Random::NonCrypto::GenerateUpToExcluding<uint8_t>(kLinkQuality3 + 1)));
+            break;
+
+        case kOpSetState:
+            router->SetState(router->IsStateValid() ? Neighbor::kStateInvalid : Neighbor::kStateValid);
+            break;
+
+        case kOpRemoveRouterLink:
+            routerTable->RemoveRouterLink(*router);
+            break;
+
+        case kOpSetNextHopAndCost:
+            if (Random::NonCrypto::GenerateUpToExcluding<uint8_t>(4) == 0)
+            {
+                router->SetNextHopToInvalid();
+            }
+            else
+            {
+                router->SetNextHopAndCost(PickRouter()->GetRouterId(),
+                                          Random::NonCrypto::GenerateUpToExcluding<uint8_t>(Mle::kMaxRouteCost));
+            }
+
+            break;
+
+        case kOpUpdateRouterIdMask:
+            if (Random::NonCrypto::GenerateUpToExcluding<uint8_t>(50) == 0)
+            {
+                UpdateRouterIdMask(kNumRouters);
+            }
+
+            break;
+
+        default:
+            break;
+        }
+
+        if (Random::NonCrypto::GenerateUpToExcluding<uint8_t>(4) != 0)
+        {
+            VerifyRoutes();
+        }
+    }
+
+    VerifyRoutes();
+    VerifyOrQuit(numReachabilityChanges > 0);
+
+    printf(" -- PASS\n");
+
+    testFreeInstance(sInstance);
+}
+
+void UnitTester::BenchmarkRouterTableRoutes(void)
+{
+    static constexpr uint16_t kNumRounds    = 1000;
+    static constexpr uint16_t kNumRouteTlvs = 100;
+
+    static Mle::RouteTlv::Data routeTlvData[kNumRouteTlvs];
+    static uint8_t             neighborIds[kNumRouteTlvs];
+
+    RouterTable *routerTable;
+    uint16_t     routerRloc16s[kNumRouters];
+    uint8_t      numRouters = 0;
+    uint32_t     numFound   = 0;
+    uint64_t     startTime;
+    uint64_t     lookupDuration;
+    uint64_t     computeDuration;
+    uint64_t     updateDuration;
+
+    printf("BenchmarkRouterTableRoutes()\n");
+
+    sInstance = testInitInstance();
+    VerifyOrQuit(sInstance != nullptr);
+
+    routerTable = &sInstance->Get<RouterTable>();
+
+    BecomeRouter();
+    UpdateRouterIdMask(kNumRouters);
+
+    for (Router &router : *routerTable)
+    {
+        routerRloc16s[numRouters++] = router.GetRloc16();
+
+        if (router.GetRouterId() != kSelfRouterId)
+        {
+            router.SetState(Neighbor::kStateValid);
+            router.GetLinkInfo().AddRss(-60);
+        }
+    }
+
+    for (uint16_t i = 0; i < kNumRouteTlvs; i++)
+    {
+        PrepareRouteTlvData(routeTlvData[i]);
+        neighborIds[i] = PickRouter()->GetRouterId();
+    }
+
+    // Benchmark processing Route TLVs received from neighbors.
+
+    startTime = GetMonotonicTimeNs();
+
+    for (uint16_t i = 0; i < kNumRouteTlvs; i++)
+    {
+        routerTable->UpdateRoutes(routeTlvData[i], neighborIds[i]);
+    }
+
+    updateDuration = GetMonotonicTimeNs() - startTime;
+
+    // Benchmark determining the next hop towards every router (as done
+    // when forwarding mesh frames), and the same using the full
+    // computation.
+
+    startTime = GetMonotonicTimeNs();
+
+    for (uint16_t round = 0; round < kNumRounds; round++)
+    {
+        for (uint16_t rloc16 : routerRloc16s)
+        {
+            if (routerTable->GetNextHop(rloc16) != Mle::kInvalidRloc16)
+            {
+                numFound++;
+            }
+        }
+    }
+
+    lookupDuration = GetMonotonicTimeNs() - startTime;
+
+    startTime = GetMonotonicTimeNs();
+
+    for (uint16_t round = 0; round < kNumRounds; round++)
+    {
+        for (uint16_t rloc16 : routerRloc16s)
+        {
+            uint16_t nextHopRloc16;
+            uint8_t  pathCost;
+
+            routerTable->ComputeNextHopAndPathCost(rloc16, nextHopRloc16, pathCost);
+
+            if (nextHopRloc16 != Mle::kInvalidRloc16)
+            {
+                numFound--;
+            }
+        }
+    }
+
+    computeDuration = GetMonotonicTimeNs() - startTime;
+
+    VerifyOrQuit(numFound == 0);
+
+    printf("  routers:             %u\n", kNumRouters);
+    printf("  route cache:         %s\n", OPENTHREAD_CONFIG_MLE_ROUTE_CACHE_ENABLE ? "enabled" : "disabled");
+    printf("  update routes (ns):  %lu\n", ToUlong(static_cast<uint32_t>(updateDuration / kNumRouteTlvs)));
+    printf("  next hop (ns):       %lu\n", ToUlong(static_cast<uint32_t>(lookupDuration / (kNumRounds * kNumRouters))));
+    printf("  full compute (ns):   %lu\n",
+           ToUlong(static_cast<uint32_t>(computeDuration / (kNumRounds * kNumRouters))));
+
+    testFreeInstance(sInstance);
+}
+
+} // namespace ot
+
+int main(void)
+{
+    ot::UnitTester::TestRouterTableRoutes();
+    ot::UnitTester::BenchmarkRouterTableRoutes();
+    printf("\nAll tests passed.\n");
+    return 0;
+}
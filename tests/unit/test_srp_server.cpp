@@ -107,7 +107,7 @@ uint32_t otPlatAlarmMilliGetNow(void) { return sNow; }
 
 //----------------------------------------------------------------------------------------------------------------------
 
-Array<void *, 500> sHeapAllocatedPtrs;
+Array<void *, 5000> sHeapAllocatedPtrs;
 
 #if OPENTHREAD_CONFIG_HEAP_EXTERNAL_ENABLE
 void *otPlatCAlloc(size_t aNum, size_t aSize)
@@ -1610,6 +1610,198 @@ void TestSrpServerFastStartMode(void)
 
 #endif // OPENTHREAD_CONFIG_SRP_SERVER_FAST_START_MODE_ENABLE
 
+#if OPENTHREAD_CONFIG_HEAP_EXTERNAL_ENABLE
+
+namespace Srp {
+
+class ServerTester
+{
+    typedef Server::Host    Host;
+    typedef Server::Service Service;
+
+public:
+    static void BenchmarkNameIndex(void)
+    {
+        // Registers 1000 services (on 100 hosts using 20 service types)
+        // directly on the SRP server and compares looking up each
+        // service by its instance name using the name index with a
+        // search through all hosts and services.
+
+        static constexpr uint16_t kNumHosts           = 100;
+        static constexpr uint16_t kNumServicesPerHost = 10;
+        static constexpr uint16_t kNumServices        = kNumHosts * kNumServicesPerHost;
+        static constexpr uint16_t kNumServiceTypes    = 20;
+        static constexpr uint16_t kNumRounds          = 20;
+        static constexpr uint16_t kNameSize           = 64;
+
+        static char sInstanceNames[kNumServices][kNameSize];
+
+        Server        *srpServer;
+        const Service *service;
+        TimeMilli      now;
+        char           name[kNameSize];
+        char           label[kNameSize];
+        uint16_t       heapAllocations;
+        uint16_t       numMatches;
+        uint64_t       startTime;
+        uint64_t       linearDuration;
+        uint64_t       indexDuration;
+
+        Log("--------------------------------------------------------------------------------------------");
+        Log("BenchmarkNameIndex");
+
+        InitTest(/* aStartThread */ false);
+
+        srpServer       = &sInstance->Get<Server>();
+        heapAllocations = sHeapAllocatedPtrs.GetLength();
+        now             = TimerMilli::GetNow();
+
+        for (uint16_t hostIndex = 0; hostIndex < kNumHosts; hostIndex++)
+        {
+            Host *host = Host::Allocate(*sInstance, now);
+
+            VerifyOrQuit(host != nullptr);
+            snprintf(name, sizeof(name), "host%u.default.service.arpa.", hostIndex);
+            SuccessOrQuit(host->SetFullName(name));
+
+            for (uint16_t index = hostIndex * kNumServicesPerHost; index < (hostIndex + 1) * kNumServicesPerHost;
+                 index++)
+            {
+                Service *newService;
+
+                snprintf(label, sizeof(label), "ins%u", index);
+                snprintf(sInstanceNames[index], kNameSize, "ins%u._srv%u._udp.default.service.arpa.", index,
+                         index % kNumServiceTypes);
+
+                newService = host->AddNewService(sInstanceNames[index], label, now);
+                VerifyOrQuit(newService != nullptr);
+
+                snprintf(name, sizeof(name), "_srv%u._udp.default.service.arpa.", index % kNumServiceTypes);
+                SuccessOrQuit(newService->mServiceName.Set(name));
+
+                if (index == 0)
+                {
+                    Heap::String *subType = newService->mSubTypes.PushBack();
+
+                    VerifyOrQuit(subType != nullptr);
+                    SuccessOrQuit(subType->Set("_s0._sub._srv0._udp.default.service.arpa."));
+                }
+            }
+
+            srpServer->mHosts.Push(*host);
+            srpServer->mNameIndex.AddHost(*host);
+        }
+
+        //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        // Validate the lookups using the name index.
+
+        service = srpServer->FindNextServiceByInstanceName("INS7._SRV7._UDP.default.service.arpa.", nullptr);
+        VerifyOrQuit(service != nullptr);
+        VerifyOrQuit(StringMatch(service->GetInstanceName(), sInstanceNames[7]));
+        VerifyOrQuit(srpServer->FindNextServiceByInstanceName(sInstanceNames[7], service) == nullptr);
+
+        VerifyOrQuit(srpServer->FindHost("Host42.Default.Service.Arpa.") != nullptr);
+        VerifyOrQuit(StringMatch(srpServer->FindHost("host42.default.service.arpa.")->GetFullName(),
+                                 "host42.default.service.arpa."));
+        VerifyOrQuit(srpServer->FindHost("host420.default.service.arpa.") == nullptr);
+        VerifyOrQuit(srpServer->FindNextServiceByInstanceName("ins1000._srv0._udp.default.service.arpa.", nullptr) ==
+                     nullptr);
+
+        numMatches = 0;
+        service    = nullptr;
+
+        while ((service = srpServer->FindNextServiceByServiceName("_srv3._udp.default.service.arpa.", service)) !=
+               nullptr)
+        {
+            VerifyOrQuit(service->MatchesServiceName("_srv3._udp.default.service.arpa."));
+            numMatches++;
+        }
+
+        VerifyOrQuit(numMatches == kNumServices / kNumServiceTypes);
+
+        service = srpServer->FindNextServiceByServiceName("_S0._sub._srv0._udp.default.service.arpa.", nullptr);
+        VerifyOrQuit(service != nullptr);
+        VerifyOrQuit(StringMatch(service->GetInstanceName(), sInstanceNames[0]));
+        VerifyOrQuit(srpServer->FindNextServiceByServiceName("_s0._sub._srv0._udp.default.service.arpa.", service) ==
+                     nullptr);
+        VerifyOrQuit(srpServer->FindNextServiceByServiceName("_s1._sub._srv0._udp.default.service.arpa.", nullptr) ==
+                     nullptr);
+
+        //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        // Benchmark the instance name lookups.
+
+        startTime = GetMonotonicTimeNs();
+
+        for (uint16_t round = 0; round < kNumRounds; round++)
+        {
+            for (const char *instanceName : sInstanceNames)
+            {
+                VerifyOrQuit(FindServiceBySearch(*srpServer, instanceName) != nullptr);
+            }
+        }
+
+        linearDuration = GetMonotonicTimeNs() - startTime;
+        startTime      = GetMonotonicTimeNs();
+
+        for (uint16_t round = 0; round < kNumRounds; round++)
+        {
+            for (const char *instanceName : sInstanceNames)
+            {
+                VerifyOrQuit(srpServer->FindNextServiceByInstanceName(instanceName, nullptr) != nullptr);
+            }
+        }
+
+        indexDuration = GetMonotonicTimeNs() - startTime;
+
+        Log("%u services: search %lu ns, name index %lu ns per lookup", kNumServices,
+            ToUlong(static_cast<uint32_t>(linearDuration / (kNumRounds * kNumServices))),
+            ToUlong(static_cast<uint32_t>(indexDuration / (kNumRounds * kNumServices))));
+
+        //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        // Remove all hosts and validate that all heap allocations are freed.
+
+        while (!srpServer->mHosts.IsEmpty())
+        {
+            Host *host = srpServer->mHosts.Pop();
+
+            srpServer->mNameIndex.RemoveHost(*host);
+            host->Free();
+        }
+
+        VerifyOrQuit(srpServer->FindHost("host42.default.service.arpa.") == nullptr);
+        VerifyOrQuit(srpServer->FindNextServiceByInstanceName(sInstanceNames[7], nullptr) == nullptr);
+        VerifyOrQuit(heapAllocations == sHeapAllocatedPtrs.GetLength());
+
+        FinalizeTest();
+
+        Log("End of BenchmarkNameIndex");
+    }
+
+private:
+    static const Service *FindServiceBySearch(const Server &aServer, const char *aInstanceName)
+    {
+        const Service *match = nullptr;
+
+        for (const Host &host : aServer.mHosts)
+        {
+            for (const Service &service : host.mServices)
+            {
+                if (service.MatchesInstanceName(aInstanceName))
+                {
+                    ExitNow(match = &service);
+                }
+            }
+        }
+
+    exit:
+        return match;
+    }
+};
+
+} // namespace Srp
+
+#endif // OPENTHREAD_CONFIG_HEAP_EXTERNAL_ENABLE
+
 #endif // ENABLE_SRP_TEST
 
 } // namespace ot
@@ -1631,6 +1823,9 @@ int main(void)
 #if OPENTHREAD_CONFIG_SRP_SERVER_FAST_START_MODE_ENABLE
     ot::TestSrpServerFastStartMode();
 #endif
+#if OPENTHREAD_CONFIG_HEAP_EXTERNAL_ENABLE
+    ot::Srp::ServerTester::BenchmarkNameIndex();
+#endif
 
     printf("All tests passed\n");
 #else
@@ -27,11 +27,13 @@
  */
 
 #include "test_platform.h"
+#include "test_util.hpp"
 
 #include "common/array.hpp"
 #include "common/code_utils.hpp"
 #include "common/debug.hpp"
 #include "common/num_utils.hpp"
+#include "common/random.hpp"
 #include "common/timer.hpp"
 #include "instance/instance.hpp"
 
@@ -578,6 +580,140 @@ template <typename TimerType> int TestTenTimers(void)
     return 0;
 }
 
+/**
+ * `BenchmarkTimer` sub-classes `TimerMilli` or `TimerMicro` and checks from its handler that timers fire in order of
+ * their fire times.
+ */
+template <typename TimerType> class BenchmarkTimer : public TimerType
+{
+public:
+    explicit BenchmarkTimer(Instance &aInstance)
+        : TimerType(aInstance, BenchmarkTimer::HandleTimerFired)
+    {
+    }
+
+    static void HandleTimerFired(Timer &aTimer)
+    {
+        VerifyOrQuit(aTimer.GetFireTime() >= sLastFireTime, "Timers fired out of order");
+        sLastFireTime = aTimer.GetFireTime();
+        sFiredCount++;
+    }
+
+    static void RemoveAll(Instance &aInstance) { TimerType::RemoveAll(aInstance); }
+
+    static Time     sLastFireTime;
+    static uint32_t sFiredCount;
+};
+
+template <typename TimerType> Time     BenchmarkTimer<TimerType>::sLastFireTime;
+template <typename TimerType> uint32_t BenchmarkTimer<TimerType>::sFiredCount;
+
+/**
+ * Measures the average cost of adding, removing and firing timers with a given number of running timers.
+ */
+template <typename TimerType> void BenchmarkTimers(uint16_t aNumTimers)
+{
+    static constexpr uint16_t kNumRounds   = 20;
+    static constexpr uint32_t kMaxInterval = 100000;
+
+    Instance                   *instance  = testInitInstance();
+    BenchmarkTimer<TimerType> **timers    = new BenchmarkTimer<TimerType> *[aNumTimers];
+    uint32_t                   *intervals = new uint32_t[aNumTimers];
+    uint64_t                    addNs     = 0;
+    uint64_t                    removeNs  = 0;
+    uint64_t                    fireNs    = 0;
+    uint64_t                    startNs;
+    uint64_t                    numOps;
+
+    printf("BenchmarkTimers() with %4u timers ", aNumTimers);
+
+    BenchmarkTimer<TimerType>::RemoveAll(*instance);
+
+    for (uint16_t i = 0; i < aNumTimers; i++)
+    {
+        timers[i]    = new BenchmarkTimer<TimerType>(*instance);
+        intervals[i] = 1 + Random::NonCrypto::GenerateUpToExcluding<uint32_t>(kMaxInterval);
+    }
+
+    sNow = 0;
+
+    for (uint16_t round = 0; round < kNumRounds; round++)
+    {
+        // Add: start all timers with random intervals.
+
+        startNs = GetMonotonicTimeNs();
+
+        for (uint16_t i = 0; i < aNumTimers; i++)
+        {
+            timers[i]->Start(intervals[i]);
+        }
+
+        addNs += GetMonotonicTimeNs() - startNs;
+
+        // Remove: stop all timers (in an order unrelated to their fire times).
+
+        startNs = GetMonotonicTimeNs();
+
+        for (uint16_t i = 0; i < aNumTimers; i++)
+        {
+            timers[i]->Stop();
+        }
+
+        removeNs += GetMonotonicTimeNs() - startNs;
+
+        VerifyOrQuit(!sTimerOn);
+
+        // Fire: start all timers again, then move the time past the
+        // longest interval and process all the expired timers.
+
+        for (uint16_t i = 0; i < aNumTimers; i++)
+        {
+            timers[i]->Start(intervals[(i + round) % aNumTimers]);
+        }
+
+        BenchmarkTimer<TimerType>::sLastFireTime = Time(sNow);
+        BenchmarkTimer<TimerType>::sFiredCount   = 0;
+        sNow += kMaxInterval;
+
+        startNs = GetMonotonicTimeNs();
+
+        while (sTimerOn)
+        {
+            AlarmFired<TimerType>(instance);
+        }
+
+        fireNs += GetMonotonicTimeNs() - startNs;
+
+        VerifyOrQuit(BenchmarkTimer<TimerType>::sFiredCount == aNumTimers);
+    }
+
+    numOps = static_cast<uint64_t>(kNumRounds) * aNumTimers;
+
+    printf("- add: %6lu ns, remove: %6lu ns, fire: %6lu ns (per timer) --> PASSED\n",
+           static_cast<unsigned long>(addNs / numOps), static_cast<unsigned long>(removeNs / numOps),
+           static_cast<unsigned long>(fireNs / numOps));
+
+    for (uint16_t i = 0; i < aNumTimers; i++)
+    {
+        delete timers[i];
+    }
+
+    delete[] timers;
+    delete[] intervals;
+
+    testFreeInstance(instance);
+}
+
+template <typename TimerType> void TestTimerBenchmark(void)
+{
+    static const uint16_t kNumTimers[] = {10, 100, 1000};
+
+    for (uint16_t numTimers : kNumTimers)
+    {
+        BenchmarkTimers<TimerType>(numTimers);
+    }
+}
+
 /**
  * Test the `Timer::Time` class.
  */
@@ -676,6 +812,7 @@ template <typename TimerType> void RunTimerTests(void)
     TestOneTimer<TimerType>();
     TestTwoTimers<TimerType>();
     TestTenTimers<TimerType>();
+    TestTimerBenchmark<TimerType>();
 }
 
 } // namespace ot
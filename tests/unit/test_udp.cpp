@@ -0,0 +1,256 @@
+/*
+ *  Copyright (c) 2026, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "test_platform.h"
+
+#include <openthread/config.h>
+
+#include "test_util.h"
+#include "test_util.hpp"
+#include "common/code_utils.hpp"
+#include "common/num_utils.hpp"
+#include "instance/instance.hpp"
+#include "net/udp6.hpp"
+
+namespace ot {
+
+static Instance *sInstance;
+
+static constexpr uint16_t kNumSockets = 256;
+static constexpr uint16_t kBasePort   = 20000;
+
+static uint32_t sReceiveCounts[kNumSockets];
+
+static void HandleUdpReceive(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo)
+{
+    OT_UNUSED_VARIABLE(aMessage);
+    OT_UNUSED_VARIABLE(aMessageInfo);
+
+    (*static_cast<uint32_t *>(aContext))++;
+}
+
+static void OpenSocket(Ip6::Udp::SocketHandle &aSocket, uint16_t aIndex)
+{
+    SuccessOrQuit(sInstance->Get<Ip6::Udp>().Open(aSocket, Ip6::kNetifThreadInternal, HandleUdpReceive,
+                                                  &sReceiveCounts[aIndex]));
+}
+
+// Delivers a datagram and returns the index of the socket which received it, or `kNumSockets` if none.
+static uint16_t Deliver(Message &aMessage, Ip6::MessageInfo &aMessageInfo)
+{
+    uint16_t index;
+
+    memset(sReceiveCounts, 0, sizeof(sReceiveCounts));
+    sInstance->Get<Ip6::Udp>().HandlePayload(aMessage, aMessageInfo);
+
+    for (index = 0; index < kNumSockets; index++)
+    {
+        if (sReceiveCounts[index] != 0)
+        {
+            VerifyOrQuit(sReceiveCounts[index] == 1);
+            break;
+        }
+    }
+
+    return index;
+}
+
+void TestUdpSocketDemux(void)
+{
+    static Ip6::Udp::SocketHandle sockets[kNumSockets];
+
+    Ip6::Udp        *udp;
+    Message         *message;
+    Ip6::MessageInfo messageInfo;
+    Ip6::Address     peerAddress;
+    Ip6::Address     otherPeerAddress;
+    Ip6::Address     multicastAddress;
+
+    printf("TestUdpSocketDemux()");
+
+    sInstance = testInitInstance();
+    VerifyOrQuit(sInstance != nullptr);
+
+    udp = &sInstance->Get<Ip6::Udp>();
+
+    message = udp->NewMessage();
+    VerifyOrQuit(message != nullptr);
+
+    SuccessOrQuit(peerAddress.FromString("fd00::1"));
+    SuccessOrQuit(otherPeerAddress.FromString("fd00::2"));
+    SuccessOrQuit(multicastAddress.FromString("ff03::fc"));
+
+    messageInfo.SetPeerAddr(peerAddress);
+    messageInfo.SetPeerPort(1234);
+
+    // Every bound socket receives the datagrams sent to its port.
+
+    for (uint16_t i = 0; i < kNumSockets; i++)
+    {
+        OpenSocket(sockets[i], i);
+        SuccessOrQuit(udp->Bind(sockets[i], Ip6::SockAddr(kBasePort + i)));
+    }
+
+    for (uint16_t i = 0; i < kNumSockets; i++)
+    {
+        messageInfo.SetSockPort(kBasePort + i);
+        VerifyOrQuit(Deliver(*message, messageInfo) == i);
+    }
+
+    messageInfo.SetSockPort(kBasePort + kNumSockets);
+    VerifyOrQuit(Deliver(*message, messageInfo) == kNumSockets);
+
+    // Rebinding and closing a socket.
+
+    SuccessOrQuit(udp->Bind(sockets[7], Ip6::SockAddr(kBasePort + kNumSockets)));
+    VerifyOrQuit(Deliver(*message, messageInfo) == 7);
+    messageInfo.SetSockPort(kBasePort + 7);
+    VerifyOrQuit(Deliver(*message, messageInfo) == kNumSockets);
+
+    SuccessOrQuit(udp->Close(sockets[8]));
+    messageInfo.SetSockPort(kBasePort + 8);
+    VerifyOrQuit(Deliver(*message, messageInfo) == kNumSockets);
+
+    // A connected socket only receives from its peer. When more than
+    // one socket matches, the most recently opened one receives.
+
+    OpenSocket(sockets[8], 8);
+    SuccessOrQuit(udp->Connect(sockets[8], Ip6::SockAddr(peerAddress, 1234)));
+    SuccessOrQuit(udp->Bind(sockets[8], Ip6::SockAddr(kBasePort + 9)));
+
+    messageInfo.SetSockPort(kBasePort + 9);
+    VerifyOrQuit(Deliver(*message, messageInfo) == 8);
+    messageInfo.SetPeerAddr(otherPeerAddress);
+    VerifyOrQuit(Deliver(*message, messageInfo) == 9);
+
+    SuccessOrQuit(udp->Close(sockets[8]));
+    messageInfo.SetPeerAddr(peerAddress);
+    VerifyOrQuit(Deliver(*message, messageInfo) == 9);
+
+    // A socket bound to an address only receives datagrams sent to
+    // that address.
+
+    SuccessOrQuit(udp->Close(sockets[10]));
+    OpenSocket(sockets[10], 10);
+    SuccessOrQuit(udp->Bind(sockets[10], Ip6::SockAddr(multicastAddress, kBasePort + 11)));
+
+    messageInfo.SetSockPort(kBasePort + 11);
+    VerifyOrQuit(Deliver(*message, messageInfo) == 11);
+    messageInfo.SetSockAddr(multicastAddress);
+    VerifyOrQuit(Deliver(*message, messageInfo) == 10);
+    messageInfo.GetSockAddr().Clear();
+
+    for (Ip6::Udp::SocketHandle &socket : sockets)
+    {
+        SuccessOrQuit(udp->Close(socket));
+    }
+
+    messageInfo.SetSockPort(kBasePort);
+    VerifyOrQuit(Deliver(*message, messageInfo) == kNumSockets);
+
+    printf(" -- PASS\n");
+
+    message->Free();
+    testFreeInstance(sInstance);
+}
+
+void BenchmarkUdpSocketDemux(void)
+{
+    static constexpr uint32_t kNumRounds = 200;
+
+    static Ip6::Udp::SocketHandle sockets[kNumSockets];
+
+    Ip6::Udp        *udp;
+    Message         *message;
+    Ip6::MessageInfo messageInfo;
+    uint32_t         numReceived = 0;
+    uint64_t         startTime;
+    uint64_t         duration;
+
+    printf("BenchmarkUdpSocketDemux()\n");
+
+    sInstance = testInitInstance();
+    VerifyOrQuit(sInstance != nullptr);
+
+    udp = &sInstance->Get<Ip6::Udp>();
+
+    message = udp->NewMessage();
+    VerifyOrQuit(message != nullptr);
+
+    for (uint16_t i = 0; i < kNumSockets; i++)
+    {
+        OpenSocket(sockets[i], i);
+        SuccessOrQuit(udp->Bind(sockets[i], Ip6::SockAddr(kBasePort + i)));
+    }
+
+    memset(sReceiveCounts, 0, sizeof(sReceiveCounts));
+    messageInfo.SetPeerPort(1234);
+
+    startTime = GetMonotonicTimeNs();
+
+    for (uint32_t round = 0; round < kNumRounds; round++)
+    {
+        for (uint16_t i = 0; i < kNumSockets; i++)
+        {
+            messageInfo.SetSockPort(kBasePort + i);
+            udp->HandlePayload(*message, messageInfo);
+        }
+    }
+
+    duration = GetMonotonicTimeNs() - startTime;
+
+    for (uint32_t count : sReceiveCounts)
+    {
+        numReceived += count;
+    }
+
+    VerifyOrQuit(numReceived == kNumRounds * kNumSockets);
+
+    printf("  sockets:             %u\n", kNumSockets);
+    printf("  index size:          %u\n", OPENTHREAD_CONFIG_UDP_SOCKET_INDEX_SIZE);
+    printf("  demux (ns):          %lu\n",
+           ToUlong(static_cast<uint32_t>(duration / (kNumRounds * kNumSockets))));
+
+    for (Ip6::Udp::SocketHandle &socket : sockets)
+    {
+        SuccessOrQuit(udp->Close(socket));
+    }
+
+    message->Free();
+    testFreeInstance(sInstance);
+}
+
+} // namespace ot
+
+int main(void)
+{
+    ot::TestUdpSocketDemux();
+    ot::BenchmarkUdpSocketDemux();
+    printf("\nAll tests passed.\n");
+    return 0;
+}
@@ -29,6 +29,7 @@
 #include "test_util.hpp"
 
 #include <ctype.h>
+#include <time.h>
 
 void DumpBuffer(const char *aTextMessage, const uint8_t *aBuffer, uint16_t aBufferLength)
 {
@@ -66,3 +67,12 @@ void DumpBuffer(const char *aTextMessage, const uint8_t *aBuffer, uint16_t aBuff
 
     printf("    %s\n", charBuff);
 }
+
+uint64_t GetMonotonicTimeNs(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return static_cast<uint64_t>(now.tv_sec) * 1000000000ull + static_cast<uint64_t>(now.tv_nsec);
+}
@@ -42,4 +42,13 @@
  */
 void DumpBuffer(const char *aTextMessage, const uint8_t *aBuffer, uint16_t aBufferLength);
 
+/**
+ * Returns the current value of the host monotonic clock in nanoseconds.
+ *
+ * Is intended for measuring elapsed time in micro-benchmarks within unit tests.
+ *
+ * @returns The current monotonic time in nanoseconds.
+ */
+uint64_t GetMonotonicTimeNs(void);
+
 #endif // OT_UNIT_TEST_UTIL_HPP_